@@ -0,0 +1,160 @@
+/**
+ * @file bench_frame.cpp
+ * @brief Micro-benchmarks for the frame, CRC and message hot paths
+ *
+ * Each benchmark runs over payload sizes from a scalar up to the maximum
+ * payload; frame benchmarks also run with the CRC on and off, selected by
+ * the second argument (0 = off, 1 = on).
+ */
+
+#include <limp/limp.hpp>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <vector>
+
+using namespace limp;
+
+namespace
+{
+    Frame makeFrame(size_t payloadSize, bool crc)
+    {
+        std::vector<uint8_t> payload(payloadSize);
+        for (size_t i = 0; i < payloadSize; ++i)
+        {
+            payload[i] = static_cast<uint8_t>(i * 31 + 7);
+        }
+        return MessageBuilder::event(0x0010, 0x3000, 1, 0x0001)
+            .setPayload(std::move(payload))
+            .enableCRC(crc)
+            .build();
+    }
+
+    /** @brief Payload sizes x CRC off/on */
+    void frameArgs(benchmark::internal::Benchmark *bench)
+    {
+        for (int64_t size : {0, 4, 32, 256, 1024, 4096, 65534})
+        {
+            bench->Args({size, 0});
+            bench->Args({size, 1});
+        }
+        bench->ArgNames({"payload", "crc"});
+    }
+
+    void setProcessed(benchmark::State &state, size_t bytesPerIteration)
+    {
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(bytesPerIteration));
+    }
+} // namespace
+
+static void BM_SerializeFrame(benchmark::State &state)
+{
+    const Frame frame = makeFrame(static_cast<size_t>(state.range(0)), state.range(1) != 0);
+    std::vector<uint8_t> buffer;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(serializeFrame(frame, buffer));
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    setProcessed(state, frame.totalSize());
+}
+BENCHMARK(BM_SerializeFrame)->Apply(frameArgs);
+
+static void BM_SerializeFrameInto(benchmark::State &state)
+{
+    const Frame frame = makeFrame(static_cast<size_t>(state.range(0)), state.range(1) != 0);
+    std::vector<uint8_t> buffer(frame.totalSize());
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(serializeFrameInto(frame, buffer.data(), buffer.size()));
+        benchmark::ClobberMemory();
+    }
+    setProcessed(state, frame.totalSize());
+}
+BENCHMARK(BM_SerializeFrameInto)->Apply(frameArgs);
+
+static void BM_DeserializeFrame(benchmark::State &state)
+{
+    std::vector<uint8_t> buffer;
+    serializeFrame(makeFrame(static_cast<size_t>(state.range(0)), state.range(1) != 0), buffer);
+    Frame frame; // Reused: payload capacity is kept across iterations
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(deserializeFrame(buffer, frame));
+        benchmark::DoNotOptimize(frame.payload.data());
+    }
+    setProcessed(state, buffer.size());
+}
+BENCHMARK(BM_DeserializeFrame)->Apply(frameArgs);
+
+static void BM_DeserializeFrameView(benchmark::State &state)
+{
+    std::vector<uint8_t> buffer;
+    serializeFrame(makeFrame(static_cast<size_t>(state.range(0)), state.range(1) != 0), buffer);
+    FrameView view;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(deserializeFrameView(buffer.data(), buffer.size(), view));
+        benchmark::DoNotOptimize(view.payload().data());
+    }
+    setProcessed(state, buffer.size());
+}
+BENCHMARK(BM_DeserializeFrameView)->Apply(frameArgs);
+
+static void BM_CalculateCRC16(benchmark::State &state)
+{
+    const auto engine = static_cast<CRC16Engine>(state.range(1));
+    if (!isCRC16EngineSupported(engine))
+    {
+        state.SkipWithError("CRC engine not supported on this CPU");
+        return;
+    }
+
+    std::vector<uint8_t> data(static_cast<size_t>(state.range(0)));
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<uint8_t>(i);
+    }
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(calculateCRC16(data.data(), data.size(), engine));
+    }
+    state.SetLabel(toString(engine));
+    setProcessed(state, data.size());
+}
+BENCHMARK(BM_CalculateCRC16)
+    ->ArgsProduct({{HEADER_SIZE, 64, 256, 1024, 4096, 65534},
+                   {static_cast<int64_t>(CRC16Engine::Table), static_cast<int64_t>(CRC16Engine::Slice8),
+                    static_cast<int64_t>(CRC16Engine::CLMul)}})
+    ->ArgNames({"bytes", "engine"});
+
+static void BM_MessageBuilderScalar(benchmark::State &state)
+{
+    const bool crc = state.range(0) != 0;
+    for (auto _ : state)
+    {
+        Frame frame = MessageBuilder::event(0x0010, 0x3000, 1, 0x0001)
+                          .setPayload(23.5f)
+                          .enableCRC(crc)
+                          .build();
+        benchmark::DoNotOptimize(frame);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_MessageBuilderScalar)->Arg(0)->Arg(1)->ArgName("crc");
+
+static void BM_MessageBuilderBytes(benchmark::State &state)
+{
+    const std::vector<uint8_t> payload(static_cast<size_t>(state.range(0)), 0x5A);
+    const bool crc = state.range(1) != 0;
+    for (auto _ : state)
+    {
+        Frame frame = MessageBuilder::event(0x0010, 0x3000, 1, 0x0001)
+                          .setPayload(payload)
+                          .enableCRC(crc)
+                          .build();
+        benchmark::DoNotOptimize(frame);
+    }
+    setProcessed(state, payload.size());
+}
+BENCHMARK(BM_MessageBuilderBytes)->Apply(frameArgs);
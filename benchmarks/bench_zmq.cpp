@@ -0,0 +1,285 @@
+/**
+ * @file bench_zmq.cpp
+ * @brief End-to-end ZeroMQ transport benchmarks
+ *
+ * Round-trip latency (REQ/REP and DEALER/ROUTER) and one-way DEALER to
+ * ROUTER throughput over inproc, ipc and tcp. The first argument selects
+ * the transport (0 = inproc, 1 = ipc, 2 = tcp), the second the payload
+ * size. Latency benchmarks report p50/p99/p999 counters in microseconds.
+ */
+
+#include <limp/limp.hpp>
+#include <limp/zmq/zmq.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace limp;
+
+namespace
+{
+    /** @brief Wait per receive in server threads, bounding how long shutdown takes (ms) */
+    constexpr int SERVER_POLL_MS = 100;
+
+    /** @brief Frames per sendBatch() call in throughput benchmarks */
+    constexpr size_t STREAM_BATCH = 64;
+
+    const char *schemeName(int64_t scheme)
+    {
+        switch (scheme)
+        {
+        case 0:
+            return "inproc";
+        case 1:
+            return "ipc";
+        default:
+            return "tcp";
+        }
+    }
+
+    /** @brief Endpoint for a benchmark; tcp uses port 25550 + slot */
+    std::string endpointFor(int64_t scheme, const char *name, int slot)
+    {
+        switch (scheme)
+        {
+        case 0:
+            return std::string("inproc://limp-bench-") + name;
+        case 1:
+            return std::string("ipc:///tmp/limp-bench-") + name;
+        default:
+            return "tcp://127.0.0.1:" + std::to_string(25550 + slot);
+        }
+    }
+
+    ZMQConfig benchConfig()
+    {
+        ZMQConfig config;
+        config.useSharedContext = true; // inproc needs both ends in one context
+        config.sendTimeout = 5000;
+        config.receiveTimeout = 5000;
+        return config;
+    }
+
+    Frame makeFrame(size_t payloadSize)
+    {
+        return MessageBuilder::request(0x0010, 0x3000, 1, 0x0001)
+            .setPayload(std::vector<uint8_t>(payloadSize, 0x5A))
+            .build();
+    }
+
+    void transportArgs(benchmark::internal::Benchmark *bench)
+    {
+        for (int64_t scheme : {0, 1, 2})
+        {
+            for (int64_t size : {8, 256, 4096})
+            {
+                bench->Args({scheme, size});
+            }
+        }
+        bench->ArgNames({"transport", "payload"})->UseRealTime();
+    }
+
+    /** @brief Record per-iteration round trips and report percentiles */
+    class LatencyRecorder
+    {
+    public:
+        explicit LatencyRecorder(benchmark::State &state) : state_(state) { samples_.reserve(1 << 16); }
+
+        void add(std::chrono::steady_clock::duration elapsed)
+        {
+            samples_.push_back(std::chrono::duration<double, std::micro>(elapsed).count());
+        }
+
+        void report()
+        {
+            if (samples_.empty())
+            {
+                return;
+            }
+            std::sort(samples_.begin(), samples_.end());
+            state_.counters["p50_us"] = percentile(0.50);
+            state_.counters["p99_us"] = percentile(0.99);
+            state_.counters["p999_us"] = percentile(0.999);
+        }
+
+    private:
+        double percentile(double fraction) const
+        {
+            const size_t index = static_cast<size_t>(fraction * static_cast<double>(samples_.size() - 1));
+            return samples_[index];
+        }
+
+        benchmark::State &state_;
+        std::vector<double> samples_;
+    };
+} // namespace
+
+static void BM_ClientServerRoundTrip(benchmark::State &state)
+{
+    const std::string endpoint = endpointFor(state.range(0), "reqrep", 0);
+    const ZMQConfig config = benchConfig();
+
+    ZMQServer server(config);
+    if (server.bind(endpoint) != TransportError::None)
+    {
+        state.SkipWithError("server bind failed");
+        return;
+    }
+
+    std::atomic<bool> stop{false};
+    std::thread echo([&]()
+                     {
+        Frame request;
+        while (!stop.load()) {
+            if (server.receive(request, SERVER_POLL_MS) == TransportError::None) {
+                server.send(request);
+            }
+        } });
+
+    ZMQClient client(config);
+    const Frame request = makeFrame(static_cast<size_t>(state.range(1)));
+    Frame reply;
+    LatencyRecorder latency(state);
+    if (client.connect(endpoint) != TransportError::None)
+    {
+        state.SkipWithError("client connect failed");
+    }
+    else
+    {
+        for (auto _ : state)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            if (client.send(request) != TransportError::None || client.receive(reply) != TransportError::None)
+            {
+                state.SkipWithError("round trip failed");
+                break;
+            }
+            latency.add(std::chrono::steady_clock::now() - start);
+        }
+    }
+
+    stop = true;
+    echo.join();
+    latency.report();
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+    state.SetLabel(schemeName(state.range(0)));
+}
+BENCHMARK(BM_ClientServerRoundTrip)->Apply(transportArgs);
+
+static void BM_DealerRouterRoundTrip(benchmark::State &state)
+{
+    const std::string endpoint = endpointFor(state.range(0), "router", 1);
+    const ZMQConfig config = benchConfig();
+
+    ZMQRouter router(config);
+    if (router.bind(endpoint) != TransportError::None)
+    {
+        state.SkipWithError("router bind failed");
+        return;
+    }
+
+    std::atomic<bool> stop{false};
+    std::thread echo([&]()
+                     {
+        PeerId source;
+        Frame request;
+        while (!stop.load()) {
+            if (router.receive(source, request, SERVER_POLL_MS) == TransportError::None) {
+                router.send(source, request);
+            }
+        } });
+
+    ZMQDealer dealer(config);
+    const Frame request = makeFrame(static_cast<size_t>(state.range(1)));
+    Frame reply;
+    LatencyRecorder latency(state);
+    if (dealer.connect(endpoint) != TransportError::None)
+    {
+        state.SkipWithError("dealer connect failed");
+    }
+    else
+    {
+        for (auto _ : state)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            if (dealer.send(request) != TransportError::None || dealer.receive(reply) != TransportError::None)
+            {
+                state.SkipWithError("round trip failed");
+                break;
+            }
+            latency.add(std::chrono::steady_clock::now() - start);
+        }
+    }
+
+    stop = true;
+    echo.join();
+    latency.report();
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+    state.SetLabel(schemeName(state.range(0)));
+}
+BENCHMARK(BM_DealerRouterRoundTrip)->Apply(transportArgs);
+
+static void BM_DealerRouterThroughput(benchmark::State &state)
+{
+    const std::string endpoint = endpointFor(state.range(0), "stream", 2);
+    const ZMQConfig config = benchConfig();
+
+    ZMQRouter router(config);
+    if (router.bind(endpoint) != TransportError::None)
+    {
+        state.SkipWithError("router bind failed");
+        return;
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> received{0};
+    std::thread sink([&]()
+                     {
+        ByteSpan source;
+        FrameView view;
+        while (!stop.load()) {
+            if (router.receiveView(source, view, SERVER_POLL_MS) == TransportError::None) {
+                received.fetch_add(1, std::memory_order_relaxed);
+            }
+        } });
+
+    ZMQDealer dealer(config);
+    const std::vector<Frame> batch(STREAM_BATCH, makeFrame(static_cast<size_t>(state.range(1))));
+    uint64_t sentTotal = 0;
+    if (dealer.connect(endpoint) != TransportError::None)
+    {
+        state.SkipWithError("dealer connect failed");
+    }
+    else
+    {
+        for (auto _ : state)
+        {
+            size_t sent = 0;
+            if (dealer.sendBatch(Span<const Frame>(batch.data(), batch.size()), sent) != TransportError::None)
+            {
+                state.SkipWithError("send batch failed");
+                break;
+            }
+            sentTotal += sent;
+        }
+
+        // Count the run as finished only once the router has everything
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (received.load() < sentTotal && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    stop = true;
+    sink.join();
+    state.SetItemsProcessed(static_cast<int64_t>(received.load()));
+    state.SetBytesProcessed(static_cast<int64_t>(received.load() * batch.front().totalSize()));
+    state.SetLabel(schemeName(state.range(0)));
+}
+BENCHMARK(BM_DealerRouterThroughput)->Apply(transportArgs);
@@ -15,14 +15,18 @@ class LimpConan(ConanFile):
     options = {
         "shared": [True, False],
         "fPIC": [True, False],
-        "with_zmq": [True, False]
+        "with_zmq": [True, False],
+        "with_benchmarks": [True, False],
+        "with_zstd": [True, False]
     }
     default_options = {
         "shared": False,
         "fPIC": True,
-        "with_zmq": True
+        "with_zmq": True,
+        "with_benchmarks": False,
+        "with_zstd": False
     }
-    exports_sources = "CMakeLists.txt", "include/*", "src/*", "examples/*", "tests/*"
+    exports_sources = "CMakeLists.txt", "include/*", "src/*", "examples/*", "tests/*", "benchmarks/*"
 
     def config_options(self):
         if self.settings.os == "Windows":
@@ -32,6 +36,10 @@ class LimpConan(ConanFile):
         if self.options.with_zmq:
             self.requires("zeromq/4.3.5")
             self.requires("cppzmq/4.10.0")
+        if self.options.with_benchmarks:
+            self.requires("benchmark/1.8.3")
+        if self.options.with_zstd:
+            self.requires("zstd/1.5.5")
 
     def layout(self):
         cmake_layout(self)
@@ -42,6 +50,8 @@ class LimpConan(ConanFile):
         tc.variables["LIMP_BUILD_ZMQ"] = self.options.with_zmq
         tc.variables["LIMP_BUILD_EXAMPLES"] = False
         tc.variables["LIMP_BUILD_TESTS"] = False
+        tc.variables["LIMP_BUILD_BENCHMARKS"] = self.options.with_benchmarks
+        tc.variables["LIMP_WITH_ZSTD"] = self.options.with_zstd
         tc.generate()
 
         deps = CMakeDeps(self)
@@ -28,7 +28,6 @@
 #include <chrono>
 #include <atomic>
 #include <csignal>
-#include <map>
 #include <string>
 #include <sstream>
 #include <iomanip>
@@ -91,7 +90,7 @@ void routerThread()
     }
 
     // Track client identities
-    std::map<uint16_t, std::string> nodeRegistry; // nodeID -> socket identity
+    RoutingTable nodeRegistry; // nodeID -> socket identity
 
     while (running)
     {
@@ -106,9 +105,8 @@ void routerThread()
             uint16_t srcNodeId = frame.srcNodeID;
 
             // Register source node
-            if (nodeRegistry.find(srcNodeId) == nodeRegistry.end())
+            if (nodeRegistry.add(srcNodeId, PeerId(sourceIdentity)))
             {
-                nodeRegistry[srcNodeId] = sourceIdentity;
                 std::lock_guard<std::mutex> lock(coutMutex);
                 std::cout << "[Router] Registered " << sourceIdentity << " (node 0x" << std::hex << srcNodeId << std::dec << ")" << std::endl;
             }
@@ -134,6 +132,9 @@ void routerThread()
                 std::cerr << "[Router] No destination specified from " << sourceIdentity << std::endl;
             }
         }
+
+        // Free routes replaced by re-registrations (no Route pointer is held here)
+        nodeRegistry.reclaim();
     }
 
     {
@@ -89,8 +89,8 @@ int main()
     int totalMessages = 0;
 
     // Routing table: maps srcNode ID -> socket identity
-    // This is built dynamically as clients connect
-    std::unordered_map<uint16_t, std::string> routingTable;
+    // This is built dynamically as clients connect; a lookup is one array load
+    RoutingTable routingTable;
 
     std::cout << "Broker Mode: Routes messages based on message type" << std::endl;
     std::cout << "  - REQUEST  → PLC nodes (0x0030)" << std::endl;
@@ -99,36 +99,37 @@ int main()
     std::cout << "Clients should use regular dealer.send() (not send(dst, frame))" << std::endl;
     std::cout << std::endl;
 
+    // Reused across iterations: the pooled frame keeps its payload capacity
+    PeerId sourceIdentity;
+    PooledFrame incomingFrame = FramePool::acquire();
+
     // Main server loop - broker messages between nodes
     while (running)
     {
-        std::string sourceIdentity;
-        Frame incomingFrame;
 
         // Receive message from any client
-        auto recvErr = router.receive(sourceIdentity, incomingFrame, 1000);
+        auto recvErr = router.receive(sourceIdentity, *incomingFrame, 1000);
         if (recvErr != TransportError::None)
         {
             continue; // Timeout, check if still running
         }
 
         totalMessages++;
-        nodeMessageCount[sourceIdentity]++;
+        nodeMessageCount[sourceIdentity.str()]++;
 
         // Parse the incoming message
-        MessageParser parser(incomingFrame);
+        MessageParser parser(*incomingFrame);
 
-        std::cout << "[RECEIVED] From: " << sourceIdentity
+        std::cout << "[RECEIVED] From: " << sourceIdentity.str()
                   << " | SrcNode: 0x" << std::hex << parser.srcNode()
                   << " | Type: 0x" << static_cast<int>(parser.msgType())
                   << std::dec << std::endl;
 
         // Register this node in routing table (first message from this node)
-        if (routingTable.find(parser.srcNode()) == routingTable.end())
+        if (routingTable.add(parser.srcNode(), sourceIdentity))
         {
-            routingTable[parser.srcNode()] = sourceIdentity;
             std::cout << "  [REGISTERED] Node 0x" << std::hex << parser.srcNode()
-                      << std::dec << " -> " << sourceIdentity << std::endl;
+                      << std::dec << " -> " << sourceIdentity.str() << std::endl;
         }
 
         // BROKER LOGIC: Route messages between nodes
@@ -138,20 +139,13 @@ int main()
         {
             std::cout << "  [ROUTING] Request to PLC nodes" << std::endl;
 
-            // Find PLC nodes and forward the request
-            bool routed = false;
-            for (const auto &[nodeId, destIdentity] : routingTable)
+            // Forward the request to the PLC node (0x0030 is PLC node ID)
+            if (const Route *plc = routingTable.lookup(0x0030))
             {
-                // Route to PLC nodes (0x0030 is PLC node ID)
-                if (nodeId == 0x0030)
-                {
-                    router.send(destIdentity, incomingFrame);
-                    std::cout << "    -> Forwarded to PLC: " << destIdentity << std::endl;
-                    routed = true;
-                }
+                router.send(plc->identity, *incomingFrame);
+                std::cout << "    -> Forwarded to PLC: " << plc->identity.str() << std::endl;
             }
-
-            if (!routed)
+            else
             {
                 std::cout << "    [WARNING] No PLC nodes registered" << std::endl;
             }
@@ -162,15 +156,12 @@ int main()
         {
             std::cout << "  [ROUTING] Response to requesters" << std::endl;
 
-            // Find HMI/requester nodes and forward the response
-            for (const auto &[nodeId, destIdentity] : routingTable)
+            // Forward the response to the HMI node (0x0010 is HMI node ID)
+            const Route *hmi = routingTable.lookup(0x0010);
+            if (hmi && hmi->identity != sourceIdentity)
             {
-                // Route to HMI nodes (0x0010 is HMI node ID)
-                if (nodeId == 0x0010 && destIdentity != sourceIdentity)
-                {
-                    router.send(destIdentity, incomingFrame);
-                    std::cout << "    -> Forwarded to HMI: " << destIdentity << std::endl;
-                }
+                router.send(hmi->identity, *incomingFrame);
+                std::cout << "    -> Forwarded to HMI: " << hmi->identity.str() << std::endl;
             }
         }
 
@@ -179,16 +170,15 @@ int main()
         {
             std::cout << "  [BROADCAST] Event to all nodes" << std::endl;
             int broadcastCount = 0;
-            for (const auto &[nodeId, destIdentity] : routingTable)
-            {
-                if (destIdentity != sourceIdentity) // Don't echo to sender
+            routingTable.forEach([&](const Route &route)
+                                 {
+                if (route.identity != sourceIdentity) // Don't echo to sender
                 {
-                    router.send(destIdentity, incomingFrame);
-                    std::cout << "    -> Node 0x" << std::hex << nodeId
-                              << std::dec << " (" << destIdentity << ")" << std::endl;
+                    router.send(route.identity, *incomingFrame);
+                    std::cout << "    -> Node 0x" << std::hex << route.nodeID
+                              << std::dec << " (" << route.identity.str() << ")" << std::endl;
                     broadcastCount++;
-                }
-            }
+                } });
             if (broadcastCount == 0)
             {
                 std::cout << "    [INFO] No other nodes to broadcast to" << std::endl;
@@ -198,6 +188,9 @@ int main()
         std::cout << "  Total messages: " << totalMessages
                   << " | Registered nodes: " << routingTable.size() << std::endl;
         std::cout << std::endl;
+
+        // Free routes replaced by re-registration (no Route pointers are held here)
+        routingTable.reclaim();
     }
 
     std::cout << "\nShutting down server..." << std::endl;
@@ -0,0 +1,267 @@
+#pragma once
+
+#include "crc.hpp"
+#include "frame.hpp"
+#include "frame_view.hpp"
+#include "types.hpp"
+#include "utils.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <vector>
+
+namespace limp
+{
+
+    /**
+     * @brief Wire encoding of a scalar attribute value type
+     *
+     * Specialized for the fixed-size payload types (uint8_t ... double).
+     */
+    template <typename T>
+    struct AttributeTraits;
+
+    template <>
+    struct AttributeTraits<uint8_t>
+    {
+        static constexpr PayloadType type = PayloadType::UINT8;
+        static void encode(uint8_t *dst, uint8_t value) noexcept { dst[0] = value; }
+        static uint8_t decode(const uint8_t *src) noexcept { return src[0]; }
+    };
+
+    template <>
+    struct AttributeTraits<uint16_t>
+    {
+        static constexpr PayloadType type = PayloadType::UINT16;
+        static void encode(uint8_t *dst, uint16_t value) noexcept
+        {
+            uint16_t valueBE = utils::hton16(value);
+            std::memcpy(dst, &valueBE, 2);
+        }
+        static uint16_t decode(const uint8_t *src) noexcept
+        {
+            uint16_t valueBE;
+            std::memcpy(&valueBE, src, 2);
+            return utils::ntoh16(valueBE);
+        }
+    };
+
+    template <>
+    struct AttributeTraits<uint32_t>
+    {
+        static constexpr PayloadType type = PayloadType::UINT32;
+        static void encode(uint8_t *dst, uint32_t value) noexcept
+        {
+            uint32_t valueBE = utils::hton32(value);
+            std::memcpy(dst, &valueBE, 4);
+        }
+        static uint32_t decode(const uint8_t *src) noexcept
+        {
+            uint32_t valueBE;
+            std::memcpy(&valueBE, src, 4);
+            return utils::ntoh32(valueBE);
+        }
+    };
+
+    template <>
+    struct AttributeTraits<uint64_t>
+    {
+        static constexpr PayloadType type = PayloadType::UINT64;
+        static void encode(uint8_t *dst, uint64_t value) noexcept
+        {
+            uint64_t valueBE = utils::hton64(value);
+            std::memcpy(dst, &valueBE, 8);
+        }
+        static uint64_t decode(const uint8_t *src) noexcept
+        {
+            uint64_t valueBE;
+            std::memcpy(&valueBE, src, 8);
+            return utils::ntoh64(valueBE);
+        }
+    };
+
+    template <>
+    struct AttributeTraits<float>
+    {
+        static constexpr PayloadType type = PayloadType::FLOAT32;
+        static void encode(uint8_t *dst, float value) noexcept
+        {
+            AttributeTraits<uint32_t>::encode(dst, utils::floatToBits(value));
+        }
+        static float decode(const uint8_t *src) noexcept
+        {
+            return utils::bitsToFloat(AttributeTraits<uint32_t>::decode(src));
+        }
+    };
+
+    template <>
+    struct AttributeTraits<double>
+    {
+        static constexpr PayloadType type = PayloadType::FLOAT64;
+        static void encode(uint8_t *dst, double value) noexcept
+        {
+            AttributeTraits<uint64_t>::encode(dst, utils::doubleToBits(value));
+        }
+        static double decode(const uint8_t *src) noexcept
+        {
+            return utils::bitsToDouble(AttributeTraits<uint64_t>::decode(src));
+        }
+    };
+
+    /**
+     * @brief Compile-time descriptor of a typed attribute
+     *
+     * Fixes classID, attrID and value type at compile time, so everything
+     * in the header except MsgType, SrcNodeID and InstanceID is a constant.
+     * build<Attr>() memcpy's the precomputed header and patches the three
+     * runtime fields; parse<Attr>() compares the constant header bytes and
+     * loads the value, with no variant and no runtime type switch.
+     *
+     * @code
+     * using MotorSpeed = Attribute<0x4000, 0x0002, float>;
+     *
+     * uint8_t wire[MotorSpeed::MAX_WIRE_SIZE];
+     * size_t size = build<MotorSpeed>(wire, sizeof(wire), MsgType::EVENT, node, motor, 1450.0f);
+     *
+     * if (auto rpm = parse<MotorSpeed>(view)) {
+     *     speeds[view.instanceID()] = *rpm;
+     * }
+     * @endcode
+     *
+     * @tparam ClassID Object class ID
+     * @tparam AttrID Attribute ID
+     * @tparam T Value type (uint8_t, uint16_t, uint32_t, uint64_t, float or double)
+     */
+    template <uint16_t ClassID, uint16_t AttrID, typename T>
+    struct Attribute
+    {
+        using value_type = T;
+
+        static constexpr uint16_t classID = ClassID;
+        static constexpr uint16_t attrID = AttrID;
+        static constexpr PayloadType payloadType = AttributeTraits<T>::type;
+        static constexpr uint16_t PAYLOAD_SIZE = static_cast<uint16_t>(sizeof(T));
+
+        static_assert(PAYLOAD_SIZE == getPayloadTypeSize(payloadType), "Value type must match its wire size");
+
+        /** @brief Wire size without CRC */
+        static constexpr size_t WIRE_SIZE = HEADER_SIZE + PAYLOAD_SIZE;
+
+        /** @brief Wire size with CRC */
+        static constexpr size_t MAX_WIRE_SIZE = WIRE_SIZE + CRC_SIZE;
+
+        /** @brief Precomputed header (MsgType, SrcNodeID, InstanceID and Flags left 0) */
+        static constexpr std::array<uint8_t, HEADER_SIZE> HEADER = {
+            PROTOCOL_VERSION,
+            0,
+            0, 0,
+            static_cast<uint8_t>(ClassID >> 8), static_cast<uint8_t>(ClassID),
+            0, 0,
+            static_cast<uint8_t>(AttrID >> 8), static_cast<uint8_t>(AttrID),
+            static_cast<uint8_t>(AttributeTraits<T>::type),
+            static_cast<uint8_t>(PAYLOAD_SIZE >> 8), static_cast<uint8_t>(PAYLOAD_SIZE),
+            0};
+    };
+
+    /**
+     * @brief Check if wire bytes carry a typed attribute
+     *
+     * Compares the header bytes fixed by Attr (version, ClassID, AttrID,
+     * PayloadTypeID, PayloadLen).
+     */
+    template <typename Attr>
+    inline bool matches(const FrameView &view) noexcept
+    {
+        const uint8_t *data = view.data();
+        return view.size() >= Attr::WIRE_SIZE && data[0] == Attr::HEADER[0] &&
+               std::memcmp(data + 4, Attr::HEADER.data() + 4, 2) == 0 &&
+               std::memcmp(data + 8, Attr::HEADER.data() + 8, 5) == 0;
+    }
+
+    /**
+     * @brief Serialize a typed attribute into a caller-provided buffer
+     *
+     * @param dst Destination buffer (Attr::MAX_WIRE_SIZE bytes always suffice)
+     * @param capacity Destination capacity in bytes
+     * @param type Message type
+     * @param src Source node ID
+     * @param instanceID Object instance ID
+     * @param value Attribute value
+     * @param crc true to append CRC16-MODBUS
+     * @return Number of bytes written, or 0 if dst is too small
+     */
+    template <typename Attr>
+    inline size_t build(uint8_t *dst, size_t capacity, MsgType type, uint16_t src, uint16_t instanceID,
+                        typename Attr::value_type value, bool crc = false) noexcept
+    {
+        const size_t total = crc ? Attr::MAX_WIRE_SIZE : Attr::WIRE_SIZE;
+        if (dst == nullptr || capacity < total)
+        {
+            return 0;
+        }
+
+        std::memcpy(dst, Attr::HEADER.data(), HEADER_SIZE);
+        dst[1] = static_cast<uint8_t>(type);
+        dst[2] = static_cast<uint8_t>(src >> 8);
+        dst[3] = static_cast<uint8_t>(src);
+        dst[6] = static_cast<uint8_t>(instanceID >> 8);
+        dst[7] = static_cast<uint8_t>(instanceID);
+        AttributeTraits<typename Attr::value_type>::encode(dst + HEADER_SIZE, value);
+
+        if (crc)
+        {
+            dst[13] = Flags::CRC_PRESENT;
+            uint16_t crcBE = utils::hton16(calculateCRC16(dst, Attr::WIRE_SIZE));
+            std::memcpy(dst + Attr::WIRE_SIZE, &crcBE, 2);
+        }
+        return total;
+    }
+
+    /**
+     * @brief Serialize a typed attribute into a vector (resized to the exact size)
+     * @return true on success
+     */
+    template <typename Attr>
+    inline bool build(std::vector<uint8_t> &buffer, MsgType type, uint16_t src, uint16_t instanceID,
+                      typename Attr::value_type value, bool crc = false)
+    {
+        buffer.resize(crc ? Attr::MAX_WIRE_SIZE : Attr::WIRE_SIZE);
+        return build<Attr>(buffer.data(), buffer.size(), type, src, instanceID, value, crc) != 0;
+    }
+
+    /**
+     * @brief Load a typed attribute value from received wire bytes
+     *
+     * Checks the header against Attr and decodes the payload in place. CRC
+     * is not re-verified; the view should come from deserializeFrameView().
+     *
+     * @return Value, or empty if the frame is not Attr
+     */
+    template <typename Attr>
+    inline std::optional<typename Attr::value_type> parse(const FrameView &view) noexcept
+    {
+        if (!matches<Attr>(view))
+        {
+            return std::nullopt;
+        }
+        return AttributeTraits<typename Attr::value_type>::decode(view.data() + HEADER_SIZE);
+    }
+
+    /**
+     * @brief Load a typed attribute value from a frame
+     * @return Value, or empty if the frame is not Attr
+     */
+    template <typename Attr>
+    inline std::optional<typename Attr::value_type> parse(const Frame &frame) noexcept
+    {
+        if (frame.classID != Attr::classID || frame.attrID != Attr::attrID ||
+            frame.payloadType != Attr::payloadType || frame.payload.size() != Attr::PAYLOAD_SIZE)
+        {
+            return std::nullopt;
+        }
+        return AttributeTraits<typename Attr::value_type>::decode(frame.payload.data());
+    }
+
+} // namespace limp
@@ -0,0 +1,251 @@
+#pragma once
+
+#include "frame.hpp"
+#include "frame_view.hpp"
+#include "message.hpp"
+#include "span.hpp"
+#include "types.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace limp
+{
+
+    /**
+     * @brief One attribute value inside a BATCH payload
+     *
+     * References the payload bytes; valid while the parsed frame is alive.
+     */
+    struct BatchRecord
+    {
+        uint16_t attrID = 0;                  ///< Attribute identifier
+        PayloadType type = PayloadType::NONE; ///< Value type
+        ByteSpan value;                       ///< Encoded value (big-endian, as in a single-value payload)
+
+        /** @brief Decode value (std::monostate for NONE or malformed values) */
+        PayloadValue getValue() const;
+    };
+
+    /**
+     * @brief Builder for multi-attribute (PayloadType::BATCH) frames
+     *
+     * Packs many (attrID, type, value) records of one object instance into
+     * a single frame instead of one frame per attribute. Records are grouped
+     * by type into segments; fixed-size types use a columnar, fixed-stride
+     * layout (all attribute IDs, then all values) that BatchParser decodes
+     * in a tight loop. See limp.hpp for the wire layout.
+     *
+     * The header AttrID keeps its usual meaning (e.g. a transaction ID for
+     * REQUEST/RESPONSE matching); records carry their own attribute IDs.
+     * Records of one type keep their order; segments are written in
+     * PayloadType order.
+     *
+     * @code
+     * // Read 500 tags in one request, answer in one response
+     * BatchBuilder request = BatchBuilder::request(0x10, 0x3000, 7, txId);
+     * for (uint16_t tag = 1; tag <= 500; ++tag) request.add(tag);
+     *
+     * BatchBuilder response = BatchBuilder::response(0x30, 0x3000, 7, txId);
+     * response.add(1, 21.5f).add(2, 22.0f).add(3, uint16_t(1));
+     * Frame frame;
+     * if (response.build(frame)) { dealer.send(frame); }
+     * @endcode
+     */
+    class BatchBuilder
+    {
+    public:
+        /**
+         * @brief Construct builder for a frame header
+         * @param type Message type
+         * @param src Source node ID
+         * @param classID Object class ID
+         * @param instanceID Object instance ID
+         * @param attrID Header attribute ID (0 or a transaction ID)
+         */
+        BatchBuilder(MsgType type, uint16_t src, uint16_t classID, uint16_t instanceID, uint16_t attrID = 0);
+
+        /** @brief REQUEST batch (typically NONE records naming attributes to read) */
+        static BatchBuilder request(uint16_t src, uint16_t classID, uint16_t instanceID, uint16_t attrID = 0)
+        {
+            return BatchBuilder(MsgType::REQUEST, src, classID, instanceID, attrID);
+        }
+
+        /** @brief RESPONSE batch */
+        static BatchBuilder response(uint16_t src, uint16_t classID, uint16_t instanceID, uint16_t attrID = 0)
+        {
+            return BatchBuilder(MsgType::RESPONSE, src, classID, instanceID, attrID);
+        }
+
+        /** @brief EVENT batch */
+        static BatchBuilder event(uint16_t src, uint16_t classID, uint16_t instanceID, uint16_t attrID = 0)
+        {
+            return BatchBuilder(MsgType::EVENT, src, classID, instanceID, attrID);
+        }
+
+        /**
+         * @name Record Adders
+         * Append one record; the type follows from the value as in MessageBuilder::setPayload().
+         * @{
+         */
+
+        /** @brief Add NONE record (attribute ID only) */
+        BatchBuilder &add(uint16_t attrID);
+
+        BatchBuilder &add(uint16_t attrID, uint8_t value);
+        BatchBuilder &add(uint16_t attrID, uint16_t value);
+        BatchBuilder &add(uint16_t attrID, uint32_t value);
+        BatchBuilder &add(uint16_t attrID, uint64_t value);
+        BatchBuilder &add(uint16_t attrID, float value);
+        BatchBuilder &add(uint16_t attrID, double value);
+        BatchBuilder &add(uint16_t attrID, const std::string &value);
+        BatchBuilder &add(uint16_t attrID, const char *value);
+        BatchBuilder &add(uint16_t attrID, const std::vector<uint8_t> &value);
+
+        /** @} */
+
+        /**
+         * @brief Enable/disable CRC16-MODBUS validation
+         * @param enabled true to enable CRC (default), false to disable
+         * @return Reference to builder for chaining
+         */
+        BatchBuilder &enableCRC(bool enabled = true);
+
+        /** @brief Number of records added */
+        size_t size() const noexcept { return records_; }
+
+        /** @brief Check if no records were added */
+        bool empty() const noexcept { return records_ == 0; }
+
+        /** @brief Encoded payload size of the records added so far */
+        size_t payloadSize() const noexcept;
+
+        /**
+         * @brief Check if a record would still fit into one frame
+         * @param type Record type
+         * @param valueSize Encoded value size (only needed for STRING/OPAQUE)
+         */
+        bool fits(PayloadType type, size_t valueSize = 0) const noexcept;
+
+        /** @brief Remove all records (header is kept) */
+        void clear();
+
+        /**
+         * @brief Build the BATCH frame
+         * @param frame Output frame
+         * @return false if the records exceed MAX_PAYLOAD_SIZE or a segment holds more than 65535 records
+         */
+        bool build(Frame &frame) const;
+
+    private:
+        /** @brief Records of one type */
+        struct Segment
+        {
+            std::vector<uint16_t> attrIDs; ///< Attribute IDs in insertion order
+            std::vector<uint8_t> values;   ///< Encoded values (length-prefixed for STRING/OPAQUE)
+        };
+
+        static constexpr size_t SEGMENT_TYPES = 9; ///< NONE..OPAQUE
+
+        BatchBuilder &addFixed(uint16_t attrID, PayloadType type, uint64_t bits);
+        BatchBuilder &addVariable(uint16_t attrID, PayloadType type, const void *data, size_t size);
+
+        Frame header_;
+        std::array<Segment, SEGMENT_TYPES> segments_;
+        size_t records_;
+    };
+
+    /**
+     * @brief Non-owning parser for BATCH payloads
+     *
+     * Validates the segment structure once on construction; afterwards
+     * records are decoded straight from the payload without allocating.
+     * The parser references the frame's payload and is valid while the
+     * frame (or receive buffer of a FrameView) is alive.
+     *
+     * @code
+     * BatchParser batch(frame);
+     * std::vector<uint16_t> ids;
+     * std::vector<float> values;
+     * batch.get(ids, values);  // All FLOAT32 records, tight loop
+     *
+     * batch.forEach([](const BatchRecord &record) { apply(record.attrID, record.getValue()); });
+     * @endcode
+     */
+    class BatchParser
+    {
+    public:
+        /** @brief Parse a frame's payload (invalid unless payloadType is BATCH) */
+        explicit BatchParser(const Frame &frame);
+
+        /** @brief Parse a received frame view (invalid unless payloadType is BATCH) */
+        explicit BatchParser(const FrameView &view);
+
+        /** @brief Parse raw BATCH payload bytes */
+        explicit BatchParser(ByteSpan payload);
+
+        /** @brief Check if the payload is a well-formed batch */
+        bool valid() const noexcept { return valid_; }
+
+        /** @brief Total number of records (0 if invalid) */
+        size_t size() const noexcept { return records_; }
+
+        /**
+         * @brief Visit every record in wire order
+         * @param visit Callable taking const BatchRecord &
+         */
+        template <typename Visitor>
+        void forEach(Visitor &&visit) const
+        {
+            if (!valid_)
+            {
+                return;
+            }
+            for (size_t offset = 0; offset < payload_.size();)
+            {
+                offset = forEachInSegment(offset, [&visit](const BatchRecord &record) { visit(record); });
+            }
+        }
+
+        /** @brief Copy all records */
+        std::vector<BatchRecord> records() const;
+
+        /** @brief Find the first record for an attribute */
+        std::optional<BatchRecord> find(uint16_t attrID) const;
+
+        /**
+         * @name Bulk Decoders
+         * Append every record of the matching type (fixed-stride segments,
+         * one tight loop per segment). Return the number of records appended.
+         * @{
+         */
+
+        size_t get(std::vector<uint16_t> &attrIDs, std::vector<uint8_t> &values) const;
+        size_t get(std::vector<uint16_t> &attrIDs, std::vector<uint16_t> &values) const;
+        size_t get(std::vector<uint16_t> &attrIDs, std::vector<uint32_t> &values) const;
+        size_t get(std::vector<uint16_t> &attrIDs, std::vector<uint64_t> &values) const;
+        size_t get(std::vector<uint16_t> &attrIDs, std::vector<float> &values) const;
+        size_t get(std::vector<uint16_t> &attrIDs, std::vector<double> &values) const;
+
+        /** @} */
+
+    private:
+        /** @brief Walk one segment calling visit per record, return the next segment offset */
+        size_t forEachInSegment(size_t offset, const std::function<void(const BatchRecord &)> &visit) const;
+
+        template <typename T, typename Decode>
+        size_t getFixed(PayloadType type, std::vector<uint16_t> &attrIDs, std::vector<T> &values,
+                        Decode decode) const;
+
+        void validate();
+
+        ByteSpan payload_;
+        size_t records_;
+        bool valid_;
+    };
+
+} // namespace limp
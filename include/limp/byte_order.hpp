@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace limp
+{
+
+    /**
+     * @brief Bulk byte-swap implementations
+     *
+     * All engines produce identical results; they differ only in speed.
+     * byteSwap16/32/64() pick the fastest engine supported by the running CPU.
+     */
+    enum class ByteSwapEngine
+    {
+        Scalar, ///< One element per step
+        SSSE3,  ///< x86 PSHUFB, 16 bytes per step
+        AVX2,   ///< x86 VPSHUFB, 32 bytes per step
+        NEON    ///< ARM VREV, 16 bytes per step
+    };
+
+    /**
+     * @name Bulk Byte Swap
+     * Reverse the byte order of count 2/4/8-byte elements. Buffers need no
+     * alignment; dst may equal src (in-place), otherwise they must not overlap.
+     * @{
+     */
+
+    void byteSwap16(void *dst, const void *src, size_t count);
+    void byteSwap32(void *dst, const void *src, size_t count);
+    void byteSwap64(void *dst, const void *src, size_t count);
+
+    /** @brief Swap with a specific engine (falls back to Scalar if unsupported) */
+    void byteSwap(void *dst, const void *src, size_t count, size_t width, ByteSwapEngine engine);
+
+    /** @} */
+
+    /**
+     * @brief Check whether an engine can run on this CPU
+     * @param engine Engine to query
+     * @return true if supported (Scalar is always supported)
+     */
+    bool isByteSwapEngineSupported(ByteSwapEngine engine) noexcept;
+
+    /**
+     * @brief Get the engine selected by byteSwap16/32/64()
+     * @return Fastest supported engine
+     */
+    ByteSwapEngine activeByteSwapEngine() noexcept;
+
+    /** @brief Convert ByteSwapEngine to string (never null) */
+    const char *toString(ByteSwapEngine engine) noexcept;
+
+    namespace utils
+    {
+
+        /**
+         * @name Array Endianness Conversion
+         * Convert count host-order values to/from a big-endian byte buffer
+         * (count * sizeof(T) bytes). Plain copies on big-endian hosts.
+         * @{
+         */
+
+        template <typename T>
+        inline void htonArray(uint8_t *dst, const T *src, size_t count)
+        {
+            static_assert(sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8, "2, 4 or 8-byte elements");
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            if constexpr (sizeof(T) == 2)
+            {
+                byteSwap16(dst, src, count);
+            }
+            else if constexpr (sizeof(T) == 4)
+            {
+                byteSwap32(dst, src, count);
+            }
+            else
+            {
+                byteSwap64(dst, src, count);
+            }
+#else
+            if (count > 0)
+            {
+                std::memcpy(dst, src, count * sizeof(T));
+            }
+#endif
+        }
+
+        template <typename T>
+        inline void ntohArray(T *dst, const uint8_t *src, size_t count)
+        {
+            static_assert(sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8, "2, 4 or 8-byte elements");
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            if constexpr (sizeof(T) == 2)
+            {
+                byteSwap16(dst, src, count);
+            }
+            else if constexpr (sizeof(T) == 4)
+            {
+                byteSwap32(dst, src, count);
+            }
+            else
+            {
+                byteSwap64(dst, src, count);
+            }
+#else
+            if (count > 0)
+            {
+                std::memcpy(dst, src, count * sizeof(T));
+            }
+#endif
+        }
+
+        /** @} */
+
+    } // namespace utils
+} // namespace limp
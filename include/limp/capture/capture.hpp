@@ -0,0 +1,11 @@
+#pragma once
+
+/**
+ * @file capture.hpp
+ * @brief Convenience header that includes the frame capture log components
+ *
+ * Include this file to record and replay frames (POSIX only).
+ */
+
+#include "frame_recorder.hpp"
+#include "frame_replayer.hpp"
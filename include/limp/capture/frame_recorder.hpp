@@ -0,0 +1,140 @@
+#pragma once
+
+#include "../frame.hpp"
+#include "../frame_view.hpp"
+#include "../transport.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace limp
+{
+
+    /**
+     * @brief Append-only frame log in memory-mapped segment files
+     *
+     * Records every frame with its receive timestamp for post-incident
+     * analysis and load generation (see FrameReplayer). Frames are
+     * serialized straight into a mapped segment, so recording is a memcpy
+     * and no system call until a segment is full; each segment then
+     * continues in a new file "<path>.<NNNNNN>.limplog". A sparse time index
+     * in every segment header lets the replayer seek without scanning.
+     *
+     * Records only become durable once the kernel writes the pages back;
+     * call flush() to force it. After a crash, records stored before the
+     * last completed one are intact.
+     *
+     * Not thread-safe; record from one thread (e.g. the capture subscriber).
+     *
+     * @code
+     * FrameRecorder recorder;
+     * recorder.open("/var/log/limp/line1");   // line1.000000.limplog, ...
+     * ZMQSubscriber subscriber;
+     * subscriber.connect("tcp://127.0.0.1:5556");
+     * subscriber.subscribe();
+     * FrameView view;
+     * while (running) {
+     *     if (subscriber.receiveView(view, 1000) == TransportError::None) {
+     *         recorder.record(view);
+     *     }
+     * }
+     * @endcode
+     */
+    class FrameRecorder
+    {
+    public:
+        /** @brief Smallest segment (a maximum-size frame always fits) */
+        static constexpr size_t MIN_SEGMENT_SIZE = 1024 * 1024;
+
+        /** @brief Segment options */
+        struct Options
+        {
+            size_t segmentSize = 64 * 1024 * 1024; ///< Bytes per segment file (at least MIN_SEGMENT_SIZE)
+        };
+
+        FrameRecorder() noexcept : FrameRecorder(Options()) {}
+        explicit FrameRecorder(const Options &options) noexcept;
+
+        /** @brief Destructor - closes the current segment */
+        ~FrameRecorder();
+
+        // Disable copy construction and assignment (owns the mapping)
+        FrameRecorder(const FrameRecorder &) = delete;
+        FrameRecorder &operator=(const FrameRecorder &) = delete;
+
+        /**
+         * @brief Start a log, replacing segments of an old log with the same path
+         * @param path Path prefix of the segment files (the directory must exist)
+         * @return TransportError::None on success, TransportError::BindFailed if the first segment cannot be created
+         */
+        TransportError open(const std::string &path);
+
+        /** @brief Finish the current segment and stop recording */
+        void close() noexcept;
+
+        /** @brief Check if a log is open */
+        bool isOpen() const noexcept { return data_ != nullptr; }
+
+        /**
+         * @brief Append a frame
+         * @param frame Frame to record
+         * @param timestampNs Receive time in nanoseconds since the Unix epoch
+         * @return TransportError::None, TransportError::SerializationFailed if the frame is invalid,
+         *         TransportError::SocketClosed if no log is open, or TransportError::InternalError
+         *         if the next segment cannot be created
+         */
+        TransportError record(const Frame &frame, uint64_t timestampNs);
+
+        /** @brief Append a frame stamped with the current time */
+        TransportError record(const Frame &frame) { return record(frame, now()); }
+
+        /** @brief Append a received frame view (its wire bytes are copied as they are) */
+        TransportError record(const FrameView &view, uint64_t timestampNs);
+
+        /** @brief Append a received frame view stamped with the current time */
+        TransportError record(const FrameView &view) { return record(view, now()); }
+
+        /**
+         * @brief Write the current segment back to disk (msync)
+         * @return TransportError::None on success, TransportError::InternalError on failure
+         */
+        TransportError flush();
+
+        /** @brief Frames recorded since open() */
+        uint64_t recordCount() const noexcept { return totalRecords_; }
+
+        /** @brief Segment files written since open() */
+        uint64_t segmentCount() const noexcept { return segments_; }
+
+        /** @brief Current time in nanoseconds since the Unix epoch */
+        static uint64_t now() noexcept;
+
+    private:
+        /** @brief Reserve a record of length bytes; returns where the frame bytes go */
+        uint8_t *reserve(size_t length, uint64_t timestampNs, TransportError &error);
+
+        /** @brief Publish the reserved record */
+        void commit(uint8_t *record, size_t length) noexcept;
+
+        /** @brief Create and map segment sequence_ */
+        bool openSegment();
+
+        /** @brief Write the segment summary, truncate and unmap */
+        void closeSegment() noexcept;
+
+        Options options_;
+        std::string path_;      ///< Path prefix
+        int fd_;                ///< Current segment file
+        uint8_t *data_;         ///< Current segment mapping
+        size_t offset_;         ///< Next record offset (relative to the data area)
+        size_t capacity_;       ///< Data area size
+        size_t indexStride_;    ///< Data bytes between index entries
+        size_t nextIndexAt_;    ///< Offset of the next record to index
+        uint32_t indexCount_;   ///< Index entries in the current segment
+        uint64_t sequence_;     ///< Current segment number
+        uint64_t segments_;     ///< Segments since open()
+        uint64_t records_;      ///< Records in the current segment
+        uint64_t totalRecords_; ///< Records since open()
+    };
+
+} // namespace limp
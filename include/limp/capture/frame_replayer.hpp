@@ -0,0 +1,155 @@
+#pragma once
+
+#include "../frame.hpp"
+#include "../frame_view.hpp"
+#include "../transport.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace limp
+{
+
+    /**
+     * @brief Reads and replays a log written by FrameRecorder
+     *
+     * Maps every segment read-only and hands out FrameViews straight into
+     * the mapping. replay() sends the frames at their original pacing
+     * (scaled by Options::speed) or as fast as possible, e.g. to reproduce
+     * an incident against a test system or to drive a benchmark with real
+     * traffic. seek() uses the time index in the segment headers and scans
+     * at most one index stride.
+     *
+     * Segments of a log that is still being recorded are read up to the
+     * last completed record when open() is called.
+     *
+     * Not thread-safe.
+     *
+     * @code
+     * FrameReplayer::Options options;
+     * options.speed = 0.0;                     // Flat out
+     * FrameReplayer replayer(options);
+     * replayer.open("/var/log/limp/line1");
+     * replayer.seek(incidentTimeNs - 5'000'000'000ull);
+     * size_t replayed = 0;
+     * replayer.replay(testPublisher, replayed);
+     * @endcode
+     */
+    class FrameReplayer
+    {
+    public:
+        /** @brief Pacing options */
+        struct Options
+        {
+            double speed = 1.0; ///< Pacing factor (1: original, 2: twice as fast, 0: no pauses)
+        };
+
+        /**
+         * @brief Receiver of replayed frames
+         * @param view Recorded frame (valid until the replayer is closed)
+         * @param timestampNs Recorded receive time (ns since the Unix epoch)
+         * @return TransportError::None to continue, any other code stops the replay
+         */
+        using Sink = std::function<TransportError(const FrameView &view, uint64_t timestampNs)>;
+
+        FrameReplayer() noexcept : FrameReplayer(Options()) {}
+        explicit FrameReplayer(const Options &options) noexcept;
+
+        /** @brief Destructor - unmaps the log */
+        ~FrameReplayer();
+
+        // Disable copy construction and assignment (owns the mappings)
+        FrameReplayer(const FrameReplayer &) = delete;
+        FrameReplayer &operator=(const FrameReplayer &) = delete;
+
+        /**
+         * @brief Map the segments of a log
+         * @param path Path prefix passed to FrameRecorder::open()
+         * @return TransportError::None on success, TransportError::ConnectionFailed if the log does not
+         *         exist, TransportError::DeserializationFailed if a segment is not a LIMP log
+         */
+        TransportError open(const std::string &path);
+
+        /** @brief Unmap the log (views handed out become invalid) */
+        void close() noexcept;
+
+        /** @brief Check if a log is open */
+        bool isOpen() const noexcept { return !segments_.empty(); }
+
+        /**
+         * @brief Read the next record
+         * @param view Output view into the mapping (valid until close())
+         * @param timestampNs Output: recorded receive time
+         * @return false at the end of the log
+         */
+        bool next(FrameView &view, uint64_t &timestampNs);
+
+        /**
+         * @brief Read the next records without validating them
+         *
+         * For replaying large logs across cores: pass the records to
+         * validateFrames() or deserializeFrames(), which check them in
+         * parallel instead of one at a time as next() does.
+         *
+         * @param records Output: wire bytes of each record (valid until close())
+         * @param timestampsNs Output: recorded receive time of each record (at least records.size())
+         * @return Number of records read (0 at the end of the log)
+         */
+        size_t nextBatch(Span<ByteSpan> records, Span<uint64_t> timestampsNs);
+
+        /**
+         * @brief Position at the first record stamped at or after a time
+         *
+         * Assumes timestamps increase through the log (as receive times do).
+         *
+         * @return false if no record is that late (positioned at the end)
+         */
+        bool seek(uint64_t timestampNs);
+
+        /** @brief Position at the first record */
+        void rewind() noexcept;
+
+        /**
+         * @brief Pass the remaining records to a sink, paced by their timestamps
+         * @param sink Receiver of each frame
+         * @param replayed Output: records accepted by the sink
+         * @return TransportError::None at the end of the log, or the sink's error
+         */
+        TransportError replay(const Sink &sink, size_t &replayed);
+
+        /**
+         * @brief Send the remaining records over a transport, paced by their timestamps
+         * @see replay(const Sink &, size_t &)
+         */
+        TransportError replay(Transport &transport, size_t &replayed);
+
+        /** @brief Number of segment files */
+        size_t segmentCount() const noexcept { return segments_.size(); }
+
+        /** @brief Timestamp of the first record (0 if the log is empty) */
+        uint64_t firstTimestamp() const noexcept;
+
+    private:
+        /** @brief One mapped segment file */
+        struct Segment
+        {
+            const uint8_t *base = nullptr; ///< Mapping (header page first)
+            size_t mappedSize = 0;         ///< Bytes mapped
+            size_t dataSize = 0;           ///< Bytes of records
+        };
+
+        /** @brief Map one segment; false if it does not exist */
+        TransportError mapSegment(const std::string &file, bool &exists);
+
+        /** @brief Move to the first record at or after the current one (skips into later segments) */
+        const uint8_t *current() noexcept;
+
+        Options options_;
+        std::vector<Segment> segments_;
+        size_t segment_; ///< Current segment
+        size_t offset_;  ///< Next record offset in the current segment
+    };
+
+} // namespace limp
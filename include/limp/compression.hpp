@@ -0,0 +1,165 @@
+#pragma once
+
+#include "frame.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace limp
+{
+
+    /**
+     * @brief Check if payload compression is compiled in
+     *
+     * Compression uses zstd and is built with -DLIMP_WITH_ZSTD=ON. Without
+     * it, compressFrame() leaves frames unchanged and compressed frames fail
+     * to deserialize.
+     */
+    bool isCompressionAvailable() noexcept;
+
+    /**
+     * @brief Shared zstd dictionary for compressing small, repetitive payloads
+     *
+     * Both ends must use the same dictionary. Dictionaries in zstd format
+     * (for example from train()) carry an ID that is recorded in every frame
+     * compressed with them, so a mismatched dictionary is detected instead of
+     * producing garbage. Immutable and safe to share between threads.
+     *
+     * @code
+     * auto dictionary = CompressionDictionary::train(sampleRecipes);
+     * CompressionOptions options;
+     * options.enabled = true;
+     * options.threshold = 64;
+     * options.dictionary = dictionary;
+     * setFrameCompression(options);   // Same on the receiving side
+     * @endcode
+     */
+    class CompressionDictionary
+    {
+    public:
+        /**
+         * @brief Load a dictionary
+         * @param data Dictionary bytes (zstd format or raw content)
+         * @param size Number of bytes
+         * @param level Compression level used with this dictionary
+         */
+        CompressionDictionary(const uint8_t *data, size_t size, int level = 3);
+        ~CompressionDictionary();
+
+        CompressionDictionary(const CompressionDictionary &) = delete;
+        CompressionDictionary &operator=(const CompressionDictionary &) = delete;
+
+        /**
+         * @brief Train a dictionary from sample payloads
+         * @param samples Typical payloads (a few hundred give good results)
+         * @param maxSize Dictionary size limit in bytes
+         * @param level Compression level used with the dictionary
+         * @return Dictionary, or nullptr if compression is unavailable or training failed
+         */
+        static std::shared_ptr<CompressionDictionary> train(const std::vector<std::vector<uint8_t>> &samples,
+                                                            size_t maxSize = 16 * 1024, int level = 3);
+
+        /** @brief Check if the dictionary was loaded */
+        bool isValid() const noexcept;
+
+        /** @brief Dictionary ID recorded in compressed frames (0 for raw-content dictionaries) */
+        uint32_t id() const noexcept { return id_; }
+
+        /** @brief Dictionary bytes (to ship to the other end) */
+        const std::vector<uint8_t> &bytes() const noexcept { return bytes_; }
+
+    private:
+        friend struct CompressionAccess;
+
+        struct Impl;
+        std::vector<uint8_t> bytes_;
+        uint32_t id_;
+        std::unique_ptr<Impl> impl_;
+    };
+
+    /** @brief Frame payload compression settings */
+    struct CompressionOptions
+    {
+        /** @brief Default minimum payload size worth compressing (bytes) */
+        static constexpr size_t DEFAULT_THRESHOLD = 1024;
+
+        bool enabled = false;                 ///< Compress in serializeFrame() and the transports
+        size_t threshold = DEFAULT_THRESHOLD; ///< Smallest payload that is compressed
+        int level = 3;                        ///< zstd level (ignored when a dictionary is set)
+
+        /** @brief Optional shared dictionary (must match the other end) */
+        std::shared_ptr<const CompressionDictionary> dictionary;
+    };
+
+    /**
+     * @brief Set process-wide compression for serialization and the transports
+     *
+     * When enabled, serializeFrame() and every transport send path (ZeroMQ,
+     * TCP, UDP, shared memory, WireBuffer, broker output and capture logs)
+     * compress STRING and OPAQUE payloads of at least threshold bytes and
+     * set Flags::COMPRESSED, keeping the original whenever compression does
+     * not make it smaller. Compressed frames are decompressed by
+     * deserializeFrame() and FrameView::toFrame() regardless of `enabled`,
+     * using the configured dictionary. serializeFrameInto() writes frames as
+     * they are (its size is fixed by Frame::totalSize()); call
+     * compressFrame() first to compress on that path.
+     *
+     * The settings are published as one immutable snapshot, so a frame is
+     * never compressed with fields from two different calls. Each thread
+     * reads its cached snapshot without a lock and only refreshes it after
+     * a call; a replaced snapshot (and its dictionary) is freed once no
+     * thread holds it. Calls may race with serialization on other threads.
+     */
+    void setFrameCompression(const CompressionOptions &options);
+
+    /** @brief Current process-wide compression settings */
+    CompressionOptions getFrameCompression();
+
+    /**
+     * @brief Compress a frame's payload in place
+     *
+     * Only STRING and OPAQUE payloads are compressed, and only if doing so
+     * makes them smaller.
+     *
+     * @param frame Frame to compress (left unchanged if not compressed)
+     * @param options Threshold, level and dictionary
+     * @return true if the payload was replaced by its compressed form
+     */
+    bool compressFrame(Frame &frame, const CompressionOptions &options);
+
+    /**
+     * @brief Restore the payload of a compressed frame in place
+     *
+     * @param frame Frame with Flags::COMPRESSED (others are left unchanged)
+     * @param dictionary Dictionary the sender used (nullptr: none)
+     * @return true if the frame is uncompressed afterwards
+     */
+    bool decompressFrame(Frame &frame, const CompressionDictionary *dictionary = nullptr);
+
+    namespace detail
+    {
+        /**
+         * @brief Build the frame as it goes on the wire under the process-wide settings
+         *
+         * @param frame Validated frame to send
+         * @param wire Output: frame with the compressed payload and Flags::COMPRESSED
+         *             (its payload capacity is reused between calls)
+         * @return true if wire was filled, false if frame is sent as it is
+         */
+        bool compressForWire(const Frame &frame, Frame &wire);
+
+        /**
+         * @brief Frame to serialize in place of a validated frame
+         * @return frame itself, or a thread-local compressed copy valid until the next call on this thread
+         */
+        const Frame &wireFrame(const Frame &frame);
+
+        /** @brief Whether the process-wide settings call for compressing this frame */
+        bool wantsCompression(const Frame &frame);
+
+        /** @brief Decompress a wire payload into frame.payload using the process-wide dictionary */
+        bool decompressPayload(const uint8_t *data, size_t size, Frame &frame);
+    } // namespace detail
+
+} // namespace limp
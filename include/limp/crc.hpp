@@ -9,11 +9,25 @@ namespace limp
     constexpr uint16_t CRC16_POLYNOMIAL = 0xA001;
     constexpr uint16_t CRC16_INITIAL = 0xFFFF;
 
+    /**
+     * @brief CRC16-MODBUS computation engines
+     *
+     * All engines produce identical results; they differ only in speed.
+     * calculateCRC16() picks the fastest engine supported by the running CPU.
+     */
+    enum class CRC16Engine
+    {
+        Table,  ///< Byte-at-a-time 256-entry lookup table
+        Slice8, ///< Slicing-by-8 (eight 256-entry tables, 8 bytes per step)
+        CLMul   ///< Carry-less multiply folding (x86 PCLMULQDQ / ARMv8 PMULL)
+    };
+
     /**
      * @brief Calculate CRC16-MODBUS checksum
      *
      * Algorithm: Polynomial 0xA001 (reflected), Initial value 0xFFFF, LSB-first.
-     * Standard MODBUS CRC-16 implementation.
+     * Standard MODBUS CRC-16 implementation. Dispatches to the fastest
+     * engine available on the running CPU (selected once at first use).
      *
      * @param data Pointer to data buffer
      * @param length Data length in bytes
@@ -21,6 +35,29 @@ namespace limp
      */
     uint16_t calculateCRC16(const uint8_t *data, size_t length);
 
+    /**
+     * @brief Calculate CRC16-MODBUS checksum with a specific engine
+     *
+     * Falls back to CRC16Engine::Slice8 if the requested engine is not
+     * supported by the running CPU.
+     *
+     * @param data Pointer to data buffer
+     * @param length Data length in bytes
+     * @param engine Engine to use
+     * @return 16-bit CRC checksum value
+     */
+    uint16_t calculateCRC16(const uint8_t *data, size_t length, CRC16Engine engine);
+
+    /**
+     * @brief Continue a CRC16-MODBUS computation over more data
+     *
+     * @param crc Running CRC value (CRC16_INITIAL for a fresh computation)
+     * @param data Pointer to data buffer
+     * @param length Data length in bytes
+     * @return Updated running CRC value
+     */
+    uint16_t updateCRC16(uint16_t crc, const uint8_t *data, size_t length);
+
     /**
      * @brief Verify CRC16-MODBUS checksum
      *
@@ -32,4 +69,67 @@ namespace limp
      */
     bool verifyCRC16(const uint8_t *data, size_t length);
 
+    /**
+     * @brief Check whether an engine can run on this CPU
+     * @param engine Engine to query
+     * @return true if supported (Table and Slice8 are always supported)
+     */
+    bool isCRC16EngineSupported(CRC16Engine engine) noexcept;
+
+    /**
+     * @brief Get the engine selected by calculateCRC16() for large buffers
+     * @return Fastest supported engine
+     */
+    CRC16Engine activeCRC16Engine() noexcept;
+
+    /** @brief Convert CRC16Engine to string (never null) */
+    const char *toString(CRC16Engine engine) noexcept;
+
+    /**
+     * @brief Incremental CRC16-MODBUS accumulator
+     *
+     * Computes a CRC over data supplied in pieces, e.g. a frame header and
+     * payload written to different places, without a second pass.
+     *
+     * @code
+     * Crc16 crc;
+     * crc.update(header, HEADER_SIZE);
+     * crc.update(payload, payloadLen);
+     * uint16_t value = crc.finalize();
+     * @endcode
+     */
+    class Crc16
+    {
+    public:
+        /** @brief Construct accumulator in initial state */
+        Crc16() noexcept : crc_(CRC16_INITIAL) {}
+
+        /** @brief Reset accumulator to initial state */
+        void reset() noexcept { crc_ = CRC16_INITIAL; }
+
+        /**
+         * @brief Feed more data into the accumulator
+         * @param data Pointer to data buffer
+         * @param length Data length in bytes
+         * @return Reference to accumulator for chaining
+         */
+        Crc16 &update(const uint8_t *data, size_t length)
+        {
+            crc_ = updateCRC16(crc_, data, length);
+            return *this;
+        }
+
+        /**
+         * @brief Get the CRC of all data fed so far
+         *
+         * Does not modify the accumulator; more data may still be added.
+         *
+         * @return 16-bit CRC checksum value
+         */
+        uint16_t finalize() const noexcept { return crc_; }
+
+    private:
+        uint16_t crc_;
+    };
+
 } // namespace limp
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "frame.hpp"
+#include "frame_view.hpp"
+#include <cstdint>
+
+namespace limp
+{
+
+    /**
+     * @brief Class ID of credit-based flow control messages
+     *
+     * Flow control travels in ACK frames of this class (instance and
+     * attribute 0) with a UINT32 payload:
+     *
+     *   - credits == 0: credit request (receiver-bound, sent on connect)
+     *   - credits  > 0: credit grant (sender-bound): the sender may send
+     *     that many more frames
+     *
+     * The receiver grants a window when a sender asks for it, and returns
+     * credit as it consumes frames, so a sender never has more than the
+     * window in flight. See CreditDealer and CreditRouter.
+     */
+    constexpr uint16_t CREDIT_CLASS_ID = 0xFFFF;
+
+    /**
+     * @brief Build a credit request (credits == 0) or grant
+     * @param srcNode Source node ID
+     * @param credits Frames granted (0: request)
+     */
+    Frame makeCreditFrame(uint16_t srcNode, uint32_t credits);
+
+    /**
+     * @brief Check for a flow control message
+     * @param credits Output: frames granted (0: request)
+     * @return true if the frame is a credit request or grant
+     */
+    bool parseCreditFrame(const Frame &frame, uint32_t &credits) noexcept;
+
+    /** @copydoc parseCreditFrame(const Frame &, uint32_t &) */
+    bool parseCreditFrame(const FrameView &view, uint32_t &credits) noexcept;
+
+} // namespace limp
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "frame.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace limp
+{
+
+    /**
+     * @brief Per-attribute deadband and change filter for telemetry
+     *
+     * Decides whether an EVENT frame is worth publishing, keyed by
+     * (classID, instanceID, attrID). Numeric scalars (UINT8..UINT64,
+     * FLOAT32, FLOAT64) are suppressed while they stay within the absolute
+     * or percent deadband of the last value sent; every other payload is
+     * suppressed while its bytes are unchanged. Each attribute is sent again
+     * once refreshInterval has passed since it was last sent, so subscribers
+     * that missed a value converge (integrity refresh). Frames of other
+     * message types always pass and are not tracked.
+     *
+     * State lives in a flat open-addressing table (linear probing, one
+     * 40-byte slot per attribute), so a check is a hash, usually one cache
+     * line, and no allocation once the table has grown to the working set.
+     *
+     * Not thread-safe; use one filter per publishing thread.
+     *
+     * @code
+     * DeadbandFilter::Options options;
+     * options.absolute = 0.05;                        // Ignore +-0.05 noise
+     * options.refreshInterval = std::chrono::seconds(10);
+     * DeadbandFilter filter(options);
+     * filter.setDeadband(0x4000, 1, 2, 0.0, 1.0);     // 1% for this attribute
+     * if (filter.check(frame)) {
+     *     publisher.publish(frame);
+     * }
+     * @endcode
+     */
+    class DeadbandFilter
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /** @brief Default deadbands and refresh */
+        struct Options
+        {
+            double absolute = 0.0; ///< Suppress if |value - last| <= absolute
+            double percent = 0.0;  ///< Suppress if |value - last| <= percent% of |last|
+
+            /** @brief Resend an unchanged attribute after this long (0: never) */
+            std::chrono::milliseconds refreshInterval{10000};
+
+            size_t initialCapacity = 1024; ///< Initial number of slots (rounded up to a power of two)
+        };
+
+        /** @brief Decision counters */
+        struct Stats
+        {
+            uint64_t passed = 0;     ///< Frames that changed beyond the deadband (or were new)
+            uint64_t suppressed = 0; ///< Frames filtered out
+            uint64_t refreshed = 0;  ///< Unchanged frames passed by the integrity refresh
+        };
+
+        DeadbandFilter() : DeadbandFilter(Options()) {}
+        explicit DeadbandFilter(const Options &options);
+
+        /**
+         * @brief Decide whether to publish a frame, recording it if so
+         * @param frame Frame about to be published
+         * @param now Current time (for the refresh)
+         * @return true to publish, false to suppress
+         */
+        bool check(const Frame &frame, Clock::time_point now = Clock::now());
+
+        /**
+         * @brief Forget the last sent value of a frame's attribute
+         *
+         * Call when a frame check() passed could not be sent, so the next
+         * value goes out regardless of the deadband.
+         */
+        void invalidate(const Frame &frame) noexcept;
+
+        /**
+         * @brief Override the deadband of one attribute
+         * @param absolute Absolute deadband
+         * @param percent Percent deadband (of the last sent value)
+         */
+        void setDeadband(uint16_t classID, uint16_t instanceID, uint16_t attrID, double absolute, double percent);
+
+        /** @brief Number of tracked attributes */
+        size_t size() const noexcept { return size_; }
+
+        /** @brief Decision counters */
+        const Stats &getStats() const noexcept { return stats_; }
+
+        /** @brief Forget all attributes and overrides */
+        void clear() noexcept;
+
+    private:
+        /** @brief Key value of unused slots (real keys use the low 48 bits) */
+        static constexpr uint64_t EMPTY_KEY = ~uint64_t(0);
+
+        struct Slot
+        {
+            uint64_t key = EMPTY_KEY; ///< (classID, instanceID, attrID)
+            uint64_t value = 0;       ///< Last sent value: double bits, or payload hash
+            int64_t sentAt = 0;       ///< Clock ticks of the last send
+            double absolute = 0.0;    ///< Absolute deadband
+            float percent = 0.0f;     ///< Percent deadband
+            PayloadType type = PayloadType::NONE; ///< Payload type of value
+            bool hasValue = false;    ///< value/sentAt are valid
+        };
+
+        Slot &findOrInsert(uint64_t key);
+        Slot *find(uint64_t key) noexcept;
+        void grow();
+
+        Options options_;
+        std::vector<Slot> slots_;
+        size_t mask_;
+        size_t size_;
+        Stats stats_;
+    };
+
+} // namespace limp
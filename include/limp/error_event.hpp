@@ -0,0 +1,123 @@
+#pragma once
+
+#include "transport.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+namespace limp
+{
+
+    /** @brief Kind of transport operation that failed */
+    enum class TransportOperation : uint8_t
+    {
+        Unknown = 0,
+        Setup,     ///< Context/socket creation and socket options
+        Connect,   ///< Connecting to an endpoint
+        Bind,      ///< Binding an endpoint
+        Send,      ///< Sending (including serialization and message allocation)
+        Receive,   ///< Receiving (including unexpected message layouts)
+        Subscribe, ///< Changing subscriptions
+        Close      ///< Closing the socket
+    };
+
+    /** @brief Convert a transport operation to a string */
+    const char *toString(TransportOperation operation) noexcept;
+
+    /**
+     * @brief Structured transport error
+     *
+     * Built on the stack and passed by reference, so reporting it does not
+     * allocate. The strings have static storage duration (literals or
+     * zmq_strerror() text) and may be kept by the receiver.
+     */
+    struct ErrorEvent
+    {
+        TransportError error;         ///< Error code returned to the caller
+        TransportOperation operation; ///< Kind of operation
+        int errnum;                   ///< errno / zmq_errno() value (0 if none)
+        const char *context;          ///< Operation name (e.g. "router send")
+        const char *reason;           ///< Failure description (nullptr: use toString(error))
+    };
+
+    /** @brief Structured error callback type */
+    using ErrorEventCallback = std::function<void(const ErrorEvent &)>;
+
+    /**
+     * @brief Format an error event as text
+     *
+     * Produces "<prefix> error during <context>: <reason> (code: <errnum>)";
+     * the code is omitted when errnum is 0. Output is truncated to fit.
+     *
+     * @param event Event to format
+     * @param prefix Transport name (e.g. "ZMQ")
+     * @param buffer Destination
+     * @param size Destination size in bytes (including the terminator)
+     * @return Length of the formatted text (excluding the terminator)
+     */
+    size_t formatErrorEvent(const ErrorEvent &event, const char *prefix, char *buffer, size_t size) noexcept;
+
+    /**
+     * @brief Error delivery with deferred, rate-limited formatting
+     *
+     * The structured callback, if set, receives every event as is. Text is
+     * only produced for the message callback (or std::cerr when neither
+     * callback is set), and at most `burst` messages per interval; the rest
+     * are counted, and the count is appended to the next message that goes
+     * out. A suppressed error costs a clock read and a few comparisons.
+     *
+     * Not thread-safe; owned by one transport.
+     */
+    class ErrorReporter
+    {
+    public:
+        /** @brief Default number of messages per interval */
+        static constexpr size_t DEFAULT_BURST = 10;
+
+        /** @brief Default rate-limit interval */
+        static constexpr std::chrono::milliseconds DEFAULT_INTERVAL{1000};
+
+        /**
+         * @brief Construct a reporter
+         * @param prefix Transport name used in formatted messages (static storage)
+         */
+        explicit ErrorReporter(const char *prefix) noexcept;
+
+        /** @brief Set the structured callback (receives every event) */
+        void setEventCallback(ErrorEventCallback callback) { eventCallback_ = std::move(callback); }
+
+        /** @brief Set the text callback (rate-limited) */
+        void setMessageCallback(ErrorCallback callback) { messageCallback_ = std::move(callback); }
+
+        /**
+         * @brief Set the text rate limit
+         * @param burst Messages allowed per interval (0 drops all text)
+         * @param interval Length of the rate-limit window
+         */
+        void setRateLimit(size_t burst, std::chrono::milliseconds interval) noexcept;
+
+        /** @brief Deliver an event (callbacks run on the calling thread) */
+        void report(const ErrorEvent &event);
+
+        /** @brief Number of messages not formatted because of the rate limit */
+        uint64_t suppressedCount() const noexcept { return suppressedTotal_; }
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        void emitMessage(const ErrorEvent &event);
+
+        const char *prefix_;               ///< Transport name for messages
+        ErrorEventCallback eventCallback_; ///< Structured notification
+        ErrorCallback messageCallback_;    ///< Text notification
+        size_t burst_;                     ///< Messages per window
+        Clock::duration interval_;         ///< Window length
+        Clock::time_point windowStart_;    ///< Start of the current window
+        size_t windowCount_;               ///< Messages emitted in the window
+        uint64_t pendingSuppressed_;       ///< Suppressed since the last message
+        uint64_t suppressedTotal_;         ///< Suppressed over the lifetime
+    };
+
+} // namespace limp
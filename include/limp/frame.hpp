@@ -1,6 +1,7 @@
 #pragma once
 
 #include "types.hpp"
+#include "payload_buffer.hpp"
 #include <vector>
 #include <memory>
 #include <optional>
@@ -52,11 +53,11 @@ namespace limp
         /** @brief Payload length in bytes */
         uint16_t payloadLen;
 
-        /** @brief Control flags (bit 0: CRC_PRESENT) */
+        /** @brief Control flags (bit 0: CRC_PRESENT, bit 1: SEQUENCED, bit 2: COMPRESSED) */
         uint8_t flags;
 
-        /** @brief Payload binary data */
-        std::vector<uint8_t> payload;
+        /** @brief Payload binary data (stored inline up to PayloadBuffer::INLINE_CAPACITY bytes) */
+        PayloadBuffer payload;
 
         /** @brief CRC16-MODBUS checksum (present if CRC flag set) */
         std::optional<uint16_t> crc;
@@ -68,7 +69,7 @@ namespace limp
         Frame(const Frame &) = default;
         Frame &operator=(const Frame &) = default;
 
-        // Move operations (efficient transfer of payload vector)
+        // Move operations (efficient transfer of payload storage)
         Frame(Frame &&) noexcept = default;
         Frame &operator=(Frame &&) noexcept = default;
 
@@ -87,6 +88,12 @@ namespace limp
          */
         bool hasCRC() const noexcept { return (flags & Flags::CRC_PRESENT) != 0; }
 
+        /**
+         * @brief Check if the payload holds compressed bytes
+         * @return true if COMPRESSED flag is set
+         */
+        bool isCompressed() const noexcept { return (flags & Flags::COMPRESSED) != 0; }
+
         /**
          * @brief Enable or disable CRC16-MODBUS validation
          * @param enabled true to enable CRC, false to disable
@@ -108,6 +115,8 @@ namespace limp
      *
      * Converts frame to binary wire format (big-endian byte order).
      * Automatically calculates and appends CRC16-MODBUS if CRC flag is set.
+     * Compresses large STRING/OPAQUE payloads when enabled with
+     * setFrameCompression().
      *
      * @param frame Frame to serialize
      * @param buffer Output buffer (automatically resized to exact frame size)
@@ -115,6 +124,40 @@ namespace limp
      */
     bool serializeFrame(const Frame &frame, std::vector<uint8_t> &buffer);
 
+    /**
+     * @brief Serialize frame into a caller-provided buffer
+     *
+     * Writes the wire format directly to dst (header, payload and CRC in one
+     * pass) without any allocation. Use Frame::totalSize() to size dst.
+     *
+     * @param frame Frame to serialize
+     * @param dst Destination buffer
+     * @param capacity Destination capacity in bytes
+     * @return Number of bytes written, or 0 if validation fails or dst is too small
+     */
+    size_t serializeFrameInto(const Frame &frame, uint8_t *dst, size_t capacity);
+
+    /**
+     * @brief Write the 14-byte wire header of a frame
+     *
+     * For transports that send the payload straight from the Frame (gather
+     * writes). Does not validate the frame.
+     *
+     * @param frame Frame whose header fields are written
+     * @param header Destination of HEADER_SIZE bytes
+     */
+    void serializeFrameHeader(const Frame &frame, uint8_t *header) noexcept;
+
+    namespace detail
+    {
+        /**
+         * @brief serializeFrameInto() without validation, for callers that already validated
+         * @param buffer Destination of at least frame.totalSize() bytes
+         * @return frame.totalSize()
+         */
+        size_t serializeValidatedFrame(const Frame &frame, uint8_t *buffer) noexcept;
+    } // namespace detail
+
     /**
      * @brief Deserialize frame from wire format
      *
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "frame.hpp"
+#include "frame_view.hpp"
+#include "span.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace limp
+{
+
+    class ThreadPool;
+
+    /** @brief How deserializeFrames() and validateFrames() split a batch */
+    struct BulkDecodeOptions
+    {
+        ThreadPool *pool = nullptr;  ///< Workers to share the batch with (nullptr: getThreadPool())
+        size_t framesPerTask = 256;  ///< Frames per work item; smaller batches stay on the calling thread
+    };
+
+    /**
+     * @brief Check the headers of many encoded frames at once
+     *
+     * The fixed header fields of every input are checked in one branch-free,
+     * table-driven pass (version, reserved flags, payload type sizes, total
+     * length), leaving out only the CRC. Gives the same answer as
+     * FrameView::validate() without the CRC.
+     *
+     * @param inputs Encoded frames
+     * @param valid Output: per input, true if the header is well-formed (at least inputs.size())
+     * @return Number of well-formed headers
+     */
+    size_t checkFrameHeaders(Span<const ByteSpan> inputs, Span<bool> valid) noexcept;
+
+    /**
+     * @brief Validate many encoded frames into views, in parallel
+     *
+     * Runs checkFrameHeaders() and then verifies the CRC of each frame that
+     * carries one, splitting the batch across a thread pool in chunks of
+     * options.framesPerTask. The calling thread takes chunks too, so this is
+     * safe to call from a worker of the same pool. Views point into the
+     * inputs, which must outlive them.
+     *
+     * @param inputs Encoded frames
+     * @param views Output: view of each valid input (at least inputs.size())
+     * @param valid Output: per input, true if it validated (at least inputs.size())
+     * @param options Pool and chunk size
+     * @return Number of valid frames
+     */
+    size_t validateFrames(Span<const ByteSpan> inputs, Span<FrameView> views, Span<bool> valid,
+                          const BulkDecodeOptions &options = BulkDecodeOptions());
+
+    /**
+     * @brief Deserialize many encoded frames, in parallel
+     *
+     * Bulk form of deserializeFrame(): validates as validateFrames() does
+     * and copies (or decompresses) each valid frame into frames[i]. Check
+     * valid[i] before using frames[i]; entries of invalid inputs hold
+     * whatever was there before (or a partly decoded frame).
+     *
+     * @code
+     * std::vector<ByteSpan> inputs = ...;            // e.g. a drained receive batch
+     * std::vector<Frame> frames(inputs.size());
+     * std::unique_ptr<bool[]> valid(new bool[inputs.size()]);
+     * const size_t decoded = deserializeFrames(inputs, frames, Span<bool>(valid.get(), inputs.size()));
+     * @endcode
+     *
+     * @param inputs Encoded frames
+     * @param frames Output frames (at least inputs.size())
+     * @param valid Output: per input, true if it deserialized (at least inputs.size())
+     * @param options Pool and chunk size
+     * @return Number of frames deserialized
+     */
+    size_t deserializeFrames(Span<const ByteSpan> inputs, Span<Frame> frames, Span<bool> valid,
+                             const BulkDecodeOptions &options = BulkDecodeOptions());
+
+} // namespace limp
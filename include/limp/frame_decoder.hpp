@@ -0,0 +1,187 @@
+#pragma once
+
+#include "frame.hpp"
+#include "frame_view.hpp"
+#include "span.hpp"
+#include "types.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace limp
+{
+
+    /**
+     * @brief Incremental frame decoder for byte-stream transports
+     *
+     * deserializeFrame() needs exactly one frame per buffer, which message
+     * transports (ZeroMQ, UDP) provide but TCP and serial links do not.
+     * FrameDecoder accepts arbitrary chunks as they arrive, emits each frame
+     * as soon as its last byte is in, and carries a partial frame over to
+     * the next chunk.
+     *
+     * After garbage (line noise, a peer restart mid-frame) the decoder
+     * resynchronizes by sliding one byte at a time until a plausible header
+     * is followed by a frame that validates, including its CRC. Frames
+     * without CRC cannot be told apart from noise that merely looks like a
+     * header, so links that need robust resync should set requireCRC.
+     *
+     * Frames are decoded in place: from the caller's chunk when possible,
+     * otherwise from an internal buffer that only grows (to a few
+     * maximum-size frames at most). Nothing is allocated per byte or per frame.
+     *
+     * Two ways to drive it:
+     * - Push: feed() a chunk and get a callback per frame. Views are only
+     *   valid during the callback.
+     * - Pull: receive straight into prepare(), commit() the byte count, then
+     *   call next() until it returns false. Views stay valid until the next
+     *   prepare(), feed() or reset().
+     *
+     * @code
+     * FrameDecoder decoder;
+     * uint8_t chunk[4096];
+     * while ((n = read(fd, chunk, sizeof(chunk))) > 0) {
+     *     decoder.feed(chunk, n, [&](const FrameView &view) { handle(view); });
+     * }
+     * @endcode
+     */
+    class FrameDecoder
+    {
+    public:
+        /** @brief Largest possible frame on the wire */
+        static constexpr size_t MAX_FRAME_SIZE = HEADER_SIZE + MAX_PAYLOAD_SIZE + CRC_SIZE;
+
+        /** @brief Decoder options */
+        struct Options
+        {
+            bool requireCRC = false;                   ///< Only accept frames carrying a CRC (stronger resync)
+            size_t initialBufferSize = MAX_FRAME_SIZE; ///< Buffer allocated up front (0: on first partial frame)
+        };
+
+        /** @brief Decoder counters */
+        struct Stats
+        {
+            uint64_t frames = 0;         ///< Frames emitted
+            uint64_t discardedBytes = 0; ///< Bytes skipped while resynchronizing
+            uint64_t resyncs = 0;        ///< Times the stream lost frame alignment
+        };
+
+        FrameDecoder() : FrameDecoder(Options()) {}
+
+        /** @brief Construct decoder */
+        explicit FrameDecoder(const Options &options);
+
+        /**
+         * @brief Consume a chunk of stream bytes
+         *
+         * @param data Chunk bytes
+         * @param length Chunk size
+         * @param visit Callable taking const FrameView &, invoked per complete frame in order
+         * @return Number of frames emitted from this chunk
+         */
+        template <typename Visitor>
+        size_t feed(const uint8_t *data, size_t length, Visitor &&visit);
+
+        /**
+         * @brief Consume a chunk, appending owning copies of complete frames
+         * @return Number of frames appended
+         */
+        size_t feed(const uint8_t *data, size_t length, std::vector<Frame> &frames);
+
+        /**
+         * @brief Get buffer space to receive stream bytes into
+         * @param minSize Minimum writable size
+         * @return Writable span (at least minSize bytes) after the buffered bytes
+         */
+        Span<uint8_t> prepare(size_t minSize);
+
+        /** @brief Mark size bytes written into the last prepare() span as received */
+        void commit(size_t size) noexcept { end_ += size; }
+
+        /**
+         * @brief Extract the next complete frame from the buffered bytes
+         * @param view Output view (valid until the next prepare(), feed() or reset())
+         * @return false if more bytes are needed
+         */
+        bool next(FrameView &view);
+
+        /** @brief Bytes held back waiting for the rest of a frame */
+        size_t buffered() const noexcept { return end_ - begin_; }
+
+        /** @brief Counters since construction or reset() */
+        const Stats &stats() const noexcept { return stats_; }
+
+        /** @brief Drop buffered bytes and counters (e.g. after reconnecting) */
+        void reset() noexcept;
+
+        /**
+         * @brief Check if bytes start with a plausible frame header
+         *
+         * Cheap pre-filter used for resync: version, message type, flags,
+         * payload type and length. Needs HEADER_SIZE bytes.
+         */
+        static bool isPlausibleHeader(const uint8_t *header, bool requireCRC) noexcept;
+
+    private:
+        /**
+         * @brief Find the next frame in data starting at offset
+         *
+         * Skips garbage, advancing offset past it. On success offset points
+         * past the frame; otherwise it points at an incomplete candidate.
+         */
+        bool extract(const uint8_t *data, size_t length, size_t &offset, FrameView &view);
+
+        /** @brief Append bytes after the buffered ones */
+        void append(const uint8_t *data, size_t length);
+
+        /** @brief Move buffered bytes to the front and make room for size more */
+        void reserveTail(size_t size);
+
+        Options options_;
+        Stats stats_;
+        std::vector<uint8_t> buffer_; ///< Carried-over bytes live in [begin_, end_)
+        size_t begin_;
+        size_t end_;
+        bool inSync_; ///< false while sliding over garbage
+    };
+
+    template <typename Visitor>
+    size_t FrameDecoder::feed(const uint8_t *data, size_t length, Visitor &&visit)
+    {
+        size_t frames = 0;
+        FrameView view;
+
+        // Complete the carried-over frame, topping up at most one frame's worth at a
+        // time so the buffer stays bounded
+        while (buffered() > 0 && length > 0)
+        {
+            const size_t take = length < MAX_FRAME_SIZE ? length : MAX_FRAME_SIZE;
+            append(data, take);
+            data += take;
+            length -= take;
+
+            size_t offset = 0;
+            while (extract(buffer_.data() + begin_, buffered(), offset, view))
+            {
+                ++frames;
+                visit(static_cast<const FrameView &>(view));
+            }
+            begin_ += offset;
+        }
+        if (begin_ == end_)
+        {
+            begin_ = end_ = 0;
+        }
+
+        // Fast path: decode straight from the caller's chunk, keep only the tail
+        size_t offset = 0;
+        while (extract(data, length, offset, view))
+        {
+            ++frames;
+            visit(static_cast<const FrameView &>(view));
+        }
+        append(data + offset, length - offset);
+        return frames;
+    }
+
+} // namespace limp
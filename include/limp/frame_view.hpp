@@ -0,0 +1,135 @@
+#pragma once
+
+#include "frame.hpp"
+#include "span.hpp"
+#include <cstdint>
+#include <optional>
+
+namespace limp
+{
+
+    /**
+     * @brief Non-owning, zero-copy view of a serialized LIMP frame
+     *
+     * Wraps wire-format bytes (e.g. the data of a received zmq::message_t)
+     * without copying them. Header fields are decoded on access straight from
+     * the wire bytes and the payload is exposed as a ByteSpan into the same
+     * buffer. The view is only valid while the underlying buffer is alive.
+     *
+     * Header accessors assume at least HEADER_SIZE bytes; use
+     * deserializeFrameView() or validate() before reading fields of
+     * untrusted data.
+     *
+     * @code
+     * FrameView view;
+     * if (dealer.receiveView(view) == TransportError::None &&
+     *     view.msgType() == MsgType::REQUEST) {
+     *     route(view.srcNodeID(), view.payload());
+     * }
+     * @endcode
+     */
+    class FrameView
+    {
+    public:
+        /** @brief Construct empty view */
+        FrameView() noexcept : data_(nullptr), size_(0) {}
+
+        /**
+         * @brief Construct view over wire bytes (not validated)
+         * @param data Pointer to serialized frame
+         * @param size Size of serialized frame in bytes
+         */
+        FrameView(const uint8_t *data, size_t size) noexcept : data_(data), size_(size) {}
+
+        /** @brief Pointer to the wire bytes */
+        const uint8_t *data() const noexcept { return data_; }
+
+        /** @brief Size of the wire bytes */
+        size_t size() const noexcept { return size_; }
+
+        /** @brief Check if view references no data */
+        bool empty() const noexcept { return size_ == 0; }
+
+        /**
+         * @name Header Accessors
+         * Decode header fields directly from the wire bytes
+         * @{
+         */
+
+        uint8_t version() const noexcept { return data_[0]; }
+        MsgType msgType() const noexcept { return static_cast<MsgType>(data_[1]); }
+        uint16_t srcNodeID() const noexcept { return read16(2); }
+        uint16_t classID() const noexcept { return read16(4); }
+        uint16_t instanceID() const noexcept { return read16(6); }
+        uint16_t attrID() const noexcept { return read16(8); }
+        PayloadType payloadType() const noexcept { return static_cast<PayloadType>(data_[10]); }
+        uint16_t payloadLen() const noexcept { return read16(11); }
+        uint8_t flags() const noexcept { return data_[13]; }
+        bool hasCRC() const noexcept { return (flags() & Flags::CRC_PRESENT) != 0; }
+        bool isSequenced() const noexcept { return (flags() & Flags::SEQUENCED) != 0; }
+        bool isCompressed() const noexcept { return (flags() & Flags::COMPRESSED) != 0; }
+
+        /** @} */
+
+        /**
+         * @brief Payload bytes (points into the wire buffer)
+         *
+         * If isCompressed(), these are the zstd bytes, not the value; use
+         * toFrame() to get the decompressed payload.
+         *
+         * @return View of payloadLen() bytes following the header
+         */
+        ByteSpan payload() const noexcept { return ByteSpan(data_ + HEADER_SIZE, payloadLen()); }
+
+        /**
+         * @brief Stored CRC16 value
+         * @return CRC if the CRC flag is set, empty otherwise
+         */
+        std::optional<uint16_t> crc() const noexcept;
+
+        /**
+         * @brief Validate frame structure against the wire bytes
+         *
+         * Applies the same checks as deserializeFrame(): size, version,
+         * reserved flags, payload length and CRC16 if present.
+         *
+         * @return true if the bytes form a valid frame
+         */
+        bool validate() const;
+
+        /**
+         * @brief Materialize an owning Frame (copies the payload)
+         *
+         * Does not re-verify the CRC; the view should come from
+         * deserializeFrameView() or have passed validate(). A compressed
+         * payload is decompressed (see setFrameCompression()).
+         *
+         * @param frame Output frame
+         * @return true on success, false if the decoded frame fails Frame::validate()
+         */
+        bool toFrame(Frame &frame) const;
+
+    private:
+        uint16_t read16(size_t offset) const noexcept
+        {
+            return static_cast<uint16_t>((static_cast<uint16_t>(data_[offset]) << 8) | data_[offset + 1]);
+        }
+
+        const uint8_t *data_;
+        size_t size_;
+    };
+
+    /**
+     * @brief Create a validated view over wire bytes
+     *
+     * Zero-copy counterpart of deserializeFrame(). No bytes are copied and
+     * nothing is allocated; the view references the input buffer.
+     *
+     * @param data Pointer to binary buffer
+     * @param length Buffer size in bytes
+     * @param view Output view
+     * @return true on success, false if format invalid or CRC verification fails
+     */
+    bool deserializeFrameView(const uint8_t *data, size_t length, FrameView &view);
+
+} // namespace limp
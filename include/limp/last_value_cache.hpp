@@ -0,0 +1,119 @@
+#pragma once
+
+#include "frame.hpp"
+#include "frame_view.hpp"
+#include "topic.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace limp
+{
+
+    /**
+     * @brief Conflating cache of the latest frame per attribute
+     *
+     * Keeps exactly one Frame per (classID, instanceID, attrID): each update
+     * replaces the previous value of its attribute, so a consumer that
+     * falls behind a kHz publisher reads current values instead of working
+     * through a backlog of stale ones. Lookups are O(1).
+     *
+     * snapshot() copies the whole state (or the part under a Topic prefix),
+     * e.g. to bring a late-joining HMI up to date immediately.
+     *
+     * Thread-safe: many readers may run concurrently with one or more
+     * writers.
+     *
+     * @code
+     * LastValueCache cache;
+     * size_t received;
+     * subscriber.receiveInto(cache, 1024, received, 0);  // Drain and conflate
+     *
+     * Frame temperature;
+     * if (cache.get(0x4000, 1, 2, temperature)) {
+     *     display(temperature);
+     * }
+     * @endcode
+     */
+    class LastValueCache
+    {
+    public:
+        /** @brief Cache key of an attribute */
+        static constexpr uint64_t keyOf(uint16_t classID, uint16_t instanceID, uint16_t attrID) noexcept
+        {
+            return (static_cast<uint64_t>(classID) << 32) | (static_cast<uint64_t>(instanceID) << 16) | attrID;
+        }
+
+        LastValueCache() = default;
+
+        LastValueCache(const LastValueCache &) = delete;
+        LastValueCache &operator=(const LastValueCache &) = delete;
+
+        /**
+         * @brief Store a frame as the latest value of its attribute
+         * @return true if the attribute was not cached before
+         */
+        bool update(const Frame &frame);
+
+        /**
+         * @brief Store a received frame as the latest value of its attribute
+         *
+         * Decodes into a per-thread Frame and swaps it with the cached one, so
+         * payload storage is reused. A view that fails to decode (e.g. a
+         * corrupt compressed payload) leaves the cache untouched.
+         *
+         * @param view Validated frame view
+         * @return true if the attribute was not cached before, false if it was
+         *         or if the view could not be decoded
+         */
+        bool update(const FrameView &view);
+
+        /**
+         * @brief Copy the latest value of an attribute
+         * @return true if the attribute is cached
+         */
+        bool get(uint16_t classID, uint16_t instanceID, uint16_t attrID, Frame &frame) const;
+
+        /** @brief Latest value of an attribute, if cached */
+        std::optional<Frame> get(uint16_t classID, uint16_t instanceID, uint16_t attrID) const;
+
+        /** @brief Check if an attribute is cached */
+        bool contains(uint16_t classID, uint16_t instanceID, uint16_t attrID) const;
+
+        /**
+         * @brief Remove an attribute
+         * @return true if it was cached
+         */
+        bool erase(uint16_t classID, uint16_t instanceID, uint16_t attrID);
+
+        /**
+         * @brief Append the current value of every attribute under a topic
+         *
+         * @param frames Output (appended to, in no particular order)
+         * @param filter Class, instance or attribute prefix (empty for all)
+         * @return Number of frames appended
+         */
+        size_t snapshot(std::vector<Frame> &frames, const Topic &filter = Topic()) const;
+
+        /** @brief Number of cached attributes */
+        size_t size() const;
+
+        /** @brief Total updates applied (updates() - size() were conflated away) */
+        uint64_t updates() const noexcept { return updates_.load(std::memory_order_relaxed); }
+
+        /** @brief Remove all attributes */
+        void clear();
+
+    private:
+        static bool matches(uint64_t key, const Topic &filter) noexcept;
+
+        mutable std::shared_mutex mutex_;
+        std::unordered_map<uint64_t, Frame> values_;
+        std::atomic<uint64_t> updates_{0};
+    };
+
+} // namespace limp
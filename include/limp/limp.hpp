@@ -36,9 +36,22 @@ FLOAT32     = 0x05  - 32-bit IEEE 754 float (PayloadLen = 4)
 FLOAT64     = 0x06  - 64-bit IEEE 754 double (PayloadLen = 8)
 STRING      = 0x07  - UTF-8 string (variable length)
 OPAQUE      = 0x08  - Binary blob (variable length)
+BATCH       = 0x09  - Multiple attribute records (variable length, see below)
+UINT16_ARRAY  = 0x0A  - Array of UINT16 (PayloadLen = 2 * N)
+UINT32_ARRAY  = 0x0B  - Array of UINT32 (PayloadLen = 4 * N)
+UINT64_ARRAY  = 0x0C  - Array of UINT64 (PayloadLen = 8 * N)
+FLOAT32_ARRAY = 0x0D  - Array of FLOAT32 (PayloadLen = 4 * N)
+FLOAT64_ARRAY = 0x0E  - Array of FLOAT64 (PayloadLen = 8 * N)
 
 Note: All multi-byte values use big-endian byte order (network byte order).
 
+BATCH payload: one or more segments, each holding records of one type
+  [Type:1][Count:2]                 Segment header (Type = PayloadTypeID 0x00-0x08)
+  UINT8..FLOAT64:  [AttrID:2] x Count, then [Value:S] x Count  (S = type size)
+  STRING/OPAQUE:   ([AttrID:2][Len:2][Bytes:Len]) x Count
+  NONE:            [AttrID:2] x Count  (e.g. attributes to read in a REQUEST)
+  The header AttrID keeps its meaning; records carry their own AttrIDs.
+
 ------------------------------------------------------------------------------
 3. LIMP Frame Format (Binary Wire Format)
 -----------------------------
@@ -71,7 +84,8 @@ Version Handling:
 
 Flags Handling:
   - Bit 0: CRC_PRESENT (0=no CRC, 1=CRC appended)
-  - Bits 1-7: Reserved, MUST be 0
+  - Bit 1: SEQUENCED (datagram transports: 4-byte sequence number trails the frame)
+  - Bits 2-7: Reserved, MUST be 0
   - Receivers MUST reject frames with non-zero reserved bits
 
 Error Response Protocol:
@@ -138,10 +152,30 @@ End
 
 #include "limp/types.hpp"
 #include "limp/frame.hpp"
+#include "limp/payload_buffer.hpp"
+#include "limp/frame_view.hpp"
+#include "limp/frame_decoder.hpp"
+#include "limp/topic.hpp"
+#include "limp/attribute.hpp"
+#include "limp/last_value_cache.hpp"
+#include "limp/pool.hpp"
+#include "limp/queue.hpp"
+#include "limp/wire_buffer.hpp"
 #include "limp/message.hpp"
+#include "limp/batch.hpp"
 #include "limp/transport.hpp"
+#include "limp/metrics.hpp"
+#include "limp/trace.hpp"
+#include "limp/error_event.hpp"
+#include "limp/compression.hpp"
+#include "limp/deadband.hpp"
+#include "limp/credit.hpp"
+#include "limp/frame_bulk.hpp"
 #include "limp/utils.hpp"
+#include "limp/byte_order.hpp"
 #include "limp/crc.hpp"
+#include "limp/thread_pool.hpp"
+#include "limp/transaction_tracker.hpp"
 
 namespace limp
 {
@@ -1,10 +1,15 @@
 #pragma once
 
 #include "frame.hpp"
+#include "frame_view.hpp"
+#include "span.hpp"
+#include "transport.hpp"
 #include "types.hpp"
 #include <string>
+#include <string_view>
 #include <variant>
 #include <memory>
+#include <utility>
 
 namespace limp
 {
@@ -22,7 +27,12 @@ namespace limp
         float,               // FLOAT32
         double,              // FLOAT64
         std::string,         // STRING
-        std::vector<uint8_t> // OPAQUE
+        std::vector<uint8_t>,  // OPAQUE
+        std::vector<uint16_t>, // UINT16_ARRAY
+        std::vector<uint32_t>, // UINT32_ARRAY
+        std::vector<uint64_t>, // UINT64_ARRAY
+        std::vector<float>,    // FLOAT32_ARRAY
+        std::vector<double>    // FLOAT64_ARRAY
         >;
 
     /**
@@ -151,6 +161,21 @@ namespace limp
         /** @brief Set STRING payload from C-string */
         MessageBuilder &setPayload(const char *value);
 
+        /** @brief Set UINT16_ARRAY payload (at most 32767 elements) */
+        MessageBuilder &setPayload(Span<const uint16_t> values);
+
+        /** @brief Set UINT32_ARRAY payload (at most 16383 elements) */
+        MessageBuilder &setPayload(Span<const uint32_t> values);
+
+        /** @brief Set UINT64_ARRAY payload (at most 8191 elements) */
+        MessageBuilder &setPayload(Span<const uint64_t> values);
+
+        /** @brief Set FLOAT32_ARRAY payload (at most 16383 elements) */
+        MessageBuilder &setPayload(Span<const float> values);
+
+        /** @brief Set FLOAT64_ARRAY payload (at most 8191 elements) */
+        MessageBuilder &setPayload(Span<const double> values);
+
         /** @brief Clear payload (set to NONE) */
         MessageBuilder &setNoPayload();
 
@@ -168,6 +193,67 @@ namespace limp
          */
         Frame build() &&;
 
+        /**
+         * @brief Serialize the message straight into a caller buffer
+         *
+         * Writes the frame the builder holds, without building a Frame copy.
+         * Same format as serializeFrameInto().
+         *
+         * @param buffer Output buffer
+         * @param capacity Size of buffer in bytes
+         * @return Bytes written, or 0 if the frame is invalid or does not fit
+         */
+        size_t serializeTo(uint8_t *buffer, size_t capacity) const;
+
+        /**
+         * @brief Serialize the message into a vector
+         * @see serializeFrame()
+         * @return true on success, false if the frame is invalid
+         */
+        bool serializeTo(std::vector<uint8_t> &buffer) const;
+
+        /**
+         * @brief Send the message without building a Frame copy
+         *
+         * Calls transport.send(target..., frame). Leading arguments are
+         * passed through, so identity-addressed sends work too:
+         * `builder.sendVia(router, peer)`.
+         *
+         * @param transport Any transport (or wrapper) with a matching send()
+         * @param target Arguments placed before the frame (e.g. a peer identity)
+         * @return Result of send()
+         */
+        template <typename T, typename... Target>
+        TransportError sendVia(T &transport, Target &&...target) const &
+        {
+            return transport.send(std::forward<Target>(target)..., frame_);
+        }
+
+        /**
+         * @brief Send the message, handing its frame to the transport
+         *
+         * The frame is passed as an rvalue and picks up send(Frame &&) where
+         * the transport has one: the ZeroMQ transports then serialize large
+         * payloads inside their own allocation instead of copying them. That
+         * needs PayloadBuffer::SPILL_HEADROOM bytes of spare capacity, which a
+         * vector moved in with setPayload() has only if it reserved them. The
+         * builder is left holding a moved-from frame.
+         *
+         * @code
+         * std::vector<uint8_t> image;
+         * image.reserve(imageSize + PayloadBuffer::SPILL_HEADROOM);
+         * // ... fill image ...
+         * auto builder = MessageBuilder::event(0x10, 0x5000, 1, 1);
+         * builder.setPayload(std::move(image));  // Adopted, not copied
+         * std::move(builder).sendVia(dealer);    // Serialized in place
+         * @endcode
+         */
+        template <typename T, typename... Target>
+        TransportError sendVia(T &transport, Target &&...target) &&
+        {
+            return transport.send(std::forward<Target>(target)..., std::move(frame_));
+        }
+
         /**
          * @name Factory Methods
          * Convenience methods for creating common message types
@@ -287,6 +373,106 @@ namespace limp
         Frame frame_;
     };
 
+    /**
+     * @brief Non-owning, allocation-free message parser
+     *
+     * Decodes the header once and references the payload of a Frame or a
+     * received FrameView; nothing is copied. STRING and OPAQUE payloads are
+     * exposed as std::string_view / ByteSpan into the same bytes, so the
+     * view is only valid while the frame (or receive buffer) is alive.
+     *
+     * A compressed payload (Flags::COMPRESSED) cannot be read in place: all
+     * typed getters return empty and isCompressed() is true. Decompress
+     * with FrameView::toFrame() (or decompressFrame()) and view the Frame.
+     *
+     * @code
+     * FrameView received;
+     * if (dealer.receiveView(received) == TransportError::None) {
+     *     MessageView message(received);
+     *     if (auto name = message.getStringView()) {
+     *         lookup(*name);  // No allocation
+     *     }
+     * }
+     * @endcode
+     */
+    class MessageView
+    {
+    public:
+        /** @brief View a frame (references its payload) */
+        explicit MessageView(const Frame &frame) noexcept;
+
+        /** @brief View received wire bytes (references the receive buffer) */
+        explicit MessageView(const FrameView &view) noexcept;
+
+        /**
+         * @name Typed Payload Getters
+         * Same semantics as MessageParser. Returns empty optional if type mismatch.
+         * @{
+         */
+
+        std::optional<uint8_t> getUInt8() const noexcept;
+        std::optional<uint16_t> getUInt16() const noexcept;
+        std::optional<uint32_t> getUInt32() const noexcept;
+        std::optional<uint64_t> getUInt64() const noexcept;
+        std::optional<float> getFloat32() const noexcept;
+        std::optional<double> getFloat64() const noexcept;
+
+        /** @brief Get STRING payload without copying */
+        std::optional<std::string_view> getStringView() const noexcept;
+
+        /** @brief Get OPAQUE payload without copying */
+        std::optional<ByteSpan> getOpaqueSpan() const noexcept;
+
+        bool getUInt16Array(std::vector<uint16_t> &values) const;
+        bool getUInt32Array(std::vector<uint32_t> &values) const;
+        bool getUInt64Array(std::vector<uint64_t> &values) const;
+        bool getFloat32Array(std::vector<float> &values) const;
+        bool getFloat64Array(std::vector<double> &values) const;
+
+        /** @brief Get payload as variant type (copies STRING/OPAQUE/array payloads) */
+        PayloadValue getValue() const;
+
+        /** @brief Extract application error code from ERROR message */
+        std::optional<uint8_t> getErrorCode() const noexcept;
+
+        /** @} */
+
+        /**
+         * @name Frame Accessors
+         * @{
+         */
+
+        MsgType msgType() const noexcept { return msgType_; }
+        uint16_t srcNode() const noexcept { return srcNodeID_; }
+        uint16_t classID() const noexcept { return classID_; }
+        uint16_t instanceID() const noexcept { return instanceID_; }
+        uint16_t attrID() const noexcept { return attrID_; }
+        PayloadType payloadType() const noexcept { return payloadType_; }
+
+        /** @brief Raw payload bytes (the compressed bytes if isCompressed()) */
+        ByteSpan payload() const noexcept { return payload_; }
+
+        /** @brief Check if the payload is compressed (typed getters then return empty) */
+        bool isCompressed() const noexcept { return valueType_ != payloadType_; }
+
+        bool isRequest() const noexcept { return msgType_ == MsgType::REQUEST; }
+        bool isResponse() const noexcept { return msgType_ == MsgType::RESPONSE; }
+        bool isEvent() const noexcept { return msgType_ == MsgType::EVENT; }
+        bool isError() const noexcept { return msgType_ == MsgType::ERROR; }
+
+        /** @} */
+
+    private:
+        MsgType msgType_;
+        uint16_t srcNodeID_;
+        uint16_t classID_;
+        uint16_t instanceID_;
+        uint16_t attrID_;
+        PayloadType payloadType_;
+        PayloadType valueType_; ///< payloadType_, or NONE while the payload is compressed
+        ByteSpan payload_;
+    };
+
     /**
      * @brief Type-safe parser for extracting frame payload
      *
@@ -309,6 +495,9 @@ namespace limp
     public:
         /**
          * @brief Construct parser from frame (copy)
+         *
+         * Copies the whole frame; use MessageView to inspect a frame in place.
+         *
          * @param frame LIMP frame to parse
          */
         explicit MessageParser(const Frame &frame);
@@ -349,6 +538,42 @@ namespace limp
         /** @brief Get OPAQUE (binary) payload */
         std::optional<std::vector<uint8_t>> getOpaque() const;
 
+        /** @brief Get STRING payload without copying (valid while the parser is alive) */
+        std::optional<std::string_view> getStringView() const noexcept;
+
+        /** @brief Get OPAQUE payload without copying (valid while the parser is alive) */
+        std::optional<ByteSpan> getOpaqueSpan() const noexcept;
+
+        /** @brief Get UINT16_ARRAY payload */
+        std::optional<std::vector<uint16_t>> getUInt16Array() const;
+
+        /** @brief Get UINT32_ARRAY payload */
+        std::optional<std::vector<uint32_t>> getUInt32Array() const;
+
+        /** @brief Get UINT64_ARRAY payload */
+        std::optional<std::vector<uint64_t>> getUInt64Array() const;
+
+        /** @brief Get FLOAT32_ARRAY payload */
+        std::optional<std::vector<float>> getFloat32Array() const;
+
+        /** @brief Get FLOAT64_ARRAY payload */
+        std::optional<std::vector<double>> getFloat64Array() const;
+
+        /** @} */
+
+        /**
+         * @name Array Payload Getters (buffer reuse)
+         * Decode into an existing vector, reusing its capacity across frames.
+         * Return false (values untouched) on type mismatch.
+         * @{
+         */
+
+        bool getUInt16Array(std::vector<uint16_t> &values) const;
+        bool getUInt32Array(std::vector<uint32_t> &values) const;
+        bool getUInt64Array(std::vector<uint64_t> &values) const;
+        bool getFloat32Array(std::vector<float> &values) const;
+        bool getFloat64Array(std::vector<double> &values) const;
+
         /** @} */
 
         /**
@@ -366,6 +591,9 @@ namespace limp
         /** @brief Get underlying frame */
         const Frame &frame() const noexcept { return frame_; }
 
+        /** @brief Non-owning view of the underlying frame */
+        MessageView view() const noexcept { return MessageView(frame_); }
+
         /** @brief Get message type */
         MsgType msgType() const noexcept { return frame_.msgType; }
 
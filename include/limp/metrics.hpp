@@ -0,0 +1,267 @@
+#pragma once
+
+#include "transport.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace limp
+{
+
+    /** @brief Number of TransportError codes (indexes TransportStats::errors) */
+    constexpr size_t TRANSPORT_ERROR_COUNT = static_cast<size_t>(TransportError::InternalError) + 1;
+
+    /**
+     * @brief Check if instrumentation is compiled in
+     *
+     * Building with LIMP_DISABLE_METRICS (CMake: -DLIMP_ENABLE_METRICS=OFF)
+     * turns every record call into a no-op and stops reading the clock;
+     * metrics objects keep their layout, and snapshots read as zero.
+     */
+    constexpr bool metricsEnabled() noexcept
+    {
+#ifdef LIMP_DISABLE_METRICS
+        return false;
+#else
+        return true;
+#endif
+    }
+
+    /**
+     * @brief Lock-free latency histogram with HDR-style log-linear buckets
+     *
+     * Values below 16 ns get one bucket each; above that every power of two
+     * is split into 16 linear sub-buckets, so a reported percentile is within
+     * 1/16 (6.25%) of the true value. Values up to about 68 s are resolved;
+     * larger ones land in the last bucket. Recording is two relaxed atomic
+     * increments plus a max update and is safe from any number of threads.
+     *
+     * @code
+     * const uint64_t start = LatencyHistogram::now();
+     * transport.send(frame);
+     * sendLatency.record(LatencyHistogram::now() - start);
+     *
+     * auto snapshot = sendLatency.snapshot();
+     * report(snapshot.percentile(0.50), snapshot.percentile(0.99));
+     * @endcode
+     */
+    class LatencyHistogram
+    {
+    public:
+        /** @brief log2 of the number of sub-buckets per power of two */
+        static constexpr unsigned SUB_BUCKET_BITS = 4;
+
+        /** @brief Sub-buckets per power of two */
+        static constexpr size_t SUB_BUCKETS = size_t(1) << SUB_BUCKET_BITS;
+
+        /** @brief Highest resolved power of two (2^36 ns ~ 68.7 s) */
+        static constexpr unsigned MAX_EXPONENT = 36;
+
+        /** @brief Total number of buckets */
+        static constexpr size_t BUCKET_COUNT = (MAX_EXPONENT - SUB_BUCKET_BITS + 2) * SUB_BUCKETS;
+
+        /** @brief Point-in-time copy of a histogram */
+        struct Snapshot
+        {
+            uint64_t count = 0; ///< Number of recorded values
+            uint64_t sum = 0;   ///< Sum of recorded values (ns)
+            uint64_t max = 0;   ///< Largest recorded value (ns)
+            std::array<uint64_t, BUCKET_COUNT> buckets{}; ///< Values per bucket
+
+            /** @brief Mean value in nanoseconds (0 if empty) */
+            double mean() const noexcept { return count ? static_cast<double>(sum) / static_cast<double>(count) : 0.0; }
+
+            /**
+             * @brief Value at a quantile in nanoseconds
+             * @param quantile Fraction in [0, 1] (e.g. 0.99 for p99)
+             * @return Upper bound of the bucket holding the quantile (capped at max), 0 if empty
+             */
+            uint64_t percentile(double quantile) const noexcept;
+        };
+
+        LatencyHistogram() noexcept;
+
+        /** @brief Copy the current counts (relaxed; concurrent records may be partly included) */
+        LatencyHistogram(const LatencyHistogram &other) noexcept;
+        LatencyHistogram &operator=(const LatencyHistogram &other) noexcept;
+
+        /** @brief Monotonic timestamp in nanoseconds (0 when metrics are disabled) */
+        static uint64_t now() noexcept
+        {
+            if (!metricsEnabled())
+            {
+                return 0;
+            }
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                             std::chrono::steady_clock::now().time_since_epoch())
+                                             .count());
+        }
+
+        /** @brief Record one value in nanoseconds */
+        void record(uint64_t nanoseconds) noexcept
+        {
+            if (!metricsEnabled())
+            {
+                return;
+            }
+            buckets_[bucketIndex(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+            sum_.fetch_add(nanoseconds, std::memory_order_relaxed);
+
+            uint64_t max = max_.load(std::memory_order_relaxed);
+            while (nanoseconds > max && !max_.compare_exchange_weak(max, nanoseconds, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        /** @brief Record the time elapsed since a now() timestamp */
+        void recordSince(uint64_t start) noexcept
+        {
+            if (metricsEnabled())
+            {
+                record(now() - start);
+            }
+        }
+
+        /** @brief Copy the current counts */
+        Snapshot snapshot() const noexcept;
+
+        /** @brief Clear all counts */
+        void reset() noexcept;
+
+        /** @brief Bucket holding a value */
+        static size_t bucketIndex(uint64_t value) noexcept
+        {
+            if (value < SUB_BUCKETS)
+            {
+                return static_cast<size_t>(value);
+            }
+            const unsigned exponent = highestBit(value);
+            if (exponent > MAX_EXPONENT)
+            {
+                return BUCKET_COUNT - 1;
+            }
+            const unsigned shift = exponent - SUB_BUCKET_BITS;
+            const size_t sub = static_cast<size_t>(value >> shift) & (SUB_BUCKETS - 1);
+            return (exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + sub;
+        }
+
+        /** @brief Smallest value that falls into a bucket */
+        static uint64_t bucketLowerBound(size_t index) noexcept
+        {
+            if (index < SUB_BUCKETS)
+            {
+                return index;
+            }
+            const size_t group = index / SUB_BUCKETS;
+            const uint64_t sub = index % SUB_BUCKETS;
+            return (SUB_BUCKETS + sub) << (group - 1);
+        }
+
+    private:
+        static unsigned highestBit(uint64_t value) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return 63u - static_cast<unsigned>(__builtin_clzll(value));
+#else
+            unsigned bit = 0;
+            while (value >>= 1)
+            {
+                ++bit;
+            }
+            return bit;
+#endif
+        }
+
+        std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets_; ///< Values per bucket
+        std::atomic<uint64_t> sum_;                               ///< Sum of values
+        std::atomic<uint64_t> max_;                               ///< Largest value
+    };
+
+    /** @brief Snapshot of a transport's counters and latency histograms */
+    struct TransportStats
+    {
+        uint64_t framesSent = 0;     ///< Messages handed to the socket
+        uint64_t framesReceived = 0; ///< Messages received
+        uint64_t bytesSent = 0;      ///< Frame bytes sent (envelope parts excluded)
+        uint64_t bytesReceived = 0;  ///< Frame bytes received (envelope parts excluded)
+        uint64_t timeouts = 0;       ///< Receives that timed out (same as errorCount(Timeout))
+        std::array<uint64_t, TRANSPORT_ERROR_COUNT> errors{}; ///< Failures by TransportError code
+        LatencyHistogram::Snapshot sendLatency;               ///< Time spent in send calls
+        LatencyHistogram::Snapshot roundTrip;                 ///< Request sent to response received
+
+        /** @brief Number of failures with a given code */
+        uint64_t errorCount(TransportError error) const noexcept { return errors[static_cast<size_t>(error)]; }
+
+        /** @brief Total number of failures (timeouts included) */
+        uint64_t totalErrors() const noexcept;
+    };
+
+    /**
+     * @brief Per-transport counters and latency histograms
+     *
+     * Every member is a relaxed atomic, so getStats() may be called from a
+     * monitoring thread while the owning thread sends and receives.
+     */
+    class TransportMetrics
+    {
+    public:
+        TransportMetrics() noexcept;
+
+        /** @brief Copy the current values (keeps transports movable) */
+        TransportMetrics(const TransportMetrics &other) noexcept;
+        TransportMetrics &operator=(const TransportMetrics &other) noexcept;
+
+        /** @brief Count sent messages and their frame bytes */
+        void recordSend(uint64_t frames, uint64_t bytes) noexcept
+        {
+            if (metricsEnabled())
+            {
+                framesSent_.fetch_add(frames, std::memory_order_relaxed);
+                bytesSent_.fetch_add(bytes, std::memory_order_relaxed);
+            }
+        }
+
+        /** @brief Count received messages and their frame bytes */
+        void recordReceive(uint64_t frames, uint64_t bytes) noexcept
+        {
+            if (metricsEnabled())
+            {
+                framesReceived_.fetch_add(frames, std::memory_order_relaxed);
+                bytesReceived_.fetch_add(bytes, std::memory_order_relaxed);
+            }
+        }
+
+        /** @brief Count a failed operation (TransportError::None is ignored) */
+        void recordError(TransportError error) noexcept
+        {
+            if (metricsEnabled() && error != TransportError::None)
+            {
+                errors_[static_cast<size_t>(error)].fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        /** @brief Histogram of time spent in send calls */
+        LatencyHistogram &sendLatency() noexcept { return sendLatency_; }
+
+        /** @brief Histogram of request/response round trips */
+        LatencyHistogram &roundTrip() noexcept { return roundTrip_; }
+
+        /** @brief Copy all counters and histograms */
+        TransportStats snapshot() const noexcept;
+
+        /** @brief Clear all counters and histograms */
+        void reset() noexcept;
+
+    private:
+        std::atomic<uint64_t> framesSent_;                                 ///< Messages sent
+        std::atomic<uint64_t> framesReceived_;                             ///< Messages received
+        std::atomic<uint64_t> bytesSent_;                                  ///< Frame bytes sent
+        std::atomic<uint64_t> bytesReceived_;                              ///< Frame bytes received
+        std::array<std::atomic<uint64_t>, TRANSPORT_ERROR_COUNT> errors_; ///< Failures by code
+        LatencyHistogram sendLatency_;                                     ///< Send call durations
+        LatencyHistogram roundTrip_;                                       ///< Request/response round trips
+    };
+
+} // namespace limp
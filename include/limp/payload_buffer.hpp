@@ -0,0 +1,165 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <vector>
+
+namespace limp
+{
+
+    /**
+     * @brief Frame payload storage with inline small-buffer optimization
+     *
+     * Stores up to INLINE_CAPACITY bytes inside the object, so scalar payloads
+     * (UINT8..FLOAT64) and short strings never touch the heap. Larger payloads
+     * spill to an internal std::vector. Once spilled the buffer stays on the
+     * heap and keeps its capacity, so a reused Frame does not reallocate.
+     *
+     * The interface mirrors the parts of std::vector<uint8_t> used for frame
+     * payloads (data, size, resize, assign, iteration, comparison) and
+     * converts to and from std::vector. Moving in a std::vector adopts its
+     * allocation instead of copying.
+     */
+    class PayloadBuffer
+    {
+    public:
+        using value_type = uint8_t;
+        using size_type = size_t;
+        using iterator = uint8_t *;
+        using const_iterator = const uint8_t *;
+
+        /** @brief Bytes stored without heap allocation */
+        static constexpr size_t INLINE_CAPACITY = 32;
+
+        /**
+         * @brief Spare capacity reserved when the payload spills to the heap
+         *
+         * Room for a frame header and CRC, so a moved frame can be serialized
+         * inside its own payload allocation (see ZMQ send(Frame &&)).
+         */
+        static constexpr size_t SPILL_HEADROOM = 16;
+
+        /** @brief Construct empty payload (no allocation) */
+        PayloadBuffer() noexcept : size_(0), onHeap_(false) {}
+
+        /** @brief Construct by copying raw bytes */
+        PayloadBuffer(const uint8_t *data, size_t size) : PayloadBuffer() { assign(data, size); }
+
+        /** @brief Construct from byte list */
+        PayloadBuffer(std::initializer_list<uint8_t> bytes) : PayloadBuffer() { assign(bytes.begin(), bytes.size()); }
+
+        /** @brief Construct by copying a vector (inline if small enough) */
+        PayloadBuffer(const std::vector<uint8_t> &bytes) : PayloadBuffer() { assign(bytes.data(), bytes.size()); }
+
+        /** @brief Construct by adopting a vector's allocation */
+        PayloadBuffer(std::vector<uint8_t> &&bytes) noexcept
+            : heap_(std::move(bytes)), size_(0), onHeap_(true)
+        {
+        }
+
+        PayloadBuffer(const PayloadBuffer &other) : PayloadBuffer() { assign(other.data(), other.size()); }
+        PayloadBuffer(PayloadBuffer &&other) noexcept;
+
+        PayloadBuffer &operator=(const PayloadBuffer &other);
+        PayloadBuffer &operator=(PayloadBuffer &&other) noexcept;
+        PayloadBuffer &operator=(const std::vector<uint8_t> &bytes);
+        PayloadBuffer &operator=(std::vector<uint8_t> &&bytes) noexcept;
+
+        ~PayloadBuffer() = default;
+
+        uint8_t *data() noexcept { return onHeap_ ? heap_.data() : inline_; }
+        const uint8_t *data() const noexcept { return onHeap_ ? heap_.data() : inline_; }
+        size_t size() const noexcept { return onHeap_ ? heap_.size() : size_; }
+        bool empty() const noexcept { return size() == 0; }
+
+        /** @brief Bytes that can be held without reallocating */
+        size_t capacity() const noexcept { return onHeap_ ? heap_.capacity() : INLINE_CAPACITY; }
+
+        /** @brief Check if the payload is stored inline (no heap allocation) */
+        bool isInline() const noexcept { return !onHeap_; }
+
+        iterator begin() noexcept { return data(); }
+        iterator end() noexcept { return data() + size(); }
+        const_iterator begin() const noexcept { return data(); }
+        const_iterator end() const noexcept { return data() + size(); }
+
+        uint8_t &operator[](size_t index) noexcept { return data()[index]; }
+        const uint8_t &operator[](size_t index) const noexcept { return data()[index]; }
+
+        /**
+         * @brief Resize payload, zero-filling new bytes
+         *
+         * Stays inline while size <= INLINE_CAPACITY; otherwise spills to
+         * the heap, preserving existing contents.
+         */
+        void resize(size_t size);
+
+        /** @brief Remove all bytes (keeps any heap capacity) */
+        void clear() noexcept;
+
+        /** @brief Replace contents with a copy of raw bytes */
+        void assign(const uint8_t *data, size_t size);
+
+        /** @brief Replace contents with a copy of an iterator range (no zero-fill pass) */
+        template <typename ForwardIt>
+        void assign(ForwardIt first, ForwardIt last)
+        {
+            const size_t size = static_cast<size_t>(std::distance(first, last));
+            if (onHeap_)
+            {
+                heap_.assign(first, last);
+                return;
+            }
+
+            if (size <= INLINE_CAPACITY)
+            {
+                std::copy(first, last, inline_);
+                size_ = size;
+                return;
+            }
+
+            heap_.reserve(size + SPILL_HEADROOM);
+            heap_.assign(first, last);
+            onHeap_ = true;
+            size_ = 0;
+        }
+
+        /** @brief Copy contents into a new vector */
+        std::vector<uint8_t> toVector() const { return std::vector<uint8_t>(begin(), end()); }
+
+        /**
+         * @brief Move the contents out as a vector, leaving the buffer empty
+         *
+         * A heap payload hands over its allocation (and spare capacity);
+         * inline bytes are copied.
+         */
+        std::vector<uint8_t> release();
+
+        friend bool operator==(const PayloadBuffer &a, const PayloadBuffer &b) noexcept
+        {
+            return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+        }
+        friend bool operator!=(const PayloadBuffer &a, const PayloadBuffer &b) noexcept { return !(a == b); }
+
+        friend bool operator==(const PayloadBuffer &a, const std::vector<uint8_t> &b) noexcept
+        {
+            return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+        }
+        friend bool operator==(const std::vector<uint8_t> &a, const PayloadBuffer &b) noexcept { return b == a; }
+        friend bool operator!=(const PayloadBuffer &a, const std::vector<uint8_t> &b) noexcept { return !(a == b); }
+        friend bool operator!=(const std::vector<uint8_t> &a, const PayloadBuffer &b) noexcept { return !(b == a); }
+
+    private:
+        /** @brief Return a moved-from buffer to the empty inline state */
+        void reset() noexcept;
+
+        uint8_t inline_[INLINE_CAPACITY]; ///< Inline storage (valid while !onHeap_)
+        std::vector<uint8_t> heap_;       ///< Spill storage (valid while onHeap_)
+        size_t size_;                     ///< Inline size (heap size is heap_.size())
+        bool onHeap_;                     ///< Storage selector
+    };
+
+} // namespace limp
@@ -0,0 +1,249 @@
+#pragma once
+
+#include "frame.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace limp
+{
+
+    template <typename T>
+    class ThreadLocalPool;
+
+    /**
+     * @brief Recycling hook applied when an object returns to its pool
+     *
+     * The default leaves the object untouched so that reused objects keep
+     * their allocations (a recycled Frame keeps its payload capacity).
+     * Specialize to reset state that must not leak between uses.
+     */
+    template <typename T>
+    struct PoolTraits
+    {
+        static void recycle(T &) noexcept {}
+    };
+
+    /** @brief Frames are reset to their default state (payload capacity kept) on release */
+    template <>
+    struct PoolTraits<Frame>
+    {
+        static void recycle(Frame &frame) noexcept
+        {
+            PayloadBuffer payload = std::move(frame.payload);
+            payload.clear();
+            frame = Frame();
+            frame.payload = std::move(payload);
+        }
+    };
+
+    /** @brief Buffers are cleared (capacity kept) on release */
+    template <>
+    struct PoolTraits<std::vector<uint8_t>>
+    {
+        static void recycle(std::vector<uint8_t> &buffer) noexcept { buffer.clear(); }
+    };
+
+    /** @brief Strings (e.g. identities) are cleared (capacity kept) on release */
+    template <>
+    struct PoolTraits<std::string>
+    {
+        static void recycle(std::string &value) noexcept { value.clear(); }
+    };
+
+    /**
+     * @brief RAII handle to a pooled object
+     *
+     * Move-only. On destruction or reset() the object is handed back to the
+     * free list of the thread that releases it. A default-constructed handle
+     * is empty.
+     *
+     * @tparam T Pooled object type
+     */
+    template <typename T>
+    class Pooled
+    {
+    public:
+        /** @brief Construct empty handle */
+        Pooled() noexcept : object_(nullptr) {}
+
+        ~Pooled() { reset(); }
+
+        Pooled(const Pooled &) = delete;
+        Pooled &operator=(const Pooled &) = delete;
+
+        Pooled(Pooled &&other) noexcept : object_(other.object_) { other.object_ = nullptr; }
+
+        Pooled &operator=(Pooled &&other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                object_ = other.object_;
+                other.object_ = nullptr;
+            }
+            return *this;
+        }
+
+        T *get() const noexcept { return object_; }
+        T &operator*() const noexcept { return *object_; }
+        T *operator->() const noexcept { return object_; }
+
+        /** @brief Check if handle holds an object */
+        explicit operator bool() const noexcept { return object_ != nullptr; }
+
+        /** @brief Return the object to the pool and leave the handle empty */
+        void reset() noexcept
+        {
+            if (object_)
+            {
+                ThreadLocalPool<T>::release(object_);
+                object_ = nullptr;
+            }
+        }
+
+    private:
+        friend class ThreadLocalPool<T>;
+
+        explicit Pooled(T *object) noexcept : object_(object) {}
+
+        T *object_;
+    };
+
+    /**
+     * @brief Per-thread free list of reusable objects
+     *
+     * acquire() pops a previously released object (or allocates one when the
+     * list is empty); releasing pushes it back. Each thread has its own list,
+     * so neither operation takes a lock. Objects released on another thread
+     * simply join that thread's list. Once warmed up (see reserve()), a
+     * receive/forward loop does no malloc/free for its frames and buffers.
+     *
+     * At most MAX_CACHED objects are kept per thread; extra releases are
+     * freed.
+     *
+     * @code
+     * PooledFrame frame = FramePool::acquire();
+     * while (router.receive(sourceId, frame) == TransportError::None) {
+     *     router.send(route(*frame), *frame);
+     * }
+     * @endcode
+     *
+     * @tparam T Pooled object type (must be default constructible)
+     */
+    template <typename T>
+    class ThreadLocalPool
+    {
+    public:
+        /** @brief Maximum number of idle objects kept per thread */
+        static constexpr size_t MAX_CACHED = 256;
+
+        /**
+         * @brief Take an object from this thread's free list
+         * @return Handle to a recycled or newly allocated object
+         */
+        static Pooled<T> acquire()
+        {
+            auto *list = freeList();
+            if (!list || list->empty())
+            {
+                return Pooled<T>(new T());
+            }
+
+            T *object = list->back().release();
+            list->pop_back();
+            return Pooled<T>(object);
+        }
+
+        /**
+         * @brief Pre-populate this thread's free list
+         * @param count Number of idle objects to have available (capped at MAX_CACHED)
+         */
+        static void reserve(size_t count)
+        {
+            auto *list = freeList();
+            while (list && list->size() < count && list->size() < MAX_CACHED)
+            {
+                list->emplace_back(new T());
+            }
+        }
+
+        /** @brief Number of idle objects in this thread's free list */
+        static size_t cached() noexcept
+        {
+            auto *list = freeList();
+            return list ? list->size() : 0;
+        }
+
+        /** @brief Free all idle objects of this thread */
+        static void trim() noexcept
+        {
+            if (auto *list = freeList())
+            {
+                list->clear();
+            }
+        }
+
+    private:
+        friend class Pooled<T>;
+
+        static void release(T *object) noexcept
+        {
+            auto *list = freeList();
+            if (!list || list->size() >= MAX_CACHED)
+            {
+                delete object;
+                return;
+            }
+            PoolTraits<T>::recycle(*object);
+            // Capacity reserved up front, so this never reallocates
+            list->emplace_back(object);
+        }
+
+        /**
+         * @brief This thread's free list, or null once it has been destroyed
+         *
+         * Handles released by other thread_local destructors during thread
+         * exit may outlive the list; their objects are then simply deleted.
+         */
+        static std::vector<std::unique_ptr<T>> *freeList()
+        {
+            if (destroyed())
+            {
+                return nullptr;
+            }
+            thread_local FreeList list;
+            return &list.items;
+        }
+
+        /** @brief Set when this thread's free list is destroyed (trivial, so never destroyed itself) */
+        static bool &destroyed() noexcept
+        {
+            thread_local bool flag = false;
+            return flag;
+        }
+
+        struct FreeList
+        {
+            FreeList() { items.reserve(MAX_CACHED); }
+            ~FreeList() { destroyed() = true; }
+            std::vector<std::unique_ptr<T>> items;
+        };
+    };
+
+    /** @brief Thread-local pool of frames (payload capacity is kept across reuse) */
+    using FramePool = ThreadLocalPool<Frame>;
+    using PooledFrame = Pooled<Frame>;
+
+    /** @brief Thread-local pool of byte buffers */
+    using BufferPool = ThreadLocalPool<std::vector<uint8_t>>;
+    using PooledBuffer = Pooled<std::vector<uint8_t>>;
+
+    /** @brief Thread-local pool of identity strings */
+    using IdentityPool = ThreadLocalPool<std::string>;
+    using PooledIdentity = Pooled<std::string>;
+
+} // namespace limp
@@ -0,0 +1,351 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace limp
+{
+
+    /** @brief Cache line size assumed for padding shared counters */
+    constexpr size_t CACHE_LINE_SIZE = 64;
+
+    namespace detail
+    {
+        /** @brief Smallest power of two >= value (at least 2) */
+        constexpr size_t nextPowerOfTwo(size_t value) noexcept
+        {
+            size_t result = 2;
+            while (result < value)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+    } // namespace detail
+
+    /**
+     * @brief Bounded lock-free queue for one producer and one consumer thread
+     *
+     * A ring of pre-constructed slots; items are moved in and out, so a
+     * queue of Frame or PooledFrame never allocates after construction.
+     * Each side caches the other side's index and only reads the shared
+     * counter when its cached copy says the ring is full (or empty), so a
+     * steady stream costs no cache-line ping-pong per item.
+     *
+     * All operations are wait-free and never block: tryPush() fails if the
+     * queue is full, tryPop() if it is empty.
+     *
+     * @code
+     * SPSCQueue<PooledFrame> queue(1024);
+     * // receive thread
+     * PooledFrame frame = FramePool::acquire();
+     * subscriber.receive(*frame);
+     * queue.tryPush(std::move(frame));
+     * // worker thread
+     * PooledFrame work;
+     * while (queue.tryPop(work)) { process(*work); }
+     * @endcode
+     *
+     * @tparam T Item type (default constructible and move assignable)
+     */
+    template <typename T>
+    class SPSCQueue
+    {
+        static_assert(std::is_default_constructible<T>::value && std::is_nothrow_move_assignable<T>::value,
+                      "SPSCQueue items must be default constructible and nothrow move assignable");
+
+    public:
+        /**
+         * @brief Construct queue
+         * @param capacity Minimum number of items (rounded up to a power of two)
+         */
+        explicit SPSCQueue(size_t capacity)
+            : capacity_(detail::nextPowerOfTwo(capacity)), mask_(capacity_ - 1), slots_(new T[capacity_]),
+              head_(0), tailCache_(0), tail_(0), headCache_(0)
+        {
+        }
+
+        SPSCQueue(const SPSCQueue &) = delete;
+        SPSCQueue &operator=(const SPSCQueue &) = delete;
+
+        /** @brief Move an item in (producer); false if full */
+        bool tryPush(T &&item) noexcept
+        {
+            const size_t tail = tail_.load(std::memory_order_relaxed);
+            if (tail - headCache_ == capacity_)
+            {
+                headCache_ = head_.load(std::memory_order_acquire);
+                if (tail - headCache_ == capacity_)
+                {
+                    return false;
+                }
+            }
+            slots_[tail & mask_] = std::move(item);
+            tail_.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Move up to count items in (producer)
+         * @return Number of items pushed (items[0..n) are moved from)
+         */
+        size_t pushBatch(T *items, size_t count) noexcept
+        {
+            const size_t tail = tail_.load(std::memory_order_relaxed);
+            size_t space = capacity_ - (tail - headCache_);
+            if (space < count)
+            {
+                headCache_ = head_.load(std::memory_order_acquire);
+                space = capacity_ - (tail - headCache_);
+            }
+
+            const size_t n = count < space ? count : space;
+            for (size_t i = 0; i < n; ++i)
+            {
+                slots_[(tail + i) & mask_] = std::move(items[i]);
+            }
+            tail_.store(tail + n, std::memory_order_release); // One publish for the whole batch
+            return n;
+        }
+
+        /** @brief Move the oldest item out (consumer); false if empty */
+        bool tryPop(T &item) noexcept
+        {
+            const size_t head = head_.load(std::memory_order_relaxed);
+            if (head == tailCache_)
+            {
+                tailCache_ = tail_.load(std::memory_order_acquire);
+                if (head == tailCache_)
+                {
+                    return false;
+                }
+            }
+            item = std::move(slots_[head & mask_]);
+            head_.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Move up to maxItems items out (consumer)
+         * @return Number of items written to out
+         */
+        size_t popBatch(T *out, size_t maxItems) noexcept
+        {
+            const size_t head = head_.load(std::memory_order_relaxed);
+            size_t available = tailCache_ - head;
+            if (available < maxItems)
+            {
+                tailCache_ = tail_.load(std::memory_order_acquire);
+                available = tailCache_ - head;
+            }
+
+            const size_t n = maxItems < available ? maxItems : available;
+            for (size_t i = 0; i < n; ++i)
+            {
+                out[i] = std::move(slots_[(head + i) & mask_]);
+            }
+            head_.store(head + n, std::memory_order_release);
+            return n;
+        }
+
+        /** @brief Approximate number of queued items */
+        size_t size() const noexcept
+        {
+            return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+        }
+
+        /** @brief Check if the queue is (approximately) empty */
+        bool empty() const noexcept { return size() == 0; }
+
+        /** @brief Maximum number of queued items */
+        size_t capacity() const noexcept { return capacity_; }
+
+    private:
+        const size_t capacity_;
+        const size_t mask_;
+        std::unique_ptr<T[]> slots_;
+
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> head_; ///< Next slot to pop (consumer)
+        size_t tailCache_;                                  ///< Consumer's copy of tail_
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail_; ///< Next slot to push (producer)
+        size_t headCache_;                                  ///< Producer's copy of head_
+    };
+
+    /**
+     * @brief Bounded lock-free queue for many producer threads and one consumer
+     *
+     * Each slot carries a sequence number telling producers and the consumer
+     * whether it is free for the current lap (Vyukov's bounded queue).
+     * Producers claim slots with one CAS on the tail, a whole batch at a time
+     * when the slots are free, and never wait for each other. The consumer
+     * needs no read-modify-write at all.
+     *
+     * Pushing and popping never block: tryPush() fails if the queue is full,
+     * tryPop() if it is empty (or the oldest slot is claimed but not yet filled).
+     *
+     * @code
+     * MPSCQueue<Frame> outbox(4096);
+     * // any worker thread
+     * outbox.tryPush(std::move(reply));
+     * // the thread owning the socket
+     * Frame batch[64];
+     * size_t n = outbox.popBatch(batch, 64);
+     * dealer.sendBatch(Span<const Frame>(batch, n), sent);
+     * @endcode
+     *
+     * @tparam T Item type (default constructible and move assignable)
+     */
+    template <typename T>
+    class MPSCQueue
+    {
+        static_assert(std::is_default_constructible<T>::value && std::is_nothrow_move_assignable<T>::value,
+                      "MPSCQueue items must be default constructible and nothrow move assignable");
+
+    public:
+        /**
+         * @brief Construct queue
+         * @param capacity Minimum number of items (rounded up to a power of two)
+         */
+        explicit MPSCQueue(size_t capacity)
+            : capacity_(detail::nextPowerOfTwo(capacity)), mask_(capacity_ - 1), cells_(new Cell[capacity_]),
+              head_(0), tail_(0)
+        {
+            for (size_t i = 0; i < capacity_; ++i)
+            {
+                cells_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        MPSCQueue(const MPSCQueue &) = delete;
+        MPSCQueue &operator=(const MPSCQueue &) = delete;
+
+        /** @brief Move an item in (any thread); false if full */
+        bool tryPush(T &&item) noexcept
+        {
+            size_t tail = tail_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Cell &cell = cells_[tail & mask_];
+                const intptr_t lag = static_cast<intptr_t>(cell.sequence.load(std::memory_order_acquire)) -
+                                     static_cast<intptr_t>(tail);
+                if (lag == 0)
+                {
+                    if (tail_.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed))
+                    {
+                        cell.value = std::move(item);
+                        cell.sequence.store(tail + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (lag < 0)
+                {
+                    return false; // Slot still holds an item from the previous lap
+                }
+                else
+                {
+                    tail = tail_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief Move up to count items in (any thread)
+         *
+         * Claims all slots with a single CAS when they are free, otherwise
+         * pushes item by item until the queue is full.
+         *
+         * @return Number of items pushed (items[0..n) are moved from)
+         */
+        size_t pushBatch(T *items, size_t count) noexcept
+        {
+            if (count == 0)
+            {
+                return 0;
+            }
+
+            size_t tail = tail_.load(std::memory_order_relaxed);
+            while (count <= capacity_)
+            {
+                // The consumer frees slots in order, so if the last one is free all are
+                const size_t last = tail + count - 1;
+                if (cells_[last & mask_].sequence.load(std::memory_order_acquire) != last)
+                {
+                    break;
+                }
+                if (tail_.compare_exchange_weak(tail, tail + count, std::memory_order_relaxed))
+                {
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        Cell &cell = cells_[(tail + i) & mask_];
+                        cell.value = std::move(items[i]);
+                        cell.sequence.store(tail + i + 1, std::memory_order_release);
+                    }
+                    return count;
+                }
+            }
+
+            size_t pushed = 0;
+            while (pushed < count && tryPush(std::move(items[pushed])))
+            {
+                ++pushed;
+            }
+            return pushed;
+        }
+
+        /** @brief Move the oldest item out (consumer); false if empty */
+        bool tryPop(T &item) noexcept
+        {
+            Cell &cell = cells_[head_ & mask_];
+            if (cell.sequence.load(std::memory_order_acquire) != head_ + 1)
+            {
+                return false;
+            }
+            item = std::move(cell.value);
+            cell.sequence.store(head_ + capacity_, std::memory_order_release); // Free for the next lap
+            ++head_;
+            return true;
+        }
+
+        /**
+         * @brief Move up to maxItems items out (consumer)
+         * @return Number of items written to out
+         */
+        size_t popBatch(T *out, size_t maxItems) noexcept
+        {
+            size_t n = 0;
+            while (n < maxItems && tryPop(out[n]))
+            {
+                ++n;
+            }
+            return n;
+        }
+
+        /** @brief Approximate number of queued items (callable from the consumer) */
+        size_t size() const noexcept { return tail_.load(std::memory_order_acquire) - head_; }
+
+        /** @brief Check if the queue is (approximately) empty (callable from the consumer) */
+        bool empty() const noexcept { return size() == 0; }
+
+        /** @brief Maximum number of queued items */
+        size_t capacity() const noexcept { return capacity_; }
+
+    private:
+        struct Cell
+        {
+            std::atomic<size_t> sequence; ///< Lap marker: == position when free, position + 1 when filled
+            T value;
+        };
+
+        const size_t capacity_;
+        const size_t mask_;
+        std::unique_ptr<Cell[]> cells_;
+
+        alignas(CACHE_LINE_SIZE) size_t head_;              ///< Next slot to pop (consumer only)
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail_; ///< Next slot to claim (producers)
+    };
+
+} // namespace limp
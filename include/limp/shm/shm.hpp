@@ -0,0 +1,12 @@
+#pragma once
+
+/**
+ * @file shm.hpp
+ * @brief Convenience header that includes all shared-memory transport components
+ *
+ * Include this file to use the LIMP shared-memory transport (POSIX only).
+ */
+
+#include "shm_config.hpp"
+#include "shm_ring.hpp"
+#include "shm_transport.hpp"
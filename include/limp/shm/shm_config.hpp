@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+
+namespace limp
+{
+
+    /**
+     * @brief Configuration structure for shared-memory transports
+     *
+     * Endpoints have the form "shm://name" (letters, digits, '_', '-' and '.').
+     */
+    struct SHMConfig
+    {
+        size_t ringSize = 4 * 1024 * 1024; ///< Bytes per direction (rounded up to a power of two, at least 256 KB)
+        int sendTimeout = 1000;            ///< Wait for ring space in milliseconds (-1 for infinite)
+        int receiveTimeout = 1000;         ///< Receive timeout in milliseconds (-1 for infinite)
+        int spinCount = 4000;              ///< Busy-poll iterations before sleeping on a futex (0: sleep at once)
+    };
+
+} // namespace limp
@@ -0,0 +1,137 @@
+#pragma once
+
+#include "../frame.hpp"
+#include "../span.hpp"
+#include "../transport.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace limp
+{
+
+    /**
+     * @brief Bounded byte ring in POSIX shared memory, one reader, one or many writers
+     *
+     * Records are written in place: a writer reserves space, serializes the
+     * frame straight into the mapping and publishes it by storing its length.
+     * The reader gets a view of the record inside the mapping and releases it
+     * on the next read(). Nothing passes through the kernel on the data path.
+     *
+     * Multi-producer rings reserve space with a CAS on the write position;
+     * single-producer rings use a plain store. Records never wrap: a padding
+     * record fills the end of the ring when needed. Consumed bytes are zeroed
+     * so that an unpublished record always reads as length 0.
+     *
+     * Waiting spins for a configurable number of iterations and then sleeps
+     * on a futex in the shared mapping. Writers only issue a wake-up system
+     * call when the other side is actually asleep. Other POSIX systems fall
+     * back to short sleeps.
+     *
+     * Thread safety: write() may be called concurrently from several threads
+     * and processes on multi-producer rings. read() needs a single reader.
+     *
+     * Crash behaviour: a writer that dies between reserving a record and
+     * publishing it leaves a record that never becomes readable. The reader
+     * stops at it and times out on every read() from then on, and the ring
+     * has to be closed and created again.
+     */
+    class SharedMemoryRing
+    {
+    public:
+        /** @brief Smallest ring (a maximum-size frame always fits next to a padding record) */
+        static constexpr size_t MIN_CAPACITY = 256 * 1024;
+
+        SharedMemoryRing() noexcept;
+
+        /** @brief Destructor - unmaps the ring (and removes it if this side created it) */
+        ~SharedMemoryRing();
+
+        // Disable copy construction and assignment (owns the mapping)
+        SharedMemoryRing(const SharedMemoryRing &) = delete;
+        SharedMemoryRing &operator=(const SharedMemoryRing &) = delete;
+
+        /**
+         * @brief Create a ring
+         *
+         * An existing ring with the same name is only replaced if the process
+         * that created it no longer exists. A ring whose owner is alive, or
+         * that cannot be checked (another layout version, still being set
+         * up), is left alone and create() fails with errno set to EEXIST.
+         * The check compares process ids, so processes sharing a ring must
+         * live in the same PID namespace.
+         *
+         * @param name POSIX shared memory name (starting with '/')
+         * @param capacity Data bytes (rounded up to a power of two, at least MIN_CAPACITY)
+         * @param multiProducer Allow concurrent writers
+         * @return TransportError::None on success, TransportError::BindFailed on failure
+         */
+        TransportError create(const std::string &name, size_t capacity, bool multiProducer);
+
+        /**
+         * @brief Attach to a ring created by another process
+         * @return TransportError::None on success, TransportError::ConnectionFailed if it does not exist or is incompatible
+         */
+        TransportError open(const std::string &name);
+
+        /** @brief Unmap the ring (and remove the name if this side created it) */
+        void close() noexcept;
+
+        /** @brief Check if the ring is mapped */
+        bool isOpen() const noexcept { return header_ != nullptr; }
+
+        /** @brief Data capacity in bytes */
+        size_t capacity() const noexcept { return capacity_; }
+
+        /**
+         * @brief Serialize a frame into the ring
+         *
+         * @param frame Frame to write
+         * @param timeoutMs Wait for space in milliseconds (0=fail at once, -1=infinite)
+         * @param spinCount Busy-poll iterations before sleeping
+         * @return TransportError::None, TransportError::Timeout if the ring stayed full,
+         *         or TransportError::SerializationFailed if the frame is invalid
+         */
+        TransportError write(const Frame &frame, int timeoutMs, int spinCount);
+
+        /** @brief Write raw bytes as one record */
+        TransportError write(const uint8_t *data, size_t size, int timeoutMs, int spinCount);
+
+        /**
+         * @brief Get the next record, releasing the previous one
+         *
+         * @param record Output view into the mapping (valid until the next read() or release())
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=infinite)
+         * @param spinCount Busy-poll iterations before sleeping
+         * @return TransportError::None or TransportError::Timeout
+         */
+        TransportError read(ByteSpan &record, int timeoutMs, int spinCount);
+
+        /** @brief Give the last record's space back to the writers */
+        void release() noexcept;
+
+    private:
+        struct Header;
+
+        /** @brief Map a shared memory object and set the data pointers */
+        bool map(int fd, size_t size);
+
+        /** @brief Check if an existing ring was created by a process that has exited */
+        static bool ownerIsGone(const std::string &name);
+
+        /** @brief Reserve a record of size payload bytes; returns its record offset */
+        TransportError reserve(size_t size, int timeoutMs, int spinCount, uint64_t &offset);
+
+        /** @brief Publish a reserved record and wake a sleeping reader */
+        void publish(uint64_t offset, size_t size) noexcept;
+
+        Header *header_;       ///< Shared control block
+        uint8_t *data_;        ///< Shared record area
+        size_t capacity_;      ///< Record area size (power of two)
+        size_t mappingSize_;   ///< Bytes mapped
+        std::string name_;     ///< Shared memory name
+        bool owner_;           ///< Created by this side (unlinks on close)
+        uint64_t pendingSize_; ///< Bytes of the last record handed out by read()
+    };
+
+} // namespace limp
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "../transport.hpp"
+#include "shm_config.hpp"
+#include "shm_ring.hpp"
+#include <cstddef>
+#include <string>
+
+namespace limp
+{
+
+    /**
+     * @brief Shared-memory transport for processes on the same host
+     *
+     * A pair of SharedMemoryRing objects, one per direction. The side that
+     * calls bind() creates both rings; peers attach with connect(). Frames
+     * are serialized straight into the ring and received as views into it,
+     * so a frame crosses processes with one copy and no system call while
+     * the receiver is polling.
+     *
+     * The ring towards the bound side is multi-producer: several connected
+     * processes (or threads with their own transport) may send to it. The
+     * ring back is read by a single connected process.
+     *
+     * Thread safety: Not thread-safe. Use external synchronization if
+     * accessing from multiple threads.
+     *
+     * @code
+     * SHMTransport historian;          // Process A
+     * historian.bind("shm://historian");
+     *
+     * SHMTransport broker;             // Process B
+     * broker.connect("shm://historian");
+     * broker.send(frame);
+     *
+     * FrameView view;                  // Process A
+     * historian.receiveView(view, 100);
+     * @endcode
+     */
+    class SHMTransport : public Transport
+    {
+    public:
+        /**
+         * @brief Construct an unopened transport
+         * @param config Ring size, timeouts and spin budget
+         */
+        explicit SHMTransport(const SHMConfig &config = SHMConfig());
+
+        /** @brief Destructor - closes the rings (removing them if bound) */
+        ~SHMTransport() override;
+
+        // Disable copy construction and assignment (rings are unique resources)
+        SHMTransport(const SHMTransport &) = delete;
+        SHMTransport &operator=(const SHMTransport &) = delete;
+
+        /**
+         * @brief Create the rings for an endpoint
+         *
+         * @param endpoint Endpoint string (e.g., "shm://historian")
+         * @return TransportError::None on success, error code on failure
+         */
+        TransportError bind(const std::string &endpoint);
+
+        /**
+         * @brief Attach to rings created with bind()
+         *
+         * @param endpoint Endpoint string (e.g., "shm://historian")
+         * @return TransportError::None on success, TransportError::ConnectionFailed if nobody is bound
+         */
+        TransportError connect(const std::string &endpoint);
+
+        /**
+         * @brief Serialize a frame into the outgoing ring
+         * @return TransportError::None, or TransportError::Timeout if the ring stayed full for sendTimeout
+         */
+        TransportError send(const Frame &frame) override;
+
+        TransportError sendRaw(const uint8_t *data, size_t size) override;
+
+        TransportError receive(Frame &frame, int timeoutMs = -1) override;
+
+        /**
+         * @brief Receive a frame without copying it
+         *
+         * The view references the shared ring and stays valid until the next
+         * receive call, which hands its space back to the sender.
+         *
+         * @param view Output view of the received frame
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=SHMConfig::receiveTimeout)
+         * @return TransportError::None on success, TransportError::Timeout on timeout,
+         *         TransportError::DeserializationFailed if the record is not a valid frame
+         */
+        TransportError receiveView(FrameView &view, int timeoutMs = -1) override;
+
+        /**
+         * @brief Copy the next record into a caller buffer
+         * @return Number of bytes copied, 0 on timeout, or -1 on error or if the record does not fit
+         */
+        std::ptrdiff_t receiveRaw(uint8_t *buffer, size_t maxSize) override;
+
+        bool isConnected() const override { return tx_.isOpen() && rx_.isOpen(); }
+
+        void close() override;
+
+        /** @brief Get the endpoint passed to bind() or connect() */
+        const std::string &getEndpoint() const { return endpoint_; }
+
+    private:
+        /** @brief Map "shm://name" to the POSIX names of both rings */
+        static bool ringNames(const std::string &endpoint, std::string &toBound, std::string &toConnected);
+
+        SHMConfig config_;     ///< Transport configuration
+        SharedMemoryRing tx_;  ///< Outgoing ring
+        SharedMemoryRing rx_;  ///< Incoming ring
+        std::string endpoint_; ///< Endpoint
+    };
+
+} // namespace limp
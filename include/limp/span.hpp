@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace limp
+{
+
+    /**
+     * @brief Non-owning view over a contiguous sequence of objects
+     *
+     * Minimal C++17 stand-in for std::span. Holds a pointer and an element
+     * count; never allocates and never owns the referenced memory.
+     *
+     * @tparam T Element type (use const T for read-only views)
+     */
+    template <typename T>
+    class Span
+    {
+    public:
+        using element_type = T;
+        using value_type = std::remove_cv_t<T>;
+        using pointer = T *;
+        using reference = T &;
+        using iterator = T *;
+
+        /** @brief Construct empty span */
+        constexpr Span() noexcept : data_(nullptr), size_(0) {}
+
+        /**
+         * @brief Construct span from pointer and element count
+         * @param data Pointer to first element
+         * @param size Number of elements
+         */
+        constexpr Span(T *data, size_t size) noexcept : data_(data), size_(size) {}
+
+        /** @brief Construct span over a C array */
+        template <size_t N>
+        constexpr Span(T (&array)[N]) noexcept : data_(array), size_(N) {}
+
+        /** @brief Construct span over a contiguous container (vector, array, string) */
+        template <typename Container,
+                  typename = std::enable_if_t<
+                      !std::is_same<std::remove_cv_t<Container>, Span>::value &&
+                      std::is_convertible<decltype(std::declval<Container &>().data()), T *>::value>>
+        constexpr Span(Container &container) noexcept
+            : data_(container.data()), size_(container.size())
+        {
+        }
+
+        /** @brief Allow Span<T> to convert to Span<const T> */
+        template <typename U,
+                  typename = std::enable_if_t<std::is_convertible<U (*)[], T (*)[]>::value>>
+        constexpr Span(const Span<U> &other) noexcept : data_(other.data()), size_(other.size())
+        {
+        }
+
+        constexpr T *data() const noexcept { return data_; }
+        constexpr size_t size() const noexcept { return size_; }
+        constexpr bool empty() const noexcept { return size_ == 0; }
+
+        constexpr T *begin() const noexcept { return data_; }
+        constexpr T *end() const noexcept { return data_ + size_; }
+
+        constexpr T &operator[](size_t index) const noexcept { return data_[index]; }
+
+        /** @brief View of the first count elements */
+        constexpr Span first(size_t count) const noexcept { return Span(data_, count); }
+
+        /** @brief View of count elements starting at offset */
+        constexpr Span subspan(size_t offset, size_t count) const noexcept { return Span(data_ + offset, count); }
+
+    private:
+        T *data_;
+        size_t size_;
+    };
+
+    /** @brief Read-only view over raw bytes */
+    using ByteSpan = Span<const uint8_t>;
+
+} // namespace limp
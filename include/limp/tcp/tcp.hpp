@@ -0,0 +1,15 @@
+#pragma once
+
+/**
+ * @file tcp.hpp
+ * @brief Convenience header that includes all raw TCP transport components
+ *
+ * Include this file to use the LIMP raw TCP transport layer (POSIX only).
+ * TCPServer is available on Linux, where it is built on epoll.
+ */
+
+#include "tcp_config.hpp"
+#include "tcp_transport.hpp"
+#if defined(__linux__)
+#include "tcp_server.hpp"
+#endif
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "../frame_decoder.hpp"
+
+namespace limp
+{
+
+    /**
+     * @brief Configuration structure for raw TCP transports
+     *
+     * Timeouts and socket options for TCPTransport and TCPServer. Endpoints
+     * use the ZeroMQ form ("tcp://host:port"; host "*" binds all interfaces).
+     */
+    struct TCPConfig
+    {
+        int sendTimeout = 1000;    ///< Send timeout in milliseconds (-1 for infinite)
+        int receiveTimeout = 1000; ///< Receive timeout in milliseconds (-1 for infinite)
+        int connectTimeout = 1000; ///< Connect timeout in milliseconds (-1 for infinite)
+        int sendBufferSize = 0;    ///< SO_SNDBUF in bytes (0 for default)
+        int receiveBufferSize = 0; ///< SO_RCVBUF in bytes (0 for default)
+        bool noDelay = true;       ///< TCP_NODELAY: send small frames immediately (no Nagle delay)
+        bool keepAlive = true;     ///< SO_KEEPALIVE: detect dead device links
+        int listenBacklog = 128;   ///< listen() backlog for servers
+
+        /** @brief Stream decoder options (set requireCRC on links that need robust resync) */
+        FrameDecoder::Options decoder;
+    };
+
+} // namespace limp
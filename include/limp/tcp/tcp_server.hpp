@@ -0,0 +1,164 @@
+#pragma once
+
+#include "../frame_decoder.hpp"
+#include "../span.hpp"
+#include "../transport.hpp"
+#include "tcp_config.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace limp
+{
+
+    /**
+     * @brief Event-driven raw TCP server for many device connections (Linux)
+     *
+     * A fixed set of worker threads multiplexes all connections with epoll,
+     * so thousands of mostly idle links cost no thread each. Worker 0
+     * also accepts connections and hands them out round-robin. Each
+     * connection has its own FrameDecoder; frames are decoded straight from
+     * the worker's read buffer whenever a read holds them completely.
+     *
+     * Handlers run on the worker thread that owns the connection, so frames of
+     * one connection are delivered in order and never concurrently. The
+     * FrameView passed to onFrame is only valid during the callback.
+     *
+     * send() may be called from any thread, including from inside a handler.
+     * It uses the same gather writes as TCPTransport.
+     *
+     * @code
+     * TCPServer server;
+     * server.bind("tcp://0.0.0.0:6000");
+     * TCPServer::Handlers handlers;
+     * handlers.onFrame = [&](TCPServer::ConnectionId id, const FrameView &view) {
+     *     server.send(id, makeReply(view));
+     * };
+     * server.start(handlers, 2);
+     * @endcode
+     */
+    class TCPServer
+    {
+    public:
+        /** @brief Identifies a connection for the lifetime of the server (never reused) */
+        using ConnectionId = uint64_t;
+
+        /** @brief Connection event callbacks (all optional) */
+        struct Handlers
+        {
+            std::function<void(ConnectionId, const FrameView &)> onFrame; ///< Complete frame received
+            std::function<void(ConnectionId)> onConnect;                  ///< Connection accepted
+            std::function<void(ConnectionId)> onDisconnect;               ///< Connection closed
+        };
+
+        /**
+         * @brief Construct server
+         * @param config Socket options, timeouts and per-connection decoder options
+         */
+        explicit TCPServer(const TCPConfig &config = TCPConfig());
+
+        /** @brief Destructor - stops the server and closes all connections */
+        ~TCPServer();
+
+        // Disable copy construction and assignment (owns sockets and threads)
+        TCPServer(const TCPServer &) = delete;
+        TCPServer &operator=(const TCPServer &) = delete;
+
+        /**
+         * @brief Bind and listen on an endpoint
+         *
+         * @param endpoint Endpoint string (e.g., "tcp://0.0.0.0:6000"; port 0 picks a free port)
+         * @return TransportError::None on success, error code on failure
+         */
+        TransportError bind(const std::string &endpoint);
+
+        /** @brief Port the server listens on (0 if not bound) */
+        uint16_t port() const;
+
+        /**
+         * @brief Start the worker threads
+         *
+         * @param handlers Event callbacks
+         * @param threads Number of worker threads (at least 1)
+         * @return TransportError::None on success, TransportError::NotConnected if not bound,
+         *         TransportError::AlreadyConnected if already running
+         */
+        TransportError start(const Handlers &handlers, size_t threads = 1);
+
+        /**
+         * @brief Stop the workers and close the listener and all connections
+         *
+         * onDisconnect is called for every open connection. Must not be
+         * called from a handler.
+         */
+        void stop();
+
+        /** @brief Check if the workers are running */
+        bool isRunning() const noexcept { return running_.load(std::memory_order_acquire); }
+
+        /**
+         * @brief Send a frame to a connection
+         * @return TransportError::None on success, TransportError::NotConnected if the
+         *         connection does not exist (anymore), other error code on failure
+         */
+        TransportError send(ConnectionId id, const Frame &frame);
+
+        /**
+         * @brief Send many frames to a connection with as few system calls as possible
+         *
+         * If a write fails part way through a frame (e.g. a timeout after a
+         * short write), the connection is shut down and SocketClosed is
+         * returned: the peer could not parse anything sent after it.
+         *
+         * @param sent Output: number of frames completely sent
+         */
+        TransportError sendBatch(ConnectionId id, Span<const Frame> frames, size_t &sent);
+
+        /**
+         * @brief Close a connection
+         *
+         * The owning worker sees the shutdown and calls onDisconnect.
+         *
+         * @return false if the connection does not exist
+         */
+        bool disconnect(ConnectionId id);
+
+        /** @brief Number of open connections */
+        size_t connectionCount() const;
+
+        /** @brief Set error callback function */
+        void setErrorCallback(ErrorCallback callback);
+
+    private:
+        struct Connection;
+        struct Worker;
+
+        /** @brief Bytes read per recv() into the worker buffer */
+        static constexpr size_t READ_BUFFER_SIZE = 64 * 1024;
+
+        void run(Worker &worker);
+        void acceptConnections();
+        void readConnection(Worker &worker, Connection &connection);
+        void closeConnection(Connection &connection);
+        std::shared_ptr<Connection> find(ConnectionId id) const;
+        void handleError(const char *operation);
+
+        TCPConfig config_;                                                          ///< Server configuration
+        Handlers handlers_;                                                         ///< Set by start()
+        ErrorCallback errorCallback_;                                               ///< Error notification callback
+        int listenFd_;                                                              ///< Listening socket (-1 if not bound)
+        std::atomic<bool> running_;                                                 ///< Worker loop flag
+        std::vector<std::unique_ptr<Worker>> workers_;                              ///< Event loops
+        size_t nextWorker_;                                                         ///< Round-robin assignment (worker 0 only)
+        ConnectionId nextId_;                                                       ///< Next connection id (worker 0 only)
+        mutable std::mutex mutex_;                                                  ///< Guards connections_
+        std::unordered_map<ConnectionId, std::shared_ptr<Connection>> connections_; ///< Open connections
+    };
+
+} // namespace limp
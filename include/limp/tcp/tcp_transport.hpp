@@ -0,0 +1,142 @@
+#pragma once
+
+#include "../frame_decoder.hpp"
+#include "../span.hpp"
+#include "../transport.hpp"
+#include "tcp_config.hpp"
+#include <cstddef>
+#include <string>
+
+namespace limp
+{
+
+    /**
+     * @brief Raw TCP client transport for LIMP frames
+     *
+     * Frames are written back to back on a plain TCP stream, with no
+     * envelope or length prefix: the LIMP header already carries the payload
+     * length. This is the cheapest wire for devices that cannot run ZeroMQ.
+     *
+     * Sending uses gather writes: header, payload and CRC of each frame go
+     * out as separate iovecs, and sendBatch() writes up to 64 frames per
+     * system call. Receiving reads straight into a FrameDecoder buffer, so
+     * receiveView() returns frames without copying them.
+     *
+     * Socket errors are reported through the error callback (std::cerr
+     * when none is set). Once the peer closes the stream, every call
+     * returns TransportError::SocketClosed until connect() is called again.
+     *
+     * Thread safety: Not thread-safe. Use external synchronization if
+     * accessing from multiple threads.
+     *
+     * @code
+     * TCPTransport transport;
+     * transport.connect("tcp://192.168.1.10:6000");
+     * transport.send(frame);
+     * FrameView reply;
+     * if (transport.receiveView(reply, 100) == TransportError::None) { ... }
+     * @endcode
+     */
+    class TCPTransport : public Transport
+    {
+    public:
+        /**
+         * @brief Construct an unconnected transport
+         * @param config Socket options and timeouts
+         */
+        explicit TCPTransport(const TCPConfig &config = TCPConfig());
+
+        /**
+         * @brief Take ownership of a connected socket (e.g. from accept())
+         * @param fd Connected stream socket (closed by the transport)
+         * @param config Socket options and timeouts
+         */
+        TCPTransport(int fd, const TCPConfig &config);
+
+        /** @brief Destructor - closes the socket */
+        ~TCPTransport() override;
+
+        // Disable copy construction and assignment (sockets are unique resources)
+        TCPTransport(const TCPTransport &) = delete;
+        TCPTransport &operator=(const TCPTransport &) = delete;
+
+        /**
+         * @brief Connect to a server
+         *
+         * @param endpoint Endpoint string (e.g., "tcp://127.0.0.1:6000")
+         * @return TransportError::None on success, error code on failure
+         */
+        TransportError connect(const std::string &endpoint);
+
+        TransportError send(const Frame &frame) override;
+
+        /**
+         * @brief Send many frames with as few system calls as possible
+         *
+         * Stops at the first frame that fails validation or cannot be written.
+         * If a write fails part way through a frame (e.g. a timeout after a
+         * short write), the socket is closed and SocketClosed is returned: the
+         * peer could not parse anything sent after it. Frames [0, sent) are on
+         * the wire either way, so a retry resends only frames [sent, size).
+         *
+         * @param frames Frames to send
+         * @param sent Output: number of frames completely sent
+         * @return TransportError::None if all frames were sent, error code of the first failure otherwise
+         */
+        TransportError sendBatch(Span<const Frame> frames, size_t &sent);
+
+        TransportError sendRaw(const uint8_t *data, size_t size) override;
+
+        TransportError receive(Frame &frame, int timeoutMs = -1) override;
+
+        /**
+         * @brief Receive a frame without copying it
+         *
+         * The view references the decoder buffer and stays valid until the
+         * next receive call. Frames already buffered are returned without a
+         * system call.
+         *
+         * @param view Output view of the received frame
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=TCPConfig::receiveTimeout)
+         * @return TransportError::None on success, TransportError::Timeout on timeout,
+         *         TransportError::SocketClosed if the peer closed the stream
+         */
+        TransportError receiveView(FrameView &view, int timeoutMs = -1) override;
+
+        /**
+         * @brief Copy the next frame's wire bytes into a caller buffer
+         * @return Number of bytes copied, 0 on timeout, or -1 on error or if the frame does not fit
+         */
+        std::ptrdiff_t receiveRaw(uint8_t *buffer, size_t maxSize) override;
+
+        bool isConnected() const override { return fd_ >= 0; }
+
+        void close() override;
+
+        /** @brief Set error callback function */
+        void setErrorCallback(ErrorCallback callback);
+
+        /** @brief Get the endpoint passed to connect() (empty for adopted sockets) */
+        const std::string &getEndpoint() const { return endpoint_; }
+
+        /** @brief Underlying socket descriptor (-1 when closed), e.g. for an external poll loop */
+        int nativeHandle() const noexcept { return fd_; }
+
+        /** @brief Stream decoder counters (resyncs point at a corrupted link) */
+        const FrameDecoder::Stats &decoderStats() const noexcept { return decoder_.stats(); }
+
+    private:
+        /** @brief Bytes requested from the decoder per recv() */
+        static constexpr size_t RECEIVE_CHUNK = 64 * 1024;
+
+        /** @brief Report the current errno through the error callback */
+        void handleError(const char *operation);
+
+        TCPConfig config_;            ///< Transport configuration
+        FrameDecoder decoder_;        ///< Stream reassembly (owns the receive buffer)
+        std::string endpoint_;        ///< Connection endpoint
+        ErrorCallback errorCallback_; ///< Error notification callback
+        int fd_;                      ///< Socket descriptor (-1 when closed)
+    };
+
+} // namespace limp
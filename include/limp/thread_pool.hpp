@@ -0,0 +1,81 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace limp
+{
+
+    /**
+     * @brief Fixed-size pool of worker threads for async operations
+     *
+     * Tasks are queued FIFO and run on the first free worker. The
+     * destructor finishes queued tasks before joining the workers.
+     *
+     * @code
+     * ThreadPool pool(2);
+     * std::future<int> answer = pool.submit([] { return 42; });
+     * @endcode
+     */
+    class ThreadPool
+    {
+    public:
+        /**
+         * @brief Start worker threads
+         * @param threads Number of workers (at least 1)
+         */
+        explicit ThreadPool(size_t threads = std::thread::hardware_concurrency());
+
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        /**
+         * @brief Queue a task
+         * @param func Callable taking no arguments
+         * @return Future for the task's result (or exception)
+         */
+        template <typename F>
+        auto submit(F &&func) -> std::future<std::invoke_result_t<std::decay_t<F>>>
+        {
+            using Result = std::invoke_result_t<std::decay_t<F>>;
+            auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(func));
+            std::future<Result> future = task->get_future();
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                tasks_.emplace([task]() { (*task)(); });
+            }
+            cv_.notify_one();
+            return future;
+        }
+
+        /** @brief Number of worker threads */
+        size_t size() const noexcept { return workers_.size(); }
+
+    private:
+        void workerLoop();
+
+        std::vector<std::thread> workers_;
+        std::queue<std::function<void()>> tasks_;
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        bool stop_ = false;
+    };
+
+    /**
+     * @brief Shared thread pool used by the transactional wrappers
+     *
+     * Created on first use with 4 workers.
+     */
+    ThreadPool &getThreadPool();
+
+} // namespace limp
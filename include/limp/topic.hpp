@@ -0,0 +1,140 @@
+#pragma once
+
+#include "frame.hpp"
+#include "frame_view.hpp"
+#include "span.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace limp
+{
+
+    /**
+     * @brief Binary pub/sub topic derived from a frame's object address
+     *
+     * Encodes classID, instanceID and attrID as up to 6 big-endian bytes:
+     *
+     *   [classID:2][instanceID:2][attrID:2]
+     *
+     * A full 6-byte topic names one attribute; its 2- and 4-byte prefixes
+     * name a class or an instance. Since ZeroMQ matches subscriptions by
+     * byte prefix, subscribing to forClass(0x3000) receives every frame
+     * published under any attribute of any instance of that class, with
+     * the filtering done by ZeroMQ rather than by the subscriber.
+     *
+     * Topics live inline (no allocation) and can be passed straight to
+     * ZMQPublisher::publish() and ZMQSubscriber::subscribe().
+     *
+     * @code
+     * publisher.publish(frame);                                // Topic::forFrame(frame)
+     * subscriber.subscribe(Topic::forInstance(0x3000, 7));     // All attributes of instance 7
+     * subscriber.subscribe(Topic::forAttribute(0x4000, 1, 2)); // One attribute
+     * @endcode
+     *
+     * Binary and string topics share one namespace on a socket, so a
+     * publisher should use one kind or the other.
+     */
+    class Topic
+    {
+    public:
+        /** @brief Size of a full (attribute) topic in bytes */
+        static constexpr size_t MAX_SIZE = 6;
+
+        /** @brief Empty topic (matches everything when subscribed) */
+        constexpr Topic() noexcept : data_{}, size_(0) {}
+
+        /** @brief Topic for every instance of a class */
+        static constexpr Topic forClass(uint16_t classID) noexcept
+        {
+            return Topic(classID, 0, 0, 2);
+        }
+
+        /** @brief Topic for every attribute of one instance */
+        static constexpr Topic forInstance(uint16_t classID, uint16_t instanceID) noexcept
+        {
+            return Topic(classID, instanceID, 0, 4);
+        }
+
+        /** @brief Topic for one attribute */
+        static constexpr Topic forAttribute(uint16_t classID, uint16_t instanceID, uint16_t attrID) noexcept
+        {
+            return Topic(classID, instanceID, attrID, MAX_SIZE);
+        }
+
+        /** @brief Attribute topic of a frame */
+        static Topic forFrame(const Frame &frame) noexcept
+        {
+            return forAttribute(frame.classID, frame.instanceID, frame.attrID);
+        }
+
+        /**
+         * @brief Attribute topic of a frame view
+         *
+         * The bytes are copied straight from the wire header.
+         */
+        static Topic forFrame(const FrameView &view) noexcept
+        {
+            return forAttribute(view.classID(), view.instanceID(), view.attrID());
+        }
+
+        /** @brief Pointer to the encoded bytes */
+        constexpr const uint8_t *data() const noexcept { return data_; }
+
+        /** @brief Encoded size: 0, 2, 4 or 6 bytes */
+        constexpr size_t size() const noexcept { return size_; }
+
+        /** @brief Check if topic is empty */
+        constexpr bool empty() const noexcept { return size_ == 0; }
+
+        /** @brief Encoded bytes as a span */
+        ByteSpan bytes() const noexcept { return ByteSpan(data_, size_); }
+
+        /** @brief Encoded bytes as a (binary) string */
+        std::string str() const { return std::string(reinterpret_cast<const char *>(data_), size_); }
+
+        /** @brief Check if a message topic falls under this one (prefix match) */
+        constexpr bool matches(const uint8_t *topic, size_t size) const noexcept
+        {
+            if (size < size_)
+            {
+                return false;
+            }
+            for (size_t i = 0; i < size_; ++i)
+            {
+                if (topic[i] != data_[i])
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /** @brief Decoded classID (0 if empty) */
+        constexpr uint16_t classID() const noexcept { return size_ >= 2 ? read16(0) : 0; }
+
+        /** @brief Decoded instanceID (0 if not an instance or attribute topic) */
+        constexpr uint16_t instanceID() const noexcept { return size_ >= 4 ? read16(2) : 0; }
+
+        /** @brief Decoded attrID (0 if not an attribute topic) */
+        constexpr uint16_t attrID() const noexcept { return size_ >= 6 ? read16(4) : 0; }
+
+    private:
+        constexpr Topic(uint16_t classID, uint16_t instanceID, uint16_t attrID, size_t size) noexcept
+            : data_{static_cast<uint8_t>(classID >> 8), static_cast<uint8_t>(classID),
+                    static_cast<uint8_t>(instanceID >> 8), static_cast<uint8_t>(instanceID),
+                    static_cast<uint8_t>(attrID >> 8), static_cast<uint8_t>(attrID)},
+              size_(static_cast<uint8_t>(size))
+        {
+        }
+
+        constexpr uint16_t read16(size_t offset) const noexcept
+        {
+            return static_cast<uint16_t>((static_cast<uint16_t>(data_[offset]) << 8) | data_[offset + 1]);
+        }
+
+        uint8_t data_[MAX_SIZE];
+        uint8_t size_;
+    };
+
+} // namespace limp
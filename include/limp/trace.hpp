@@ -0,0 +1,113 @@
+#pragma once
+
+#include "transport.hpp"
+#include "types.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace limp
+{
+
+    /** @brief Points in a frame's life at which the installed Tracer is called */
+    enum class TraceEvent : uint8_t
+    {
+        FrameReceived = 0,       ///< Bytes taken off the socket, not yet parsed
+        DeserializeComplete = 1, ///< Frame parsed and validated (error set on failure)
+        SendEnqueued = 2,        ///< Frame serialized, about to be handed to the socket
+        SendComplete = 3         ///< Socket accepted the frame (error set on failure)
+    };
+
+    /** @brief Convert a trace event to a string */
+    const char *toString(TraceEvent event) noexcept;
+
+    /**
+     * @brief One tracing event
+     *
+     * Header fields are read straight from the wire bytes and are only
+     * meaningful when hasHeader is set (the bytes hold at least HEADER_SIZE).
+     * For FrameReceived they are not validated yet.
+     */
+    struct TraceRecord
+    {
+        TraceEvent event;      ///< What happened
+        uint64_t timestamp;    ///< steady_clock time in nanoseconds
+        const char *operation; ///< Transport operation (e.g. "router send")
+        TransportError error;  ///< Outcome (None unless the step failed)
+        size_t size;           ///< Frame size in bytes
+        bool hasHeader;        ///< Header fields below are valid
+        MsgType msgType;       ///< Message type
+        uint16_t srcNodeID;    ///< Source node
+        uint16_t classID;      ///< Class ID
+        uint16_t instanceID;   ///< Instance ID
+        uint16_t attrID;       ///< Attribute / transaction ID
+        uint8_t flags;         ///< Control flags
+    };
+
+    /**
+     * @brief Receiver of tracing events
+     *
+     * onEvent() runs synchronously on the sending or receiving thread, so it
+     * should only copy the record somewhere (ring buffer, perf/LTTng probe,
+     * OpenTelemetry span) and return. It may be called from several threads
+     * at once.
+     */
+    class Tracer
+    {
+    public:
+        virtual ~Tracer() = default;
+
+        /** @brief Handle one event */
+        virtual void onEvent(const TraceRecord &record) noexcept = 0;
+    };
+
+    /**
+     * @brief Install a process-wide tracer
+     *
+     * With no tracer installed each hook costs one atomic load and a branch.
+     * The tracer is not owned; it must stay alive until it has been replaced
+     * and no transport call that may still be running can reach it.
+     *
+     * @param tracer Tracer to install, or nullptr to remove the current one
+     */
+    void setTracer(Tracer *tracer) noexcept;
+
+    /** @brief Currently installed tracer (nullptr if none) */
+    Tracer *getTracer() noexcept;
+
+    namespace detail
+    {
+        extern std::atomic<Tracer *> activeTracer;
+
+        void emitTrace(Tracer &tracer, TraceEvent event, const uint8_t *frame, size_t size,
+                       TransportError error, const char *operation) noexcept;
+    } // namespace detail
+
+    /**
+     * @brief Report an event on a serialized frame to the installed tracer
+     *
+     * Called by transports; a no-op when no tracer is installed.
+     *
+     * @param event Event to report
+     * @param frame Wire bytes of the frame; the first min(size, HEADER_SIZE) must be readable
+     * @param size Frame size in bytes
+     * @param error Outcome of the step
+     * @param operation Transport operation name
+     */
+    inline void traceFrame(TraceEvent event, const uint8_t *frame, size_t size,
+                           TransportError error, const char *operation) noexcept
+    {
+        Tracer *tracer = detail::activeTracer.load(std::memory_order_acquire);
+        if (tracer)
+        {
+            detail::emitTrace(*tracer, event, frame, size, error, operation);
+        }
+    }
+
+    /** @brief Check if a tracer is installed */
+    inline bool isTracing() noexcept
+    {
+        return detail::activeTracer.load(std::memory_order_relaxed) != nullptr;
+    }
+
+} // namespace limp
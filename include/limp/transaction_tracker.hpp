@@ -0,0 +1,319 @@
+#pragma once
+
+#include "frame.hpp"
+#include "metrics.hpp"
+#include "transport.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace limp
+{
+
+    /**
+     * @brief Extract the transaction ID (AttrID) from a frame
+     * @return AttrID, or std::nullopt if it is 0 ("no transaction")
+     */
+    inline std::optional<uint16_t> extractTransactionId(const Frame &frame)
+    {
+        return frame.attrID != 0 ? std::optional<uint16_t>(frame.attrID) : std::nullopt;
+    }
+
+    /**
+     * @brief Extract the transaction ID (AttrID) from wire bytes
+     * @return AttrID, or std::nullopt if the buffer is shorter than a header or the ID is 0
+     */
+    inline std::optional<uint16_t> extractTransactionId(const uint8_t *data, size_t size)
+    {
+        if (!data || size < HEADER_SIZE)
+        {
+            return std::nullopt;
+        }
+        const uint16_t id = static_cast<uint16_t>((data[8] << 8) | data[9]);
+        return id != 0 ? std::optional<uint16_t>(id) : std::nullopt;
+    }
+
+    /**
+     * @brief Exception delivered through futures of failed transactions
+     *
+     * Carries the TransportError that ended the transaction (for example
+     * TransportError::Timeout when it expired), or the ERROR frame the peer
+     * answered with.
+     */
+    class TransactionFailure : public std::runtime_error
+    {
+    public:
+        explicit TransactionFailure(TransportError error)
+            : std::runtime_error(std::string("transaction failed: ") + toString(error)), error_(error)
+        {
+        }
+
+        /** @brief Failure by an application-level ERROR reply */
+        explicit TransactionFailure(const Frame &errorReply)
+            : std::runtime_error("transaction failed: peer replied with ERROR"), error_(TransportError::None),
+              reply_(errorReply)
+        {
+        }
+
+        /** @brief Error that ended the transaction (None if the peer replied with ERROR) */
+        TransportError error() const noexcept { return error_; }
+
+        /** @brief ERROR frame the peer replied with, or nullptr for transport failures */
+        const Frame *reply() const noexcept { return reply_ ? &*reply_ : nullptr; }
+
+    private:
+        TransportError error_;
+        std::optional<Frame> reply_;
+    };
+
+    /**
+     * @brief Thread-safe transaction lifecycle management
+     *
+     * Tracks pending transactions keyed by their 16-bit transaction ID
+     * (the frame's AttrID). State is split across SHARD_COUNT independently
+     * locked shards selected by the low bits of the ID, so threads working
+     * on different transactions rarely contend; completion is an O(1) hash
+     * lookup within one shard.
+     *
+     * Expiry uses a hashed timer wheel per shard: each transaction is
+     * filed in the wheel slot of its registration tick, and
+     * cleanupTimedOutTransactions() only visits the slots that have aged
+     * past the timeout since the previous sweep instead of every pending
+     * transaction. Each entry knows its position in its slot, so completing
+     * or expiring it is a constant-time swap-remove.
+     *
+     * @code
+     * auto tracker = std::make_shared<TransactionTracker>();
+     * tracker->registerTransaction(request.attrID, "", "plc-7");
+     * // ... later, on the reply
+     * tracker->completeTransaction(reply.attrID);
+     * tracker->cleanupTimedOutTransactions(std::chrono::seconds(5));
+     * @endcode
+     *
+     * A transaction may carry a CompletionHandler, invoked exactly once when
+     * it leaves the tracker (reply, failure, timeout or clear()). Handlers
+     * run on the completing thread after the shard lock is released, so they
+     * may call back into the tracker.
+     */
+    class TransactionTracker
+    {
+    public:
+        /** @brief Number of independently locked shards (power of two) */
+        static constexpr size_t SHARD_COUNT = 16;
+
+        /** @brief Number of timer wheel slots per shard (power of two) */
+        static constexpr size_t WHEEL_SLOTS = 256;
+
+        /** @brief Snapshot of a pending transaction */
+        struct TransactionInfo
+        {
+            uint16_t transactionId;
+            std::chrono::steady_clock::time_point timestamp;
+            std::string sourceIdentity;      ///< For routing (optional)
+            std::string destinationIdentity; ///< For routing (optional)
+            bool completed;
+        };
+
+        /**
+         * @brief Completion notification
+         *
+         * Called with TransportError::None and the reply when a reply frame
+         * completes the transaction via track(); with None and nullptr for
+         * completeTransaction(id, true); TransportError::Timeout on expiry;
+         * the send error for untrack(); InternalError otherwise.
+         */
+        using CompletionHandler = std::function<void(TransportError error, const Frame *reply)>;
+
+        /** @brief Lifetime counters */
+        struct Stats
+        {
+            uint64_t registered = 0; ///< Transactions registered
+            uint64_t completed = 0;  ///< Completed successfully
+            uint64_t failed = 0;     ///< Completed with failure
+            uint64_t timedOut = 0;   ///< Removed by cleanupTimedOutTransactions()
+        };
+
+        /**
+         * @brief Construct tracker
+         * @param tickResolution Timer wheel granularity; timeouts are checked exactly,
+         *        the resolution only bounds how much of the wheel a sweep visits
+         */
+        explicit TransactionTracker(std::chrono::milliseconds tickResolution = std::chrono::milliseconds(10));
+
+        TransactionTracker(const TransactionTracker &) = delete;
+        TransactionTracker &operator=(const TransactionTracker &) = delete;
+
+        /**
+         * @brief Allocate a new transaction ID and register it
+         *
+         * IDs wrap around at 65535 -> 1 (0 means "no transaction") and skip
+         * IDs that are still pending.
+         *
+         * @param sourceId Source identity (optional)
+         * @param destId Destination identity (optional)
+         * @return New transaction ID, or 0 if all IDs are pending
+         */
+        uint16_t registerTransaction(const std::string &sourceId = "",
+                                     const std::string &destId = "");
+
+        /**
+         * @brief Register a transaction under an existing ID (e.g. a frame's AttrID)
+         * @return true if registered, false if the ID is 0 or already pending
+         */
+        bool registerTransaction(uint16_t transactionId,
+                                 const std::string &sourceId,
+                                 const std::string &destId);
+
+        /**
+         * @brief Register a transaction with a completion handler
+         *
+         * The handler is not called if registration fails.
+         *
+         * @return true if registered, false if the ID is 0 or already pending
+         */
+        bool registerTransaction(uint16_t transactionId,
+                                 const std::string &sourceId,
+                                 const std::string &destId,
+                                 CompletionHandler handler);
+
+        /**
+         * @brief Complete and remove a pending transaction
+         * @param transactionId Transaction to complete
+         * @param success Whether it completed successfully (statistics only)
+         * @return true if the transaction was pending
+         */
+        bool completeTransaction(uint16_t transactionId, bool success = true);
+
+        /**
+         * @brief Update tracking from a frame seen on the wire
+         *
+         * REQUEST frames register their AttrID; RESPONSE and ACK frames
+         * complete it successfully and ERROR frames complete it as failed.
+         * Other message types and AttrID 0 are ignored. Used by the
+         * transactional wrappers on every send and receive.
+         *
+         * @return true if a transaction was registered or completed
+         */
+        bool track(const Frame &frame, const std::string &sourceId = "", const std::string &destId = "");
+
+        /**
+         * @brief Update tracking from serialized frame bytes
+         * @see track(const Frame &, const std::string &, const std::string &)
+         */
+        bool trackRaw(const uint8_t *data, size_t size,
+                      const std::string &sourceId = "", const std::string &destId = "");
+
+        /**
+         * @brief Roll back track() for an outgoing frame that was not sent
+         *
+         * A REQUEST registered by track() is completed as failed; other
+         * message types are left alone.
+         *
+         * @param frame Frame that was not sent
+         * @param error Send error passed to the completion handler
+         * @return true if a registration was rolled back
+         */
+        bool untrack(const Frame &frame, TransportError error = TransportError::SendFailed);
+
+        /**
+         * @brief Roll back trackRaw() for outgoing bytes that were not sent
+         * @see untrack()
+         */
+        bool untrackRaw(const uint8_t *data, size_t size, TransportError error = TransportError::SendFailed);
+
+        /** @brief Check if a transaction is pending */
+        bool isPending(uint16_t transactionId) const;
+
+        /** @brief Get a pending transaction's details */
+        std::optional<TransactionInfo> getTransaction(uint16_t transactionId) const;
+
+        /** @brief IDs of all pending transactions */
+        std::vector<uint16_t> getPendingTransactions() const;
+
+        /**
+         * @brief IDs of pending transactions older than a timeout
+         * @param timeout Age after which a transaction is timed out
+         */
+        std::vector<uint16_t> getTimedOutTransactions(std::chrono::milliseconds timeout) const;
+
+        /**
+         * @brief Remove pending transactions older than a timeout
+         * @param timeout Age after which a transaction is timed out
+         * @return Number of transactions removed
+         */
+        size_t cleanupTimedOutTransactions(std::chrono::milliseconds timeout);
+
+        /** @brief Number of pending transactions */
+        size_t getPendingCount() const noexcept { return pending_.load(std::memory_order_relaxed); }
+
+        /** @brief Lifetime counters */
+        Stats getStats() const noexcept;
+
+        /** @brief Registration-to-completion latency of successful transactions */
+        LatencyHistogram::Snapshot getRoundTripLatency() const noexcept { return roundTrip_.snapshot(); }
+
+        /** @brief Remove all pending transactions */
+        void clear();
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        struct Entry
+        {
+            TransactionInfo info;
+            uint64_t tick;             ///< Registration tick (selects the wheel slot)
+            size_t slotIndex;          ///< Position in its wheel slot
+            CompletionHandler handler; ///< Optional completion notification
+        };
+
+        using EntryMap = std::unordered_map<uint16_t, Entry>;
+
+        struct alignas(64) Shard
+        {
+            mutable std::mutex mutex;
+            EntryMap transactions;
+            std::array<std::vector<Entry *>, WHEEL_SLOTS> wheel; ///< Map nodes are stable, so slots hold pointers
+            uint64_t sweptTick = 0; ///< Slots before this tick hold no expired entries
+        };
+
+        Shard &shardFor(uint16_t transactionId) noexcept { return shards_[transactionId & (SHARD_COUNT - 1)]; }
+        const Shard &shardFor(uint16_t transactionId) const noexcept
+        {
+            return shards_[transactionId & (SHARD_COUNT - 1)];
+        }
+
+        bool track(MsgType type, uint16_t transactionId, const std::string &sourceId, const std::string &destId,
+                   const Frame *reply);
+        uint64_t tickOf(Clock::time_point time) const noexcept;
+        bool insertLocked(Shard &shard, uint16_t transactionId, Clock::time_point now,
+                          const std::string &sourceId, const std::string &destId,
+                          CompletionHandler &&handler);
+        bool finish(uint16_t transactionId, bool success, TransportError error, const Frame *reply);
+        static void unlinkLocked(Shard &shard, EntryMap::iterator it);
+
+        template <typename Visitor>
+        static void forEachExpiredLocked(const Shard &shard, uint64_t cutoffTick,
+                                         Clock::time_point cutoff, Visitor &&visit);
+
+        const Clock::time_point epoch_;
+        const Clock::duration tickResolution_;
+        std::array<Shard, SHARD_COUNT> shards_;
+        std::atomic<uint16_t> nextTransactionId_;
+        std::atomic<size_t> pending_;
+        std::atomic<uint64_t> registered_;
+        std::atomic<uint64_t> completed_;
+        std::atomic<uint64_t> failed_;
+        std::atomic<uint64_t> timedOut_;
+        LatencyHistogram roundTrip_;
+    };
+
+} // namespace limp
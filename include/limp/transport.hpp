@@ -1,6 +1,7 @@
 #pragma once
 
 #include "frame.hpp"
+#include "frame_view.hpp"
 #include <cstddef>
 #include <functional>
 #include <memory>
@@ -51,6 +52,7 @@ namespace limp
      * Method hierarchy:
      * - send(Frame) and receive(Frame) are the primary abstract methods
      * - sendRaw() and receiveRaw() are optional methods for raw data access
+     * - receiveView() is an optional zero-copy receive returning a FrameView
      * - Frame-based methods typically call Raw methods internally after serialization
      */
     class Transport
@@ -114,6 +116,25 @@ namespace limp
             return -1; // Not supported by default
         }
 
+        /**
+         * @brief Receive a frame without copying it
+         *
+         * Zero-copy counterpart of receive(). The view references memory owned
+         * by the transport and stays valid only until the next receive call on
+         * the same transport. Not all transports support this.
+         *
+         * @param view Output view of the received frame
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=infinite)
+         * @return TransportError::None on success, TransportError::Timeout on timeout,
+         *         other error code on failure
+         */
+        virtual TransportError receiveView(FrameView &view, int timeoutMs = -1)
+        {
+            (void)view;
+            (void)timeoutMs;
+            return TransportError::InternalError; // Not supported by default
+        }
+
         /**
          * @brief Check if transport is connected and ready
          * @return true if connected, false otherwise
@@ -65,15 +65,21 @@ namespace limp
      */
     enum class PayloadType : uint8_t
     {
-        NONE = 0x00,    ///< No payload
-        UINT8 = 0x01,   ///< 8-bit unsigned integer
-        UINT16 = 0x02,  ///< 16-bit unsigned integer (big-endian)
-        UINT32 = 0x03,  ///< 32-bit unsigned integer (big-endian)
-        UINT64 = 0x04,  ///< 64-bit unsigned integer (big-endian)
-        FLOAT32 = 0x05, ///< 32-bit IEEE 754 float (big-endian)
-        FLOAT64 = 0x06, ///< 64-bit IEEE 754 double (big-endian)
-        STRING = 0x07,  ///< UTF-8 string (length-prefixed)
-        OPAQUE = 0x08   ///< Opaque binary data
+        NONE = 0x00,          ///< No payload
+        UINT8 = 0x01,         ///< 8-bit unsigned integer
+        UINT16 = 0x02,        ///< 16-bit unsigned integer (big-endian)
+        UINT32 = 0x03,        ///< 32-bit unsigned integer (big-endian)
+        UINT64 = 0x04,        ///< 64-bit unsigned integer (big-endian)
+        FLOAT32 = 0x05,       ///< 32-bit IEEE 754 float (big-endian)
+        FLOAT64 = 0x06,       ///< 64-bit IEEE 754 double (big-endian)
+        STRING = 0x07,        ///< UTF-8 string (length-prefixed)
+        OPAQUE = 0x08,        ///< Opaque binary data
+        BATCH = 0x09,         ///< Multiple attribute records (see BatchBuilder)
+        UINT16_ARRAY = 0x0A,  ///< Array of 16-bit unsigned integers (big-endian)
+        UINT32_ARRAY = 0x0B,  ///< Array of 32-bit unsigned integers (big-endian)
+        UINT64_ARRAY = 0x0C,  ///< Array of 64-bit unsigned integers (big-endian)
+        FLOAT32_ARRAY = 0x0D, ///< Array of 32-bit IEEE 754 floats (big-endian)
+        FLOAT64_ARRAY = 0x0E  ///< Array of 64-bit IEEE 754 doubles (big-endian)
     };
 
     /**
@@ -84,8 +90,27 @@ namespace limp
         /** @brief Bit 0: CRC16 checksum is present at end of frame */
         constexpr uint8_t CRC_PRESENT = 0x01;
 
-        /** @brief Bits 1-7: Reserved for future use */
-        constexpr uint8_t RESERVED_MASK = 0xFE;
+        /**
+         * @brief Bit 1: Datagram carries a sequence number after the frame
+         *
+         * Set by datagram transports (UDPMulticastTransport) that append a
+         * 4-byte big-endian sequence number for gap detection. The trailer
+         * is not part of the frame and not covered by the CRC; stream
+         * transports ignore the bit.
+         */
+        constexpr uint8_t SEQUENCED = 0x02;
+
+        /**
+         * @brief Bit 2: Payload is zstd-compressed
+         *
+         * Only STRING and OPAQUE payloads are compressed. PayloadLen is the
+         * compressed length and the CRC covers the compressed bytes; the
+         * original size is stored in the zstd frame header. See compression.hpp.
+         */
+        constexpr uint8_t COMPRESSED = 0x04;
+
+        /** @brief Bits 3-7: Reserved for future use */
+        constexpr uint8_t RESERVED_MASK = 0xF8;
     }
 
     /**
@@ -94,9 +119,9 @@ namespace limp
      * Returns fixed byte size for scalar types, 0 for variable-length types.
      *
      * @param type Payload type
-     * @return Size in bytes (0 for NONE, STRING, OPAQUE)
+     * @return Size in bytes (0 for NONE, STRING, OPAQUE, BATCH and array types)
      */
-    inline uint16_t getPayloadTypeSize(PayloadType type)
+    constexpr uint16_t getPayloadTypeSize(PayloadType type)
     {
         switch (type)
         {
@@ -118,6 +143,34 @@ namespace limp
             return 0; // Variable
         case PayloadType::OPAQUE:
             return 0; // Variable
+        case PayloadType::BATCH:
+            return 0; // Variable
+        default:
+            return 0; // Arrays are variable (see getPayloadElementSize)
+        }
+    }
+
+    /**
+     * @brief Get element size of an array payload type
+     *
+     * Array payloads hold PayloadLen / size elements; PayloadLen must be a
+     * multiple of the element size.
+     *
+     * @param type Payload type
+     * @return Element size in bytes (0 for non-array types)
+     */
+    constexpr uint16_t getPayloadElementSize(PayloadType type)
+    {
+        switch (type)
+        {
+        case PayloadType::UINT16_ARRAY:
+            return 2;
+        case PayloadType::UINT32_ARRAY:
+        case PayloadType::FLOAT32_ARRAY:
+            return 4;
+        case PayloadType::UINT64_ARRAY:
+        case PayloadType::FLOAT64_ARRAY:
+            return 8;
         default:
             return 0;
         }
@@ -0,0 +1,11 @@
+#pragma once
+
+/**
+ * @file udp.hpp
+ * @brief Convenience header that includes all UDP transport components
+ *
+ * Include this file to use the LIMP UDP multicast transport (POSIX only).
+ */
+
+#include "udp_config.hpp"
+#include "udp_multicast.hpp"
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace limp
+{
+
+    /**
+     * @brief Configuration structure for UDP multicast transports
+     *
+     * Endpoints use the form "udp://group:port" with a numeric IPv4 address
+     * (e.g. "udp://239.192.0.1:7000").
+     */
+    struct UDPConfig
+    {
+        std::string interfaceAddress; ///< Local IPv4 address of the LAN interface (empty: default route)
+        int ttl = 1;                  ///< IP_MULTICAST_TTL (1: do not leave the local subnet)
+        bool loopback = true;         ///< IP_MULTICAST_LOOP: deliver to receivers on the sending host
+        bool sequenced = true;        ///< Append sequence numbers (Flags::SEQUENCED) for gap detection
+        int sendTimeout = 1000;       ///< Send timeout in milliseconds (-1 for infinite)
+        int receiveTimeout = 1000;    ///< Receive timeout in milliseconds (-1 for infinite)
+        int sendBufferSize = 0;       ///< SO_SNDBUF in bytes (0 for default)
+        int receiveBufferSize = 0;    ///< SO_RCVBUF in bytes (0 for default; raise it for bursty publishers)
+        size_t batchSize = 16;        ///< Datagrams per sendmmsg/recvmmsg call, 1-64 (receivers keep one 64 KB slot each)
+    };
+
+} // namespace limp
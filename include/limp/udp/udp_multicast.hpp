@@ -0,0 +1,214 @@
+#pragma once
+
+#include "../frame.hpp"
+#include "../frame_view.hpp"
+#include "../span.hpp"
+#include "../transport.hpp"
+#include "udp_config.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace limp
+{
+
+    /**
+     * @brief Callback for sequence gaps: source node and number of frames missed
+     */
+    using GapCallback = std::function<void(uint16_t srcNodeID, uint32_t lost)>;
+
+    /**
+     * @brief UDP multicast transport for one-to-many telemetry
+     *
+     * Every LIMP frame travels as one datagram, so the publisher sends each
+     * frame once no matter how many receivers have joined the group. On
+     * Linux, sendBatch() and the receive path move up to UDPConfig::batchSize
+     * datagrams per system call (sendmmsg/recvmmsg).
+     *
+     * With UDPConfig::sequenced the sender sets Flags::SEQUENCED and appends
+     * a 4-byte big-endian sequence number to each datagram. Receivers track
+     * the sequence per sender socket and report missing datagrams through
+     * the gap callback and stats(). Late (reordered or duplicated) datagrams
+     * are still delivered and counted. UDP gives no delivery guarantee:
+     * consumers that need every update should ask for it again (e.g. a
+     * REQUEST over a reliable transport) when a gap is reported.
+     *
+     * Datagrams are limited to MAX_DATAGRAM_SIZE, so frames with payloads
+     * close to MAX_PAYLOAD_SIZE cannot be sent.
+     *
+     * Thread safety: Not thread-safe. Use external synchronization if
+     * accessing from multiple threads.
+     *
+     * @code
+     * UDPMulticastTransport publisher;
+     * publisher.connect("udp://239.192.0.1:7000");
+     * publisher.send(frame);
+     *
+     * UDPMulticastTransport receiver;
+     * receiver.join("udp://239.192.0.1:7000");
+     * FrameView view;
+     * if (receiver.receiveView(view, 100) == TransportError::None) { ... }
+     * @endcode
+     */
+    class UDPMulticastTransport : public Transport
+    {
+    public:
+        /** @brief Largest datagram an IPv4 UDP socket can carry */
+        static constexpr size_t MAX_DATAGRAM_SIZE = 65507;
+
+        /** @brief Size of the sequence number trailer */
+        static constexpr size_t SEQUENCE_SIZE = 4;
+
+        /** @brief Transport counters */
+        struct Stats
+        {
+            uint64_t framesSent = 0;       ///< Frames sent
+            uint64_t framesReceived = 0;   ///< Valid frames delivered
+            uint64_t invalidDatagrams = 0; ///< Datagrams dropped (truncated, not a frame, bad CRC)
+            uint64_t gaps = 0;             ///< Sequence gaps detected
+            uint64_t lostFrames = 0;       ///< Frames missing in those gaps
+            uint64_t reordered = 0;        ///< Datagrams older than the expected sequence
+        };
+
+        /**
+         * @brief Construct an unopened transport
+         * @param config Multicast options and timeouts
+         */
+        explicit UDPMulticastTransport(const UDPConfig &config = UDPConfig());
+
+        /** @brief Destructor - leaves the group and closes the socket */
+        ~UDPMulticastTransport() override;
+
+        // Disable copy construction and assignment (sockets are unique resources)
+        UDPMulticastTransport(const UDPMulticastTransport &) = delete;
+        UDPMulticastTransport &operator=(const UDPMulticastTransport &) = delete;
+
+        /**
+         * @brief Open a socket that sends to a group
+         *
+         * @param endpoint Group endpoint (e.g., "udp://239.192.0.1:7000")
+         * @return TransportError::None on success, error code on failure
+         */
+        TransportError connect(const std::string &endpoint);
+
+        /**
+         * @brief Join a group to receive its frames
+         *
+         * Several receivers on one host can join the same group and port.
+         * The socket can also send to the group.
+         *
+         * @param endpoint Group endpoint (multicast address required)
+         * @return TransportError::None on success, error code on failure
+         */
+        TransportError join(const std::string &endpoint);
+
+        TransportError send(const Frame &frame) override;
+
+        /**
+         * @brief Send many frames as one datagram each, batching system calls
+         *
+         * Stops at the first frame that fails validation, does not fit a
+         * datagram or cannot be sent.
+         *
+         * @param frames Frames to send
+         * @param sent Output: number of frames sent
+         * @return TransportError::None if all frames were sent, error code of the first failure otherwise
+         */
+        TransportError sendBatch(Span<const Frame> frames, size_t &sent);
+
+        /** @brief Send raw bytes as one datagram (no sequence number is added) */
+        TransportError sendRaw(const uint8_t *data, size_t size) override;
+
+        TransportError receive(Frame &frame, int timeoutMs = -1) override;
+
+        /**
+         * @brief Receive a frame without copying it
+         *
+         * The view references a receive slot of the transport and stays valid
+         * until the next receive call. Datagrams already received are returned
+         * without a system call.
+         *
+         * @param view Output view of the received frame
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=UDPConfig::receiveTimeout)
+         * @return TransportError::None on success, TransportError::Timeout on timeout,
+         *         other error code on failure
+         */
+        TransportError receiveView(FrameView &view, int timeoutMs = -1) override;
+
+        /**
+         * @brief Receive up to maxFrames queued frames
+         *
+         * The first frame is awaited for timeoutMs; the rest are taken while
+         * datagrams are queued. Existing elements of frames are reused, and
+         * frames is resized to the number of frames received.
+         *
+         * @return TransportError::None if at least one frame was received,
+         *         TransportError::Timeout if none arrived, other error code on failure
+         */
+        TransportError receiveBatch(std::vector<Frame> &frames, size_t maxFrames, int timeoutMs = -1);
+
+        /**
+         * @brief Copy the next frame's wire bytes (without sequence trailer) into a caller buffer
+         * @return Number of bytes copied, 0 on timeout, or -1 on error or if the frame does not fit
+         */
+        std::ptrdiff_t receiveRaw(uint8_t *buffer, size_t maxSize) override;
+
+        bool isConnected() const override { return fd_ >= 0; }
+
+        void close() override;
+
+        /** @brief Set error callback function */
+        void setErrorCallback(ErrorCallback callback);
+
+        /** @brief Set callback invoked when a sequence gap is detected */
+        void setGapCallback(GapCallback callback);
+
+        /** @brief Get the group endpoint */
+        const std::string &getEndpoint() const { return endpoint_; }
+
+        /** @brief Counters since the socket was opened */
+        const Stats &stats() const noexcept { return stats_; }
+
+    private:
+        /** @brief Receive slot (one datagram) */
+        struct Slot
+        {
+            std::vector<uint8_t> data; ///< Datagram bytes (MAX_DATAGRAM_SIZE)
+            size_t size = 0;           ///< Received length
+            uint64_t source = 0;       ///< Sender address and port
+            bool truncated = false;    ///< Datagram did not fit
+        };
+
+        /** @brief Open the socket and resolve the group */
+        TransportError open(const std::string &endpoint, bool receiver);
+
+        /** @brief Receive queued datagrams into the slots, waiting up to timeoutMs for the first */
+        TransportError fill(int timeoutMs);
+
+        /** @brief Validate a slot and run gap detection */
+        bool accept(const Slot &slot, FrameView &view);
+
+        /** @brief Report the current errno through the error callback */
+        void handleError(const char *operation);
+
+        UDPConfig config_;                                ///< Transport configuration
+        std::string endpoint_;                            ///< Group endpoint
+        ErrorCallback errorCallback_;                     ///< Error notification callback
+        GapCallback gapCallback_;                         ///< Gap notification callback
+        int fd_;                                          ///< Socket descriptor (-1 when closed)
+        uint32_t groupAddress_;                           ///< Group IPv4 address (network byte order)
+        uint16_t groupPort_;                              ///< Group port (network byte order)
+        uint32_t interfaceAddress_;                       ///< Interface IPv4 address (network byte order)
+        bool joined_;                                     ///< Group membership held
+        uint32_t sequence_;                               ///< Next outgoing sequence number
+        std::unordered_map<uint64_t, uint32_t> expected_; ///< Next expected sequence per sender
+        std::vector<Slot> slots_;                         ///< Receive slots
+        size_t slotCount_;                                ///< Filled slots
+        size_t slotNext_;                                 ///< Next slot to deliver
+        Stats stats_;                                     ///< Counters
+    };
+
+} // namespace limp
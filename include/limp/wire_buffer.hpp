@@ -0,0 +1,105 @@
+#pragma once
+
+#include "frame.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace limp
+{
+
+    /**
+     * @brief Immutable, reference-counted serialized frame
+     *
+     * Holds wire-format bytes in a single allocation shared by all copies.
+     * Copying only bumps an atomic reference count, so one serialized frame
+     * can be fanned out to many peers without re-serializing or copying the
+     * bytes. Transports hand the buffer to ZeroMQ zero-copy via retain() and
+     * release(), which match the zmq_free_fn signature.
+     *
+     * @code
+     * WireBuffer wire = WireBuffer::serialize(event);
+     * for (const PeerId &peer : subscribers) {
+     *     router.send(peer, wire);   // No copy, no serialization per peer
+     * }
+     * @endcode
+     *
+     * Thread safety: the reference count is atomic; distinct WireBuffer
+     * objects sharing bytes may be used from different threads.
+     */
+    class WireBuffer
+    {
+    public:
+        /** @brief Construct empty buffer */
+        WireBuffer() noexcept : block_(nullptr) {}
+
+        /**
+         * @brief Serialize a frame into a new buffer
+         * @param frame Frame to serialize
+         * @return Buffer with the wire bytes, or an empty buffer if the frame is invalid
+         */
+        static WireBuffer serialize(const Frame &frame);
+
+        /**
+         * @brief Copy raw bytes into a new buffer
+         * @param data Bytes to copy
+         * @param size Number of bytes
+         */
+        static WireBuffer copyOf(const uint8_t *data, size_t size);
+
+        WireBuffer(const WireBuffer &other) noexcept;
+        WireBuffer(WireBuffer &&other) noexcept : block_(other.block_) { other.block_ = nullptr; }
+        WireBuffer &operator=(const WireBuffer &other) noexcept;
+        WireBuffer &operator=(WireBuffer &&other) noexcept;
+        ~WireBuffer();
+
+        /** @brief Pointer to the wire bytes (nullptr if empty) */
+        const uint8_t *data() const noexcept;
+
+        /** @brief Number of wire bytes */
+        size_t size() const noexcept;
+
+        /** @brief Check if buffer holds no bytes */
+        bool empty() const noexcept { return size() == 0; }
+
+        /** @brief Check if buffer holds an allocation */
+        explicit operator bool() const noexcept { return block_ != nullptr; }
+
+        /** @brief Number of owners sharing the bytes (0 if empty) */
+        size_t useCount() const noexcept;
+
+        /**
+         * @brief Take an extra reference for an external owner
+         *
+         * Pass the result as the hint of a free-function message; the owner
+         * gives it back with release().
+         *
+         * @return Opaque handle for release() (nullptr if empty)
+         */
+        void *retain() const noexcept;
+
+        /**
+         * @brief Drop a reference taken by retain()
+         *
+         * Signature matches zmq_free_fn; may be called from any thread.
+         *
+         * @param data Ignored (the wire bytes)
+         * @param hint Handle returned by retain()
+         */
+        static void release(void *data, void *hint) noexcept;
+
+    private:
+        struct Block
+        {
+            std::atomic<size_t> refs;
+            size_t size;
+        };
+
+        static Block *allocate(size_t size);
+        static uint8_t *bytes(Block *block) noexcept { return reinterpret_cast<uint8_t *>(block + 1); }
+        static void unref(Block *block) noexcept;
+
+        Block *block_;
+    };
+
+} // namespace limp
@@ -9,6 +9,9 @@
  */
 
 #include "zmq_config.hpp"
+#include "zmq_context.hpp"
+#include "zmq_peer.hpp"
+#include "zmq_routing_table.hpp"
 #include "zmq_transport_base.hpp"
 #include "zmq_client.hpp"
 #include "zmq_server.hpp"
@@ -17,3 +20,12 @@
 #include "zmq_router.hpp"
 #include "zmq_dealer.hpp"
 #include "zmq_proxy.hpp"
+#include "zmq_proxy_cluster.hpp"
+#include "zmq_broker.hpp"
+#include "zmq_reactor.hpp"
+#include "zmq_concurrent_sender.hpp"
+#include "zmq_deadband_publisher.hpp"
+#include "zmq_flow_control.hpp"
+#include "zmq_transactional_client.hpp"
+#include "zmq_transactional_dealer.hpp"
+#include "zmq_transactional_router.hpp"
@@ -0,0 +1,235 @@
+#pragma once
+
+#include "zmq_config.hpp"
+#include "zmq_peer.hpp"
+#include "../error_event.hpp"
+#include "../frame_view.hpp"
+#include "../transport.hpp"
+#include <zmq.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace limp
+{
+
+    /**
+     * @brief Multi-threaded message broker with a ROUTER frontend
+     *
+     * Splits identity-based routing across worker threads so routing
+     * throughput scales with cores:
+     *
+     *   Nodes (DEALER) → ROUTER (I/O thread) → inproc PAIR → Worker 0..N-1
+     *   Worker → inproc PAIR → ROUTER (I/O thread) → Nodes (DEALER)
+     *
+     * The I/O thread only moves zmq messages between sockets. Each worker
+     * validates the frame, calls the routing Handler and sends whatever
+     * the handler emits back through the I/O thread. Messages are assigned
+     * to workers by a hash of the source identity, so every message from a
+     * given peer is handled by the same worker and per-peer order is kept.
+     *
+     * Clients use the same framing as with ZMQRouter: dealer.send(frame)
+     * arrives with an empty destination, dealer.send(destination, frame)
+     * with the destination identity.
+     *
+     * @code
+     * ZMQBroker broker(config, 4);
+     * broker.setFrontend("tcp://0.0.0.0:5555");
+     * broker.setHandler([&](const PeerId &source, const PeerId &destination,
+     *                       const FrameView &frame, ZMQBroker::Output &out) {
+     *     out.forward(destination.empty() ? routeFor(frame) : destination, source);
+     * });
+     * broker.start();
+     * @endcode
+     *
+     * The handler runs concurrently on all workers and must be thread-safe.
+     */
+    class ZMQBroker
+    {
+    public:
+        /**
+         * @brief Emits messages from a handler call
+         *
+         * Valid only for the duration of the handler call, on its worker.
+         */
+        class Output
+        {
+        public:
+            /**
+             * @brief Send a frame to a peer
+             *
+             * Dealer receives [delimiter][data] (receive(frame)).
+             */
+            void send(const PeerId &destination, const Frame &frame);
+
+            /**
+             * @brief Send a frame to a peer with source identity
+             *
+             * Dealer receives [source][delimiter][data] (receive(sourceIdentity, frame)).
+             */
+            void send(const PeerId &destination, const PeerId &source, const Frame &frame);
+
+            /**
+             * @brief Forward the received frame bytes unchanged
+             *
+             * Shares the received message instead of re-serializing it.
+             */
+            void forward(const PeerId &destination);
+
+            /** @brief Forward the received frame bytes with source identity */
+            void forward(const PeerId &destination, const PeerId &source);
+
+            /** @brief Index of the worker running the handler */
+            size_t worker() const noexcept { return worker_; }
+
+        private:
+            friend class ZMQBroker;
+
+            Output(ZMQBroker &broker, zmq::socket_t &socket, zmq::message_t &data, size_t worker) noexcept
+                : broker_(broker), socket_(socket), data_(data), worker_(worker)
+            {
+            }
+
+            void emit(const PeerId &destination, const PeerId *source, zmq::message_t &&data);
+
+            ZMQBroker &broker_;
+            zmq::socket_t &socket_;
+            zmq::message_t &data_;
+            size_t worker_;
+        };
+
+        /**
+         * @brief Routing function run on a worker for every valid frame
+         *
+         * @param source Sender identity
+         * @param destination Requested destination (empty if the sender used send(frame))
+         * @param frame Received frame (valid during the call)
+         * @param output Emits zero or more messages
+         */
+        using Handler = std::function<void(const PeerId &source, const PeerId &destination,
+                                           const FrameView &frame, Output &output)>;
+
+        /** @brief Message counters */
+        struct Stats
+        {
+            uint64_t received = 0; ///< Messages accepted by the frontend
+            uint64_t routed = 0;   ///< Messages emitted by handlers
+            uint64_t dropped = 0;  ///< Malformed messages discarded by workers
+        };
+
+        /**
+         * @brief Construct broker
+         *
+         * @param config Configuration for the frontend socket and context
+         * @param workers Number of routing threads (at least 1)
+         */
+        explicit ZMQBroker(const ZMQConfig &config = ZMQConfig(),
+                           size_t workers = std::thread::hardware_concurrency());
+
+        /** @brief Destructor (stops the broker) */
+        ~ZMQBroker();
+
+        ZMQBroker(const ZMQBroker &) = delete;
+        ZMQBroker &operator=(const ZMQBroker &) = delete;
+
+        /**
+         * @brief Set frontend endpoint (before start())
+         *
+         * @param endpoint Endpoint address (e.g., "tcp://0.0.0.0:5555")
+         * @param bind If true, binds to endpoint; if false, connects to endpoint
+         * @return TransportError::None on success, ConfigurationError if running
+         */
+        TransportError setFrontend(const std::string &endpoint, bool bind = true);
+
+        /**
+         * @brief Set routing function (before start())
+         * @return TransportError::None on success, ConfigurationError if running
+         */
+        TransportError setHandler(Handler handler);
+
+        /**
+         * @brief Set error callback function
+         *
+         * Receives formatted, rate-limited messages (see ErrorReporter).
+         * Errors are written to stderr when no callback is set.
+         *
+         * @param callback Function to call on errors (may run on any broker thread, one call at a time)
+         */
+        void setErrorCallback(std::function<void(const std::string &)> callback);
+
+        /**
+         * @brief Set structured error callback function
+         *
+         * Receives every error as an ErrorEvent, without formatting or rate
+         * limiting. Set before start().
+         *
+         * @param callback Function to call on errors (may run on any broker thread, one call at a time)
+         */
+        void setErrorEventCallback(ErrorEventCallback callback);
+
+        /**
+         * @brief Start the I/O and worker threads
+         *
+         * The frontend is bound (or connected) before the threads start, so
+         * endpoint errors are reported here rather than on the I/O thread.
+         *
+         * @return TransportError::None if started, ConfigurationError if running
+         *         or no handler is set, InvalidEndpoint if no frontend is set,
+         *         BindFailed/ConnectionFailed if the frontend could not be set up
+         */
+        TransportError start();
+
+        /** @brief Stop and join all threads (blocking) */
+        void stop();
+
+        /** @brief Check if broker threads are active */
+        bool isRunning() const { return running_.load(); }
+
+        /** @brief Number of worker threads */
+        size_t workerCount() const noexcept { return workerCount_; }
+
+        /** @brief Message counters */
+        Stats getStats() const noexcept;
+
+        /** @brief Get frontend endpoint */
+        const std::string &getFrontendEndpoint() const { return frontendEndpoint_; }
+
+    private:
+        /** @brief Maximum messages moved per socket per poll */
+        static constexpr size_t IO_BATCH = 64;
+
+        /** @brief How often threads check the stop flag while idle (ms) */
+        static constexpr int POLL_INTERVAL_MS = 100;
+
+        void ioThread(zmq::socket_t frontend, std::vector<zmq::socket_t> pipes);
+        void workerThread(size_t index);
+        void handleError(const zmq::error_t &e, TransportOperation operation, const char *context);
+        void handleError(TransportError error, TransportOperation operation, const char *context,
+                         const char *reason);
+        std::string workerEndpoint(size_t index) const;
+
+        ZMQConfig config_;                                       ///< Socket configuration
+        std::shared_ptr<zmq::context_t> context_;                ///< ZeroMQ context (possibly shared)
+        size_t workerCount_;                                     ///< Number of worker threads
+        std::unique_ptr<std::thread> ioThread_;                  ///< Frontend I/O thread
+        std::vector<std::thread> workers_;                       ///< Routing threads
+        std::atomic<bool> running_;                              ///< Running flag
+        std::atomic<bool> stopRequested_;                        ///< Stop request flag
+        std::string frontendEndpoint_;                           ///< Frontend endpoint
+        bool frontendBind_;                                      ///< Bind (true) or connect (false) frontend
+        Handler handler_;                                        ///< Routing function
+        ErrorReporter errors_;                                   ///< Error callbacks and rate limit
+        std::mutex errorMutex_;                                  ///< Serializes errors_ across broker threads
+        std::string workerPrefix_;                               ///< inproc endpoint prefix for workers
+        std::atomic<uint64_t> received_;                         ///< Messages accepted
+        std::atomic<uint64_t> routed_;                           ///< Messages emitted
+        std::atomic<uint64_t> dropped_;                          ///< Malformed messages
+    };
+
+} // namespace limp
@@ -0,0 +1,245 @@
+#pragma once
+
+#include "../error_event.hpp"
+#include "../frame.hpp"
+#include "../span.hpp"
+#include "../transport.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace limp
+{
+
+    class ZMQDealer;
+    class ZMQPublisher;
+
+    /**
+     * @brief Thread-safe send facade over a single-threaded socket
+     *
+     * ZeroMQ sockets must only be used from one thread. Instead of a mutex
+     * around every send, each producer thread gets its own bounded
+     * SPSCQueue (a lane) on its first send(). One internal I/O thread owns
+     * the socket, drains the lanes round-robin and writes up to batchSize
+     * frames per sendBatch() call.
+     *
+     *   Producer 0..N-1 → lane (lock-free) → I/O thread → dealer.sendBatch()
+     *
+     * Backpressure: when the peer stops reading, ZeroMQ queues up to the
+     * socket's send high-water mark and then blocks the I/O thread (for the
+     * socket send timeout). Meanwhile the lanes fill up and send() waits up
+     * to Options::sendTimeout for space (asleep, woken by the I/O thread as
+     * it drains), then returns TransportError::Timeout. Frames the socket
+     * refuses (EAGAIN: high-water mark or send timeout) are retried, not
+     * dropped; frames failing for any other reason (e.g. ETERM, ENOTSOCK)
+     * are dropped and reported.
+     *
+     * Order is kept per producer thread, not across threads. send() does
+     * not take a lock unless the I/O thread is asleep and has to be woken.
+     * A lane is handed to a new thread once its owner exits.
+     *
+     * @code
+     * ZMQDealer dealer;
+     * dealer.connect("tcp://127.0.0.1:5555");
+     *
+     * ConcurrentSender sender(dealer);
+     * sender.start();
+     * // any thread
+     * sender.send(MessageBuilder::event(...).build());
+     * // shutdown
+     * sender.stop(); // sends what is queued, then joins
+     * @endcode
+     *
+     * The transport must not be used directly while the sender is running.
+     */
+    class ConcurrentSender
+    {
+    public:
+        /**
+         * @brief Downstream write of a batch, called on the I/O thread only
+         *
+         * A refusal to be retried is reported as Timeout, or as SendFailed
+         * with zmq_errno() left at EAGAIN (as the ZeroMQ transports do). Any
+         * other error drops the frame it failed on.
+         *
+         * @param frames Frames to send in order
+         * @param sent Output: number of frames sent before any failure
+         * @return TransportError::None if all frames were sent, error code otherwise
+         */
+        using BatchSink = std::function<TransportError(Span<const Frame> frames, size_t &sent)>;
+
+        /** @brief Lane and batching options */
+        struct Options
+        {
+            size_t laneCapacity = 1024; ///< Frames buffered per producer thread (rounded up to a power of two)
+            size_t batchSize = 64;      ///< Maximum frames per sendBatch() call
+            size_t maxProducers = 64;   ///< Maximum number of producer threads alive at once
+            int sendTimeout = 1000;     ///< Wait for lane space in milliseconds (0: fail at once, -1: infinite)
+            int retryInterval = 1;      ///< Pause before resending frames the socket refused (ms)
+        };
+
+        /** @brief Frame counters */
+        struct Stats
+        {
+            uint64_t sent = 0;     ///< Frames written to the transport
+            uint64_t rejected = 0; ///< send() calls that timed out on a full lane
+            uint64_t retried = 0;  ///< Batches the transport refused and that were resent
+            uint64_t dropped = 0;  ///< Frames discarded after a non-retryable error
+        };
+
+        /**
+         * @brief Send through a dealer (sendBatch without routing)
+         * @param dealer Connected dealer, owned by the caller and outliving the sender
+         */
+        explicit ConcurrentSender(ZMQDealer &dealer) : ConcurrentSender(dealer, Options()) {}
+        ConcurrentSender(ZMQDealer &dealer, const Options &options);
+
+        /**
+         * @brief Publish through a publisher (each frame under its attribute topic)
+         * @param publisher Bound publisher, owned by the caller and outliving the sender
+         */
+        explicit ConcurrentSender(ZMQPublisher &publisher) : ConcurrentSender(publisher, Options()) {}
+        ConcurrentSender(ZMQPublisher &publisher, const Options &options);
+
+        /**
+         * @brief Send through any batch writer (e.g. a router with a fixed destination)
+         * @param sink Called on the I/O thread with each batch
+         */
+        explicit ConcurrentSender(BatchSink sink) : ConcurrentSender(std::move(sink), Options()) {}
+        ConcurrentSender(BatchSink sink, const Options &options);
+
+        /** @brief Destructor (stops the I/O thread) */
+        ~ConcurrentSender();
+
+        ConcurrentSender(const ConcurrentSender &) = delete;
+        ConcurrentSender &operator=(const ConcurrentSender &) = delete;
+
+        /**
+         * @brief Start the I/O thread
+         * @return TransportError::None if started, ConfigurationError if already running
+         */
+        TransportError start();
+
+        /**
+         * @brief Stop the I/O thread (blocking)
+         *
+         * Frames queued before the call, or by send() calls already under
+         * way, are still sent; if the transport refuses one of them, the
+         * remaining frames are dropped.
+         */
+        void stop();
+
+        /**
+         * @brief Queue a copy of a frame (any thread)
+         *
+         * @param frame Frame to send
+         * @return TransportError::None if queued, InvalidFrame if it fails validation,
+         *         NotConnected if the sender is not running (or stops while the lane
+         *         is full), Timeout if the lane stayed full for Options::sendTimeout,
+         *         ConfigurationError if maxProducers threads already hold a lane
+         */
+        TransportError send(const Frame &frame);
+
+        /**
+         * @brief Queue a frame without copying its payload (any thread)
+         *
+         * frame is moved from only if TransportError::None is returned.
+         *
+         * @see send(const Frame &)
+         */
+        TransportError send(Frame &&frame);
+
+        /**
+         * @brief Wait until everything queued so far has been handed to the transport
+         * @param timeoutMs Maximum wait in milliseconds (-1 for infinite)
+         * @return true if the lanes drained in time
+         */
+        bool flush(int timeoutMs = -1);
+
+        /**
+         * @brief Set error callback function
+         *
+         * Receives descriptions of dropped frames and refused calls,
+         * rate-limited as described for ErrorReporter. Errors are written to
+         * stderr when no callback is set.
+         *
+         * @param callback Function to call on errors (runs on the I/O thread or a
+         *                 producer thread; set before start())
+         */
+        void setErrorCallback(ErrorCallback callback);
+
+        /**
+         * @brief Set structured error callback
+         *
+         * Receives every error as an ErrorEvent, without formatting or rate
+         * limiting.
+         *
+         * @param callback Function to call on errors (same threads as setErrorCallback())
+         */
+        void setErrorEventCallback(ErrorEventCallback callback);
+
+        /** @brief Check if the I/O thread is active */
+        bool isRunning() const { return running_.load(); }
+
+        /** @brief Frame counters */
+        Stats getStats() const noexcept;
+
+    private:
+        struct Lane;
+        struct LaneCache;
+
+        /** @brief How long the idle I/O thread sleeps between stop checks (ms) */
+        static constexpr int POLL_INTERVAL_MS = 100;
+
+        /** @brief Lane of the calling thread (claimed on first use), or null if none is free */
+        Lane *localLane();
+        TransportError waitForSpace(Lane &lane, Frame &frame);
+        void ioThread();
+        void deliver(Frame *frames, size_t count);
+        void wake();
+
+        /**
+         * @brief Report an error (any thread)
+         *
+         * @param error Error code returned to the caller or that dropped frames
+         * @param operation Kind of operation that failed
+         * @param errnum errno / zmq_errno() value (0 if none)
+         * @param context Operation name (string literal)
+         * @param reason Failure description (string literal)
+         */
+        void handleError(TransportError error, TransportOperation operation, int errnum, const char *context,
+                         const char *reason);
+
+        uint64_t id_;                              ///< Unique sender id (keys the thread-local lane cache)
+        BatchSink sink_;                           ///< Downstream writer
+        Options options_;                          ///< Lane and batching options
+        std::vector<std::shared_ptr<Lane>> lanes_; ///< maxProducers slots, [0, laneCount_) in use
+        std::atomic<size_t> laneCount_;            ///< Number of created lanes
+        std::mutex laneMutex_;                     ///< Serializes lane creation and claiming
+        std::unique_ptr<std::thread> ioThread_;    ///< Drains the lanes
+        std::atomic<bool> running_;                ///< Running flag
+        std::atomic<bool> stopRequested_;          ///< Stop request flag
+        std::atomic<bool> draining_;               ///< I/O thread holds popped, unsent frames
+        std::atomic<bool> sleeping_;               ///< I/O thread is waiting on wakeup_
+        std::atomic<size_t> sendsInFlight_;        ///< send() calls between the running check and the push
+        std::atomic<size_t> spaceWaiters_;         ///< Producers waiting on spaceAvailable_
+        std::mutex spaceMutex_;                    ///< Pairs with spaceAvailable_
+        std::condition_variable spaceAvailable_;   ///< Signals lane space to producers
+        bool wakeRequested_;                       ///< Guarded by wakeMutex_
+        std::mutex wakeMutex_;                     ///< Pairs with wakeup_
+        std::condition_variable wakeup_;           ///< Wakes the idle I/O thread
+        bool discard_;                             ///< Stopping after a failure: drop the rest (I/O thread)
+        ErrorReporter errors_;                     ///< Error callbacks and rate limit
+        std::mutex errorMutex_;                    ///< Serializes errors_ across threads
+        std::atomic<uint64_t> sent_;               ///< Frames written
+        std::atomic<uint64_t> retried_;            ///< Refused batches resent
+        std::atomic<uint64_t> dropped_;            ///< Frames discarded
+    };
+
+} // namespace limp
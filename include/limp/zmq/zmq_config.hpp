@@ -1,7 +1,15 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <string>
+#include <vector>
+
+namespace zmq
+{
+    class context_t;
+}
 
 namespace limp
 {
@@ -22,7 +30,62 @@ namespace limp
         int reconnectInterval = 100;  ///< Reconnection interval in milliseconds
         int reconnectIntervalMax = 0; ///< Maximum reconnection interval (0 for default)
         bool immediate = true;        ///< Queue messages only to completed connections
-        int ioThreads = 1;            ///< Number of I/O threads in ZMQ context
+
+        /**
+         * @name Queueing
+         * High-water marks bound the messages ZeroMQ queues per peer; beyond
+         * them sends block (up to sendTimeout) or, for PUB, drop.
+         * @{
+         */
+        int sendHighWaterMark = -1;    ///< Outgoing queue limit in messages (0: unlimited, -1: ZeroMQ default of 1000)
+        int receiveHighWaterMark = -1; ///< Incoming queue limit in messages (0: unlimited, -1: ZeroMQ default of 1000)
+
+        /**
+         * @brief Keep only the newest message in each queue (ZMQ_CONFLATE)
+         *
+         * Last-value semantics for state that is polled. Only for sockets
+         * exchanging single-part messages: not for topic publishers or
+         * router/dealer traffic, which is multipart.
+         */
+        bool conflate = false;
+        /** @} */
+
+        /**
+         * @name TCP keep-alive
+         * Detects dead peers behind NAT or firewalls; -1 keeps the OS default.
+         * @{
+         */
+        int tcpKeepAlive = -1;         ///< 1: on, 0: off, -1: OS default
+        int tcpKeepAliveIdle = -1;     ///< Idle seconds before the first probe
+        int tcpKeepAliveCount = -1;    ///< Unanswered probes before the connection is dropped
+        int tcpKeepAliveInterval = -1; ///< Seconds between probes
+        /** @} */
+
+        /**
+         * @name I/O threads
+         * Context settings apply when a context is created from this
+         * configuration (private contexts, or the first user of the shared
+         * one); a caller-provided context is used as it is.
+         * @{
+         */
+        int ioThreads = 1;                 ///< Number of I/O threads in ZMQ context
+        uint64_t affinity = 0;             ///< Bitmask of I/O threads serving this socket's connections (0: any)
+        int ioThreadPriority = -1;         ///< OS scheduling priority of the I/O threads (-1: default)
+        int ioThreadSchedulingPolicy = -1; ///< OS scheduling policy of the I/O threads, e.g. SCHED_FIFO (-1: default)
+        std::vector<int> ioThreadCpus;     ///< CPUs to pin the I/O threads to (empty: no pinning)
+        bool zeroCopyReceive = true;       ///< Receive large messages without copying (draft libzmq option)
+        /** @} */
+
+        /**
+         * @brief Context to create sockets in (null: see useSharedContext)
+         *
+         * Transports and proxies given the same context share its I/O threads
+         * and can talk over inproc:// endpoints.
+         */
+        std::shared_ptr<zmq::context_t> context;
+
+        /** @brief Use the process-wide ZMQContextRegistry::shared() context when context is null */
+        bool useSharedContext = false;
     };
 
 } // namespace limp
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "zmq_config.hpp"
+#include <zmq.hpp>
+#include <memory>
+
+namespace limp
+{
+
+    /**
+     * @brief Source of ZeroMQ contexts for transports and proxies
+     *
+     * By default every transport owns a private context (its own I/O
+     * threads). Setting ZMQConfig::context, or ZMQConfig::useSharedContext,
+     * makes components share one context instead, which reduces thread count
+     * and startup cost and allows inproc:// pipelines between them.
+     *
+     * @code
+     * ZMQConfig config;
+     * config.useSharedContext = true;
+     *
+     * ZMQPublisher publisher(config);
+     * publisher.bind("inproc://telemetry");
+     *
+     * ZMQSubscriber subscriber(config);      // Same context: inproc works
+     * subscriber.connect("inproc://telemetry");
+     * @endcode
+     *
+     * Thread safety: all methods are thread-safe.
+     */
+    class ZMQContextRegistry
+    {
+    public:
+        /**
+         * @brief Get the process-wide shared context
+         *
+         * Created on first use and kept alive as long as any component holds
+         * it; a later call after all users are gone creates a fresh one.
+         *
+         * @param ioThreads I/O thread count used only when the context is created
+         * @return Shared context
+         * @throws zmq::error_t if context creation fails
+         */
+        static std::shared_ptr<zmq::context_t> shared(int ioThreads = 1);
+
+        /**
+         * @brief Get the process-wide shared context, creating it from a configuration
+         *
+         * The I/O thread settings of the configuration only take effect if
+         * this call creates the context.
+         *
+         * @param config Configuration (ioThreads and the I/O thread settings)
+         * @return Shared context
+         * @throws zmq::error_t if context creation fails
+         */
+        static std::shared_ptr<zmq::context_t> shared(const ZMQConfig &config);
+
+        /**
+         * @brief Create a private context with the I/O thread settings of a configuration
+         *
+         * Applies ioThreads, ioThreadPriority, ioThreadSchedulingPolicy,
+         * ioThreadCpus and zeroCopyReceive. Options the linked libzmq does
+         * not know are skipped.
+         *
+         * @param config Configuration
+         * @return New context
+         * @throws zmq::error_t if context creation fails or an option is rejected
+         */
+        static std::shared_ptr<zmq::context_t> create(const ZMQConfig &config);
+
+        /**
+         * @brief Pick the context a component should use for a configuration
+         *
+         * Returns config.context if set, shared(config) if
+         * config.useSharedContext is true, and otherwise create(config).
+         *
+         * @param config Component configuration
+         * @return Context to create sockets in
+         * @throws zmq::error_t if context creation fails
+         */
+        static std::shared_ptr<zmq::context_t> resolve(const ZMQConfig &config);
+    };
+
+    /**
+     * @brief Apply the socket options of a configuration
+     *
+     * Used for every socket LIMP creates (transports, proxy, broker), so a
+     * configuration means the same everywhere: timeouts, linger, buffer
+     * sizes, reconnect, immediate, high-water marks, conflate, I/O thread
+     * affinity and TCP keep-alive. Call before bind() or connect().
+     *
+     * @param socket Socket to configure
+     * @param config Configuration
+     * @throws zmq::error_t if an option is rejected
+     */
+    void configureSocket(zmq::socket_t &socket, const ZMQConfig &config);
+
+} // namespace limp
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "../deadband.hpp"
+#include "../span.hpp"
+#include "../topic.hpp"
+#include "../transport.hpp"
+#include <cstddef>
+#include <string>
+
+namespace limp
+{
+
+    class ZMQPublisher;
+
+    /**
+     * @brief Publisher front end that drops telemetry that has not changed
+     *
+     * Runs every EVENT frame through a DeadbandFilter before handing it to
+     * a ZMQPublisher: values within the deadband of what subscribers last
+     * received are not published, and each attribute is republished after
+     * Options::refreshInterval even if unchanged. A suppressed publish
+     * returns TransportError::None. A frame that fails to send is forgotten
+     * by the filter, so the next value of that attribute goes out.
+     *
+     * Not thread-safe (like the publisher it wraps).
+     *
+     * @code
+     * DeadbandPublisher::Options options;
+     * options.absolute = 0.1;
+     * DeadbandPublisher telemetry(publisher, options);
+     * for (;;) {                       // Every PLC scan
+     *     telemetry.publish(readTag());
+     * }
+     * @endcode
+     */
+    class DeadbandPublisher
+    {
+    public:
+        using Options = DeadbandFilter::Options;
+
+        /**
+         * @brief Wrap a publisher
+         * @param publisher Bound publisher, owned by the caller and outliving this object
+         */
+        explicit DeadbandPublisher(ZMQPublisher &publisher) : DeadbandPublisher(publisher, Options()) {}
+        DeadbandPublisher(ZMQPublisher &publisher, const Options &options);
+
+        /** @brief Publish under the frame's binary topic unless suppressed */
+        TransportError publish(const Frame &frame);
+
+        /** @brief Publish under a binary topic unless suppressed */
+        TransportError publish(const Topic &topic, const Frame &frame);
+
+        /** @brief Publish under a string topic unless suppressed */
+        TransportError publish(const std::string &topic, const Frame &frame);
+
+        /**
+         * @brief Publish the frames that pass the filter, each under its own binary topic
+         *
+         * Passing frames are handed to ZMQPublisher::publishBatch() in
+         * contiguous runs, without copying.
+         *
+         * @param frames Frames to consider
+         * @param handled Output: frames published or suppressed before any failure
+         * @return TransportError::None if every passing frame was published, error code otherwise
+         */
+        TransportError publishBatch(Span<const Frame> frames, size_t &handled);
+
+        /** @brief Filter, e.g. for per-attribute deadbands (setDeadband()) */
+        DeadbandFilter &filter() noexcept { return filter_; }
+
+        /** @brief Decision counters */
+        const DeadbandFilter::Stats &getStats() const noexcept { return filter_.getStats(); }
+
+    private:
+        template <typename Send>
+        TransportError publishIfChanged(const Frame &frame, Send &&send);
+
+        ZMQPublisher &publisher_;
+        DeadbandFilter filter_;
+    };
+
+} // namespace limp
@@ -112,6 +112,17 @@ namespace limp
          */
         TransportError send(const Frame &frame) override;
 
+        /**
+         * @brief Send a LIMP frame, adopting its payload allocation
+         *
+         * Large heap payloads are serialized in place and handed to ZeroMQ
+         * without a copy (see serializeToMessage(Frame &&, zmq::message_t &)).
+         *
+         * @param frame Frame to send (left moved-from)
+         * @return TransportError::None on success, specific error code on failure
+         */
+        TransportError send(Frame &&frame);
+
         /**
          * @brief Send a LIMP frame with explicit destination routing
          *
@@ -127,6 +138,12 @@ namespace limp
          */
         TransportError send(const std::string &destinationIdentity, const Frame &frame);
 
+        /**
+         * @brief Send a LIMP frame with destination routing, adopting its payload allocation
+         * @see send(Frame &&)
+         */
+        TransportError send(const std::string &destinationIdentity, Frame &&frame);
+
         /**
          * @brief Receive a LIMP frame without source identity
          *
@@ -137,7 +154,7 @@ namespace limp
          * Pair with: router.send(clientIdentity, frame)
          *
          * @param frame Output frame
-         * @param timeoutMs Timeout in milliseconds (currently unused, uses socket config timeout)
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=socket receive timeout)
          * @return TransportError::None on success, TransportError::Timeout on timeout,
          *         other error code on failure
          */
@@ -154,12 +171,100 @@ namespace limp
          *
          * @param sourceIdentity Output: sender's identity from router
          * @param frame Output frame
-         * @param timeoutMs Timeout in milliseconds (currently unused, uses socket config timeout)
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=socket receive timeout)
          * @return TransportError::None on success, TransportError::Timeout on timeout,
          *         other error code on failure
          */
         TransportError receive(std::string &sourceIdentity, Frame &frame, int timeoutMs = -1);
 
+        /**
+         * @brief Receive a LIMP frame without copying it
+         *
+         * Zero-copy counterpart of receive(frame). The view references a
+         * transport-owned message and is valid until the next receive call.
+         *
+         * Pair with: router.send(clientIdentity, frame)
+         *
+         * @param view Output view of the received frame
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=socket receive timeout)
+         * @return TransportError::None on success, TransportError::Timeout on timeout,
+         *         other error code on failure
+         */
+        TransportError receiveView(FrameView &view, int timeoutMs = -1) override;
+
+        /**
+         * @brief Receive a LIMP frame with source identity without copying it
+         *
+         * Zero-copy counterpart of receive(sourceIdentity, frame). Both the
+         * identity and the view reference transport-owned messages and are
+         * valid until the next receive call.
+         *
+         * Pair with: router.send(clientIdentity, sourceIdentity, frame)
+         *
+         * @param sourceIdentity Output: sender's identity bytes
+         * @param view Output view of the received frame
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=socket receive timeout)
+         * @return TransportError::None on success, TransportError::Timeout on timeout,
+         *         other error code on failure
+         */
+        TransportError receiveView(ByteSpan &sourceIdentity, FrameView &view, int timeoutMs = -1);
+
+        /**
+         * @brief Receive a LIMP frame with or without source identity
+         *
+         * Accepts both [delimiter][data] and [source_identity][delimiter][data]
+         * messages, for dealers whose peers reply both directly and through a
+         * routing broker. sourceIdentity is empty for 2-part messages.
+         *
+         * @param sourceIdentity Output: sender's identity bytes (may be empty)
+         * @param view Output view of the received frame
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=socket receive timeout)
+         * @return TransportError::None on success, TransportError::Timeout on timeout,
+         *         other error code on failure
+         */
+        TransportError receiveAnyView(ByteSpan &sourceIdentity, FrameView &view, int timeoutMs = -1);
+
+        /**
+         * @brief Send many frames without routing in one call
+         *
+         * Each frame is sent as in send(frame). Frames are queued with
+         * ZMQ_DONTWAIT and only block (up to the send timeout) when the
+         * queue is full, amortizing per-call overhead over the batch.
+         *
+         * @param frames Frames to send
+         * @param sent Output: number of frames sent before any failure
+         * @return TransportError::None if all frames were sent, specific error code otherwise
+         */
+        TransportError sendBatch(Span<const Frame> frames, size_t &sent);
+
+        /**
+         * @brief Send many frames to one destination in one call
+         *
+         * Each frame is sent as in send(destinationIdentity, frame).
+         *
+         * @param destinationIdentity Target identity for routing
+         * @param frames Frames to send
+         * @param sent Output: number of frames sent before any failure
+         * @return TransportError::None if all frames were sent, specific error code otherwise
+         */
+        TransportError sendBatch(const std::string &destinationIdentity, Span<const Frame> frames, size_t &sent);
+
+        /**
+         * @brief Receive up to maxFrames queued frames in one call
+         *
+         * Waits for the first frame like receive(frame), then drains already
+         * queued frames without blocking. Elements already in frames are
+         * reused; frames is resized to the number received.
+         *
+         * @param frames Output frames
+         * @param maxFrames Maximum number of frames to receive (0=no limit, drain the queue)
+         * @param received Output: number of frames received, also when an error ends the batch
+         * @param timeoutMs Timeout for the first frame in milliseconds (0=non-blocking, -1=socket receive timeout)
+         * @return TransportError::None if the batch ended on an empty queue or maxFrames,
+         *         TransportError::Timeout if no frame arrived, other error code on failure
+         */
+        TransportError receiveBatch(std::vector<Frame> &frames, size_t maxFrames, size_t &received, int timeoutMs = -1);
+
         /**
          * @brief Get the current identity
          *
@@ -212,6 +317,16 @@ namespace limp
          */
         std::ptrdiff_t receiveRaw(uint8_t *buffer, size_t maxSize) override;
 
+        /**
+         * @brief Receive raw data without source identity, with a per-call timeout
+         *
+         * @param buffer Pointer to buffer to store received data
+         * @param maxSize Maximum size of the buffer
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=socket receive timeout)
+         * @return Number of bytes received, 0 on timeout, or -1 on error
+         */
+        std::ptrdiff_t receiveRaw(uint8_t *buffer, size_t maxSize, int timeoutMs);
+
         /**
          * @brief Receive raw data with source identity
          *
@@ -223,11 +338,13 @@ namespace limp
          * @param sourceIdentity Output: sender's identity
          * @param buffer Pointer to buffer to store received data
          * @param maxSize Maximum size of the buffer
-         * @return Number of bytes received, or -1 on error
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=socket receive timeout)
+         * @return Number of bytes received, 0 on timeout, or -1 on error
          */
         std::ptrdiff_t receiveRaw(std::string &sourceIdentity,
                                   uint8_t *buffer,
-                                  size_t maxSize);
+                                  size_t maxSize,
+                                  int timeoutMs = -1);
 
     private:
         std::string identity_; ///< Socket identity
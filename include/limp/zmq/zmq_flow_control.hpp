@@ -0,0 +1,179 @@
+#pragma once
+
+#include "../credit.hpp"
+#include "../frame.hpp"
+#include "../transport.hpp"
+#include "zmq_peer.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+
+namespace limp
+{
+
+    class ZMQDealer;
+    class ZMQRouter;
+
+    /**
+     * @brief Dealer side of credit-based flow control
+     *
+     * Sends each frame against one credit granted by the router (see
+     * CREDIT_CLASS_ID). Out of credit, frames are queued locally up to
+     * Options::queueCapacity; beyond that send() waits for a grant for up to
+     * Options::sendTimeout and then returns TransportError::Timeout. A
+     * producer is thus slowed down to the rate the router consumes at,
+     * instead of filling ZeroMQ's high-water mark and failing with
+     * SendFailed.
+     *
+     * Grants arrive on the same socket as replies: they are consumed by
+     * send() while it waits and by receive(), which returns everything else.
+     * Not thread-safe (like the dealer it wraps).
+     *
+     * @code
+     * ZMQDealer dealer;
+     * dealer.connect("tcp://127.0.0.1:5555");
+     * CreditDealer flow(dealer);
+     * flow.requestCredit();
+     * for (const Frame &sample : samples) {
+     *     flow.send(sample);            // Waits while the router is behind
+     * }
+     * @endcode
+     */
+    class CreditDealer
+    {
+    public:
+        /** @brief Local queueing and waiting */
+        struct Options
+        {
+            size_t queueCapacity = 0; ///< Frames queued while out of credit (0: send() waits instead)
+            int sendTimeout = 1000;   ///< Wait for credit in milliseconds once the queue is full (-1: infinite)
+            uint16_t srcNodeID = 0;   ///< Source node of credit requests
+        };
+
+        /**
+         * @brief Wrap a dealer
+         * @param dealer Connected dealer, owned by the caller and outliving this object
+         */
+        explicit CreditDealer(ZMQDealer &dealer) : CreditDealer(dealer, Options()) {}
+        CreditDealer(ZMQDealer &dealer, const Options &options);
+
+        /**
+         * @brief Ask the router for its window (after connect() or a reconnect)
+         *
+         * Drops the credit held so far. Frames queued before the grant
+         * arrives are sent then.
+         */
+        TransportError requestCredit();
+
+        /**
+         * @brief Send a frame, queueing or waiting while out of credit
+         * @return TransportError::None if sent or queued, TransportError::Timeout if no
+         *         credit arrived within Options::sendTimeout, other error code on failure
+         */
+        TransportError send(const Frame &frame);
+
+        /**
+         * @brief Receive the next frame that is not a credit grant
+         *
+         * Grants received meanwhile release queued frames.
+         */
+        TransportError receive(Frame &frame, int timeoutMs = -1);
+
+        /**
+         * @brief Wait until every queued frame has been sent
+         * @return TransportError::None once the queue is empty, TransportError::Timeout otherwise
+         */
+        TransportError flush(int timeoutMs);
+
+        /** @brief Frames that may be sent without waiting */
+        uint32_t credits() const noexcept { return credits_; }
+
+        /** @brief Frames waiting for credit */
+        size_t queued() const noexcept { return queue_.size(); }
+
+    private:
+        /** @brief Receive one message: apply a grant, or keep a reply for receive() */
+        TransportError pump(int timeoutMs);
+
+        /** @brief Send queued frames while credit lasts */
+        TransportError drainQueue();
+
+        /** @brief Send one frame against one credit */
+        TransportError sendNow(const Frame &frame);
+
+        ZMQDealer &dealer_;
+        Options options_;
+        uint32_t credits_;
+        std::deque<Frame> queue_; ///< Frames waiting for credit
+        std::deque<Frame> inbox_; ///< Replies received while waiting for credit
+    };
+
+    /**
+     * @brief Router side of credit-based flow control
+     *
+     * Answers credit requests with Options::window frames of credit per
+     * dealer and returns credit as the application consumes frames: the
+     * credit for a frame is given back on the next receive() call, when the
+     * application is done with it, in grants of Options::grantBatch. Each
+     * CreditDealer therefore has at most window frames queued in ZeroMQ and
+     * in the broker, however fast it produces.
+     *
+     * Dealers that never request credit are passed through untouched.
+     * Not thread-safe (like the router it wraps).
+     *
+     * @code
+     * ZMQRouter router;
+     * router.bind("tcp://0.0.0.0:5555");
+     * CreditRouter flow(router);
+     * PeerId source;
+     * Frame frame;
+     * while (flow.receive(source, frame, 1000) != TransportError::SocketClosed) {
+     *     process(source, frame);
+     * }
+     * @endcode
+     */
+    class CreditRouter
+    {
+    public:
+        /** @brief Window per dealer */
+        struct Options
+        {
+            uint32_t window = 64;    ///< Frames each dealer may have in flight
+            uint32_t grantBatch = 0; ///< Frames consumed before credit is returned (0: window / 4)
+            uint16_t srcNodeID = 0;  ///< Source node of grants
+        };
+
+        /**
+         * @brief Wrap a router
+         * @param router Bound router, owned by the caller and outliving this object
+         */
+        explicit CreditRouter(ZMQRouter &router) : CreditRouter(router, Options()) {}
+        CreditRouter(ZMQRouter &router, const Options &options);
+
+        /**
+         * @brief Receive the next application frame
+         *
+         * Returns the credit of the previous frame, answers credit requests
+         * and keeps waiting for a frame until the timeout.
+         */
+        TransportError receive(PeerId &sourceIdentity, Frame &frame, int timeoutMs = -1);
+
+        /** @brief Stop tracking a dealer (e.g. after it disconnected) */
+        void forget(const PeerId &identity);
+
+        /** @brief Number of flow-controlled dealers */
+        size_t peerCount() const noexcept { return consumed_.size(); }
+
+    private:
+        /** @brief Return the credit of the last delivered frame */
+        void returnCredit();
+
+        ZMQRouter &router_;
+        Options options_;
+        std::unordered_map<PeerId, uint32_t> consumed_; ///< Frames consumed since the last grant, per dealer
+        PeerId delivered_;                              ///< Source of the frame returned last
+        bool holdsCredit_;                              ///< delivered_ still owes its credit
+    };
+
+} // namespace limp
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "../span.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+
+namespace limp
+{
+
+    /**
+     * @brief Interned ZeroMQ peer identity
+     *
+     * Stores identity bytes inline (ZeroMQ identities are 1..255 bytes), so
+     * creating, copying and sending a PeerId never allocates. Build one per
+     * peer when it is first seen and keep it in routing tables; router sends
+     * taking a PeerId build the identity part straight from these bytes, and
+     * identities up to 33 bytes fit ZeroMQ's inline message storage.
+     *
+     * @code
+     * PeerId source;
+     * Frame frame;
+     * router.receive(source, frame);
+     * routes[frame.srcNodeID] = source;   // Interned once
+     * router.send(routes[dest], reply);   // No identity conversion per send
+     * @endcode
+     */
+    class PeerId
+    {
+    public:
+        /** @brief Maximum identity length accepted by ZeroMQ */
+        static constexpr size_t MAX_SIZE = 255;
+
+        /** @brief Construct empty identity */
+        PeerId() noexcept : size_(0) {}
+
+        /**
+         * @brief Construct from identity bytes
+         *
+         * Bytes beyond MAX_SIZE are ignored (ZeroMQ never produces them).
+         */
+        explicit PeerId(ByteSpan bytes) noexcept { assign(bytes.data(), bytes.size()); }
+
+        /** @brief Construct from identity string */
+        explicit PeerId(const std::string &identity) noexcept
+        {
+            assign(reinterpret_cast<const uint8_t *>(identity.data()), identity.size());
+        }
+
+        /** @brief Replace identity bytes */
+        void assign(const uint8_t *data, size_t size) noexcept
+        {
+            size_ = static_cast<uint8_t>(std::min(size, MAX_SIZE));
+            if (size_ > 0)
+            {
+                std::memcpy(data_, data, size_);
+            }
+        }
+
+        const uint8_t *data() const noexcept { return data_; }
+        size_t size() const noexcept { return size_; }
+        bool empty() const noexcept { return size_ == 0; }
+
+        /** @brief View of the identity bytes */
+        ByteSpan bytes() const noexcept { return ByteSpan(data_, size_); }
+
+        /** @brief Identity as string (allocates for long identities) */
+        std::string str() const { return std::string(reinterpret_cast<const char *>(data_), size_); }
+
+        friend bool operator==(const PeerId &a, const PeerId &b) noexcept
+        {
+            return a.size_ == b.size_ && std::memcmp(a.data_, b.data_, a.size_) == 0;
+        }
+        friend bool operator!=(const PeerId &a, const PeerId &b) noexcept { return !(a == b); }
+        friend bool operator<(const PeerId &a, const PeerId &b) noexcept
+        {
+            return std::lexicographical_compare(a.data_, a.data_ + a.size_, b.data_, b.data_ + b.size_);
+        }
+
+        /** @brief FNV-1a hash of the identity bytes */
+        size_t hash() const noexcept
+        {
+            uint64_t h = 14695981039346656037ull;
+            for (size_t i = 0; i < size_; ++i)
+            {
+                h = (h ^ data_[i]) * 1099511628211ull;
+            }
+            return static_cast<size_t>(h);
+        }
+
+    private:
+        uint8_t size_;
+        uint8_t data_[MAX_SIZE];
+    };
+
+} // namespace limp
+
+namespace std
+{
+    template <>
+    struct hash<limp::PeerId>
+    {
+        size_t operator()(const limp::PeerId &peer) const noexcept { return peer.hash(); }
+    };
+} // namespace std
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "zmq_config.hpp"
+#include "zmq_peer.hpp"
+#include "../error_event.hpp"
+#include "../frame_view.hpp"
 #include "../transport.hpp"
 #include <zmq.hpp>
 #include <memory>
@@ -8,6 +11,8 @@
 #include <thread>
 #include <atomic>
 #include <functional>
+#include <mutex>
+#include <unordered_map>
 
 namespace limp
 {
@@ -73,6 +78,27 @@ namespace limp
      * The proxy automatically forwards all messages between frontend and
      * backend sockets using ZeroMQ's built-in proxy functionality.
      *
+     * HEADER ROUTING (ROUTER-ROUTER only):
+     *
+     * When routes are added with addRoute()/addNodeRoute(), the ROUTER-ROUTER
+     * proxy runs a LIMP-aware loop instead: it reads only the 14-byte header
+     * of each frame, looks the destination identity up in the routing table
+     * and forwards the original message (no payload copy, no CRC check or
+     * recompute). Lookup order:
+     *
+     *   1. Exact (classID, instanceID) route
+     *   2. classID route (any instance)
+     *   3. srcNodeID route
+     *   4. Destination given by the sender (dealer.send(destination, frame))
+     *
+     * Frames matching nothing are dropped, as are frames whose destination
+     * queue is full (the loop never blocks on one slow node); both are
+     * counted in Stats. Receivers get the frame with the
+     * sender identity ([source][delimiter][data], i.e. receive(sourceIdentity,
+     * frame)). A destination is looked up on the opposite socket first, then
+     * on the socket the frame came from, so nodes on the same side reach
+     * each other as well.
+     *
      * Example usage:
      * @code
      * // Create a load balancer
@@ -101,6 +127,25 @@ namespace limp
             XPUB_XSUB      ///< Pub/Sub forwarder: XPUB frontend, XSUB backend
         };
 
+        /** @brief Traffic counters for one socket direction */
+        struct Counters
+        {
+            uint64_t messages = 0; ///< Message parts (each zmq_msg, as counted by libzmq)
+            uint64_t bytes = 0;    ///< Payload bytes of those parts
+        };
+
+        /** @brief Proxy traffic since start() */
+        struct Stats
+        {
+            Counters frontendReceived; ///< Received on the frontend socket
+            Counters frontendSent;     ///< Sent on the frontend socket
+            Counters backendReceived;  ///< Received on the backend socket
+            Counters backendSent;      ///< Sent on the backend socket
+            uint64_t dropped = 0;      ///< Header routing: frames dropped on a full destination queue
+            uint64_t unroutable = 0;   ///< Header routing: frames without a route or connected destination
+            uint64_t malformed = 0;    ///< Header routing: messages with a bad layout or a short header
+        };
+
         /**
          * @brief Construct a ZeroMQ proxy
          *
@@ -158,22 +203,79 @@ namespace limp
          */
         TransportError setCapture(const std::string &endpoint);
 
+        /**
+         * @brief Route frames of one object instance by header (ROUTER-ROUTER)
+         *
+         * Must be called before start(). Replaces an existing route for the key.
+         *
+         * @param classID Object class in the frame header
+         * @param instanceID Object instance in the frame header
+         * @param destinationIdentity Identity of the receiving node
+         * @return TransportError::None on success, ConfigurationError if running or not ROUTER-ROUTER
+         */
+        TransportError addRoute(uint16_t classID, uint16_t instanceID, const std::string &destinationIdentity);
+
+        /**
+         * @brief Route frames of every instance of a class by header (ROUTER-ROUTER)
+         * @see addRoute(uint16_t, uint16_t, const std::string &)
+         */
+        TransportError addRoute(uint16_t classID, const std::string &destinationIdentity);
+
+        /**
+         * @brief Route frames from a source node by header (ROUTER-ROUTER)
+         *
+         * Lowest-priority table route; e.g. all traffic of a PLC to its HMI.
+         *
+         * @see addRoute(uint16_t, uint16_t, const std::string &)
+         */
+        TransportError addNodeRoute(uint16_t srcNodeID, const std::string &destinationIdentity);
+
+        /**
+         * @brief Remove all header routes (before start())
+         * @return TransportError::None on success, ConfigurationError if running
+         */
+        TransportError clearRoutes();
+
+        /**
+         * @brief Check if the proxy routes by LIMP header
+         * @return true for ROUTER-ROUTER with at least one route
+         */
+        bool hasHeaderRouting() const;
+
         /**
          * @brief Set error callback function
          *
-         * Register a callback to be notified of proxy errors.
+         * Register a callback to be notified of proxy errors. Messages are
+         * rate-limited (see ErrorReporter) and written to stderr when no
+         * callback is set.
          *
-         * @param callback Function to call on errors
+         * @param callback Function to call on errors (may run on the proxy thread)
          */
         void setErrorCallback(std::function<void(const std::string &)> callback);
 
+        /**
+         * @brief Set structured error callback function
+         *
+         * Receives every error as an ErrorEvent, without formatting or rate
+         * limiting.
+         *
+         * @param callback Function to call on errors (may run on the proxy thread)
+         */
+        void setErrorEventCallback(ErrorEventCallback callback);
+
         /**
          * @brief Start the proxy
          *
-         * Starts the proxy in a background thread. The proxy will run
-         * until stop() is called or an error occurs.
+         * Creates and binds (or connects) the sockets on the calling thread,
+         * so a bad or busy endpoint fails here, then forwards on a background
+         * thread until stop() is called or an error occurs. The proxy is
+         * running when start() returns: pause(), resume() and stats() may be
+         * called right away. A proxy whose thread ended on an error is joined
+         * first, so start() may be called again.
          *
-         * @return TransportError::None if started successfully, specific error code if already running or config invalid
+         * @return TransportError::None if started, ConfigurationError if already running,
+         *         InvalidEndpoint if an endpoint is missing, BindFailed or ConnectionFailed
+         *         if an endpoint could not be bound or connected
          */
         TransportError start();
 
@@ -182,9 +284,49 @@ namespace limp
          *
          * Stops the proxy thread and cleans up resources. This is a
          * blocking call that waits for the thread to terminate.
+         *
+         * The proxy is stopped with TERMINATE on its inproc control socket
+         * rather than by shutting down the context, so a context shared with
+         * other transports (ZMQConfig::context or useSharedContext) is
+         * unaffected.
          */
         void stop();
 
+        /**
+         * @brief Suspend forwarding (PAUSE)
+         *
+         * Messages queue on the sockets (up to their high-water marks) and
+         * are forwarded after resume().
+         *
+         * @return TransportError::None on success, NotConnected if not running
+         */
+        TransportError pause();
+
+        /**
+         * @brief Continue forwarding after pause() (RESUME)
+         * @return TransportError::None on success, NotConnected if not running
+         */
+        TransportError resume();
+
+        /**
+         * @brief Check if forwarding is paused
+         */
+        bool isPaused() const { return paused_.load(); }
+
+        /**
+         * @brief Query live traffic counters (STATISTICS)
+         *
+         * Round trip through the proxy thread; safe to call from any thread
+         * while the proxy runs, including when paused. The drop counters are
+         * only maintained by header-routing proxies (zero otherwise).
+         *
+         * @param stats Output counters
+         * @param timeoutMs Maximum time to wait for the proxy thread's reply
+         * @return TransportError::None on success, NotConnected if not running,
+         *         Timeout if the proxy did not answer in time
+         */
+        TransportError stats(Stats &stats, int timeoutMs = 1000);
+
         /**
          * @brief Check if proxy is running
          *
@@ -210,17 +352,54 @@ namespace limp
         /**
          * @brief Proxy thread main function
          *
-         * Runs the ZeroMQ proxy loop in a separate thread.
+         * Runs the ZeroMQ proxy loop on the sockets start() set up.
+         *
+         * @param capture Capture socket, or an empty socket for none
+         */
+        void proxyThread(zmq::socket_t frontend, zmq::socket_t backend, zmq::socket_t control, zmq::socket_t capture);
+
+        /**
+         * @brief Header-routing loop (replaces zmq::proxy_steerable)
+         *
+         * Runs until TERMINATE arrives on the control socket.
+         */
+        void routeLoop(zmq::socket_t &frontend, zmq::socket_t &backend,
+                       zmq::socket_t &control, zmq::socket_t *capture);
+
+        /**
+         * @brief Send a steering command to the proxy thread
+         * @param command PAUSE, RESUME, TERMINATE or STATISTICS
+         */
+        TransportError sendCommand(const char *command);
+
+        /**
+         * @brief Find the table route for a frame header
+         * @return Destination identity, or nullptr if no route matches
+         */
+        const PeerId *findRoute(const FrameView &header) const;
+
+        /** @brief Check configuration before changing routes */
+        TransportError checkRoutable(const char *operation);
+
+        /**
+         * @brief Report a ZeroMQ error (any thread)
+         *
+         * @param e ZeroMQ exception (supplies errno and reason)
+         * @param operation Kind of operation that failed
+         * @param context Operation name (string literal)
          */
-        void proxyThread();
+        void handleError(const zmq::error_t &e, TransportOperation operation, const char *context);
 
         /**
-         * @brief Handle error with callback
+         * @brief Report an error that did not come from ZeroMQ (any thread)
          *
-         * @param error ZeroMQ error object
-         * @param context Context string for error message
+         * @param error Error code returned to the caller
+         * @param operation Kind of operation that failed
+         * @param context Operation name (string literal)
+         * @param reason Failure description (string literal)
          */
-        void handleError(const zmq::error_t &error, const std::string &context);
+        void handleError(TransportError error, TransportOperation operation, const char *context,
+                         const char *reason);
 
         /**
          * @brief Get socket type for frontend based on proxy type
@@ -234,7 +413,7 @@ namespace limp
 
         ProxyType type_;                                           ///< Proxy pattern type
         ZMQConfig config_;                                         ///< Socket configuration
-        std::unique_ptr<zmq::context_t> context_;                  ///< ZeroMQ context
+        std::shared_ptr<zmq::context_t> context_;                  ///< ZeroMQ context (possibly shared)
         std::unique_ptr<std::thread> thread_;                      ///< Proxy thread
         std::atomic<bool> running_;                                ///< Running flag
         std::atomic<bool> stopRequested_;                          ///< Stop request flag
@@ -243,7 +422,15 @@ namespace limp
         std::string captureEndpoint_;                              ///< Capture endpoint (optional)
         bool frontendBind_;                                        ///< Bind (true) or connect (false) frontend
         bool backendBind_;                                         ///< Bind (true) or connect (false) backend
-        std::function<void(const std::string &)> errorCallback_;   ///< Error callback
+        ErrorReporter errors_;                                     ///< Error callbacks and rate limit
+        std::mutex errorMutex_;                                    ///< Serializes errors_ across threads
+        std::string controlEndpoint_;                              ///< inproc endpoint used to steer the proxy
+        std::unique_ptr<zmq::socket_t> control_;                   ///< Steering socket (peer of the proxy thread)
+        std::mutex controlMutex_;                                  ///< Serializes use of control_
+        std::atomic<bool> paused_;                                 ///< Forwarding suspended
+        std::unordered_map<uint32_t, PeerId> instanceRoutes_;      ///< (classID << 16 | instanceID) → identity
+        std::unordered_map<uint16_t, PeerId> classRoutes_;         ///< classID → identity
+        std::unordered_map<uint16_t, PeerId> nodeRoutes_;          ///< srcNodeID → identity
     };
 
 } // namespace limp
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "zmq_proxy.hpp"
+#include "../error_event.hpp"
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace limp
+{
+
+    /**
+     * @brief Fleet of XPUB-XSUB proxies partitioned by topic
+     *
+     * A single ZMQProxy forwards on one thread, which limits pub/sub
+     * fan-out to one core. The cluster runs one proxy thread per shard,
+     * each with its own XSUB frontend and XPUB backend:
+     *
+     *   Publisher ─(topic hash)→ XSUB[i] → proxy thread i → XPUB[i] → Subscribers
+     *
+     * Topics are assigned to shards by hash (shardFor()), so publishers
+     * send each topic to frontendEndpoint(shardFor(topic)) and subscribers
+     * of a topic connect to backendEndpoint(shardFor(topic)). The hash is
+     * over the whole topic: subscribers using prefix subscriptions (e.g.
+     * "sensor/") connect to every backend instead.
+     *
+     * With the default ZMQConfig every shard gets its own context and
+     * therefore its own I/O threads.
+     *
+     * @code
+     * ZMQProxyCluster cluster;
+     * for (int i = 0; i < 4; ++i) {
+     *     cluster.addShard("tcp://0.0.0.0:" + std::to_string(6000 + i),
+     *                      "tcp://0.0.0.0:" + std::to_string(7000 + i));
+     * }
+     * cluster.start();
+     *
+     * // Publisher side
+     * publishers[cluster.shardFor("plc7/temp")].publish("plc7/temp", frame);
+     * @endcode
+     */
+    class ZMQProxyCluster
+    {
+    public:
+        /**
+         * @brief Construct empty cluster
+         * @param config Configuration for every shard proxy
+         */
+        explicit ZMQProxyCluster(const ZMQConfig &config = ZMQConfig());
+
+        /** @brief Destructor (stops all shards) */
+        ~ZMQProxyCluster();
+
+        ZMQProxyCluster(const ZMQProxyCluster &) = delete;
+        ZMQProxyCluster &operator=(const ZMQProxyCluster &) = delete;
+
+        /**
+         * @brief Add a shard (before start())
+         *
+         * @param frontendEndpoint XSUB endpoint publishers connect to
+         * @param backendEndpoint XPUB endpoint subscribers connect to
+         * @param bind If true, binds both endpoints; if false, connects them
+         * @return TransportError::None on success, ConfigurationError if running,
+         *         InvalidEndpoint if an endpoint is empty
+         */
+        TransportError addShard(const std::string &frontendEndpoint, const std::string &backendEndpoint,
+                                bool bind = true);
+
+        /**
+         * @brief Set error callback function
+         *
+         * Errors of the cluster and of every shard proxy share one rate limit.
+         *
+         * @param callback Function to call on errors (runs on any shard thread)
+         */
+        void setErrorCallback(std::function<void(const std::string &)> callback);
+
+        /**
+         * @brief Set structured error callback
+         *
+         * Receives every error of the cluster and of its shard proxies as an
+         * ErrorEvent, without formatting or rate limiting. Shard events are
+         * passed through unchanged.
+         *
+         * @param callback Function to call on errors (runs on any shard thread)
+         */
+        void setErrorEventCallback(ErrorEventCallback callback);
+
+        /**
+         * @brief Start every shard
+         *
+         * Shards bind their endpoints inside start(), so a busy or invalid
+         * endpoint fails the call. If a shard fails to start, shards already
+         * started are stopped again and the cluster is not running.
+         *
+         * @return TransportError::None on success, ConfigurationError if running
+         *         or no shard was added, otherwise the failing shard's error
+         */
+        TransportError start();
+
+        /** @brief Stop every shard (blocking) */
+        void stop();
+
+        /** @brief Check if the cluster was started and not stopped */
+        bool isRunning() const { return running_; }
+
+        /** @brief Number of shards */
+        size_t shardCount() const noexcept { return shards_.size(); }
+
+        /**
+         * @brief Shard responsible for a topic
+         * @param topic Full topic string
+         * @return Index in [0, shardCount()), 0 if there are no shards
+         */
+        size_t shardFor(std::string_view topic) const noexcept;
+
+        /** @brief XSUB endpoint of a shard */
+        const std::string &frontendEndpoint(size_t shard) const { return shards_[shard]->getFrontendEndpoint(); }
+
+        /** @brief XPUB endpoint of a shard */
+        const std::string &backendEndpoint(size_t shard) const { return shards_[shard]->getBackendEndpoint(); }
+
+        /** @brief Suspend forwarding on every shard */
+        TransportError pause();
+
+        /** @brief Continue forwarding on every shard */
+        TransportError resume();
+
+        /**
+         * @brief Traffic counters of one shard
+         * @see ZMQProxy::stats()
+         */
+        TransportError stats(size_t shard, ZMQProxy::Stats &stats, int timeoutMs = 1000);
+
+        /**
+         * @brief Traffic counters summed over all shards
+         * @return TransportError::None if every shard answered, otherwise the first error
+         */
+        TransportError stats(ZMQProxy::Stats &stats, int timeoutMs = 1000);
+
+    private:
+        /** @brief Report a cluster error */
+        void handleError(TransportError error, TransportOperation operation, const char *context,
+                         const char *reason);
+
+        /** @brief Deliver a cluster or shard error event */
+        void report(const ErrorEvent &event);
+
+        ZMQConfig config_;                              ///< Configuration for shard proxies
+        std::vector<std::unique_ptr<ZMQProxy>> shards_; ///< One proxy (thread) per shard
+        ErrorReporter errors_;                          ///< Error callbacks and rate limit
+        std::mutex errorMutex_;                         ///< Serializes errors_ across shard threads
+        bool running_;                                  ///< Started and not stopped
+    };
+
+} // namespace limp
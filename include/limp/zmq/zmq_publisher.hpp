@@ -1,6 +1,9 @@
 #pragma once
 
 #include "zmq_transport_base.hpp"
+#include "../last_value_cache.hpp"
+#include "../topic.hpp"
+#include <memory>
 #include <cstddef>
 
 namespace limp
@@ -21,6 +24,7 @@ namespace limp
      * ZMQPublisher publisher;
      * publisher.bind("tcp://0.0.0.0:5556");
      * publisher.publish("topic1", eventData);
+     * publisher.publish(eventData);  // Binary topic from the frame header
      * @endcode
      */
     class ZMQPublisher : public ZMQTransport
@@ -55,6 +59,51 @@ namespace limp
          */
         TransportError publish(const std::string &topic, const Frame &frame);
 
+        /**
+         * @brief Publish a LIMP frame under a binary topic
+         *
+         * @param topic Binary topic (see Topic); empty publishes without topic
+         * @param frame Frame to publish
+         * @return TransportError::None on success, specific error code on failure
+         */
+        TransportError publish(const Topic &topic, const Frame &frame);
+
+        /**
+         * @brief Publish a LIMP frame under its attribute topic
+         *
+         * Same as publish(Topic::forFrame(frame), frame). Subscribers filter
+         * at class, instance or attribute granularity with Topic prefixes;
+         * no topic string is built.
+         *
+         * @param frame Frame to publish
+         * @return TransportError::None on success, specific error code on failure
+         */
+        TransportError publish(const Frame &frame);
+
+        /**
+         * @brief Publish many frames under one topic in one call
+         *
+         * Each frame is published as in publish(topic, frame). Frames are
+         * queued with ZMQ_DONTWAIT, amortizing per-call overhead when pushing
+         * many attribute updates at once.
+         *
+         * @param topic Topic string for subscriber filtering
+         * @param frames Frames to publish
+         * @param sent Output: number of frames published before any failure
+         * @return TransportError::None if all frames were published, specific error code otherwise
+         */
+        TransportError publishBatch(const std::string &topic, Span<const Frame> frames, size_t &sent);
+
+        /**
+         * @brief Publish many frames, each under its own attribute topic
+         *
+         * @param frames Frames to publish
+         * @param sent Output: number of frames published before any failure
+         * @return TransportError::None if all frames were published, specific error code otherwise
+         * @see publish(const Frame &)
+         */
+        TransportError publishBatch(Span<const Frame> frames, size_t &sent);
+
         /**
          * @brief Publish raw data with topic
          *
@@ -65,12 +114,48 @@ namespace limp
          */
         TransportError publishRaw(const std::string &topic, const uint8_t *data, size_t size);
 
+        /**
+         * @brief Record published frames in a last-value cache
+         *
+         * Every frame published successfully afterwards also becomes the cached value of
+         * its attribute, so the publisher can replay the current state with
+         * publishSnapshot(). The cache may be shared with other readers.
+         *
+         * @param cache Cache to update (nullptr to stop recording)
+         */
+        void setLastValueCache(std::shared_ptr<LastValueCache> cache) { cache_ = std::move(cache); }
+
+        /** @brief Cache set with setLastValueCache(), if any */
+        const std::shared_ptr<LastValueCache> &getLastValueCache() const noexcept { return cache_; }
+
+        /**
+         * @brief Re-publish the current value of every cached attribute
+         *
+         * Each frame goes out under its attribute topic, giving late-joining
+         * subscribers the full state without waiting for the next change.
+         *
+         * @param sent Output: number of frames published before any failure
+         * @param filter Only attributes under this topic (empty for all)
+         * @return TransportError::None on success, ConfigurationError if no cache is set,
+         *         specific error code otherwise
+         */
+        TransportError publishSnapshot(size_t &sent, const Topic &filter = Topic());
+
     private:
+        /**
+         * @brief Send [topic][data], or [data] when size is 0
+         * @param record Also store the frame in the last-value cache
+         */
+        TransportError publishWithTopic(const void *topic, size_t size, const Frame &frame, bool record = true);
+
         // Base class overrides - use publish() instead
         TransportError send(const Frame &frame) override;
         TransportError sendRaw(const uint8_t *data, size_t size) override;
         TransportError receive(Frame &frame, int timeoutMs = -1) override;
+        TransportError receiveView(FrameView &view, int timeoutMs = -1) override;
         std::ptrdiff_t receiveRaw(uint8_t *buffer, size_t maxSize) override;
+
+        std::shared_ptr<LastValueCache> cache_; ///< Optional record of published values
     };
 
 } // namespace limp
@@ -0,0 +1,184 @@
+#pragma once
+
+#include "zmq_transport_base.hpp"
+#include <zmq.hpp>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace limp
+{
+
+    /**
+     * @brief Single-threaded event loop over many ZeroMQ transports
+     *
+     * Polls the sockets of all registered transports with one zmq::poll and
+     * dispatches incoming messages to callbacks, so one thread can serve
+     * dozens of client, server, subscriber and dealer sockets instead of one
+     * blocked receive() loop per socket.
+     *
+     * Three kinds of registration are supported:
+     * - add(): frames are decoded into a reactor-owned Frame (reused between
+     *   messages) and passed to a FrameCallback
+     * - addView(): frames are passed as a zero-copy FrameView, valid only
+     *   for the duration of the callback
+     * - addHandler(): the callback is told the socket is readable and
+     *   receives itself (e.g. identity-based ZMQRouter receives)
+     *
+     * Up to DISPATCH_BATCH queued messages are drained per socket per poll,
+     * keeping dispatch fair across sockets. Frames that fail to decode are
+     * reported, consumed and counted against the batch like any other.
+     *
+     * @code
+     * ZMQReactor reactor;
+     * reactor.add(subscriber, [](const Frame &frame) { onTelemetry(frame); });
+     * reactor.addView(dealer, [](const FrameView &view) { onReply(view); });
+     * reactor.addHandler(router, [&] {
+     *     PeerId peer;
+     *     Frame frame;
+     *     while (router.receive(peer, frame, 0) == TransportError::None) { route(peer, frame); }
+     * });
+     * reactor.run();   // Until reactor.stop()
+     * @endcode
+     *
+     * Thread safety: not thread-safe, except stop() which may be called from
+     * any thread. Callbacks may add or remove registrations.
+     */
+    class ZMQReactor
+    {
+    public:
+        /** @brief Callback receiving a zero-copy frame view */
+        using FrameViewCallback = std::function<void(const FrameView &)>;
+
+        /** @brief Callback invoked when a socket is readable */
+        using ReadableCallback = std::function<void()>;
+
+        /** @brief Maximum messages dispatched per socket per poll */
+        static constexpr size_t DISPATCH_BATCH = 64;
+
+        ZMQReactor();
+
+        // Registrations reference transports; copying would duplicate them
+        ZMQReactor(const ZMQReactor &) = delete;
+        ZMQReactor &operator=(const ZMQReactor &) = delete;
+
+        /**
+         * @brief Dispatch decoded frames from a transport
+         *
+         * Replaces any existing registration for the transport. The
+         * transport must outlive its registration.
+         *
+         * @param transport Transport whose receive(frame, 0) is used
+         * @param callback Function called for every received frame
+         */
+        void add(ZMQTransport &transport, FrameCallback callback);
+
+        /**
+         * @brief Dispatch zero-copy frame views from a transport
+         *
+         * @param transport Transport whose receiveView(view, 0) is used
+         * @param callback Function called for every received frame
+         */
+        void addView(ZMQTransport &transport, FrameViewCallback callback);
+
+        /**
+         * @brief Notify when a transport's socket is readable
+         *
+         * The callback performs the receive itself, typically with a zero
+         * timeout.
+         *
+         * @param transport Transport to watch
+         * @param callback Function called once per poll while readable
+         */
+        void addHandler(ZMQTransport &transport, ReadableCallback callback);
+
+        /**
+         * @brief Remove a transport's registration
+         * @param transport Transport to remove
+         * @return true if it was registered
+         */
+        bool remove(ZMQTransport &transport);
+
+        /** @brief Number of registered transports */
+        size_t size() const noexcept;
+
+        /**
+         * @brief Set error callback function
+         *
+         * Receives descriptions of poll and receive errors, rate-limited as
+         * described for ErrorReporter. Errors are written to stderr when no
+         * callback is set.
+         *
+         * @param callback Function to call on errors
+         */
+        void setErrorCallback(ErrorCallback callback);
+
+        /**
+         * @brief Set structured error callback
+         *
+         * Receives every poll and receive error as an ErrorEvent, without
+         * formatting or rate limiting.
+         *
+         * @param callback Function to call on errors
+         */
+        void setErrorEventCallback(ErrorEventCallback callback);
+
+        /**
+         * @brief Wait for activity and dispatch once
+         *
+         * An interrupted wait (EINTR) counts as a timeout.
+         *
+         * @param timeoutMs Maximum wait in milliseconds (0=non-blocking, -1=infinite)
+         * @return Number of messages consumed (including undecodable ones), or -1 if polling failed
+         */
+        int poll(int timeoutMs = -1);
+
+        /**
+         * @brief Dispatch until stop() is called
+         *
+         * A stop() issued before run() makes it return at once. The request
+         * is cleared when run() returns, so the reactor can be run again.
+         *
+         * @param pollIntervalMs How often the stop flag is checked while idle
+         */
+        void run(int pollIntervalMs = 100);
+
+        /** @brief Ask run() to return (thread-safe) */
+        void stop() noexcept { stopRequested_ = true; }
+
+    private:
+        enum class Kind
+        {
+            Decoded,
+            View,
+            Handler
+        };
+
+        struct Registration
+        {
+            ZMQTransport *transport;
+            Kind kind;
+            FrameCallback onFrame;
+            FrameViewCallback onView;
+            ReadableCallback onReadable;
+            bool active;
+        };
+
+        void insert(Registration registration);
+        size_t dispatch(Registration &registration);
+        void purge();
+        void reportError(TransportError error, int errnum, const char *context, const char *reason);
+
+        std::vector<std::unique_ptr<Registration>> registrations_; ///< Registered transports (stable addresses)
+        std::vector<zmq::pollitem_t> items_;                       ///< Poll set (rebuilt per poll, storage reused)
+        std::vector<Registration *> itemOwners_;                   ///< Registration of each poll item
+        Frame frame_;                                              ///< Reused frame for add() callbacks
+        ErrorReporter errors_;                                     ///< Error delivery
+        std::atomic<bool> stopRequested_;                          ///< Stop request flag
+        bool dispatching_;                                         ///< Callbacks are running
+        bool removed_;                                             ///< Registrations were removed during dispatch
+    };
+
+} // namespace limp
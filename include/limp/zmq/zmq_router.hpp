@@ -1,6 +1,8 @@
 #pragma once
 
 #include "zmq_transport_base.hpp"
+#include "../pool.hpp"
+#include "zmq_peer.hpp"
 #include <cstddef>
 #include <vector>
 
@@ -94,7 +96,7 @@ namespace limp
          *
          * @param sourceIdentity Output: sender's identity
          * @param frame Output: received frame
-         * @param timeoutMs Timeout in milliseconds (currently unused, uses socket config timeout)
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=socket receive timeout)
          * @return TransportError::None on success, TransportError::Timeout on timeout,
          *         other error code on failure
          */
@@ -114,7 +116,7 @@ namespace limp
          * @param sourceIdentity Output: sender's identity
          * @param destinationIdentity Output: intended recipient's identity
          * @param frame Output: received frame
-         * @param timeoutMs Timeout in milliseconds (currently unused, uses socket config timeout)
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=socket receive timeout)
          * @return TransportError::None on success, TransportError::Timeout on timeout,
          *         other error code on failure
          */
@@ -123,6 +125,132 @@ namespace limp
                      Frame &frame,
                      int timeoutMs = -1);
 
+        /**
+         * @brief Receive a LIMP frame with source identity without copying it
+         *
+         * Zero-copy counterpart of receive(sourceIdentity, frame). Both the
+         * identity and the view reference transport-owned messages and are
+         * valid until the next receive call on this router.
+         *
+         * Pair with: dealer.send(frame)
+         *
+         * @param sourceIdentity Output: sender's identity bytes
+         * @param view Output view of the received frame
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=socket receive timeout)
+         * @return TransportError::None on success, TransportError::Timeout on timeout,
+         *         other error code on failure
+         */
+        TransportError receiveView(ByteSpan &sourceIdentity,
+                                   FrameView &view,
+                                   int timeoutMs = -1);
+
+        /**
+         * @brief Receive a LIMP frame with source and destination identities without copying it
+         *
+         * Zero-copy counterpart of receive(sourceIdentity, destinationIdentity, frame).
+         * Lets a broker inspect the header and forward the frame without any
+         * heap allocation or payload copy.
+         *
+         * Pair with: dealer.send(destinationIdentity, frame)
+         *
+         * @param sourceIdentity Output: sender's identity bytes
+         * @param destinationIdentity Output: intended recipient's identity bytes
+         * @param view Output view of the received frame
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=socket receive timeout)
+         * @return TransportError::None on success, TransportError::Timeout on timeout,
+         *         other error code on failure
+         */
+        TransportError receiveView(ByteSpan &sourceIdentity,
+                                   ByteSpan &destinationIdentity,
+                                   FrameView &view,
+                                   int timeoutMs = -1);
+
+        /**
+         * @brief Receive into a pooled frame without destination routing
+         *
+         * Same as receive(sourceIdentity, frame); acquires a frame from
+         * FramePool first if the handle is empty. Reusing the handle across
+         * calls keeps the payload capacity, so steady-state receives do not
+         * allocate.
+         *
+         * @param sourceIdentity Output: sender's identity
+         * @param frame Pooled frame to receive into
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=socket receive timeout)
+         * @return TransportError::None on success, specific error code on failure
+         */
+        TransportError receive(std::string &sourceIdentity,
+                               PooledFrame &frame,
+                               int timeoutMs = -1);
+
+        /**
+         * @brief Receive into a pooled frame with destination routing
+         *
+         * Same as receive(sourceIdentity, destinationIdentity, frame);
+         * acquires a frame from FramePool first if the handle is empty.
+         *
+         * @param sourceIdentity Output: sender's identity
+         * @param destinationIdentity Output: destination identity
+         * @param frame Pooled frame to receive into
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=socket receive timeout)
+         * @return TransportError::None on success, specific error code on failure
+         */
+        TransportError receive(std::string &sourceIdentity,
+                               std::string &destinationIdentity,
+                               PooledFrame &frame,
+                               int timeoutMs = -1);
+
+        /**
+         * @brief Receive a LIMP frame with interned source identity
+         *
+         * Same as receive(sourceIdentity, frame) but stores the identity in
+         * a PeerId, which never allocates.
+         *
+         * @param sourceIdentity Output: sender's identity
+         * @param frame Output: received frame
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=socket receive timeout)
+         * @return TransportError::None on success, specific error code on failure
+         */
+        TransportError receive(PeerId &sourceIdentity, Frame &frame, int timeoutMs = -1);
+
+        /**
+         * @brief Receive a LIMP frame with interned source and destination identities
+         *
+         * Same as receive(sourceIdentity, destinationIdentity, frame) with PeerIds.
+         *
+         * @param sourceIdentity Output: sender's identity
+         * @param destinationIdentity Output: destination identity
+         * @param frame Output: received frame
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=socket receive timeout)
+         * @return TransportError::None on success, specific error code on failure
+         */
+        TransportError receive(PeerId &sourceIdentity,
+                               PeerId &destinationIdentity,
+                               Frame &frame,
+                               int timeoutMs = -1);
+
+        /**
+         * @brief Receive up to maxFrames queued frames in one call
+         *
+         * Waits for the first frame like receive(sourceIdentity, frame), then
+         * drains already queued frames without blocking. Existing elements of
+         * both vectors are reused; on return both hold one entry per frame.
+         *
+         * Pair with: dealer.send(frame) / dealer.sendBatch(frames, sent)
+         *
+         * @param sourceIdentities Output: sender identity of each frame
+         * @param frames Output frames
+         * @param maxFrames Maximum number of frames to receive (0=no limit, drain the queue)
+         * @param received Output: number of frames received, also when an error ends the batch
+         * @param timeoutMs Timeout for the first frame in milliseconds (0=non-blocking, -1=socket receive timeout)
+         * @return TransportError::None if the batch ended on an empty queue or maxFrames,
+         *         TransportError::Timeout if no frame arrived, other error code on failure
+         */
+        TransportError receiveBatch(std::vector<std::string> &sourceIdentities,
+                                    std::vector<Frame> &frames,
+                                    size_t maxFrames,
+                                    size_t &received,
+                                    int timeoutMs = -1);
+
         /**
          * @brief Send a LIMP frame to a specific client without source identity
          *
@@ -138,6 +266,18 @@ namespace limp
          */
         TransportError send(const std::string &clientIdentity, const Frame &frame);
 
+        /**
+         * @brief Send a LIMP frame to a specific client, adopting its payload allocation
+         *
+         * Large heap payloads are serialized in place and handed to ZeroMQ
+         * without a copy (see serializeToMessage(Frame &&, zmq::message_t &)).
+         *
+         * @param clientIdentity Target client identity
+         * @param frame Frame to send (left moved-from)
+         * @return TransportError::None on success, specific error code on failure
+         */
+        TransportError send(const std::string &clientIdentity, Frame &&frame);
+
         /**
          * @brief Send a LIMP frame to a specific client with source identity
          *
@@ -154,6 +294,98 @@ namespace limp
          */
         TransportError send(const std::string &clientIdentity, const std::string &sourceIdentity, const Frame &frame);
 
+        /**
+         * @brief Send a LIMP frame to an interned client identity
+         *
+         * Same as send(clientIdentity, frame); the identity part is built
+         * straight from the PeerId bytes.
+         *
+         * @param clientIdentity Target client identity
+         * @param frame Frame to send
+         * @return TransportError::None on success, specific error code on failure
+         */
+        TransportError send(const PeerId &clientIdentity, const Frame &frame);
+
+        /**
+         * @brief Send a LIMP frame to an interned client identity, adopting its payload allocation
+         * @see send(const std::string &, Frame &&)
+         */
+        TransportError send(const PeerId &clientIdentity, Frame &&frame);
+
+        /**
+         * @brief Send a LIMP frame with source identity using interned identities
+         *
+         * @param clientIdentity Target client identity
+         * @param sourceIdentity Source identity representing the sender
+         * @param frame Frame to send
+         * @return TransportError::None on success, specific error code on failure
+         */
+        TransportError send(const PeerId &clientIdentity, const PeerId &sourceIdentity, const Frame &frame);
+
+        /**
+         * @brief Send an already-serialized frame without copying it
+         *
+         * ZeroMQ takes a reference to the wire bytes and releases it after
+         * transmission, so the same WireBuffer can be fanned out to many
+         * clients with no serialization or copy per send.
+         *
+         * ROUTER sends: [client_identity][delimiter][wire] (3 parts)
+         *
+         * @param clientIdentity Target client identity
+         * @param wire Serialized frame (e.g. WireBuffer::serialize(frame))
+         * @return TransportError::None on success, specific error code on failure
+         */
+        TransportError send(const PeerId &clientIdentity, const WireBuffer &wire);
+
+        /**
+         * @brief Send an already-serialized frame with source identity without copying it
+         *
+         * ROUTER sends: [client_identity][source_identity][delimiter][wire] (4 parts)
+         *
+         * @param clientIdentity Target client identity
+         * @param sourceIdentity Source identity representing the sender
+         * @param wire Serialized frame
+         * @return TransportError::None on success, specific error code on failure
+         */
+        TransportError send(const PeerId &clientIdentity, const PeerId &sourceIdentity, const WireBuffer &wire);
+
+        /**
+         * @brief Send many frames to one client in one call
+         *
+         * Each frame is sent as in send(clientIdentity, frame). Frames are
+         * queued with ZMQ_DONTWAIT and only block (up to the send timeout)
+         * when the queue is full.
+         *
+         * @param clientIdentity Target client identity
+         * @param frames Frames to send
+         * @param sent Output: number of frames sent before any failure
+         * @return TransportError::None if all frames were sent, specific error code otherwise
+         */
+        TransportError sendBatch(const std::string &clientIdentity, Span<const Frame> frames, size_t &sent);
+
+        /**
+         * @brief Send a pooled frame and return it to the pool
+         *
+         * The frame goes back to the calling thread's FramePool once sent.
+         *
+         * @param clientIdentity Target client identity
+         * @param frame Pooled frame to send (consumed)
+         * @return TransportError::None on success, specific error code on failure
+         */
+        TransportError send(const std::string &clientIdentity, PooledFrame &&frame);
+
+        /**
+         * @brief Send a pooled frame with source identity and return it to the pool
+         *
+         * @param clientIdentity Target client identity
+         * @param sourceIdentity Source identity representing the sender
+         * @param frame Pooled frame to send (consumed)
+         * @return TransportError::None on success, specific error code on failure
+         */
+        TransportError send(const std::string &clientIdentity,
+                            const std::string &sourceIdentity,
+                            PooledFrame &&frame);
+
         /**
          * @brief Not supported for router (use identity-based send)
          * @return TransportError::InternalError
@@ -173,6 +405,13 @@ namespace limp
          */
         TransportError receive(Frame &frame, int timeoutMs = -1) override;
 
+        /**
+         * @brief Not supported for router (use identity-based receiveView)
+         * @param timeoutMs Ignored
+         * @return TransportError::InternalError
+         */
+        TransportError receiveView(FrameView &view, int timeoutMs = -1) override;
+
         /**
          * @brief Not supported for router (use identity-based receive)
          * @return -1 (error)
@@ -190,11 +429,13 @@ namespace limp
          * @param identity Output: sender's identity
          * @param buffer Pointer to buffer to store received data
          * @param maxSize Maximum size of the buffer
-         * @return Number of bytes received, or -1 on error
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=socket receive timeout)
+         * @return Number of bytes received, 0 on timeout, or -1 on error
          */
         std::ptrdiff_t receiveRaw(std::vector<uint8_t> &identity,
                                   uint8_t *buffer,
-                                  size_t maxSize);
+                                  size_t maxSize,
+                                  int timeoutMs = -1);
 
         /**
          * @brief Receive raw data with destination routing
@@ -208,12 +449,14 @@ namespace limp
          * @param destinationIdentity Output: intended recipient's identity
          * @param buffer Pointer to buffer to store received data
          * @param maxSize Maximum size of the buffer
-         * @return Number of bytes received, or -1 on error
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=socket receive timeout)
+         * @return Number of bytes received, 0 on timeout, or -1 on error
          */
         std::ptrdiff_t receiveRaw(std::vector<uint8_t> &sourceIdentity,
                                   std::vector<uint8_t> &destinationIdentity,
                                   uint8_t *buffer,
-                                  size_t maxSize);
+                                  size_t maxSize,
+                                  int timeoutMs = -1);
 
         /**
          * @brief Send raw data without source identity
@@ -250,6 +493,21 @@ namespace limp
                      const std::vector<uint8_t> &sourceIdentity,
                      const uint8_t *data,
                      size_t size);
+
+    private:
+        /** @brief Most envelope parts a send uses: [client_identity][source_identity][delimiter] */
+        static constexpr size_t MAX_ENVELOPE_PARTS = 3;
+
+        /**
+         * @brief Send envelope parts followed by a prepared body
+         *
+         * Shared by every identity-addressed send; the envelope ends with the
+         * empty delimiter.
+         *
+         * @param envelope Up to MAX_ENVELOPE_PARTS parts sent before body
+         * @param body Serialized frame or raw data (emptied)
+         */
+        TransportError sendEnvelope(Span<const ByteSpan> envelope, zmq::message_t &body);
     };
 
 } // namespace limp
@@ -0,0 +1,149 @@
+#pragma once
+
+#include "zmq_peer.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace limp
+{
+
+    /** @brief Route to one node: its ID and interned socket identity */
+    struct Route
+    {
+        uint16_t nodeID;  ///< Node ID (Frame::srcNodeID the node sends with)
+        PeerId identity;  ///< Socket identity to pass to ZMQRouter::send()
+    };
+
+    /**
+     * @brief Node ID to peer identity table for brokers
+     *
+     * Maps every 16-bit node ID straight to a slot of a dense array (65536
+     * pointers, 512 KiB), so resolving a frame's route is one indexed atomic
+     * load: no hashing, no string compares, no allocation, no lock.
+     * Concurrent worker threads may call lookup() and forEach() while
+     * another thread registers nodes.
+     *
+     * Updates are RCU-style: add() and remove() build a new immutable Route
+     * and publish it with a single pointer store, serialized by a mutex.
+     * Replaced routes are not freed immediately, because a reader may still
+     * be using them; they are retired and freed by reclaim(). Route pointers
+     * therefore stay valid until the next reclaim(). Call it at a point
+     * where no thread holds one, e.g. between receive-loop iterations in a
+     * single-threaded broker or while workers are paused. Re-registrations
+     * are rare, so retired routes accumulate slowly.
+     *
+     * The ordered list forEach() iterates is rebuilt on the first forEach()
+     * after a change, not on every update, so registering n nodes costs
+     * O(n) in total. The list it replaces is retired the same way.
+     *
+     * @code
+     * RoutingTable routes;
+     * PeerId source;
+     * Frame frame;
+     * while (router.receive(source, frame) == TransportError::None) {
+     *     routes.add(frame.srcNodeID, source);   // Lock-free if already known
+     *     if (const Route *dest = routes.lookup(PLC_NODE)) {
+     *         router.send(dest->identity, frame);
+     *     }
+     *     routes.reclaim();
+     * }
+     * @endcode
+     */
+    class RoutingTable
+    {
+    public:
+        /** @brief Number of slots (one per node ID) */
+        static constexpr size_t SLOT_COUNT = 65536;
+
+        RoutingTable();
+        ~RoutingTable();
+
+        RoutingTable(const RoutingTable &) = delete;
+        RoutingTable &operator=(const RoutingTable &) = delete;
+
+        /**
+         * @brief Route of a node
+         * @param nodeID Node ID to resolve
+         * @return Route, or nullptr if the node is not registered (valid until reclaim())
+         */
+        const Route *lookup(uint16_t nodeID) const noexcept
+        {
+            return slots_[nodeID].load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Register a node or change its identity
+         *
+         * Takes no lock if the node is already registered with this identity.
+         *
+         * @return true if the table changed, false if the route already existed
+         */
+        bool add(uint16_t nodeID, const PeerId &identity);
+
+        /**
+         * @brief Unregister a node
+         * @return true if the node was registered
+         */
+        bool remove(uint16_t nodeID);
+
+        /**
+         * @brief Call fn(const Route &) for every registered node, in node ID order
+         *
+         * Iterates a snapshot of the table, so concurrent updates do not
+         * disturb it. Takes the update lock only if the table changed since
+         * the last snapshot was built.
+         */
+        template <typename Fn>
+        void forEach(Fn &&fn) const
+        {
+            const Snapshot *snapshot = currentSnapshot();
+            for (const Route *route : snapshot->routes)
+            {
+                fn(*route);
+            }
+        }
+
+        /** @brief Number of registered nodes */
+        size_t size() const noexcept { return count_.load(std::memory_order_acquire); }
+
+        /** @brief Unregister all nodes */
+        void clear();
+
+        /**
+         * @brief Free routes replaced or removed since the last call
+         *
+         * No thread may hold a Route pointer obtained before the call.
+         *
+         * @return Number of routes freed
+         */
+        size_t reclaim();
+
+    private:
+        /** @brief Immutable list of registered routes (for forEach()) */
+        struct Snapshot
+        {
+            std::vector<const Route *> routes;
+        };
+
+        /** @brief Publish route for nodeID and retire the previous one (writeMutex_ held) */
+        void publish(uint16_t nodeID, const Route *route);
+
+        /** @brief Snapshot of the current routes, rebuilt first if the table changed */
+        const Snapshot *currentSnapshot() const;
+
+        std::unique_ptr<std::atomic<const Route *>[]> slots_;
+        std::atomic<size_t> count_;                       ///< Registered nodes
+        mutable std::atomic<const Snapshot *> snapshot_;  ///< Last snapshot built for forEach()
+        mutable std::atomic<bool> stale_;                 ///< Table changed since snapshot_ was built
+
+        mutable std::mutex writeMutex_;
+        std::vector<uint16_t> nodes_; ///< Registered node IDs in order (writeMutex_ held)
+        std::vector<std::unique_ptr<const Route>> retiredRoutes_;
+        mutable std::vector<std::unique_ptr<const Snapshot>> retiredSnapshots_;
+    };
+
+} // namespace limp
@@ -57,18 +57,42 @@ namespace limp
          */
         TransportError send(const Frame &frame) override;
 
+        /**
+         * @brief Send a LIMP frame, adopting its payload allocation
+         *
+         * Large heap payloads are serialized in place and handed to ZeroMQ
+         * without a copy (see serializeToMessage(Frame &&, zmq::message_t &)).
+         *
+         * @param frame Frame to send (left moved-from)
+         * @return TransportError::None on success, specific error code on failure
+         */
+        TransportError send(Frame &&frame);
+
         /**
          * @brief Receive a LIMP frame
          *
          * Receives and deserializes a LIMP frame.
          *
          * @param frame Output frame
-         * @param timeoutMs Timeout in milliseconds
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=socket receive timeout)
          * @return TransportError::None on success, TransportError::Timeout on timeout,
          *         other error code on failure
          */
         TransportError receive(Frame &frame, int timeoutMs = -1) override;
 
+        /**
+         * @brief Receive a LIMP frame without copying it
+         *
+         * The view references a transport-owned message and is valid until
+         * the next receive call on this server.
+         *
+         * @param view Output view of the received frame
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=socket receive timeout)
+         * @return TransportError::None on success, TransportError::Timeout on timeout,
+         *         other error code on failure
+         */
+        TransportError receiveView(FrameView &view, int timeoutMs = -1) override;
+
         /**
          * @brief Send raw data
          *
@@ -1,7 +1,11 @@
 #pragma once
 
 #include "zmq_transport_base.hpp"
+#include "../last_value_cache.hpp"
+#include "../topic.hpp"
 #include <cstddef>
+#include <string>
+#include <string_view>
 
 namespace limp
 {
@@ -64,16 +68,102 @@ namespace limp
          */
         TransportError unsubscribe(const std::string &topic);
 
+        /**
+         * @brief Subscribe to a binary topic
+         *
+         * Receives frames published under the topic or any longer topic it
+         * prefixes, e.g. Topic::forClass(0x3000) for a whole class.
+         *
+         * @param topic Binary topic (see Topic)
+         * @return TransportError::None on success, specific error code on failure
+         */
+        TransportError subscribe(const Topic &topic);
+
+        /**
+         * @brief Unsubscribe from a binary topic
+         *
+         * @param topic Binary topic previously passed to subscribe()
+         * @return TransportError::None on success, specific error code on failure
+         */
+        TransportError unsubscribe(const Topic &topic);
+
         /**
          * @brief Receive a LIMP frame (strips topic prefix automatically)
          *
          * @param frame Output frame
-         * @param timeoutMs Timeout in milliseconds
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=socket receive timeout)
          * @return TransportError::None on success, TransportError::Timeout on timeout,
          *         other error code on failure
          */
         TransportError receive(Frame &frame, int timeoutMs = -1) override;
 
+        /**
+         * @brief Receive a LIMP frame without copying it (topic stripped)
+         *
+         * The view references a transport-owned message and is valid until
+         * the next receive call on this subscriber.
+         *
+         * @param view Output view of the received frame
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=socket receive timeout)
+         * @return TransportError::None on success, TransportError::Timeout on timeout,
+         *         other error code on failure
+         */
+        TransportError receiveView(FrameView &view, int timeoutMs = -1) override;
+
+        /**
+         * @brief Receive a LIMP frame together with its topic
+         *
+         * The topic is assigned into the caller's string, so a string reused
+         * across calls does not reallocate.
+         *
+         * @param topic Output: topic of the message (empty if published without topic)
+         * @param frame Output frame
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=socket receive timeout)
+         * @return TransportError::None on success, TransportError::Timeout on timeout,
+         *         other error code on failure
+         */
+        TransportError receive(std::string &topic, Frame &frame, int timeoutMs = -1);
+
+        /**
+         * @brief Receive a frame and its topic without copying either
+         *
+         * Receives the [topic][data] (or [data]) message into transport-owned
+         * parts using their more() flags, so topics can be demultiplexed with
+         * no copy and no allocation. Both views are valid until the next
+         * receive call on this subscriber.
+         *
+         * @code
+         * std::string_view topic;
+         * FrameView view;
+         * while (sub.receiveView(topic, view, 0) == TransportError::None) {
+         *     handlers[topic](view);
+         * }
+         * @endcode
+         *
+         * @param topic Output: view of the topic (empty if published without topic)
+         * @param view Output view of the received frame
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=socket receive timeout)
+         * @return TransportError::None on success, TransportError::Timeout on timeout,
+         *         other error code on failure
+         */
+        TransportError receiveView(std::string_view &topic, FrameView &view, int timeoutMs = -1);
+
+        /**
+         * @brief Receive up to maxFrames queued frames in one call
+         *
+         * Waits for the first frame like receive(frame), then drains already
+         * queued frames without blocking. Elements already in frames are
+         * reused; frames is resized to the number received.
+         *
+         * @param frames Output frames
+         * @param maxFrames Maximum number of frames to receive (0=no limit, drain the queue)
+         * @param received Output: number of frames received, also when an error ends the batch
+         * @param timeoutMs Timeout for the first frame in milliseconds (0=non-blocking, -1=socket receive timeout)
+         * @return TransportError::None if the batch ended on an empty queue or maxFrames,
+         *         TransportError::Timeout if no frame arrived, other error code on failure
+         */
+        TransportError receiveBatch(std::vector<Frame> &frames, size_t maxFrames, size_t &received, int timeoutMs = -1);
+
         /**
          * @brief Receive raw data (last part of multipart message)
          *
@@ -85,6 +175,27 @@ namespace limp
          */
         std::ptrdiff_t receiveRaw(uint8_t *buffer, size_t maxSize) override;
 
+        /**
+         * @brief Receive queued frames into a last-value cache (conflation)
+         *
+         * Waits up to timeoutMs for the first message, then drains up to
+         * maxFrames queued messages (all of them if maxFrames is 0) without
+         * blocking. Each frame replaces the cached value of its attribute,
+         * so a slow consumer catches up in one call and then reads only
+         * current values from the cache. Malformed messages are skipped.
+         *
+         * ZMQ_CONFLATE is not used: it keeps one message per socket rather
+         * than per attribute.
+         *
+         * @param cache Cache to update
+         * @param maxFrames Maximum messages to take in this call (0=no limit, drain the queue)
+         * @param received Output: number of frames applied
+         * @param timeoutMs Wait for the first frame (0=non-blocking, -1=socket receive timeout)
+         * @return TransportError::None if at least one frame was applied,
+         *         Timeout if none arrived, specific error code on failure
+         */
+        TransportError receiveInto(LastValueCache &cache, size_t maxFrames, size_t &received, int timeoutMs = -1);
+
     private:
         // Base class overrides - not supported for subscriber
         TransportError send(const Frame &frame) override;
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "zmq_client.hpp"
+#include "../transaction_tracker.hpp"
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace limp
+{
+
+    /**
+     * @brief Thread-safe ZMQClient wrapper with transaction tracking
+     *
+     * Socket access is serialized by one internal mutex; transaction
+     * bookkeeping goes to the shared TransactionTracker outside that lock.
+     * Outgoing REQUEST frames register their AttrID, incoming replies
+     * complete it. The REQ send/receive alternation still applies.
+     *
+     * Async methods run on getThreadPool(); the wrapper must outlive their
+     * futures.
+     *
+     * @code
+     * auto tracker = std::make_shared<TransactionTracker>();
+     * TransactionalClient client(tracker);
+     * client.connect("tcp://127.0.0.1:5555");
+     * client.send(request);
+     * auto [error, response] = client.receiveAsync(5000).get();
+     * @endcode
+     */
+    class TransactionalClient
+    {
+    public:
+        /**
+         * @brief Construct wrapper
+         * @param tracker Tracker shared with other wrappers (must not be null)
+         * @param config Configuration of the underlying client
+         */
+        explicit TransactionalClient(std::shared_ptr<TransactionTracker> tracker,
+                                     const ZMQConfig &config = ZMQConfig());
+
+        TransactionalClient(const TransactionalClient &) = delete;
+        TransactionalClient &operator=(const TransactionalClient &) = delete;
+
+        // Connection
+        TransportError connect(const std::string &endpoint);
+
+        // Synchronous frame API
+        TransportError send(const Frame &frame);
+        TransportError receive(Frame &frame, int timeoutMs = -1);
+
+        // Synchronous raw API
+        TransportError sendRaw(const uint8_t *data, size_t size);
+        std::ptrdiff_t receiveRaw(uint8_t *buffer, size_t maxSize);
+
+        // Asynchronous frame API
+        std::future<TransportError> sendAsync(const Frame &frame);
+        std::future<std::pair<TransportError, Frame>> receiveAsync(int timeoutMs = -1);
+
+        // Asynchronous raw API (payload ownership moves into the task)
+        std::future<TransportError> sendRawAsync(std::vector<uint8_t> data);
+        std::future<std::pair<std::ptrdiff_t, std::vector<uint8_t>>> receiveRawAsync(size_t maxSize);
+
+        /** @brief AttrID of the last REQUEST sent, if any */
+        std::optional<uint16_t> getLastTransactionId() const;
+
+        /** @brief Shared tracker */
+        const std::shared_ptr<TransactionTracker> &getTracker() const noexcept { return tracker_; }
+
+    private:
+        ZMQClient client_;
+        std::shared_ptr<TransactionTracker> tracker_;
+        mutable std::mutex mutex_;
+        std::optional<uint16_t> lastTransactionId_;
+    };
+
+} // namespace limp
@@ -0,0 +1,283 @@
+#pragma once
+
+#include "zmq_dealer.hpp"
+#include "../transaction_tracker.hpp"
+#include <future>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>
+#define LIMP_HAS_COROUTINES 1
+#endif
+
+namespace limp
+{
+
+    /**
+     * @brief Thread-safe ZMQDealer wrapper with transaction tracking
+     *
+     * Every method may be called from any thread; socket access is
+     * serialized by one internal mutex, while transaction bookkeeping goes
+     * to the shared TransactionTracker outside that lock (see
+     * TransactionTracker::track()). The mutex is only held for
+     * non-blocking socket calls: receivers wait for input with it
+     * released, so sends never queue behind a blocked receive. Outgoing
+     * REQUEST frames register their AttrID with the destination identity,
+     * incoming replies complete it.
+     *
+     * Async methods run on getThreadPool(); the wrapper must outlive their
+     * futures.
+     *
+     * @code
+     * auto tracker = std::make_shared<TransactionTracker>();
+     * TransactionalDealer dealer(tracker);
+     * dealer.setIdentity("worker-001");
+     * dealer.connect("tcp://127.0.0.1:5555");
+     * dealer.send("target-node", request);
+     * auto [error, sourceId, response] = dealer.receiveAsyncWithRouting(5000).get();
+     * @endcode
+     *
+     * asyncRequest() pipelines many requests over the one socket: each is
+     * registered with the tracker under its AttrID and completed when
+     * pollResponses() receives the matching reply, in whatever order
+     * replies arrive. Concurrent requests therefore need distinct AttrIDs.
+     *
+     * @code
+     * std::vector<std::future<Frame>> replies;
+     * for (uint16_t plc = 1; plc <= 32; ++plc) {
+     *     replies.push_back(dealer.asyncRequest(plcIdentity(plc), readRequest(plc)));
+     * }
+     * while (dealer.getTracker()->getPendingCount() > 0) {
+     *     dealer.pollResponses(100);
+     *     dealer.getTracker()->cleanupTimedOutTransactions(std::chrono::seconds(2));
+     * }
+     * @endcode
+     */
+    class TransactionalDealer
+    {
+    public:
+        /**
+         * @brief Reply notification for asyncRequest()
+         *
+         * Called once with TransportError::None and the reply, or with the
+         * error that ended the request (send failure, Timeout on expiry).
+         * An ERROR reply is a failed request: it arrives with
+         * TransportError::None and reply->msgType == MsgType::ERROR, while
+         * the future and awaitable variants throw a TransactionFailure
+         * carrying it.
+         */
+        using ReplyHandler = TransactionTracker::CompletionHandler;
+
+        /**
+         * @brief Construct wrapper
+         * @param tracker Tracker shared with other wrappers (must not be null)
+         * @param config Configuration of the underlying dealer
+         */
+        explicit TransactionalDealer(std::shared_ptr<TransactionTracker> tracker,
+                                     const ZMQConfig &config = ZMQConfig());
+
+        TransactionalDealer(const TransactionalDealer &) = delete;
+        TransactionalDealer &operator=(const TransactionalDealer &) = delete;
+
+        // Connection & identity
+        TransportError setIdentity(const std::string &identity);
+        TransportError connect(const std::string &endpoint);
+        const std::string &getIdentity() const;
+
+        // Synchronous frame API - without routing
+        TransportError send(const Frame &frame);
+        TransportError receive(Frame &frame, int timeoutMs = -1);
+
+        // Synchronous frame API - with routing
+        TransportError send(const std::string &destinationIdentity, const Frame &frame);
+        TransportError receive(std::string &sourceIdentity, Frame &frame, int timeoutMs = -1);
+
+        // Synchronous raw API - without routing
+        TransportError sendRaw(const uint8_t *data, size_t size);
+        std::ptrdiff_t receiveRaw(uint8_t *buffer, size_t maxSize);
+
+        // Synchronous raw API - with routing
+        TransportError sendRaw(const std::string &destinationIdentity, const uint8_t *data, size_t size);
+        std::ptrdiff_t receiveRaw(std::string &sourceIdentity, uint8_t *buffer, size_t maxSize);
+
+        // Asynchronous frame API - without routing
+        std::future<TransportError> sendAsync(const Frame &frame);
+        std::future<std::pair<TransportError, Frame>> receiveAsync(int timeoutMs = -1);
+
+        // Asynchronous frame API - with routing
+        std::future<TransportError> sendAsyncWithRouting(const std::string &destinationIdentity,
+                                                         const Frame &frame);
+        std::future<std::tuple<TransportError, std::string, Frame>> receiveAsyncWithRouting(int timeoutMs = -1);
+
+        // Asynchronous raw API - without routing (payload ownership moves into the task)
+        std::future<TransportError> sendRawAsync(std::vector<uint8_t> data);
+        std::future<std::pair<std::ptrdiff_t, std::vector<uint8_t>>> receiveRawAsync(size_t maxSize);
+
+        // Asynchronous raw API - with routing
+        std::future<TransportError> sendRawAsyncWithRouting(const std::string &destinationIdentity,
+                                                            std::vector<uint8_t> data);
+        std::future<std::tuple<std::ptrdiff_t, std::string, std::vector<uint8_t>>>
+        receiveRawAsyncWithRouting(size_t maxSize);
+
+        /**
+         * @brief Send a REQUEST and get notified of its reply
+         *
+         * The handler runs on the thread whose pollResponses() (or tracker
+         * cleanup) completes the request.
+         *
+         * @param request REQUEST frame; its non-zero AttrID matches the reply
+         * @param handler Called exactly once unless an error is returned
+         * @return TransportError::None if the request is in flight (send failures
+         *         are reported through the handler), TransportError::InvalidFrame
+         *         if the frame is not a REQUEST with a free AttrID
+         */
+        TransportError asyncRequest(const Frame &request, ReplyHandler handler);
+
+        /**
+         * @brief Send a routed REQUEST and get notified of its reply
+         * @see asyncRequest(const Frame &, ReplyHandler)
+         */
+        TransportError asyncRequest(const std::string &destinationIdentity, const Frame &request,
+                                    ReplyHandler handler);
+
+        /**
+         * @brief Send a REQUEST and get a future for its reply
+         *
+         * The future throws TransactionFailure if the request cannot be
+         * sent, its AttrID is already pending, it times out, or the peer
+         * replies with ERROR.
+         */
+        std::future<Frame> asyncRequest(const Frame &request);
+
+        /** @brief Send a routed REQUEST and get a future for its reply */
+        std::future<Frame> asyncRequest(const std::string &destinationIdentity, const Frame &request);
+
+#ifdef LIMP_HAS_COROUTINES
+        /**
+         * @brief Awaitable REQUEST (C++20)
+         *
+         * The coroutine resumes on the thread that completes the request;
+         * co_await yields the reply or throws TransactionFailure (also for
+         * an ERROR reply).
+         *
+         * @code
+         * Frame reply = co_await dealer.awaitRequest("plc-7", request);
+         * @endcode
+         */
+        class RequestAwaiter
+        {
+        public:
+            RequestAwaiter(TransactionalDealer &dealer, std::string destinationIdentity, Frame request)
+                : dealer_(dealer), destination_(std::move(destinationIdentity)), request_(std::move(request)),
+                  error_(TransportError::None)
+            {
+            }
+
+            bool await_ready() const noexcept { return false; }
+
+            bool await_suspend(std::coroutine_handle<> handle)
+            {
+                // Do not touch members after a successful start: the reply may resume us first
+                TransportError error = dealer_.asyncRequest(destination_, request_,
+                                                            [this, handle](TransportError result, const Frame *reply)
+                                                            {
+                                                                error_ = result;
+                                                                if (result == TransportError::None && reply)
+                                                                {
+                                                                    reply_ = *reply;
+                                                                }
+                                                                handle.resume();
+                                                            });
+                if (error != TransportError::None)
+                {
+                    error_ = error;
+                    return false;
+                }
+                return true;
+            }
+
+            Frame await_resume()
+            {
+                if (error_ != TransportError::None || !reply_)
+                {
+                    throw TransactionFailure(error_ != TransportError::None ? error_ : TransportError::InternalError);
+                }
+                if (reply_->msgType == MsgType::ERROR)
+                {
+                    throw TransactionFailure(*reply_);
+                }
+                return std::move(*reply_);
+            }
+
+        private:
+            TransactionalDealer &dealer_;
+            std::string destination_;
+            Frame request_;
+            std::optional<Frame> reply_;
+            TransportError error_;
+        };
+
+        /** @brief Awaitable REQUEST without routing */
+        RequestAwaiter awaitRequest(const Frame &request) { return RequestAwaiter(*this, std::string(), request); }
+
+        /** @brief Awaitable routed REQUEST */
+        RequestAwaiter awaitRequest(const std::string &destinationIdentity, const Frame &request)
+        {
+            return RequestAwaiter(*this, destinationIdentity, request);
+        }
+#endif
+
+        /**
+         * @brief Receive replies and complete their requests
+         *
+         * Waits up to timeoutMs for the first message, then drains whatever
+         * is already queued. Replies (RESPONSE, ACK, ERROR) without a pending
+         * request, e.g. late replies to timed-out requests, go to the
+         * unmatched-reply callback; all other frames go to the unsolicited
+         * callback. Accepts replies with and without source identity. Safe
+         * to call from several threads.
+         *
+         * @param timeoutMs Wait for the first message (0=non-blocking, -1=socket receive timeout)
+         * @return Number of frames received
+         */
+        size_t pollResponses(int timeoutMs = 0);
+
+        /**
+         * @brief Set callback for frames pollResponses() receives that are not replies
+         * @param callback Function to call (runs on the polling thread)
+         */
+        void setUnsolicitedCallback(FrameCallback callback);
+
+        /**
+         * @brief Set callback for replies pollResponses() finds no pending request for
+         * @param callback Function to call (runs on the polling thread)
+         */
+        void setUnmatchedReplyCallback(FrameCallback callback);
+
+        /** @brief AttrID of the last REQUEST sent, if any */
+        std::optional<uint16_t> getLastTransactionId() const;
+
+        /** @brief Shared tracker */
+        const std::shared_ptr<TransactionTracker> &getTracker() const noexcept { return tracker_; }
+
+    private:
+        /** @brief Resolve -1 to the configured receive timeout */
+        int waitTimeout(int timeoutMs) const noexcept;
+
+        ZMQDealer dealer_;
+        std::shared_ptr<TransactionTracker> tracker_;
+        const int receiveTimeout_; ///< ZMQConfig::receiveTimeout, applied while waiting unlocked
+        mutable std::mutex mutex_;
+        std::optional<uint16_t> lastTransactionId_;
+        FrameCallback unsolicitedCallback_;
+        FrameCallback unmatchedCallback_;
+    };
+
+} // namespace limp
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "zmq_router.hpp"
+#include "../transaction_tracker.hpp"
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace limp
+{
+
+    /**
+     * @brief Thread-safe ZMQRouter wrapper with transaction tracking (frontend only)
+     *
+     * Socket access is serialized by one internal mutex; transaction
+     * bookkeeping goes to the shared TransactionTracker outside that lock.
+     * The mutex is only held for non-blocking socket calls: receivers wait
+     * for input with it released, so replies never queue behind a blocked
+     * receive. Incoming REQUEST frames register their AttrID with the source and
+     * destination identities, outgoing replies complete it.
+     *
+     * Async methods run on getThreadPool(); the wrapper must outlive their
+     * futures.
+     *
+     * @code
+     * auto tracker = std::make_shared<TransactionTracker>();
+     * TransactionalRouter router(tracker);
+     * router.bind("tcp://0.0.0.0:5555");
+     * auto [error, sourceId, destId, request] = router.receiveAsyncWithRouting(5000).get();
+     * router.send(sourceId, response);
+     * @endcode
+     */
+    class TransactionalRouter
+    {
+    public:
+        /**
+         * @brief Construct wrapper
+         * @param tracker Tracker shared with other wrappers (must not be null)
+         * @param config Configuration of the underlying router
+         */
+        explicit TransactionalRouter(std::shared_ptr<TransactionTracker> tracker,
+                                     const ZMQConfig &config = ZMQConfig());
+
+        TransactionalRouter(const TransactionalRouter &) = delete;
+        TransactionalRouter &operator=(const TransactionalRouter &) = delete;
+
+        // Binding
+        TransportError bind(const std::string &endpoint);
+
+        // Synchronous frame API - source identity only
+        TransportError receive(std::string &sourceIdentity, Frame &frame, int timeoutMs = -1);
+        TransportError send(const std::string &clientIdentity, const Frame &frame);
+
+        // Synchronous frame API - source + destination
+        TransportError receive(std::string &sourceIdentity,
+                               std::string &destinationIdentity,
+                               Frame &frame, int timeoutMs = -1);
+        TransportError send(const std::string &clientIdentity,
+                            const std::string &sourceIdentity,
+                            const Frame &frame);
+
+        // Synchronous raw API
+        TransportError sendRaw(const std::vector<uint8_t> &clientIdentity,
+                               const uint8_t *data, size_t size);
+        TransportError sendRaw(const std::vector<uint8_t> &clientIdentity,
+                               const std::vector<uint8_t> &sourceIdentity,
+                               const uint8_t *data, size_t size);
+        std::ptrdiff_t receiveRaw(std::vector<uint8_t> &identity,
+                                  uint8_t *buffer, size_t maxSize);
+        std::ptrdiff_t receiveRaw(std::vector<uint8_t> &sourceIdentity,
+                                  std::vector<uint8_t> &destinationIdentity,
+                                  uint8_t *buffer, size_t maxSize);
+
+        // Asynchronous frame API - source identity only
+        std::future<std::tuple<TransportError, std::string, Frame>> receiveAsync(int timeoutMs = -1);
+        std::future<TransportError> sendAsync(const std::string &clientIdentity, const Frame &frame);
+
+        // Asynchronous frame API - source + destination
+        std::future<std::tuple<TransportError, std::string, std::string, Frame>>
+        receiveAsyncWithRouting(int timeoutMs = -1);
+        std::future<TransportError> sendAsyncWithRouting(const std::string &clientIdentity,
+                                                         const std::string &sourceIdentity,
+                                                         const Frame &frame);
+
+        // Asynchronous raw API (payload ownership moves into the task)
+        std::future<std::tuple<TransportError, std::vector<uint8_t>, std::vector<uint8_t>>>
+        receiveRawAsync(size_t maxSize);
+        std::future<std::tuple<TransportError, std::vector<uint8_t>, std::vector<uint8_t>, std::vector<uint8_t>>>
+        receiveRawAsyncWithRouting(size_t maxSize);
+        std::future<TransportError> sendRawAsync(const std::vector<uint8_t> &clientIdentity,
+                                                 std::vector<uint8_t> data);
+        std::future<TransportError> sendRawAsyncWithRouting(const std::vector<uint8_t> &clientIdentity,
+                                                            const std::vector<uint8_t> &sourceIdentity,
+                                                            std::vector<uint8_t> data);
+
+        /** @brief Shared tracker */
+        const std::shared_ptr<TransactionTracker> &getTracker() const noexcept { return tracker_; }
+
+    private:
+        /** @brief Resolve -1 to the configured receive timeout */
+        int waitTimeout(int timeoutMs) const noexcept;
+
+        ZMQRouter router_;
+        std::shared_ptr<TransactionTracker> tracker_;
+        const int receiveTimeout_; ///< ZMQConfig::receiveTimeout, applied while waiting unlocked
+        mutable std::mutex mutex_;
+    };
+
+} // namespace limp
@@ -1,10 +1,17 @@
 #pragma once
 
+#include "../error_event.hpp"
+#include "../metrics.hpp"
 #include "../transport.hpp"
+#include "../wire_buffer.hpp"
 #include "zmq_config.hpp"
 #include <zmq.hpp>
+#include <array>
+#include <chrono>
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace limp
 {
@@ -16,7 +23,7 @@ namespace limp
      * and configuration. All ZeroMQ transport classes inherit from this base.
      *
      * This class handles:
-     * - ZeroMQ context management
+     * - ZeroMQ context management (private, user-supplied or shared; see ZMQContextRegistry)
      * - Socket creation and configuration
      * - Error handling and callbacks
      * - Common socket options
@@ -69,12 +76,37 @@ namespace limp
          * @brief Set error callback function
          *
          * Register a callback to be notified of transport errors. The callback
-         * receives an error code and descriptive message.
+         * receives a formatted message, subject to the rate limit (see
+         * setErrorRateLimit()). Without any callback, messages go to std::cerr.
          *
          * @param callback Function to call on errors
          */
         void setErrorCallback(ErrorCallback callback);
 
+        /**
+         * @brief Set structured error callback function
+         *
+         * Receives every error as an ErrorEvent (code, operation, errno),
+         * without formatting or rate limiting, so it is cheap enough for
+         * errors on the hot path. While it is set, std::cerr output stops;
+         * a setErrorCallback() callback still receives text.
+         *
+         * @param callback Function to call on errors
+         */
+        void setErrorEventCallback(ErrorEventCallback callback);
+
+        /**
+         * @brief Limit formatted error messages
+         *
+         * At most burst messages are formatted per interval; the rest are
+         * counted and the count is appended to the next message. Defaults to
+         * ErrorReporter::DEFAULT_BURST per ErrorReporter::DEFAULT_INTERVAL.
+         *
+         * @param burst Messages per interval (0 suppresses all text)
+         * @param interval Rate-limit window
+         */
+        void setErrorRateLimit(size_t burst, std::chrono::milliseconds interval);
+
         /**
          * @brief Get the current endpoint
          *
@@ -82,7 +114,42 @@ namespace limp
          */
         const std::string &getEndpoint() const { return endpoint_; }
 
+        /**
+         * @brief Snapshot of this transport's counters and latency histograms
+         *
+         * Counts frames and bytes sent and received, failures by
+         * TransportError (Timeout for receives that waited and got nothing)
+         * and the time spent in each send call; ZMQClient also records
+         * request/response round trips. May be called from any thread.
+         * All zero when built with LIMP_DISABLE_METRICS.
+         *
+         * @return Current values
+         */
+        TransportStats getStats() const noexcept { return metrics_.snapshot(); }
+
+        /** @brief Clear all counters and histograms */
+        void resetStats() noexcept { metrics_.reset(); }
+
+        /**
+         * @brief Descriptor signalled when the socket's events may have changed (ZMQ_FD)
+         *
+         * Lets a thread wait for input without holding the lock that
+         * serializes access to the socket: poll the descriptor, then retry a
+         * non-blocking receive under the lock. The signal is edge-triggered
+         * and any socket call may consume it, so waits must be bounded.
+         * Reading the descriptor is itself a socket call.
+         *
+         * @param fd Output descriptor
+         * @return false if no socket is open
+         */
+        bool notificationHandle(zmq::fd_t &fd) const;
+
     protected:
+        friend class ZMQReactor; // Polls socket_ directly
+
+        /** @brief Maximum number of message parts kept by receiveParts() */
+        static constexpr size_t MAX_RECEIVE_PARTS = 4;
+
         /**
          * @brief Create and configure a ZeroMQ socket
          *
@@ -107,20 +174,178 @@ namespace limp
         /**
          * @brief Handle ZeroMQ errors
          *
-         * Logs error and invokes error callback if set. Used internally
-         * to handle all ZeroMQ exceptions.
+         * Reports an ErrorEvent to the error callbacks. Does not allocate;
+         * text is only formatted when a rate-limited message is emitted.
+         *
+         * @param e ZeroMQ exception (supplies errno and reason)
+         * @param operation Kind of operation that failed
+         * @param context Operation name (string literal)
+         */
+        void handleError(const zmq::error_t &e, TransportOperation operation, const char *context);
+
+        /**
+         * @brief Handle errors that did not come from ZeroMQ
+         *
+         * @param error Error code returned to the caller
+         * @param operation Kind of operation that failed
+         * @param context Operation name (string literal)
+         * @param reason Failure description (string literal)
+         */
+        void handleError(TransportError error, TransportOperation operation, const char *context,
+                         const char *reason);
+
+        /**
+         * @brief Receive one complete multipart message into rxParts_
+         *
+         * Parts are received into transport-owned messages that are reused
+         * across calls, so no per-message container is allocated. Part
+         * boundaries are read from the messages themselves (no rcvmore
+         * getsockopt). The parts stay valid until the next call.
+         *
+         * A non-negative timeoutMs is applied per call with zmq::poll and a
+         * ZMQ_DONTWAIT receive, leaving the socket options untouched; a
+         * negative timeoutMs waits according to ZMQConfig::receiveTimeout.
+         *
+         * @param expectedParts Required part count (0 accepts 1..MAX_RECEIVE_PARTS)
+         * @param operation Operation name used in error reports
+         * @param timeoutMs Timeout in milliseconds (0=non-blocking, -1=socket receive timeout)
+         * @return Number of parts received, 0 on timeout, or -1 on error
+         */
+        std::ptrdiff_t receiveParts(size_t expectedParts, const char *operation, int timeoutMs = -1);
+
+        /**
+         * @brief View a received part as raw bytes
+         * @param index Part index (must be < last receiveParts() result)
+         */
+        ByteSpan partBytes(size_t index) const noexcept
+        {
+            return ByteSpan(static_cast<const uint8_t *>(rxParts_[index].data()), rxParts_[index].size());
+        }
+
+        /**
+         * @brief Validate a received part as a LIMP frame and view it in place
+         * @param index Part index holding the serialized frame
+         * @param view Output view (references rxParts_[index])
+         * @return TransportError::None or TransportError::DeserializationFailed
+         */
+        TransportError viewPart(size_t index, FrameView &view) const;
+
+        /**
+         * @brief Copy a received part into a caller buffer
+         * @param index Part index to copy
+         * @param buffer Destination buffer
+         * @param maxSize Destination capacity in bytes
+         * @return Number of bytes copied, or -1 if the part does not fit
+         */
+        std::ptrdiff_t copyPart(size_t index, uint8_t *buffer, size_t maxSize);
+
+        /**
+         * @brief Serialize a frame straight into an outgoing message
+         *
+         * Sizes the message with Frame::totalSize() and writes the wire format
+         * into it, so the frame is serialized exactly once and no intermediate
+         * buffer is allocated. Small frames fit in the message's inline storage.
+         *
+         * @param frame Frame to serialize
+         * @param message Output message (rebuilt to the frame size)
+         * @return true on success, false if the frame is invalid
+         */
+        bool serializeToMessage(const Frame &frame, zmq::message_t &message);
+
+        /**
+         * @brief Serialize a frame being given up into an outgoing message
+         *
+         * A large heap payload with room for the header and CRC (see
+         * PayloadBuffer::SPILL_HEADROOM) becomes the message itself: its
+         * bytes are shifted past the header in place and ZeroMQ takes
+         * ownership of the allocation, so nothing is allocated or copied
+         * into a new buffer. Other frames are serialized as by
+         * serializeToMessage(const Frame &, zmq::message_t &).
+         *
+         * @param frame Frame to serialize (left moved-from when its payload is adopted)
+         * @param message Output message
+         * @return true on success, false if the frame is invalid
+         */
+        bool serializeToMessage(Frame &&frame, zmq::message_t &message);
+
+        /**
+         * @brief Hand a shared wire buffer to a message without copying
+         *
+         * The message references the buffer's bytes and holds a reference
+         * that ZeroMQ drops (via WireBuffer::release) once the message is sent.
+         *
+         * @param wire Serialized bytes to send
+         * @param message Output message
+         * @return true on success, false if wire is empty or allocation fails
+         */
+        bool attachWire(const WireBuffer &wire, zmq::message_t &message);
+
+        /**
+         * @brief Send prepared parts as one multipart message
+         *
+         * All parts but the last are sent with sndmore.
+         *
+         * @param parts Array of messages to send (moved out)
+         * @param count Number of parts (at least 1)
+         * @param operation Operation name used in error reports
+         * @return TransportError::None or TransportError::SendFailed
+         */
+        TransportError sendParts(zmq::message_t *parts, size_t count, const char *operation);
+
+        /**
+         * @brief Send many frames, each wrapped in the same envelope
+         *
+         * Every frame goes out as [envelope...][data]. Messages are queued with
+         * ZMQ_DONTWAIT; only when the send queue is full does a send fall back
+         * to blocking (bounded by the socket send timeout). Stops at the first
+         * frame that fails.
+         *
+         * @param envelope Parts sent in front of each frame (identity, delimiter, topic)
+         * @param frames Frames to send
+         * @param sent Output: number of frames sent
+         * @param operation Operation name used in error reports
+         * @return TransportError::None if all frames were sent, error code of the first failure otherwise
+         */
+        TransportError sendFrameBatch(Span<const ByteSpan> envelope,
+                                      Span<const Frame> frames,
+                                      size_t &sent,
+                                      const char *operation);
+
+        /**
+         * @brief Receive up to maxFrames queued frames
+         *
+         * The first message is awaited for timeoutMs; the rest are
+         * taken with ZMQ_DONTWAIT until the queue is empty or maxFrames is
+         * reached. Existing elements of frames are reused, and frames is
+         * resized to the number of frames received. On error, frames and
+         * received still cover the frames received before it.
          *
-         * @param e ZeroMQ exception
-         * @param operation Description of the operation that failed
+         * @param expectedParts Part count per message (0 accepts any; data is the last part)
+         * @param frames Output frames
+         * @param maxFrames Maximum number of frames to receive (0=no limit, drain the queue)
+         * @param received Output: number of frames received, also on error
+         * @param timeoutMs Timeout for the first frame (0=non-blocking, -1=socket receive timeout)
+         * @param operation Operation name used in error reports
+         * @param identities Optional output: part 0 of each message (same indexing as frames)
+         * @return TransportError::None if at least one frame was received,
+         *         TransportError::Timeout if none arrived, other error code on failure
          */
-        void handleError(const zmq::error_t &e, const std::string &operation);
+        TransportError receiveFrameBatch(size_t expectedParts,
+                                         std::vector<Frame> &frames,
+                                         size_t maxFrames,
+                                         size_t &received,
+                                         int timeoutMs,
+                                         const char *operation,
+                                         std::vector<std::string> *identities = nullptr);
 
         std::shared_ptr<zmq::context_t> context_; ///< Shared ZeroMQ context
         std::unique_ptr<zmq::socket_t> socket_;   ///< ZeroMQ socket
         ZMQConfig config_;                        ///< Transport configuration
         std::string endpoint_;                    ///< Connection endpoint
-        ErrorCallback errorCallback_;             ///< Error notification callback
+        ErrorReporter errors_;                    ///< Error callbacks and rate limit
         bool connected_;                          ///< Connection state flag
+        std::array<zmq::message_t, MAX_RECEIVE_PARTS> rxParts_; ///< Reused receive parts
+        mutable TransportMetrics metrics_;                      ///< Counters and latency histograms
     };
 
 } // namespace limp
@@ -0,0 +1,469 @@
+#include "limp/batch.hpp"
+#include "limp/utils.hpp"
+#include <cstring>
+
+namespace limp
+{
+
+    namespace
+    {
+        constexpr size_t SEGMENT_HEADER_SIZE = 3; // [type:1][count:2]
+
+        uint16_t read16(const uint8_t *p)
+        {
+            return static_cast<uint16_t>((static_cast<uint16_t>(p[0]) << 8) | p[1]);
+        }
+
+        uint32_t read32(const uint8_t *p)
+        {
+            return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) |
+                   (static_cast<uint32_t>(p[2]) << 8) | p[3];
+        }
+
+        uint64_t read64(const uint8_t *p)
+        {
+            return (static_cast<uint64_t>(read32(p)) << 32) | read32(p + 4);
+        }
+
+        void write16(std::vector<uint8_t> &out, uint16_t value)
+        {
+            out.push_back(static_cast<uint8_t>(value >> 8));
+            out.push_back(static_cast<uint8_t>(value));
+        }
+
+        bool isRecordType(uint8_t type)
+        {
+            return type <= static_cast<uint8_t>(PayloadType::OPAQUE);
+        }
+
+        bool isVariable(PayloadType type)
+        {
+            return type == PayloadType::STRING || type == PayloadType::OPAQUE;
+        }
+    } // namespace
+
+    // BatchRecord
+
+    PayloadValue BatchRecord::getValue() const
+    {
+        const uint8_t *p = value.data();
+        const size_t expected = getPayloadTypeSize(type);
+        if (expected > 0 && value.size() != expected)
+        {
+            return std::monostate{};
+        }
+
+        switch (type)
+        {
+        case PayloadType::UINT8:
+            return p[0];
+        case PayloadType::UINT16:
+            return read16(p);
+        case PayloadType::UINT32:
+            return read32(p);
+        case PayloadType::UINT64:
+            return read64(p);
+        case PayloadType::FLOAT32:
+            return utils::bitsToFloat(read32(p));
+        case PayloadType::FLOAT64:
+            return utils::bitsToDouble(read64(p));
+        case PayloadType::STRING:
+            return std::string(reinterpret_cast<const char *>(p), value.size());
+        case PayloadType::OPAQUE:
+            return std::vector<uint8_t>(value.begin(), value.end());
+        default:
+            return std::monostate{};
+        }
+    }
+
+    // BatchBuilder
+
+    BatchBuilder::BatchBuilder(MsgType type, uint16_t src, uint16_t classID, uint16_t instanceID, uint16_t attrID)
+        : records_(0)
+    {
+        header_.version = PROTOCOL_VERSION;
+        header_.msgType = type;
+        header_.srcNodeID = src;
+        header_.classID = classID;
+        header_.instanceID = instanceID;
+        header_.attrID = attrID;
+        header_.payloadType = PayloadType::BATCH;
+    }
+
+    BatchBuilder &BatchBuilder::addFixed(uint16_t attrID, PayloadType type, uint64_t bits)
+    {
+        Segment &segment = segments_[static_cast<size_t>(type)];
+        segment.attrIDs.push_back(attrID);
+        for (size_t shift = getPayloadTypeSize(type); shift > 0; --shift)
+        {
+            segment.values.push_back(static_cast<uint8_t>(bits >> ((shift - 1) * 8)));
+        }
+        ++records_;
+        return *this;
+    }
+
+    BatchBuilder &BatchBuilder::addVariable(uint16_t attrID, PayloadType type, const void *data, size_t size)
+    {
+        Segment &segment = segments_[static_cast<size_t>(type)];
+        segment.attrIDs.push_back(attrID);
+        // Lengths above 65535 cannot fit a frame; build() rejects the batch
+        write16(segment.values, static_cast<uint16_t>(size > 0xFFFF ? 0xFFFF : size));
+        const uint8_t *bytes = static_cast<const uint8_t *>(data);
+        segment.values.insert(segment.values.end(), bytes, bytes + size);
+        ++records_;
+        return *this;
+    }
+
+    BatchBuilder &BatchBuilder::add(uint16_t attrID)
+    {
+        return addFixed(attrID, PayloadType::NONE, 0);
+    }
+
+    BatchBuilder &BatchBuilder::add(uint16_t attrID, uint8_t value)
+    {
+        return addFixed(attrID, PayloadType::UINT8, value);
+    }
+
+    BatchBuilder &BatchBuilder::add(uint16_t attrID, uint16_t value)
+    {
+        return addFixed(attrID, PayloadType::UINT16, value);
+    }
+
+    BatchBuilder &BatchBuilder::add(uint16_t attrID, uint32_t value)
+    {
+        return addFixed(attrID, PayloadType::UINT32, value);
+    }
+
+    BatchBuilder &BatchBuilder::add(uint16_t attrID, uint64_t value)
+    {
+        return addFixed(attrID, PayloadType::UINT64, value);
+    }
+
+    BatchBuilder &BatchBuilder::add(uint16_t attrID, float value)
+    {
+        return addFixed(attrID, PayloadType::FLOAT32, utils::floatToBits(value));
+    }
+
+    BatchBuilder &BatchBuilder::add(uint16_t attrID, double value)
+    {
+        return addFixed(attrID, PayloadType::FLOAT64, utils::doubleToBits(value));
+    }
+
+    BatchBuilder &BatchBuilder::add(uint16_t attrID, const std::string &value)
+    {
+        return addVariable(attrID, PayloadType::STRING, value.data(), value.size());
+    }
+
+    BatchBuilder &BatchBuilder::add(uint16_t attrID, const char *value)
+    {
+        return addVariable(attrID, PayloadType::STRING, value, value ? std::strlen(value) : 0);
+    }
+
+    BatchBuilder &BatchBuilder::add(uint16_t attrID, const std::vector<uint8_t> &value)
+    {
+        return addVariable(attrID, PayloadType::OPAQUE, value.data(), value.size());
+    }
+
+    BatchBuilder &BatchBuilder::enableCRC(bool enabled)
+    {
+        header_.setCRCEnabled(enabled);
+        return *this;
+    }
+
+    size_t BatchBuilder::payloadSize() const noexcept
+    {
+        size_t size = 0;
+        for (const Segment &segment : segments_)
+        {
+            if (!segment.attrIDs.empty())
+            {
+                size += SEGMENT_HEADER_SIZE + segment.attrIDs.size() * 2 + segment.values.size();
+            }
+        }
+        return size;
+    }
+
+    bool BatchBuilder::fits(PayloadType type, size_t valueSize) const noexcept
+    {
+        if (!isRecordType(static_cast<uint8_t>(type)))
+        {
+            return false;
+        }
+
+        const Segment &segment = segments_[static_cast<size_t>(type)];
+        size_t needed = 2 + (isVariable(type) ? 2 + valueSize : getPayloadTypeSize(type));
+        if (segment.attrIDs.empty())
+        {
+            needed += SEGMENT_HEADER_SIZE;
+        }
+        return segment.attrIDs.size() < 0xFFFF && payloadSize() + needed <= MAX_PAYLOAD_SIZE;
+    }
+
+    void BatchBuilder::clear()
+    {
+        for (Segment &segment : segments_)
+        {
+            segment.attrIDs.clear();
+            segment.values.clear();
+        }
+        records_ = 0;
+    }
+
+    bool BatchBuilder::build(Frame &frame) const
+    {
+        const size_t size = payloadSize();
+        if (size > MAX_PAYLOAD_SIZE)
+        {
+            return false;
+        }
+
+        std::vector<uint8_t> payload;
+        payload.reserve(size);
+        for (size_t type = 0; type < SEGMENT_TYPES; ++type)
+        {
+            const Segment &segment = segments_[type];
+            if (segment.attrIDs.empty())
+            {
+                continue;
+            }
+            if (segment.attrIDs.size() > 0xFFFF)
+            {
+                return false;
+            }
+
+            payload.push_back(static_cast<uint8_t>(type));
+            write16(payload, static_cast<uint16_t>(segment.attrIDs.size()));
+            if (isVariable(static_cast<PayloadType>(type)))
+            {
+                // Interleave IDs with the length-prefixed values
+                size_t offset = 0;
+                for (uint16_t attrID : segment.attrIDs)
+                {
+                    const size_t length = read16(&segment.values[offset]);
+                    write16(payload, attrID);
+                    payload.insert(payload.end(), segment.values.begin() + static_cast<std::ptrdiff_t>(offset),
+                                   segment.values.begin() + static_cast<std::ptrdiff_t>(offset + 2 + length));
+                    offset += 2 + length;
+                }
+            }
+            else
+            {
+                // Columnar: all IDs, then all fixed-size values
+                for (uint16_t attrID : segment.attrIDs)
+                {
+                    write16(payload, attrID);
+                }
+                payload.insert(payload.end(), segment.values.begin(), segment.values.end());
+            }
+        }
+
+        frame = header_;
+        frame.payloadLen = static_cast<uint16_t>(payload.size());
+        frame.payload = std::move(payload);
+        return true;
+    }
+
+    // BatchParser
+
+    BatchParser::BatchParser(const Frame &frame)
+        : payload_(frame.payload.data(), frame.payload.size()), records_(0), valid_(false)
+    {
+        if (frame.payloadType == PayloadType::BATCH)
+        {
+            validate();
+        }
+    }
+
+    BatchParser::BatchParser(const FrameView &view)
+        : payload_(view.payload()), records_(0), valid_(false)
+    {
+        if (view.payloadType() == PayloadType::BATCH)
+        {
+            validate();
+        }
+    }
+
+    BatchParser::BatchParser(ByteSpan payload)
+        : payload_(payload), records_(0), valid_(false)
+    {
+        validate();
+    }
+
+    void BatchParser::validate()
+    {
+        const uint8_t *data = payload_.data();
+        const size_t size = payload_.size();
+        size_t records = 0;
+
+        for (size_t offset = 0; offset < size;)
+        {
+            if (size - offset < SEGMENT_HEADER_SIZE || !isRecordType(data[offset]))
+            {
+                return;
+            }
+            const PayloadType type = static_cast<PayloadType>(data[offset]);
+            const size_t count = read16(data + offset + 1);
+            offset += SEGMENT_HEADER_SIZE;
+
+            if (isVariable(type))
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    if (size - offset < 4)
+                    {
+                        return;
+                    }
+                    const size_t length = read16(data + offset + 2);
+                    if (size - offset - 4 < length)
+                    {
+                        return;
+                    }
+                    offset += 4 + length;
+                }
+            }
+            else
+            {
+                const size_t bytes = count * (2 + getPayloadTypeSize(type));
+                if (size - offset < bytes)
+                {
+                    return;
+                }
+                offset += bytes;
+            }
+            records += count;
+        }
+
+        records_ = records;
+        valid_ = true;
+    }
+
+    size_t BatchParser::forEachInSegment(size_t offset, const std::function<void(const BatchRecord &)> &visit) const
+    {
+        const uint8_t *data = payload_.data() + offset;
+        BatchRecord record;
+        record.type = static_cast<PayloadType>(data[0]);
+        const size_t count = read16(data + 1);
+        data += SEGMENT_HEADER_SIZE;
+
+        if (isVariable(record.type))
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                record.attrID = read16(data);
+                const size_t length = read16(data + 2);
+                record.value = ByteSpan(data + 4, length);
+                visit(record);
+                data += 4 + length;
+            }
+        }
+        else
+        {
+            const size_t stride = getPayloadTypeSize(record.type);
+            const uint8_t *values = data + count * 2;
+            for (size_t i = 0; i < count; ++i)
+            {
+                record.attrID = read16(data + i * 2);
+                record.value = ByteSpan(values + i * stride, stride);
+                visit(record);
+            }
+            data = values + count * stride;
+        }
+        return static_cast<size_t>(data - payload_.data());
+    }
+
+    std::vector<BatchRecord> BatchParser::records() const
+    {
+        std::vector<BatchRecord> result;
+        result.reserve(records_);
+        forEach([&result](const BatchRecord &record) { result.push_back(record); });
+        return result;
+    }
+
+    std::optional<BatchRecord> BatchParser::find(uint16_t attrID) const
+    {
+        std::optional<BatchRecord> found;
+        forEach([&found, attrID](const BatchRecord &record)
+                {
+                    if (!found && record.attrID == attrID)
+                    {
+                        found = record;
+                    } });
+        return found;
+    }
+
+    template <typename T, typename Decode>
+    size_t BatchParser::getFixed(PayloadType type, std::vector<uint16_t> &attrIDs, std::vector<T> &values,
+                                 Decode decode) const
+    {
+        if (!valid_)
+        {
+            return 0;
+        }
+
+        const uint8_t *data = payload_.data();
+        const size_t size = payload_.size();
+        const size_t stride = getPayloadTypeSize(type);
+        size_t appended = 0;
+
+        for (size_t offset = 0; offset < size;)
+        {
+            const PayloadType segmentType = static_cast<PayloadType>(data[offset]);
+            const size_t count = read16(data + offset + 1);
+            if (segmentType != type)
+            {
+                // Skip by walking the segment; validate() guaranteed its bounds
+                offset = forEachInSegment(offset, [](const BatchRecord &) {});
+                continue;
+            }
+
+            const uint8_t *ids = data + offset + SEGMENT_HEADER_SIZE;
+            const uint8_t *encoded = ids + count * 2;
+            const size_t idBase = attrIDs.size();
+            const size_t valueBase = values.size();
+            attrIDs.resize(idBase + count);
+            values.resize(valueBase + count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                attrIDs[idBase + i] = read16(ids + i * 2);
+                values[valueBase + i] = decode(encoded + i * stride);
+            }
+
+            appended += count;
+            offset += SEGMENT_HEADER_SIZE + count * (2 + stride);
+        }
+        return appended;
+    }
+
+    size_t BatchParser::get(std::vector<uint16_t> &attrIDs, std::vector<uint8_t> &values) const
+    {
+        return getFixed(PayloadType::UINT8, attrIDs, values, [](const uint8_t *p) { return p[0]; });
+    }
+
+    size_t BatchParser::get(std::vector<uint16_t> &attrIDs, std::vector<uint16_t> &values) const
+    {
+        return getFixed(PayloadType::UINT16, attrIDs, values, read16);
+    }
+
+    size_t BatchParser::get(std::vector<uint16_t> &attrIDs, std::vector<uint32_t> &values) const
+    {
+        return getFixed(PayloadType::UINT32, attrIDs, values, read32);
+    }
+
+    size_t BatchParser::get(std::vector<uint16_t> &attrIDs, std::vector<uint64_t> &values) const
+    {
+        return getFixed(PayloadType::UINT64, attrIDs, values, read64);
+    }
+
+    size_t BatchParser::get(std::vector<uint16_t> &attrIDs, std::vector<float> &values) const
+    {
+        return getFixed(PayloadType::FLOAT32, attrIDs, values,
+                        [](const uint8_t *p) { return utils::bitsToFloat(read32(p)); });
+    }
+
+    size_t BatchParser::get(std::vector<uint16_t> &attrIDs, std::vector<double> &values) const
+    {
+        return getFixed(PayloadType::FLOAT64, attrIDs, values,
+                        [](const uint8_t *p) { return utils::bitsToDouble(read64(p)); });
+    }
+
+} // namespace limp
@@ -0,0 +1,324 @@
+#include "limp/byte_order.hpp"
+#include <initializer_list>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define LIMP_BSWAP_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define LIMP_BSWAP_TARGET_SSSE3
+#define LIMP_BSWAP_TARGET_AVX2
+#else
+#define LIMP_BSWAP_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define LIMP_BSWAP_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#elif defined(__aarch64__) || defined(__ARM_NEON)
+#define LIMP_BSWAP_ARM 1
+#include <arm_neon.h>
+#endif
+
+namespace limp
+{
+
+    namespace
+    {
+
+        inline uint16_t swap(uint16_t v)
+        {
+            return static_cast<uint16_t>((v >> 8) | (v << 8));
+        }
+
+        inline uint32_t swap(uint32_t v)
+        {
+            return (v >> 24) | ((v >> 8) & 0x0000FF00) | ((v << 8) & 0x00FF0000) | (v << 24);
+        }
+
+        inline uint64_t swap(uint64_t v)
+        {
+            return (static_cast<uint64_t>(swap(static_cast<uint32_t>(v))) << 32) |
+                   swap(static_cast<uint32_t>(v >> 32));
+        }
+
+        template <typename T>
+        void swapScalar(uint8_t *dst, const uint8_t *src, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                T value;
+                std::memcpy(&value, src + i * sizeof(T), sizeof(T));
+                value = swap(value);
+                std::memcpy(dst + i * sizeof(T), &value, sizeof(T));
+            }
+        }
+
+        void swapScalar(uint8_t *dst, const uint8_t *src, size_t count, size_t width)
+        {
+            switch (width)
+            {
+            case 2:
+                swapScalar<uint16_t>(dst, src, count);
+                break;
+            case 4:
+                swapScalar<uint32_t>(dst, src, count);
+                break;
+            case 8:
+                swapScalar<uint64_t>(dst, src, count);
+                break;
+            default:
+                break;
+            }
+        }
+
+        // Each kernel swaps whole vector blocks and returns the bytes done;
+        // the remaining tail (< one block) goes through swapScalar().
+        using KernelFn = size_t (*)(uint8_t *, const uint8_t *, size_t, size_t);
+
+#if defined(LIMP_BSWAP_X86)
+
+        // PSHUFB masks reversing each 2, 4 and 8-byte lane of a 16-byte block
+        alignas(16) const uint8_t SHUFFLE_MASKS[3][16] = {
+            {1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14},
+            {3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12},
+            {7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8}};
+
+        inline const uint8_t *shuffleMask(size_t width)
+        {
+            return SHUFFLE_MASKS[width == 2 ? 0 : (width == 4 ? 1 : 2)];
+        }
+
+        LIMP_BSWAP_TARGET_SSSE3
+        size_t swapSSSE3(uint8_t *dst, const uint8_t *src, size_t bytes, size_t width)
+        {
+            const __m128i mask = _mm_load_si128(reinterpret_cast<const __m128i *>(shuffleMask(width)));
+            size_t i = 0;
+            for (; i + 64 <= bytes; i += 64)
+            {
+                // Load all four blocks before storing so in-place swaps stay correct
+                __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+                __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 16));
+                __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 32));
+                __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 48));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_shuffle_epi8(a, mask));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 16), _mm_shuffle_epi8(b, mask));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 32), _mm_shuffle_epi8(c, mask));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 48), _mm_shuffle_epi8(d, mask));
+            }
+            for (; i + 16 <= bytes; i += 16)
+            {
+                __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_shuffle_epi8(a, mask));
+            }
+            return i;
+        }
+
+        LIMP_BSWAP_TARGET_AVX2
+        size_t swapAVX2(uint8_t *dst, const uint8_t *src, size_t bytes, size_t width)
+        {
+            const __m256i mask = _mm256_broadcastsi128_si256(
+                _mm_load_si128(reinterpret_cast<const __m128i *>(shuffleMask(width))));
+            size_t i = 0;
+            for (; i + 128 <= bytes; i += 128)
+            {
+                __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+                __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i + 32));
+                __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i + 64));
+                __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i + 96));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_shuffle_epi8(a, mask));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i + 32), _mm256_shuffle_epi8(b, mask));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i + 64), _mm256_shuffle_epi8(c, mask));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i + 96), _mm256_shuffle_epi8(d, mask));
+            }
+            for (; i + 32 <= bytes; i += 32)
+            {
+                __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_shuffle_epi8(a, mask));
+            }
+            return i;
+        }
+
+        bool cpuHasSSSE3() noexcept
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            int info[4];
+            __cpuid(info, 1);
+            return (info[2] & (1 << 9)) != 0; // ECX bit 9: SSSE3
+#else
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("ssse3");
+#endif
+        }
+
+        bool cpuHasAVX2() noexcept
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            int info[4];
+            __cpuid(info, 1);
+            const bool osSavesYmm = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 &&
+                                    (_xgetbv(0) & 0x6) == 0x6; // OSXSAVE, AVX, XMM|YMM state
+            if (!osSavesYmm)
+            {
+                return false;
+            }
+            __cpuidex(info, 7, 0);
+            return (info[1] & (1 << 5)) != 0; // EBX bit 5: AVX2
+#else
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2");
+#endif
+        }
+
+#elif defined(LIMP_BSWAP_ARM)
+
+        size_t swapNEON(uint8_t *dst, const uint8_t *src, size_t bytes, size_t width)
+        {
+            size_t i = 0;
+            for (; i + 16 <= bytes; i += 16)
+            {
+                uint8x16_t v = vld1q_u8(src + i);
+                switch (width)
+                {
+                case 2:
+                    v = vrev16q_u8(v);
+                    break;
+                case 4:
+                    v = vrev32q_u8(v);
+                    break;
+                default:
+                    v = vrev64q_u8(v);
+                    break;
+                }
+                vst1q_u8(dst + i, v);
+            }
+            return i;
+        }
+
+#endif
+
+        bool engineSupported(ByteSwapEngine engine) noexcept
+        {
+            switch (engine)
+            {
+            case ByteSwapEngine::Scalar:
+                return true;
+#if defined(LIMP_BSWAP_X86)
+            case ByteSwapEngine::SSSE3:
+                return cpuHasSSSE3();
+            case ByteSwapEngine::AVX2:
+                return cpuHasAVX2();
+#elif defined(LIMP_BSWAP_ARM)
+            case ByteSwapEngine::NEON:
+                return true; // Baseline on AArch64 and any target defining __ARM_NEON
+#endif
+            default:
+                return false;
+            }
+        }
+
+        KernelFn kernelFor(ByteSwapEngine engine) noexcept
+        {
+            switch (engine)
+            {
+#if defined(LIMP_BSWAP_X86)
+            case ByteSwapEngine::SSSE3:
+                return &swapSSSE3;
+            case ByteSwapEngine::AVX2:
+                return &swapAVX2;
+#elif defined(LIMP_BSWAP_ARM)
+            case ByteSwapEngine::NEON:
+                return &swapNEON;
+#endif
+            default:
+                return nullptr;
+            }
+        }
+
+        ByteSwapEngine detectEngine() noexcept
+        {
+            for (ByteSwapEngine engine : {ByteSwapEngine::AVX2, ByteSwapEngine::NEON, ByteSwapEngine::SSSE3})
+            {
+                if (engineSupported(engine))
+                {
+                    return engine;
+                }
+            }
+            return ByteSwapEngine::Scalar;
+        }
+
+        ByteSwapEngine activeEngine() noexcept
+        {
+            static const ByteSwapEngine engine = detectEngine();
+            return engine;
+        }
+
+        void swapWith(KernelFn kernel, void *dst, const void *src, size_t count, size_t width)
+        {
+            uint8_t *out = static_cast<uint8_t *>(dst);
+            const uint8_t *in = static_cast<const uint8_t *>(src);
+            const size_t bytes = count * width;
+            const size_t done = kernel ? kernel(out, in, bytes, width) : 0;
+            swapScalar(out + done, in + done, (bytes - done) / width, width);
+        }
+
+        // Below this many bytes the plain loop wins over dispatch
+        constexpr size_t VECTOR_MIN_BYTES = 32;
+
+        void swapFastest(void *dst, const void *src, size_t count, size_t width)
+        {
+            static const KernelFn kernel = kernelFor(activeEngine());
+            swapWith(count * width < VECTOR_MIN_BYTES ? nullptr : kernel, dst, src, count, width);
+        }
+
+    } // namespace
+
+    void byteSwap16(void *dst, const void *src, size_t count)
+    {
+        swapFastest(dst, src, count, 2);
+    }
+
+    void byteSwap32(void *dst, const void *src, size_t count)
+    {
+        swapFastest(dst, src, count, 4);
+    }
+
+    void byteSwap64(void *dst, const void *src, size_t count)
+    {
+        swapFastest(dst, src, count, 8);
+    }
+
+    void byteSwap(void *dst, const void *src, size_t count, size_t width, ByteSwapEngine engine)
+    {
+        if (width != 2 && width != 4 && width != 8)
+        {
+            return;
+        }
+        swapWith(engineSupported(engine) ? kernelFor(engine) : nullptr, dst, src, count, width);
+    }
+
+    bool isByteSwapEngineSupported(ByteSwapEngine engine) noexcept
+    {
+        return engineSupported(engine);
+    }
+
+    ByteSwapEngine activeByteSwapEngine() noexcept
+    {
+        return activeEngine();
+    }
+
+    const char *toString(ByteSwapEngine engine) noexcept
+    {
+        switch (engine)
+        {
+        case ByteSwapEngine::Scalar:
+            return "Scalar";
+        case ByteSwapEngine::SSSE3:
+            return "SSSE3";
+        case ByteSwapEngine::AVX2:
+            return "AVX2";
+        case ByteSwapEngine::NEON:
+            return "NEON";
+        default:
+            return "UNKNOWN";
+        }
+    }
+
+} // namespace limp
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "limp/utils.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace limp
+{
+
+    /**
+     * @brief On-disk layout shared by FrameRecorder and FrameReplayer
+     *
+     * A log is a sequence of segment files "<path>.<NNNNNN>.limplog". Each
+     * segment starts with one page holding the header and the sparse time
+     * index, followed by 8-byte aligned records:
+     *
+     *   [length:4][reserved:4][timestamp:8][serialized frame:length][pad]
+     *
+     * All integers are big-endian, like the wire format. Segments are
+     * created at full size, so unwritten space reads as zeros and a length
+     * of 0 marks the end of the records (also after a crash: the length is
+     * stored last). Closed segments are truncated to their data.
+     */
+    namespace capture
+    {
+        constexpr uint32_t MAGIC = 0x4C434150; // "LCAP"
+        constexpr uint32_t FORMAT_VERSION = 1;
+
+        /** @brief Header page size; records start here */
+        constexpr size_t DATA_OFFSET = 4096;
+
+        /** @brief Record header: length, reserved, timestamp */
+        constexpr size_t RECORD_HEADER = 16;
+
+        // Header page fields
+        constexpr size_t MAGIC_AT = 0;           ///< u32 MAGIC
+        constexpr size_t VERSION_AT = 4;         ///< u32 FORMAT_VERSION
+        constexpr size_t SEQUENCE_AT = 8;        ///< u64 segment number
+        constexpr size_t DATA_SIZE_AT = 16;      ///< u64 record bytes (0 while being written)
+        constexpr size_t RECORD_COUNT_AT = 24;   ///< u64 records (0 while being written)
+        constexpr size_t INDEX_COUNT_AT = 32;    ///< u32 index entries in use
+        constexpr size_t INDEX_AT = 64;          ///< Index entries: u64 timestamp, u64 record offset
+
+        constexpr size_t INDEX_ENTRY_SIZE = 16;
+        constexpr size_t INDEX_CAPACITY = (DATA_OFFSET - INDEX_AT) / INDEX_ENTRY_SIZE;
+
+        inline size_t recordSize(size_t length) noexcept
+        {
+            return (RECORD_HEADER + length + 7) & ~static_cast<size_t>(7);
+        }
+
+        inline void store32(uint8_t *at, uint32_t value) noexcept
+        {
+            value = utils::hton32(value);
+            std::memcpy(at, &value, 4);
+        }
+
+        inline void store64(uint8_t *at, uint64_t value) noexcept
+        {
+            value = utils::hton64(value);
+            std::memcpy(at, &value, 8);
+        }
+
+        inline uint32_t load32(const uint8_t *at) noexcept
+        {
+            uint32_t value;
+            std::memcpy(&value, at, 4);
+            return utils::ntoh32(value);
+        }
+
+        inline uint64_t load64(const uint8_t *at) noexcept
+        {
+            uint64_t value;
+            std::memcpy(&value, at, 8);
+            return utils::ntoh64(value);
+        }
+
+        /**
+         * @brief Store a record length with release ordering
+         *
+         * A reader of a segment still being recorded (another process mapping
+         * the same file) that sees the length with loadLength() also sees the
+         * record body written before it. Record lengths are 4-byte aligned.
+         */
+        inline void storeLength(uint8_t *at, uint32_t value) noexcept
+        {
+            __atomic_store_n(reinterpret_cast<uint32_t *>(at), utils::hton32(value), __ATOMIC_RELEASE);
+        }
+
+        /** @brief Load a record length with acquire ordering (pairs with storeLength()) */
+        inline uint32_t loadLength(const uint8_t *at) noexcept
+        {
+            return utils::ntoh32(__atomic_load_n(reinterpret_cast<const uint32_t *>(at), __ATOMIC_ACQUIRE));
+        }
+
+        /** @brief File name of segment number sequence */
+        inline std::string segmentPath(const std::string &path, uint64_t sequence)
+        {
+            char suffix[32];
+            std::snprintf(suffix, sizeof(suffix), ".%06llu.limplog", static_cast<unsigned long long>(sequence));
+            return path + suffix;
+        }
+    } // namespace capture
+
+} // namespace limp
@@ -0,0 +1,210 @@
+#include "limp/capture/frame_recorder.hpp"
+#include "frame_log.hpp"
+#include "limp/compression.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+
+namespace limp
+{
+
+    FrameRecorder::FrameRecorder(const Options &options) noexcept
+        : options_(options), fd_(-1), data_(nullptr), offset_(0), capacity_(0), indexStride_(0), nextIndexAt_(0),
+          indexCount_(0), sequence_(0), segments_(0), records_(0), totalRecords_(0)
+    {
+        // Whole pages, so the truncated tail of a segment is the only partial one
+        options_.segmentSize = std::max(options_.segmentSize, MIN_SEGMENT_SIZE);
+        options_.segmentSize = (options_.segmentSize + capture::DATA_OFFSET - 1) & ~(capture::DATA_OFFSET - 1);
+    }
+
+    FrameRecorder::~FrameRecorder()
+    {
+        close();
+    }
+
+    TransportError FrameRecorder::open(const std::string &path)
+    {
+        close();
+
+        // Remove every segment of an old log, or the replayer would run into its tail
+        for (uint64_t sequence = 0; ::unlink(capture::segmentPath(path, sequence).c_str()) == 0; ++sequence)
+        {
+        }
+
+        path_ = path;
+        sequence_ = 0;
+        segments_ = 0;
+        totalRecords_ = 0;
+        return openSegment() ? TransportError::None : TransportError::BindFailed;
+    }
+
+    void FrameRecorder::close() noexcept
+    {
+        if (isOpen())
+        {
+            closeSegment();
+        }
+    }
+
+    bool FrameRecorder::openSegment()
+    {
+        const std::string file = capture::segmentPath(path_, sequence_);
+        int fd = ::open(file.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0)
+        {
+            return false;
+        }
+
+        const size_t size = options_.segmentSize;
+        if (::ftruncate(fd, static_cast<off_t>(size)) != 0)
+        {
+            ::close(fd);
+            ::unlink(file.c_str());
+            return false;
+        }
+
+        void *mapping = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (mapping == MAP_FAILED)
+        {
+            ::close(fd);
+            ::unlink(file.c_str());
+            return false;
+        }
+
+        fd_ = fd;
+        data_ = static_cast<uint8_t *>(mapping);
+        capacity_ = size - capture::DATA_OFFSET;
+        indexStride_ = std::max<size_t>(capacity_ / capture::INDEX_CAPACITY, capture::DATA_OFFSET);
+        offset_ = 0;
+        nextIndexAt_ = 0;
+        indexCount_ = 0;
+        records_ = 0;
+        ++segments_;
+
+        // The file is zero-filled; only the identifying fields need writing
+        capture::store32(data_ + capture::MAGIC_AT, capture::MAGIC);
+        capture::store32(data_ + capture::VERSION_AT, capture::FORMAT_VERSION);
+        capture::store64(data_ + capture::SEQUENCE_AT, sequence_);
+        return true;
+    }
+
+    void FrameRecorder::closeSegment() noexcept
+    {
+        capture::store64(data_ + capture::DATA_SIZE_AT, offset_);
+        capture::store64(data_ + capture::RECORD_COUNT_AT, records_);
+        ::munmap(data_, options_.segmentSize);
+        data_ = nullptr;
+
+        // Give back the unused tail
+        if (::ftruncate(fd_, static_cast<off_t>(capture::DATA_OFFSET + offset_)) != 0)
+        {
+            // The zero-filled tail reads as the end of the records anyway
+        }
+        ::close(fd_);
+        fd_ = -1;
+    }
+
+    uint8_t *FrameRecorder::reserve(size_t length, uint64_t timestampNs, TransportError &error)
+    {
+        if (!isOpen())
+        {
+            error = TransportError::SocketClosed;
+            return nullptr;
+        }
+
+        if (offset_ + capture::recordSize(length) > capacity_)
+        {
+            closeSegment();
+            ++sequence_;
+            if (!openSegment())
+            {
+                error = TransportError::InternalError;
+                return nullptr;
+            }
+        }
+
+        uint8_t *record = data_ + capture::DATA_OFFSET + offset_;
+        capture::store64(record + 8, timestampNs);
+        error = TransportError::None;
+        return record;
+    }
+
+    void FrameRecorder::commit(uint8_t *record, size_t length) noexcept
+    {
+        // Sparse index: the first record at or after every indexStride_ bytes
+        if (offset_ >= nextIndexAt_ && indexCount_ < capture::INDEX_CAPACITY)
+        {
+            uint8_t *entry = data_ + capture::INDEX_AT + indexCount_ * capture::INDEX_ENTRY_SIZE;
+            std::memcpy(entry, record + 8, 8);
+            capture::store64(entry + 8, offset_);
+            capture::store32(data_ + capture::INDEX_COUNT_AT, ++indexCount_);
+            nextIndexAt_ = offset_ + indexStride_;
+        }
+
+        // Length last: a record with length 0 was never completed
+        capture::storeLength(record, static_cast<uint32_t>(length));
+        offset_ += capture::recordSize(length);
+        ++records_;
+        ++totalRecords_;
+    }
+
+    TransportError FrameRecorder::record(const Frame &frame, uint64_t timestampNs)
+    {
+        if (!frame.validate())
+        {
+            return TransportError::SerializationFailed;
+        }
+
+        const Frame &wire = detail::wireFrame(frame);
+        const size_t length = wire.totalSize();
+        TransportError error;
+        uint8_t *record = reserve(length, timestampNs, error);
+        if (!record)
+        {
+            return error;
+        }
+
+        detail::serializeValidatedFrame(wire, record + capture::RECORD_HEADER);
+        commit(record, length);
+        return TransportError::None;
+    }
+
+    TransportError FrameRecorder::record(const FrameView &view, uint64_t timestampNs)
+    {
+        if (view.data() == nullptr || view.size() < HEADER_SIZE)
+        {
+            return TransportError::InvalidFrame;
+        }
+
+        TransportError error;
+        uint8_t *record = reserve(view.size(), timestampNs, error);
+        if (!record)
+        {
+            return error;
+        }
+
+        std::memcpy(record + capture::RECORD_HEADER, view.data(), view.size());
+        commit(record, view.size());
+        return TransportError::None;
+    }
+
+    TransportError FrameRecorder::flush()
+    {
+        if (!isOpen())
+        {
+            return TransportError::SocketClosed;
+        }
+        return ::msync(data_, capture::DATA_OFFSET + offset_, MS_SYNC) == 0 ? TransportError::None
+                                                                             : TransportError::InternalError;
+    }
+
+    uint64_t FrameRecorder::now() noexcept
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         std::chrono::system_clock::now().time_since_epoch())
+                                         .count());
+    }
+
+} // namespace limp
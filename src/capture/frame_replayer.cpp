@@ -0,0 +1,258 @@
+#include "limp/capture/frame_replayer.hpp"
+#include "frame_log.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace limp
+{
+
+    FrameReplayer::FrameReplayer(const Options &options) noexcept
+        : options_(options), segment_(0), offset_(0)
+    {
+    }
+
+    FrameReplayer::~FrameReplayer()
+    {
+        close();
+    }
+
+    TransportError FrameReplayer::open(const std::string &path)
+    {
+        close();
+
+        for (uint64_t sequence = 0;; ++sequence)
+        {
+            bool exists = false;
+            TransportError error = mapSegment(capture::segmentPath(path, sequence), exists);
+            if (error != TransportError::None)
+            {
+                close();
+                return error;
+            }
+            if (!exists)
+            {
+                break;
+            }
+        }
+
+        return isOpen() ? TransportError::None : TransportError::ConnectionFailed;
+    }
+
+    TransportError FrameReplayer::mapSegment(const std::string &file, bool &exists)
+    {
+        int fd = ::open(file.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            exists = false;
+            return TransportError::None;
+        }
+        exists = true;
+
+        struct stat info;
+        if (::fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < capture::DATA_OFFSET)
+        {
+            ::close(fd);
+            return TransportError::DeserializationFailed;
+        }
+
+        const size_t size = static_cast<size_t>(info.st_size);
+        void *mapping = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mapping == MAP_FAILED)
+        {
+            return TransportError::ConnectionFailed;
+        }
+
+        Segment segment;
+        segment.base = static_cast<const uint8_t *>(mapping);
+        segment.mappedSize = size;
+        if (capture::load32(segment.base + capture::MAGIC_AT) != capture::MAGIC ||
+            capture::load32(segment.base + capture::VERSION_AT) != capture::FORMAT_VERSION)
+        {
+            ::munmap(mapping, size);
+            return TransportError::DeserializationFailed;
+        }
+
+        // Still being written (or not closed): the records end at the first length 0
+        const uint64_t dataSize = capture::load64(segment.base + capture::DATA_SIZE_AT);
+        segment.dataSize = (dataSize > 0 && dataSize <= size - capture::DATA_OFFSET) ? static_cast<size_t>(dataSize)
+                                                                                      : size - capture::DATA_OFFSET;
+        segments_.push_back(segment);
+        return TransportError::None;
+    }
+
+    void FrameReplayer::close() noexcept
+    {
+        for (const Segment &segment : segments_)
+        {
+            ::munmap(const_cast<uint8_t *>(segment.base), segment.mappedSize);
+        }
+        segments_.clear();
+        rewind();
+    }
+
+    void FrameReplayer::rewind() noexcept
+    {
+        segment_ = 0;
+        offset_ = 0;
+    }
+
+    const uint8_t *FrameReplayer::current() noexcept
+    {
+        for (; segment_ < segments_.size(); ++segment_, offset_ = 0)
+        {
+            const Segment &segment = segments_[segment_];
+            if (offset_ + capture::RECORD_HEADER > segment.dataSize)
+            {
+                continue;
+            }
+
+            const uint8_t *record = segment.base + capture::DATA_OFFSET + offset_;
+            const uint32_t length = capture::loadLength(record);
+            if (length > 0 && offset_ + capture::recordSize(length) <= segment.dataSize)
+            {
+                return record;
+            }
+        }
+        return nullptr;
+    }
+
+    bool FrameReplayer::next(FrameView &view, uint64_t &timestampNs)
+    {
+        while (const uint8_t *record = current())
+        {
+            const uint32_t length = capture::load32(record);
+            offset_ += capture::recordSize(length);
+
+            // A damaged record is skipped; its length still leads to the next one
+            if (deserializeFrameView(record + capture::RECORD_HEADER, length, view))
+            {
+                timestampNs = capture::load64(record + 8);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    size_t FrameReplayer::nextBatch(Span<ByteSpan> records, Span<uint64_t> timestampsNs)
+    {
+        const size_t capacity = std::min(records.size(), timestampsNs.size());
+        size_t count = 0;
+        const uint8_t *record;
+        while (count < capacity && (record = current()) != nullptr)
+        {
+            const uint32_t length = capture::load32(record);
+            offset_ += capture::recordSize(length);
+            records[count] = ByteSpan(record + capture::RECORD_HEADER, length);
+            timestampsNs[count] = capture::load64(record + 8);
+            ++count;
+        }
+        return count;
+    }
+
+    bool FrameReplayer::seek(uint64_t timestampNs)
+    {
+        rewind();
+
+        // Last segment whose first record is not later than the target
+        for (size_t i = segments_.size(); i-- > 0;)
+        {
+            const uint8_t *header = segments_[i].base;
+            if (capture::load32(header + capture::INDEX_COUNT_AT) > 0 &&
+                capture::load64(header + capture::INDEX_AT) <= timestampNs)
+            {
+                segment_ = i;
+                break;
+            }
+        }
+
+        // Last index entry not later than the target, then scan from there
+        if (segment_ < segments_.size())
+        {
+            const uint8_t *header = segments_[segment_].base;
+            const uint32_t count = std::min<uint32_t>(capture::load32(header + capture::INDEX_COUNT_AT),
+                                                      static_cast<uint32_t>(capture::INDEX_CAPACITY));
+            for (uint32_t i = count; i-- > 0;)
+            {
+                const uint8_t *entry = header + capture::INDEX_AT + i * capture::INDEX_ENTRY_SIZE;
+                if (capture::load64(entry) <= timestampNs)
+                {
+                    offset_ = static_cast<size_t>(capture::load64(entry + 8));
+                    break;
+                }
+            }
+        }
+
+        while (const uint8_t *record = current())
+        {
+            if (capture::load64(record + 8) >= timestampNs)
+            {
+                return true;
+            }
+            offset_ += capture::recordSize(capture::load32(record));
+        }
+        return false;
+    }
+
+    uint64_t FrameReplayer::firstTimestamp() const noexcept
+    {
+        for (const Segment &segment : segments_)
+        {
+            if (capture::load32(segment.base + capture::INDEX_COUNT_AT) > 0)
+            {
+                return capture::load64(segment.base + capture::INDEX_AT);
+            }
+        }
+        return 0;
+    }
+
+    TransportError FrameReplayer::replay(const Sink &sink, size_t &replayed)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        replayed = 0;
+        const bool paced = options_.speed > 0.0;
+        const Clock::time_point start = Clock::now();
+        uint64_t base = 0;
+
+        FrameView view;
+        uint64_t timestampNs = 0;
+        while (next(view, timestampNs))
+        {
+            if (replayed == 0)
+            {
+                base = timestampNs;
+            }
+
+            // Keep the recorded gaps, scaled, relative to the first frame
+            if (paced && timestampNs > base)
+            {
+                const auto offset = std::chrono::nanoseconds(
+                    static_cast<int64_t>(static_cast<double>(timestampNs - base) / options_.speed));
+                std::this_thread::sleep_until(start + std::chrono::duration_cast<Clock::duration>(offset));
+            }
+
+            TransportError error = sink(view, timestampNs);
+            if (error != TransportError::None)
+            {
+                return error;
+            }
+            ++replayed;
+        }
+        return TransportError::None;
+    }
+
+    TransportError FrameReplayer::replay(Transport &transport, size_t &replayed)
+    {
+        Frame frame;
+        return replay([&](const FrameView &view, uint64_t)
+                      { return view.toFrame(frame) ? transport.send(frame) : TransportError::DeserializationFailed; },
+                      replayed);
+    }
+
+} // namespace limp
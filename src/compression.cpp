@@ -0,0 +1,353 @@
+#include "limp/compression.hpp"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#ifdef LIMP_HAS_ZSTD
+#include <zdict.h>
+#include <zstd.h>
+#endif
+
+namespace limp
+{
+
+#ifdef LIMP_HAS_ZSTD
+    struct CompressionDictionary::Impl
+    {
+        ZSTD_CDict *cdict = nullptr;
+        ZSTD_DDict *ddict = nullptr;
+
+        ~Impl()
+        {
+            ZSTD_freeCDict(cdict);
+            ZSTD_freeDDict(ddict);
+        }
+    };
+#else
+    struct CompressionDictionary::Impl
+    {
+    };
+#endif
+
+    /** @brief Gives the codec functions access to the dictionary handles */
+    struct CompressionAccess
+    {
+        static const CompressionDictionary::Impl *impl(const CompressionDictionary *dictionary) noexcept
+        {
+            return (dictionary && dictionary->impl_) ? dictionary->impl_.get() : nullptr;
+        }
+    };
+
+    namespace
+    {
+        bool isCompressible(const Frame &frame) noexcept
+        {
+            return (frame.payloadType == PayloadType::STRING || frame.payloadType == PayloadType::OPAQUE) &&
+                   !frame.isCompressed();
+        }
+
+        /**
+         * @brief Published settings: one immutable snapshot and its version
+         *
+         * Each thread keeps a reference to the snapshot it last read and only
+         * takes the mutex when the version moves on, so the frame paths read
+         * every field from the same snapshot without a lock. A replaced
+         * snapshot is freed once the last thread holding it refreshes or exits.
+         */
+        struct PublishedOptions
+        {
+            std::mutex mutex; ///< Guards current
+            std::shared_ptr<const CompressionOptions> current = std::make_shared<const CompressionOptions>();
+            std::atomic<uint64_t> version{1};
+        };
+
+        PublishedOptions &publishedOptions()
+        {
+            static PublishedOptions published;
+            return published;
+        }
+
+        const CompressionOptions &activeOptions()
+        {
+            struct Cached
+            {
+                uint64_t version = 0;
+                std::shared_ptr<const CompressionOptions> options;
+            };
+            thread_local Cached cached;
+
+            PublishedOptions &published = publishedOptions();
+            if (published.version.load(std::memory_order_acquire) != cached.version)
+            {
+                std::lock_guard<std::mutex> lock(published.mutex);
+                cached.options = published.current;
+                cached.version = published.version.load(std::memory_order_relaxed);
+            }
+            return *cached.options;
+        }
+
+        /** @brief Whether the settings call for compressing this frame on the wire */
+        bool shouldCompress(const Frame &frame, const CompressionOptions &options) noexcept
+        {
+            return options.enabled && isCompressionAvailable() && isCompressible(frame) && frame.payloadLen > 0 &&
+                   frame.payloadLen >= options.threshold;
+        }
+
+#ifdef LIMP_HAS_ZSTD
+        /** @brief Per-thread codec contexts (reused across calls) */
+        struct Contexts
+        {
+            ZSTD_CCtx *cctx = ZSTD_createCCtx();
+            ZSTD_DCtx *dctx = ZSTD_createDCtx();
+
+            ~Contexts()
+            {
+                ZSTD_freeCCtx(cctx);
+                ZSTD_freeDCtx(dctx);
+            }
+        };
+
+        Contexts &contexts()
+        {
+            thread_local Contexts local;
+            return local;
+        }
+
+        /** @return Compressed size, or 0 if compression failed or did not fit in capacity */
+        size_t compressPayload(const uint8_t *src, size_t size, uint8_t *dst, size_t capacity,
+                               const CompressionOptions &options)
+        {
+            Contexts &ctx = contexts();
+            const auto *dict = CompressionAccess::impl(options.dictionary.get());
+            const size_t result = dict ? ZSTD_compress_usingCDict(ctx.cctx, dst, capacity, src, size, dict->cdict)
+                                       : ZSTD_compressCCtx(ctx.cctx, dst, capacity, src, size, options.level);
+            return ZSTD_isError(result) ? 0 : result;
+        }
+
+        bool decompressInto(const uint8_t *data, size_t size, const CompressionDictionary *dictionary,
+                            PayloadBuffer &out)
+        {
+            const unsigned long long contentSize = ZSTD_getFrameContentSize(data, size);
+            if (contentSize == ZSTD_CONTENTSIZE_ERROR || contentSize == ZSTD_CONTENTSIZE_UNKNOWN ||
+                contentSize > MAX_PAYLOAD_SIZE)
+            {
+                return false;
+            }
+
+            // A frame compressed with a zstd-format dictionary names it; refuse to guess
+            const unsigned dictId = ZSTD_getDictID_fromFrame(data, size);
+            const auto *dict = CompressionAccess::impl(dictionary);
+            if (dictId != 0 && (!dict || dictionary->id() != dictId))
+            {
+                return false;
+            }
+
+            out.resize(static_cast<size_t>(contentSize));
+            Contexts &ctx = contexts();
+            const size_t result =
+                dict ? ZSTD_decompress_usingDDict(ctx.dctx, out.data(), out.size(), data, size, dict->ddict)
+                     : ZSTD_decompressDCtx(ctx.dctx, out.data(), out.size(), data, size);
+            return !ZSTD_isError(result) && result == out.size();
+        }
+#else
+        size_t compressPayload(const uint8_t *, size_t, uint8_t *, size_t, const CompressionOptions &)
+        {
+            return 0;
+        }
+
+        bool decompressInto(const uint8_t *, size_t, const CompressionDictionary *, PayloadBuffer &)
+        {
+            return false;
+        }
+#endif
+
+        size_t compressBound(size_t size) noexcept
+        {
+#ifdef LIMP_HAS_ZSTD
+            return ZSTD_compressBound(size);
+#else
+            return size;
+#endif
+        }
+    } // namespace
+
+    bool isCompressionAvailable() noexcept
+    {
+#ifdef LIMP_HAS_ZSTD
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    CompressionDictionary::CompressionDictionary(const uint8_t *data, size_t size, int level)
+        : bytes_(data, data + size), id_(0), impl_(std::make_unique<Impl>())
+    {
+#ifdef LIMP_HAS_ZSTD
+        impl_->cdict = ZSTD_createCDict(bytes_.data(), bytes_.size(), level);
+        impl_->ddict = ZSTD_createDDict(bytes_.data(), bytes_.size());
+        if (!impl_->cdict || !impl_->ddict)
+        {
+            impl_.reset();
+            return;
+        }
+        id_ = ZSTD_getDictID_fromDict(bytes_.data(), bytes_.size());
+#else
+        (void)level;
+        impl_.reset();
+#endif
+    }
+
+    CompressionDictionary::~CompressionDictionary() = default;
+
+    bool CompressionDictionary::isValid() const noexcept
+    {
+        return impl_ != nullptr;
+    }
+
+    std::shared_ptr<CompressionDictionary> CompressionDictionary::train(
+        const std::vector<std::vector<uint8_t>> &samples, size_t maxSize, int level)
+    {
+#ifdef LIMP_HAS_ZSTD
+        std::vector<uint8_t> joined;
+        std::vector<size_t> sizes;
+        sizes.reserve(samples.size());
+        for (const auto &sample : samples)
+        {
+            joined.insert(joined.end(), sample.begin(), sample.end());
+            sizes.push_back(sample.size());
+        }
+
+        std::vector<uint8_t> dictionary(maxSize);
+        const size_t size = ZDICT_trainFromBuffer(dictionary.data(), dictionary.size(), joined.data(), sizes.data(),
+                                                  static_cast<unsigned>(sizes.size()));
+        if (ZDICT_isError(size))
+        {
+            return nullptr;
+        }
+
+        auto result = std::make_shared<CompressionDictionary>(dictionary.data(), size, level);
+        return result->isValid() ? result : nullptr;
+#else
+        (void)samples;
+        (void)maxSize;
+        (void)level;
+        return nullptr;
+#endif
+    }
+
+    void setFrameCompression(const CompressionOptions &options)
+    {
+        auto snapshot = std::make_shared<const CompressionOptions>(options);
+        PublishedOptions &published = publishedOptions();
+        std::lock_guard<std::mutex> lock(published.mutex);
+        published.current.swap(snapshot);
+        published.version.fetch_add(1, std::memory_order_release);
+    }
+
+    CompressionOptions getFrameCompression()
+    {
+        return activeOptions();
+    }
+
+    bool compressFrame(Frame &frame, const CompressionOptions &options)
+    {
+        if (!isCompressionAvailable() || !isCompressible(frame) || frame.payload.size() < options.threshold ||
+            frame.payload.empty())
+        {
+            return false;
+        }
+
+        // Only worth it if the result is smaller than the original
+        PayloadBuffer compressed;
+        compressed.resize(compressBound(frame.payload.size()));
+        const size_t size = compressPayload(frame.payload.data(), frame.payload.size(), compressed.data(),
+                                            compressed.size(), options);
+        if (size == 0 || size >= frame.payload.size())
+        {
+            return false;
+        }
+
+        compressed.resize(size);
+        frame.payload = std::move(compressed);
+        frame.payloadLen = static_cast<uint16_t>(size);
+        frame.flags |= Flags::COMPRESSED;
+        return true;
+    }
+
+    bool decompressFrame(Frame &frame, const CompressionDictionary *dictionary)
+    {
+        if (!frame.isCompressed())
+        {
+            return true;
+        }
+
+        PayloadBuffer plain;
+        if (!decompressInto(frame.payload.data(), frame.payload.size(), dictionary, plain))
+        {
+            return false;
+        }
+        frame.payload = std::move(plain);
+        frame.payloadLen = static_cast<uint16_t>(frame.payload.size());
+        frame.flags &= static_cast<uint8_t>(~Flags::COMPRESSED);
+        return true;
+    }
+
+    namespace detail
+    {
+        bool wantsCompression(const Frame &frame)
+        {
+            return shouldCompress(frame, activeOptions());
+        }
+
+        bool compressForWire(const Frame &frame, Frame &wire)
+        {
+            const CompressionOptions &options = activeOptions();
+            if (!shouldCompress(frame, options))
+            {
+                return false;
+            }
+
+            // Only worth it if the result is smaller than the original
+            wire.payload.resize(compressBound(frame.payloadLen));
+            const size_t size =
+                compressPayload(frame.payload.data(), frame.payloadLen, wire.payload.data(), wire.payload.size(), options);
+            if (size == 0 || size >= frame.payloadLen)
+            {
+                return false;
+            }
+
+            wire.payload.resize(size);
+            wire.version = frame.version;
+            wire.msgType = frame.msgType;
+            wire.srcNodeID = frame.srcNodeID;
+            wire.classID = frame.classID;
+            wire.instanceID = frame.instanceID;
+            wire.attrID = frame.attrID;
+            wire.payloadType = frame.payloadType;
+            wire.payloadLen = static_cast<uint16_t>(size);
+            wire.flags = static_cast<uint8_t>(frame.flags | Flags::COMPRESSED);
+            wire.crc.reset();
+            return true;
+        }
+
+        const Frame &wireFrame(const Frame &frame)
+        {
+            thread_local Frame compressed;
+            return compressForWire(frame, compressed) ? compressed : frame;
+        }
+
+        bool decompressPayload(const uint8_t *data, size_t size, Frame &frame)
+        {
+            if (!decompressInto(data, size, activeOptions().dictionary.get(), frame.payload))
+            {
+                return false;
+            }
+            frame.payloadLen = static_cast<uint16_t>(frame.payload.size());
+            frame.flags &= static_cast<uint8_t>(~Flags::COMPRESSED);
+            return true;
+        }
+    } // namespace detail
+
+} // namespace limp
@@ -1,30 +1,345 @@
 #include "limp/crc.hpp"
+#include <array>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define LIMP_CRC_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define LIMP_CRC_TARGET_CLMUL
+#else
+#define LIMP_CRC_TARGET_CLMUL __attribute__((target("pclmul,sse2")))
+#endif
+#elif defined(__aarch64__) && (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES))
+#define LIMP_CRC_ARM 1
+#include <arm_neon.h>
+#if defined(__linux__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+#endif
 
 namespace limp
 {
 
-    uint16_t calculateCRC16(const uint8_t *data, size_t length)
+    namespace
     {
-        uint16_t crc = CRC16_INITIAL; // Start with 0xFFFF for Modbus
 
-        for (size_t i = 0; i < length; ++i)
+        using CRCTable = std::array<uint16_t, 256>;
+
+        // Byte-at-a-time table: entry b is the CRC of byte b with a zero register
+        constexpr CRCTable makeTable()
         {
-            crc ^= static_cast<uint16_t>(data[i]); // XOR with LSB (Modbus style)
+            CRCTable table{};
+            for (uint32_t b = 0; b < 256; ++b)
+            {
+                uint16_t crc = static_cast<uint16_t>(b);
+                for (int j = 0; j < 8; ++j)
+                {
+                    crc = (crc & 0x0001) ? static_cast<uint16_t>((crc >> 1) ^ CRC16_POLYNOMIAL)
+                                         : static_cast<uint16_t>(crc >> 1);
+                }
+                table[b] = crc;
+            }
+            return table;
+        }
 
-            for (int j = 0; j < 8; ++j)
+        // Slicing-by-8 tables: slice[k][b] advances byte b through k further zero bytes
+        constexpr std::array<CRCTable, 8> makeSliceTables()
+        {
+            std::array<CRCTable, 8> slices{};
+            slices[0] = makeTable();
+            for (size_t k = 1; k < 8; ++k)
             {
-                if (crc & 0x0001) // Check LSB (reflected)
+                for (size_t b = 0; b < 256; ++b)
                 {
-                    crc = (crc >> 1) ^ CRC16_POLYNOMIAL; // Shift right and XOR , 0xA001;
+                    uint16_t prev = slices[k - 1][b];
+                    slices[k][b] = static_cast<uint16_t>((prev >> 8) ^ slices[0][prev & 0xFF]);
                 }
-                else
+            }
+            return slices;
+        }
+
+        constexpr std::array<CRCTable, 8> SLICE_TABLES = makeSliceTables();
+        constexpr const CRCTable &CRC_TABLE = SLICE_TABLES[0];
+
+        inline uint16_t updateTable(uint16_t crc, const uint8_t *data, size_t length)
+        {
+            for (size_t i = 0; i < length; ++i)
+            {
+                crc = static_cast<uint16_t>((crc >> 8) ^ CRC_TABLE[(crc ^ data[i]) & 0xFF]);
+            }
+            return crc;
+        }
+
+        inline uint16_t updateSlice8(uint16_t crc, const uint8_t *data, size_t length)
+        {
+            while (length >= 8)
+            {
+                crc = static_cast<uint16_t>(
+                    SLICE_TABLES[7][(data[0] ^ crc) & 0xFF] ^
+                    SLICE_TABLES[6][(data[1] ^ (crc >> 8)) & 0xFF] ^
+                    SLICE_TABLES[5][data[2]] ^
+                    SLICE_TABLES[4][data[3]] ^
+                    SLICE_TABLES[3][data[4]] ^
+                    SLICE_TABLES[2][data[5]] ^
+                    SLICE_TABLES[1][data[6]] ^
+                    SLICE_TABLES[0][data[7]]);
+                data += 8;
+                length -= 8;
+            }
+            return updateTable(crc, data, length);
+        }
+
+        /*
+         * Carry-less multiply folding.
+         *
+         * A 128-bit accumulator A (H:L, 64-bit halves of the polynomial) followed
+         * by n more bits is congruent mod P to H*(x^(n+64) mod P) + L*(x^n mod P),
+         * which fits back into 128 bits. Folding whole 16-byte blocks this way and
+         * finishing the last accumulator and tail bytes with the table gives the
+         * exact CRC without a Barrett reduction step.
+         *
+         * In the reflected (LSB-first) domain a 64x64 carry-less product is one
+         * bit short of the 128-bit alignment, so constants are x^(k-1) mod P.
+         */
+
+        // x^n mod P for P(x) = x^16 + x^15 + x^2 + 1 (0x8005, non-reflected)
+        constexpr uint16_t xPowModP(unsigned n)
+        {
+            uint32_t r = 1;
+            for (unsigned i = 0; i < n; ++i)
+            {
+                r <<= 1;
+                if (r & 0x10000)
+                {
+                    r ^= 0x18005;
+                }
+            }
+            return static_cast<uint16_t>(r);
+        }
+
+        constexpr uint16_t reflect16(uint16_t v)
+        {
+            uint16_t r = 0;
+            for (int i = 0; i < 16; ++i)
+            {
+                if (v & (1u << i))
                 {
-                    crc >>= 1; // Just shift right
+                    r = static_cast<uint16_t>(r | (1u << (15 - i)));
                 }
             }
+            return r;
+        }
+
+        // Reflected 64-bit fold constant for x^n
+        constexpr uint64_t foldConstant(unsigned n)
+        {
+            return static_cast<uint64_t>(reflect16(xPowModP(n - 1))) << 48;
+        }
+
+        constexpr uint64_t FOLD128_HI = foldConstant(128 + 64); // Applied to low qword (higher degrees)
+        constexpr uint64_t FOLD128_LO = foldConstant(128);
+        constexpr uint64_t FOLD512_HI = foldConstant(512 + 64);
+        constexpr uint64_t FOLD512_LO = foldConstant(512);
+
+        // Below this size the setup cost of folding outweighs its benefit
+        constexpr size_t CLMUL_MIN_LENGTH = 64;
+
+#if defined(LIMP_CRC_X86)
+
+        LIMP_CRC_TARGET_CLMUL
+        inline __m128i fold(__m128i acc, __m128i k)
+        {
+            return _mm_xor_si128(_mm_clmulepi64_si128(acc, k, 0x00),
+                                 _mm_clmulepi64_si128(acc, k, 0x11));
+        }
+
+        LIMP_CRC_TARGET_CLMUL
+        uint16_t updateCLMul(uint16_t crc, const uint8_t *data, size_t length)
+        {
+            if (length < CLMUL_MIN_LENGTH)
+            {
+                return updateSlice8(crc, data, length);
+            }
+
+            const __m128i k128 = _mm_set_epi64x(static_cast<long long>(FOLD128_LO),
+                                                static_cast<long long>(FOLD128_HI));
+            const __m128i *blocks = reinterpret_cast<const __m128i *>(data);
+            size_t count = length / 16;
+
+            // Register init is equivalent to XORing it into the first two bytes
+            __m128i acc0 = _mm_xor_si128(_mm_loadu_si128(blocks), _mm_cvtsi32_si128(crc));
+            size_t i = 1;
+
+            if (count >= 8)
+            {
+                const __m128i k512 = _mm_set_epi64x(static_cast<long long>(FOLD512_LO),
+                                                    static_cast<long long>(FOLD512_HI));
+                __m128i acc1 = _mm_loadu_si128(blocks + 1);
+                __m128i acc2 = _mm_loadu_si128(blocks + 2);
+                __m128i acc3 = _mm_loadu_si128(blocks + 3);
+                for (i = 4; i + 4 <= count; i += 4)
+                {
+                    acc0 = _mm_xor_si128(fold(acc0, k512), _mm_loadu_si128(blocks + i));
+                    acc1 = _mm_xor_si128(fold(acc1, k512), _mm_loadu_si128(blocks + i + 1));
+                    acc2 = _mm_xor_si128(fold(acc2, k512), _mm_loadu_si128(blocks + i + 2));
+                    acc3 = _mm_xor_si128(fold(acc3, k512), _mm_loadu_si128(blocks + i + 3));
+                }
+                acc1 = _mm_xor_si128(fold(acc0, k128), acc1);
+                acc2 = _mm_xor_si128(fold(acc1, k128), acc2);
+                acc0 = _mm_xor_si128(fold(acc2, k128), acc3);
+            }
+
+            for (; i < count; ++i)
+            {
+                acc0 = _mm_xor_si128(fold(acc0, k128), _mm_loadu_si128(blocks + i));
+            }
+
+            alignas(16) uint8_t folded[16];
+            _mm_store_si128(reinterpret_cast<__m128i *>(folded), acc0);
+            crc = updateTable(0, folded, sizeof(folded));
+            return updateTable(crc, data + count * 16, length - count * 16);
+        }
+
+        bool cpuHasCLMul() noexcept
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            int info[4];
+            __cpuid(info, 1);
+            return (info[2] & (1 << 1)) != 0; // ECX bit 1: PCLMULQDQ
+#else
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse2");
+#endif
+        }
+
+#elif defined(LIMP_CRC_ARM)
+
+        inline uint64x2_t fold(uint64x2_t acc, uint64_t kHi, uint64_t kLo)
+        {
+            poly128_t lo = vmull_p64(static_cast<poly64_t>(vgetq_lane_u64(acc, 0)), static_cast<poly64_t>(kHi));
+            poly128_t hi = vmull_p64(static_cast<poly64_t>(vgetq_lane_u64(acc, 1)), static_cast<poly64_t>(kLo));
+            return veorq_u64(vreinterpretq_u64_p128(lo), vreinterpretq_u64_p128(hi));
         }
 
-        return crc;
+        inline uint64x2_t loadBlock(const uint8_t *p)
+        {
+            return vreinterpretq_u64_u8(vld1q_u8(p));
+        }
+
+        uint16_t updateCLMul(uint16_t crc, const uint8_t *data, size_t length)
+        {
+            if (length < CLMUL_MIN_LENGTH)
+            {
+                return updateSlice8(crc, data, length);
+            }
+
+            size_t count = length / 16;
+            uint64x2_t acc0 = veorq_u64(loadBlock(data), vsetq_lane_u64(crc, vdupq_n_u64(0), 0));
+            size_t i = 1;
+
+            if (count >= 8)
+            {
+                uint64x2_t acc1 = loadBlock(data + 16);
+                uint64x2_t acc2 = loadBlock(data + 32);
+                uint64x2_t acc3 = loadBlock(data + 48);
+                for (i = 4; i + 4 <= count; i += 4)
+                {
+                    acc0 = veorq_u64(fold(acc0, FOLD512_HI, FOLD512_LO), loadBlock(data + i * 16));
+                    acc1 = veorq_u64(fold(acc1, FOLD512_HI, FOLD512_LO), loadBlock(data + (i + 1) * 16));
+                    acc2 = veorq_u64(fold(acc2, FOLD512_HI, FOLD512_LO), loadBlock(data + (i + 2) * 16));
+                    acc3 = veorq_u64(fold(acc3, FOLD512_HI, FOLD512_LO), loadBlock(data + (i + 3) * 16));
+                }
+                acc1 = veorq_u64(fold(acc0, FOLD128_HI, FOLD128_LO), acc1);
+                acc2 = veorq_u64(fold(acc1, FOLD128_HI, FOLD128_LO), acc2);
+                acc0 = veorq_u64(fold(acc2, FOLD128_HI, FOLD128_LO), acc3);
+            }
+
+            for (; i < count; ++i)
+            {
+                acc0 = veorq_u64(fold(acc0, FOLD128_HI, FOLD128_LO), loadBlock(data + i * 16));
+            }
+
+            uint8_t folded[16];
+            vst1q_u8(folded, vreinterpretq_u8_u64(acc0));
+            crc = updateTable(0, folded, sizeof(folded));
+            return updateTable(crc, data + count * 16, length - count * 16);
+        }
+
+        bool cpuHasCLMul() noexcept
+        {
+#if defined(__linux__) && defined(HWCAP_PMULL)
+            return (getauxval(AT_HWCAP) & HWCAP_PMULL) != 0;
+#else
+            return true; // Compiled for a crypto-capable target
+#endif
+        }
+
+#else
+
+        inline uint16_t updateCLMul(uint16_t crc, const uint8_t *data, size_t length)
+        {
+            return updateSlice8(crc, data, length);
+        }
+
+        inline bool cpuHasCLMul() noexcept
+        {
+            return false;
+        }
+
+#endif
+
+        using UpdateFn = uint16_t (*)(uint16_t, const uint8_t *, size_t);
+
+        bool clmulSupported() noexcept
+        {
+            static const bool supported = cpuHasCLMul();
+            return supported;
+        }
+
+        UpdateFn fastestUpdate() noexcept
+        {
+            static const UpdateFn fn = clmulSupported() ? &updateCLMul : &updateSlice8;
+            return fn;
+        }
+
+        // Short inputs (frame headers, scalar frames) stay on the table path
+        constexpr size_t SLICE8_MIN_LENGTH = 16;
+
+    } // namespace
+
+    uint16_t updateCRC16(uint16_t crc, const uint8_t *data, size_t length)
+    {
+        if (length < SLICE8_MIN_LENGTH)
+        {
+            return updateTable(crc, data, length);
+        }
+        return fastestUpdate()(crc, data, length);
+    }
+
+    uint16_t calculateCRC16(const uint8_t *data, size_t length)
+    {
+        return updateCRC16(CRC16_INITIAL, data, length);
+    }
+
+    uint16_t calculateCRC16(const uint8_t *data, size_t length, CRC16Engine engine)
+    {
+        switch (engine)
+        {
+        case CRC16Engine::Table:
+            return updateTable(CRC16_INITIAL, data, length);
+        case CRC16Engine::CLMul:
+            if (clmulSupported())
+            {
+                return updateCLMul(CRC16_INITIAL, data, length);
+            }
+            return updateSlice8(CRC16_INITIAL, data, length);
+        case CRC16Engine::Slice8:
+        default:
+            return updateSlice8(CRC16_INITIAL, data, length);
+        }
     }
 
     bool verifyCRC16(const uint8_t *data, size_t length)
@@ -44,4 +359,29 @@ namespace limp
         return calculated == stored;
     }
 
+    bool isCRC16EngineSupported(CRC16Engine engine) noexcept
+    {
+        return engine != CRC16Engine::CLMul || clmulSupported();
+    }
+
+    CRC16Engine activeCRC16Engine() noexcept
+    {
+        return clmulSupported() ? CRC16Engine::CLMul : CRC16Engine::Slice8;
+    }
+
+    const char *toString(CRC16Engine engine) noexcept
+    {
+        switch (engine)
+        {
+        case CRC16Engine::Table:
+            return "Table";
+        case CRC16Engine::Slice8:
+            return "Slice8";
+        case CRC16Engine::CLMul:
+            return "CLMul";
+        default:
+            return "UNKNOWN";
+        }
+    }
+
 } // namespace limp
@@ -0,0 +1,42 @@
+#include "limp/credit.hpp"
+#include "limp/message.hpp"
+
+namespace limp
+{
+
+    namespace
+    {
+        template <typename Source>
+        bool parseCredit(const Source &source, MsgType msgType, uint16_t classID, uint32_t &credits) noexcept
+        {
+            if (msgType != MsgType::ACK || classID != CREDIT_CLASS_ID)
+            {
+                return false;
+            }
+
+            const std::optional<uint32_t> value = MessageView(source).getUInt32();
+            if (!value)
+            {
+                return false;
+            }
+            credits = *value;
+            return true;
+        }
+    } // namespace
+
+    Frame makeCreditFrame(uint16_t srcNode, uint32_t credits)
+    {
+        return MessageBuilder::ack(srcNode, CREDIT_CLASS_ID, 0, 0).setPayload(credits).build();
+    }
+
+    bool parseCreditFrame(const Frame &frame, uint32_t &credits) noexcept
+    {
+        return parseCredit(frame, frame.msgType, frame.classID, credits);
+    }
+
+    bool parseCreditFrame(const FrameView &view, uint32_t &credits) noexcept
+    {
+        return parseCredit(view, view.msgType(), view.classID(), credits);
+    }
+
+} // namespace limp
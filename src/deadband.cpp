@@ -0,0 +1,241 @@
+#include "limp/deadband.hpp"
+#include "limp/last_value_cache.hpp"
+#include "limp/utils.hpp"
+#include <cmath>
+#include <cstring>
+
+namespace limp
+{
+
+    namespace
+    {
+        /** @brief Slot index for a key (Fibonacci hashing) */
+        size_t slotOf(uint64_t key, size_t mask) noexcept
+        {
+            return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+        }
+
+        /** @brief FNV-1a over the payload, for payloads compared by content */
+        uint64_t hashPayload(const PayloadBuffer &payload) noexcept
+        {
+            uint64_t hash = 0xCBF29CE484222325ull;
+            for (uint8_t byte : payload)
+            {
+                hash = (hash ^ byte) * 0x100000001B3ull;
+            }
+            return hash;
+        }
+
+        /** @brief Decode a numeric scalar payload */
+        bool numericValue(const Frame &frame, double &value) noexcept
+        {
+            const uint8_t *data = frame.payload.data();
+            if (frame.payload.size() != getPayloadTypeSize(frame.payloadType))
+            {
+                return false;
+            }
+
+            uint16_t u16;
+            uint32_t u32;
+            uint64_t u64;
+            switch (frame.payloadType)
+            {
+            case PayloadType::UINT8:
+                value = data[0];
+                return true;
+            case PayloadType::UINT16:
+                std::memcpy(&u16, data, 2);
+                value = utils::ntoh16(u16);
+                return true;
+            case PayloadType::UINT32:
+                std::memcpy(&u32, data, 4);
+                value = utils::ntoh32(u32);
+                return true;
+            case PayloadType::UINT64:
+                std::memcpy(&u64, data, 8);
+                value = static_cast<double>(utils::ntoh64(u64));
+                return true;
+            case PayloadType::FLOAT32:
+                std::memcpy(&u32, data, 4);
+                value = utils::bitsToFloat(utils::ntoh32(u32));
+                return true;
+            case PayloadType::FLOAT64:
+                std::memcpy(&u64, data, 8);
+                value = utils::bitsToDouble(utils::ntoh64(u64));
+                return true;
+            default:
+                return false;
+            }
+        }
+
+        uint64_t toBits(double value) noexcept
+        {
+            uint64_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+        double fromBits(uint64_t bits) noexcept
+        {
+            double value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+    } // namespace
+
+    DeadbandFilter::DeadbandFilter(const Options &options)
+        : options_(options), mask_(0), size_(0)
+    {
+        size_t capacity = 16;
+        while (capacity < options_.initialCapacity)
+        {
+            capacity <<= 1;
+        }
+        slots_.resize(capacity);
+        mask_ = capacity - 1;
+    }
+
+    DeadbandFilter::Slot *DeadbandFilter::find(uint64_t key) noexcept
+    {
+        for (size_t i = slotOf(key, mask_);; i = (i + 1) & mask_)
+        {
+            Slot &slot = slots_[i];
+            if (slot.key == key)
+            {
+                return &slot;
+            }
+            if (slot.key == EMPTY_KEY)
+            {
+                return nullptr;
+            }
+        }
+    }
+
+    DeadbandFilter::Slot &DeadbandFilter::findOrInsert(uint64_t key)
+    {
+        // Keep the load factor below 3/4 so probe sequences stay short
+        if ((size_ + 1) * 4 > slots_.size() * 3)
+        {
+            grow();
+        }
+
+        size_t i = slotOf(key, mask_);
+        while (slots_[i].key != key && slots_[i].key != EMPTY_KEY)
+        {
+            i = (i + 1) & mask_;
+        }
+
+        Slot &slot = slots_[i];
+        if (slot.key == EMPTY_KEY)
+        {
+            slot.key = key;
+            slot.absolute = options_.absolute;
+            slot.percent = static_cast<float>(options_.percent);
+            ++size_;
+        }
+        return slot;
+    }
+
+    void DeadbandFilter::grow()
+    {
+        std::vector<Slot> old(slots_.size() * 2);
+        old.swap(slots_);
+        mask_ = slots_.size() - 1;
+        for (const Slot &slot : old)
+        {
+            if (slot.key != EMPTY_KEY)
+            {
+                size_t i = slotOf(slot.key, mask_);
+                while (slots_[i].key != EMPTY_KEY)
+                {
+                    i = (i + 1) & mask_;
+                }
+                slots_[i] = slot;
+            }
+        }
+    }
+
+    bool DeadbandFilter::check(const Frame &frame, Clock::time_point now)
+    {
+        if (frame.msgType != MsgType::EVENT)
+        {
+            return true;
+        }
+
+        Slot &slot = findOrInsert(LastValueCache::keyOf(frame.classID, frame.instanceID, frame.attrID));
+        const int64_t ticks = now.time_since_epoch().count();
+
+        double number = 0.0;
+        const bool numeric = numericValue(frame, number);
+        const uint64_t value = numeric ? toBits(number) : hashPayload(frame.payload);
+
+        if (slot.hasValue && slot.type == frame.payloadType)
+        {
+            bool unchanged;
+            if (numeric)
+            {
+                const double last = fromBits(slot.value);
+                const double delta = std::fabs(number - last);
+                unchanged = value == slot.value || delta <= slot.absolute ||
+                            (slot.percent > 0.0f && delta <= std::fabs(last) * slot.percent / 100.0);
+            }
+            else
+            {
+                unchanged = value == slot.value;
+            }
+
+            if (unchanged)
+            {
+                const bool refresh = options_.refreshInterval.count() > 0 &&
+                                     Clock::duration(ticks - slot.sentAt) >= options_.refreshInterval;
+                if (!refresh)
+                {
+                    ++stats_.suppressed;
+                    return false;
+                }
+                ++stats_.refreshed;
+            }
+            else
+            {
+                ++stats_.passed;
+            }
+        }
+        else
+        {
+            ++stats_.passed;
+        }
+
+        slot.value = value;
+        slot.sentAt = ticks;
+        slot.type = frame.payloadType;
+        slot.hasValue = true;
+        return true;
+    }
+
+    void DeadbandFilter::invalidate(const Frame &frame) noexcept
+    {
+        if (Slot *slot = find(LastValueCache::keyOf(frame.classID, frame.instanceID, frame.attrID)))
+        {
+            slot->hasValue = false;
+        }
+    }
+
+    void DeadbandFilter::setDeadband(uint16_t classID, uint16_t instanceID, uint16_t attrID, double absolute,
+                                     double percent)
+    {
+        Slot &slot = findOrInsert(LastValueCache::keyOf(classID, instanceID, attrID));
+        slot.absolute = absolute;
+        slot.percent = static_cast<float>(percent);
+    }
+
+    void DeadbandFilter::clear() noexcept
+    {
+        for (Slot &slot : slots_)
+        {
+            slot = Slot();
+        }
+        size_ = 0;
+        stats_ = Stats();
+    }
+
+} // namespace limp
@@ -0,0 +1,124 @@
+#include "limp/error_event.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+namespace limp
+{
+
+    const char *toString(TransportOperation operation) noexcept
+    {
+        switch (operation)
+        {
+        case TransportOperation::Setup:
+            return "Setup";
+        case TransportOperation::Connect:
+            return "Connect";
+        case TransportOperation::Bind:
+            return "Bind";
+        case TransportOperation::Send:
+            return "Send";
+        case TransportOperation::Receive:
+            return "Receive";
+        case TransportOperation::Subscribe:
+            return "Subscribe";
+        case TransportOperation::Close:
+            return "Close";
+        default:
+            return "Unknown";
+        }
+    }
+
+    size_t formatErrorEvent(const ErrorEvent &event, const char *prefix, char *buffer, size_t size) noexcept
+    {
+        if (!buffer || size == 0)
+        {
+            return 0;
+        }
+
+        const char *context = event.context ? event.context : toString(event.operation);
+        const char *reason = event.reason ? event.reason : toString(event.error);
+        int length = (event.errnum != 0)
+                         ? std::snprintf(buffer, size, "%s error during %s: %s (code: %d)", prefix, context, reason,
+                                         event.errnum)
+                         : std::snprintf(buffer, size, "%s error during %s: %s", prefix, context, reason);
+        if (length < 0)
+        {
+            buffer[0] = '\0';
+            return 0;
+        }
+        return (static_cast<size_t>(length) < size) ? static_cast<size_t>(length) : size - 1;
+    }
+
+    ErrorReporter::ErrorReporter(const char *prefix) noexcept
+        : prefix_(prefix),
+          burst_(DEFAULT_BURST),
+          interval_(DEFAULT_INTERVAL),
+          windowStart_(),
+          windowCount_(0),
+          pendingSuppressed_(0),
+          suppressedTotal_(0)
+    {
+    }
+
+    void ErrorReporter::setRateLimit(size_t burst, std::chrono::milliseconds interval) noexcept
+    {
+        burst_ = burst;
+        interval_ = interval;
+        windowCount_ = 0;
+    }
+
+    void ErrorReporter::report(const ErrorEvent &event)
+    {
+        if (eventCallback_)
+        {
+            eventCallback_(event);
+            if (!messageCallback_)
+            {
+                return; // Structured consumer replaces the default stderr output
+            }
+        }
+
+        const Clock::time_point now = Clock::now();
+        if (now - windowStart_ >= interval_)
+        {
+            windowStart_ = now;
+            windowCount_ = 0;
+        }
+        if (windowCount_ >= burst_)
+        {
+            ++pendingSuppressed_;
+            ++suppressedTotal_;
+            return;
+        }
+        ++windowCount_;
+        emitMessage(event);
+    }
+
+    void ErrorReporter::emitMessage(const ErrorEvent &event)
+    {
+        char text[256];
+        size_t length = formatErrorEvent(event, prefix_, text, sizeof(text));
+        if (pendingSuppressed_ > 0 && length < sizeof(text))
+        {
+            int extra = std::snprintf(text + length, sizeof(text) - length, " (%llu more suppressed)",
+                                      static_cast<unsigned long long>(pendingSuppressed_));
+            if (extra > 0)
+            {
+                length = std::min(length + static_cast<size_t>(extra), sizeof(text) - 1);
+            }
+            pendingSuppressed_ = 0;
+        }
+
+        if (messageCallback_)
+        {
+            messageCallback_(std::string(text, length));
+        }
+        else
+        {
+            std::cerr.write(text, static_cast<std::streamsize>(length)) << '\n';
+        }
+    }
+
+} // namespace limp
@@ -1,4 +1,6 @@
 #include "limp/frame.hpp"
+#include "limp/frame_view.hpp"
+#include "limp/compression.hpp"
 #include "limp/crc.hpp"
 #include "limp/utils.hpp"
 #include <cstring>
@@ -47,6 +49,12 @@ namespace limp
             return false;
         }
 
+        // Only variable-length payloads are compressed
+        if (isCompressed() && payloadType != PayloadType::STRING && payloadType != PayloadType::OPAQUE)
+        {
+            return false;
+        }
+
         // Validate payload length for fixed-size types
         uint16_t expectedSize = getPayloadTypeSize(payloadType);
         if (expectedSize > 0 && payloadLen != expectedSize)
@@ -54,6 +62,13 @@ namespace limp
             return false;
         }
 
+        // Array payloads hold whole elements only
+        uint16_t elementSize = getPayloadElementSize(payloadType);
+        if (elementSize > 0 && payloadLen % elementSize != 0)
+        {
+            return false;
+        }
+
         // Check payload length limits
         if (payloadLen > MAX_PAYLOAD_SIZE)
         {
@@ -69,16 +84,8 @@ namespace limp
         return true;
     }
 
-    bool serializeFrame(const Frame &frame, std::vector<uint8_t> &buffer)
+    void serializeFrameHeader(const Frame &frame, uint8_t *buffer) noexcept
     {
-        if (!frame.validate())
-        {
-            return false;
-        }
-
-        // Resize buffer
-        buffer.resize(frame.totalSize());
-
         size_t offset = 0;
 
         // 0： Version
@@ -116,133 +123,89 @@ namespace limp
         offset += 2;
 
         // 13： Flags
-        buffer[offset++] = frame.flags;
+        buffer[offset] = frame.flags;
+    }
+
+    size_t detail::serializeValidatedFrame(const Frame &frame, uint8_t *buffer) noexcept
+    {
+        serializeFrameHeader(frame, buffer);
+        size_t offset = HEADER_SIZE;
+
+        // CRC is accumulated from the source bytes as they are written
+        const bool withCRC = frame.hasCRC();
+        Crc16 crc;
+        if (withCRC)
+        {
+            crc.update(buffer, HEADER_SIZE);
+        }
 
         // Payload
         if (frame.payloadLen > 0)
         {
             std::memcpy(&buffer[offset], frame.payload.data(), frame.payloadLen);
+            if (withCRC)
+            {
+                crc.update(frame.payload.data(), frame.payloadLen);
+            }
             offset += frame.payloadLen;
         }
 
         // CRC (if enabled)
-        if (frame.hasCRC())
+        if (withCRC)
         {
-            uint16_t crc = calculateCRC16(buffer.data(), offset);
-            uint16_t crcBE = utils::hton16(crc);
+            uint16_t crcBE = utils::hton16(crc.finalize());
             std::memcpy(&buffer[offset], &crcBE, 2);
+            offset += 2;
         }
 
-        return true;
+        return offset;
     }
 
-    bool deserializeFrame(const std::vector<uint8_t> &buffer, Frame &frame)
+    size_t serializeFrameInto(const Frame &frame, uint8_t *buffer, size_t capacity)
     {
-        return deserializeFrame(buffer.data(), buffer.size(), frame);
-    }
-
-    bool deserializeFrame(const uint8_t *data, size_t length, Frame &frame)
-    {
-        // Minimum frame size check
-        if (length < MIN_FRAME_SIZE)
+        if (!frame.validate())
         {
-            return false;
+            return 0;
         }
 
-        size_t offset = 0;
-
-        // Version
-        frame.version = data[offset++];
-        if (frame.version != PROTOCOL_VERSION)
+        if (buffer == nullptr || capacity < frame.totalSize())
         {
-            return false;
+            return 0;
         }
 
-        // MsgType
-        frame.msgType = static_cast<MsgType>(data[offset++]);
-
-        // SrcNodeID (big-endian)
-        uint16_t srcBE;
-        std::memcpy(&srcBE, &data[offset], 2);
-        frame.srcNodeID = utils::ntoh16(srcBE);
-        offset += 2;
-
-        // ClassID (big-endian)
-        uint16_t classBE;
-        std::memcpy(&classBE, &data[offset], 2);
-        frame.classID = utils::ntoh16(classBE);
-        offset += 2;
-
-        // InstanceID (big-endian)
-        uint16_t instBE;
-        std::memcpy(&instBE, &data[offset], 2);
-        frame.instanceID = utils::ntoh16(instBE);
-        offset += 2;
-
-        // AttrID (big-endian)
-        uint16_t attrBE;
-        std::memcpy(&attrBE, &data[offset], 2);
-        frame.attrID = utils::ntoh16(attrBE);
-        offset += 2;
-
-        // PayloadTypeID
-        frame.payloadType = static_cast<PayloadType>(data[offset++]);
-
-        // PayloadLen (big-endian)
-        uint16_t lenBE;
-        std::memcpy(&lenBE, &data[offset], 2);
-        frame.payloadLen = utils::ntoh16(lenBE);
-        offset += 2;
-
-        // Flags
-        frame.flags = data[offset++];
+        return detail::serializeValidatedFrame(frame, buffer);
+    }
 
-        // Check for reserved flags
-        if (frame.flags & Flags::RESERVED_MASK)
+    bool serializeFrame(const Frame &frame, std::vector<uint8_t> &buffer)
+    {
+        if (!frame.validate())
         {
             return false;
         }
 
-        // Calculate expected total size
-        size_t expectedSize = HEADER_SIZE + frame.payloadLen;
-        if (frame.hasCRC())
-        {
-            expectedSize += CRC_SIZE;
-        }
-
-        if (length != expectedSize)
-        {
-            return false;
-        }
+        // Resize buffer
+        const Frame &wire = detail::wireFrame(frame);
+        buffer.resize(wire.totalSize());
 
-        // Payload
-        frame.payload.clear();
-        if (frame.payloadLen > 0)
-        {
-            frame.payload.resize(frame.payloadLen);
-            std::memcpy(frame.payload.data(), &data[offset], frame.payloadLen);
-            offset += frame.payloadLen;
-        }
+        detail::serializeValidatedFrame(wire, buffer.data());
+        return true;
+    }
 
-        // Verify CRC if present
-        if (frame.hasCRC())
-        {
-            if (!verifyCRC16(data, length))
-            {
-                return false;
-            }
+    bool deserializeFrame(const std::vector<uint8_t> &buffer, Frame &frame)
+    {
+        return deserializeFrame(buffer.data(), buffer.size(), frame);
+    }
 
-            // Store CRC value
-            uint16_t crcBE;
-            std::memcpy(&crcBE, &data[offset], 2);
-            frame.crc = utils::ntoh16(crcBE);
-        }
-        else
+    bool deserializeFrame(const uint8_t *data, size_t length, Frame &frame)
+    {
+        // Structure and CRC checks are shared with the zero-copy view
+        FrameView view;
+        if (!deserializeFrameView(data, length, view))
         {
-            frame.crc.reset();
+            return false;
         }
 
-        return frame.validate();
+        return view.toFrame(frame);
     }
 
 } // namespace limp
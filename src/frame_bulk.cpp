@@ -0,0 +1,221 @@
+#include "limp/frame_bulk.hpp"
+#include "limp/crc.hpp"
+#include "limp/thread_pool.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace limp
+{
+
+    namespace
+    {
+        /** @brief Per-payload-type length rules, so the header check needs no switch */
+        struct TypeRule
+        {
+            uint16_t fixedSize = 0;   ///< Required PayloadLen (when fixedMask is set)
+            uint16_t fixedMask = 0;   ///< 0xFFFF for fixed-size types, else 0
+            uint16_t elementMask = 0; ///< Element size - 1 for array types (sizes are powers of two)
+            uint8_t compressible = 0; ///< Flags::COMPRESSED if the type may be compressed
+        };
+
+        std::array<TypeRule, 256> makeTypeRules() noexcept
+        {
+            std::array<TypeRule, 256> rules{};
+            for (size_t i = 0; i < rules.size(); ++i)
+            {
+                const PayloadType type = static_cast<PayloadType>(i);
+                const uint16_t fixed = getPayloadTypeSize(type);
+                const uint16_t element = getPayloadElementSize(type);
+                rules[i].fixedSize = fixed;
+                rules[i].fixedMask = fixed > 0 ? 0xFFFF : 0;
+                rules[i].elementMask = element > 0 ? static_cast<uint16_t>(element - 1) : 0;
+                rules[i].compressible =
+                    (type == PayloadType::STRING || type == PayloadType::OPAQUE) ? Flags::COMPRESSED : 0;
+            }
+            return rules;
+        }
+
+        const std::array<TypeRule, 256> typeRules = makeTypeRules();
+
+        /** @brief Header that fails every check; stands in for inputs too short to read */
+        const uint8_t blankHeader[HEADER_SIZE] = {};
+
+        /**
+         * @brief FrameView::validate() without the CRC, as straight-line code
+         *
+         * Every rule is folded into one bitwise accumulator, so a batch of
+         * mixed frames costs the same per frame and the loop does not
+         * mispredict on bad input.
+         */
+        bool headerValid(const ByteSpan &input) noexcept
+        {
+            const bool readable = input.data() != nullptr && input.size() >= MIN_FRAME_SIZE;
+            const uint8_t *header = readable ? input.data() : blankHeader;
+
+            const uint8_t flags = header[13];
+            const uint16_t payloadLen = static_cast<uint16_t>((header[11] << 8) | header[12]);
+            const TypeRule &rule = typeRules[header[10]];
+            const size_t expectedSize = HEADER_SIZE + payloadLen + (flags & Flags::CRC_PRESENT) * CRC_SIZE;
+
+            size_t bad = static_cast<uint8_t>(header[0] ^ PROTOCOL_VERSION);
+            bad |= flags & Flags::RESERVED_MASK;
+            bad |= flags & Flags::COMPRESSED & ~rule.compressible;
+            bad |= (payloadLen ^ rule.fixedSize) & rule.fixedMask;
+            bad |= payloadLen & rule.elementMask;
+            bad |= expectedSize ^ input.size();
+            return bad == 0;
+        }
+
+        /** @brief A batch split into chunks, shared by the caller and the pool tasks */
+        struct ChunkedRun
+        {
+            std::function<size_t(size_t, size_t)> work; ///< Process [begin, end), return valid count
+            size_t count = 0;                           ///< Number of items
+            size_t chunkSize = 0;                       ///< Items per chunk
+            size_t chunks = 0;                          ///< Number of chunks
+            std::atomic<size_t> nextChunk{0};           ///< Next chunk to claim
+            std::atomic<size_t> valid{0};               ///< Sum of work() results
+
+            std::mutex mutex;
+            std::condition_variable done;
+            size_t finished = 0;      ///< Chunks completed (guarded by mutex)
+            std::exception_ptr error; ///< First exception thrown by work() (guarded by mutex)
+        };
+
+        /** @brief Claim and process chunks until none are left */
+        void drain(ChunkedRun &run)
+        {
+            for (size_t chunk = run.nextChunk.fetch_add(1); chunk < run.chunks; chunk = run.nextChunk.fetch_add(1))
+            {
+                const size_t begin = chunk * run.chunkSize;
+                const size_t end = std::min(run.count, begin + run.chunkSize);
+
+                std::exception_ptr error;
+                try
+                {
+                    run.valid.fetch_add(run.work(begin, end), std::memory_order_relaxed);
+                }
+                catch (...)
+                {
+                    error = std::current_exception();
+                }
+
+                std::lock_guard<std::mutex> lock(run.mutex);
+                if (error && !run.error)
+                {
+                    run.error = error;
+                }
+                if (++run.finished == run.chunks)
+                {
+                    run.done.notify_all();
+                }
+            }
+        }
+
+        /**
+         * @brief Run work over [0, count) in chunks on the pool and the calling thread
+         *
+         * The caller claims chunks alongside the workers and only waits for
+         * chunks already being processed, so it never waits on a task stuck
+         * behind its own (as it would when called from a pool worker). Tasks
+         * that start after the batch is done find no chunk left and return
+         * without touching it.
+         */
+        size_t runChunked(size_t count, const BulkDecodeOptions &options,
+                          std::function<size_t(size_t, size_t)> work)
+        {
+            const size_t chunkSize = std::max<size_t>(options.framesPerTask, 1);
+            if (count <= chunkSize)
+            {
+                return work(0, count);
+            }
+
+            auto run = std::make_shared<ChunkedRun>();
+            run->work = std::move(work);
+            run->count = count;
+            run->chunkSize = chunkSize;
+            run->chunks = (count + chunkSize - 1) / chunkSize;
+
+            ThreadPool &pool = options.pool ? *options.pool : getThreadPool();
+            const size_t helpers = std::min(pool.size(), run->chunks - 1);
+            for (size_t i = 0; i < helpers; ++i)
+            {
+                pool.submit([run]() { drain(*run); });
+            }
+
+            drain(*run);
+
+            std::unique_lock<std::mutex> lock(run->mutex);
+            run->done.wait(lock, [&run]() { return run->finished == run->chunks; });
+            if (run->error)
+            {
+                std::rethrow_exception(run->error);
+            }
+            return run->valid.load(std::memory_order_relaxed);
+        }
+
+        /** @brief Header and CRC check of one input */
+        bool frameValid(const ByteSpan &input, bool headerOk) noexcept
+        {
+            return headerOk && (!(input[13] & Flags::CRC_PRESENT) || verifyCRC16(input.data(), input.size()));
+        }
+    } // namespace
+
+    size_t checkFrameHeaders(Span<const ByteSpan> inputs, Span<bool> valid) noexcept
+    {
+        const size_t count = std::min(inputs.size(), valid.size());
+        size_t passed = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            valid[i] = headerValid(inputs[i]);
+            passed += valid[i];
+        }
+        return passed;
+    }
+
+    size_t validateFrames(Span<const ByteSpan> inputs, Span<FrameView> views, Span<bool> valid,
+                          const BulkDecodeOptions &options)
+    {
+        const size_t count = std::min({inputs.size(), views.size(), valid.size()});
+        return runChunked(count, options, [&](size_t begin, size_t end) {
+            checkFrameHeaders(inputs.subspan(begin, end - begin), valid.subspan(begin, end - begin));
+
+            size_t passed = 0;
+            for (size_t i = begin; i < end; ++i)
+            {
+                valid[i] = frameValid(inputs[i], valid[i]);
+                if (valid[i])
+                {
+                    views[i] = FrameView(inputs[i].data(), inputs[i].size());
+                    ++passed;
+                }
+            }
+            return passed;
+        });
+    }
+
+    size_t deserializeFrames(Span<const ByteSpan> inputs, Span<Frame> frames, Span<bool> valid,
+                             const BulkDecodeOptions &options)
+    {
+        const size_t count = std::min({inputs.size(), frames.size(), valid.size()});
+        return runChunked(count, options, [&](size_t begin, size_t end) {
+            checkFrameHeaders(inputs.subspan(begin, end - begin), valid.subspan(begin, end - begin));
+
+            size_t passed = 0;
+            for (size_t i = begin; i < end; ++i)
+            {
+                valid[i] = frameValid(inputs[i], valid[i]) &&
+                           FrameView(inputs[i].data(), inputs[i].size()).toFrame(frames[i]);
+                passed += valid[i];
+            }
+            return passed;
+        });
+    }
+
+} // namespace limp
@@ -0,0 +1,146 @@
+#include "limp/frame_decoder.hpp"
+#include <cstring>
+
+namespace limp
+{
+
+    FrameDecoder::FrameDecoder(const Options &options)
+        : options_(options), buffer_(options.initialBufferSize), begin_(0), end_(0), inSync_(true)
+    {
+    }
+
+    bool FrameDecoder::isPlausibleHeader(const uint8_t *header, bool requireCRC) noexcept
+    {
+        FrameView view(header, HEADER_SIZE);
+        if (view.version() != PROTOCOL_VERSION || (view.flags() & Flags::RESERVED_MASK) != 0)
+        {
+            return false;
+        }
+        if (requireCRC && !view.hasCRC())
+        {
+            return false;
+        }
+
+        const uint8_t msgType = header[1];
+        if (msgType < static_cast<uint8_t>(MsgType::REQUEST) || msgType > static_cast<uint8_t>(MsgType::ACK))
+        {
+            return false;
+        }
+
+        const PayloadType payloadType = view.payloadType();
+        if (static_cast<uint8_t>(payloadType) > static_cast<uint8_t>(PayloadType::FLOAT64_ARRAY))
+        {
+            return false;
+        }
+
+        const uint16_t payloadLen = view.payloadLen();
+        const uint16_t fixedSize = getPayloadTypeSize(payloadType);
+        const uint16_t elementSize = getPayloadElementSize(payloadType);
+        if (payloadLen > MAX_PAYLOAD_SIZE || (payloadType == PayloadType::NONE && payloadLen != 0) ||
+            (fixedSize > 0 && payloadLen != fixedSize) || (elementSize > 0 && payloadLen % elementSize != 0))
+        {
+            return false;
+        }
+        return true;
+    }
+
+    bool FrameDecoder::extract(const uint8_t *data, size_t length, size_t &offset, FrameView &view)
+    {
+        while (length - offset >= HEADER_SIZE)
+        {
+            const uint8_t *frame = data + offset;
+            size_t total = 0;
+            if (isPlausibleHeader(frame, options_.requireCRC))
+            {
+                FrameView header(frame, HEADER_SIZE);
+                total = HEADER_SIZE + header.payloadLen() + (header.hasCRC() ? CRC_SIZE : 0);
+                if (length - offset < total)
+                {
+                    return false; // Wait for the rest of the frame
+                }
+
+                view = FrameView(frame, total);
+                if (view.validate())
+                {
+                    inSync_ = true;
+                    ++stats_.frames;
+                    offset += total;
+                    return true;
+                }
+            }
+
+            // Not a frame here: slide one byte
+            if (inSync_)
+            {
+                ++stats_.resyncs;
+                inSync_ = false;
+            }
+            ++stats_.discardedBytes;
+            ++offset;
+        }
+        return false;
+    }
+
+    void FrameDecoder::reserveTail(size_t size)
+    {
+        if (begin_ > 0)
+        {
+            std::memmove(buffer_.data(), buffer_.data() + begin_, end_ - begin_);
+            end_ -= begin_;
+            begin_ = 0;
+        }
+        if (buffer_.size() - end_ < size)
+        {
+            size_t capacity = buffer_.size() * 2;
+            if (capacity < end_ + size)
+            {
+                capacity = end_ + size;
+            }
+            buffer_.resize(capacity);
+        }
+    }
+
+    void FrameDecoder::append(const uint8_t *data, size_t length)
+    {
+        if (length == 0)
+        {
+            return;
+        }
+        reserveTail(length);
+        std::memcpy(buffer_.data() + end_, data, length);
+        end_ += length;
+    }
+
+    Span<uint8_t> FrameDecoder::prepare(size_t minSize)
+    {
+        reserveTail(minSize);
+        return Span<uint8_t>(buffer_.data() + end_, buffer_.size() - end_);
+    }
+
+    bool FrameDecoder::next(FrameView &view)
+    {
+        size_t offset = 0;
+        const bool found = extract(buffer_.data() + begin_, buffered(), offset, view);
+        begin_ += offset;
+        return found;
+    }
+
+    size_t FrameDecoder::feed(const uint8_t *data, size_t length, std::vector<Frame> &frames)
+    {
+        return feed(data, length, [&frames](const FrameView &view)
+                    {
+                        frames.emplace_back();
+                        if (!view.toFrame(frames.back()))
+                        {
+                            frames.pop_back();
+                        } });
+    }
+
+    void FrameDecoder::reset() noexcept
+    {
+        begin_ = end_ = 0;
+        stats_ = Stats();
+        inSync_ = true;
+    }
+
+} // namespace limp
@@ -0,0 +1,112 @@
+#include "limp/frame_view.hpp"
+#include "limp/compression.hpp"
+#include "limp/crc.hpp"
+
+namespace limp
+{
+
+    std::optional<uint16_t> FrameView::crc() const noexcept
+    {
+        if (!hasCRC())
+        {
+            return std::nullopt;
+        }
+        return read16(HEADER_SIZE + payloadLen());
+    }
+
+    bool FrameView::validate() const
+    {
+        // Minimum frame size check
+        if (data_ == nullptr || size_ < MIN_FRAME_SIZE)
+        {
+            return false;
+        }
+
+        if (version() != PROTOCOL_VERSION)
+        {
+            return false;
+        }
+
+        // Check for reserved flags
+        if (flags() & Flags::RESERVED_MASK)
+        {
+            return false;
+        }
+
+        // Only variable-length payloads are compressed
+        if (isCompressed() && payloadType() != PayloadType::STRING && payloadType() != PayloadType::OPAQUE)
+        {
+            return false;
+        }
+
+        // Validate payload length for fixed-size types
+        uint16_t expectedPayload = getPayloadTypeSize(payloadType());
+        if (expectedPayload > 0 && payloadLen() != expectedPayload)
+        {
+            return false;
+        }
+
+        // Array payloads hold whole elements only
+        uint16_t elementSize = getPayloadElementSize(payloadType());
+        if (elementSize > 0 && payloadLen() % elementSize != 0)
+        {
+            return false;
+        }
+
+        // Calculate expected total size
+        size_t expectedSize = HEADER_SIZE + payloadLen();
+        if (hasCRC())
+        {
+            expectedSize += CRC_SIZE;
+        }
+
+        if (size_ != expectedSize)
+        {
+            return false;
+        }
+
+        // Verify CRC if present
+        if (hasCRC() && !verifyCRC16(data_, size_))
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    bool FrameView::toFrame(Frame &frame) const
+    {
+        frame.version = version();
+        frame.msgType = msgType();
+        frame.srcNodeID = srcNodeID();
+        frame.classID = classID();
+        frame.instanceID = instanceID();
+        frame.attrID = attrID();
+        frame.payloadType = payloadType();
+        frame.payloadLen = payloadLen();
+        frame.flags = flags();
+
+        ByteSpan bytes = payload();
+        frame.crc = crc();
+        if (isCompressed())
+        {
+            // Hands back the original payload; the CRC above covered the compressed bytes
+            return detail::decompressPayload(bytes.data(), bytes.size(), frame) && frame.validate();
+        }
+        frame.payload.assign(bytes.begin(), bytes.end());
+
+        return frame.validate();
+    }
+
+    bool deserializeFrameView(const uint8_t *data, size_t length, FrameView &view)
+    {
+        FrameView candidate(data, length);
+        if (!candidate.validate())
+        {
+            return false;
+        }
+        view = candidate;
+        return true;
+    }
+
+} // namespace limp
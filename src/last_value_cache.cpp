@@ -0,0 +1,117 @@
+#include "limp/last_value_cache.hpp"
+#include <mutex>
+#include <utility>
+
+namespace limp
+{
+
+    bool LastValueCache::matches(uint64_t key, const Topic &filter) noexcept
+    {
+        switch (filter.size())
+        {
+        case 0:
+            return true;
+        case 2:
+            return (key >> 32) == filter.classID();
+        case 4:
+            return (key >> 16) == ((static_cast<uint64_t>(filter.classID()) << 16) | filter.instanceID());
+        default:
+            return key == keyOf(filter.classID(), filter.instanceID(), filter.attrID());
+        }
+    }
+
+    bool LastValueCache::update(const Frame &frame)
+    {
+        const uint64_t key = keyOf(frame.classID, frame.instanceID, frame.attrID);
+        updates_.fetch_add(1, std::memory_order_relaxed);
+
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        auto result = values_.try_emplace(key);
+        result.first->second = frame; // Copy-assign reuses the cached payload storage
+        return result.second;
+    }
+
+    bool LastValueCache::update(const FrameView &view)
+    {
+        // Decode outside the lock; swapping hands the old payload storage back for the next decode
+        thread_local Frame decoded;
+        if (!view.toFrame(decoded))
+        {
+            return false;
+        }
+
+        const uint64_t key = keyOf(view.classID(), view.instanceID(), view.attrID());
+        updates_.fetch_add(1, std::memory_order_relaxed);
+
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        auto result = values_.try_emplace(key);
+        std::swap(result.first->second, decoded);
+        return result.second;
+    }
+
+    bool LastValueCache::get(uint16_t classID, uint16_t instanceID, uint16_t attrID, Frame &frame) const
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto it = values_.find(keyOf(classID, instanceID, attrID));
+        if (it == values_.end())
+        {
+            return false;
+        }
+        frame = it->second;
+        return true;
+    }
+
+    std::optional<Frame> LastValueCache::get(uint16_t classID, uint16_t instanceID, uint16_t attrID) const
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto it = values_.find(keyOf(classID, instanceID, attrID));
+        if (it == values_.end())
+        {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    bool LastValueCache::contains(uint16_t classID, uint16_t instanceID, uint16_t attrID) const
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return values_.count(keyOf(classID, instanceID, attrID)) != 0;
+    }
+
+    bool LastValueCache::erase(uint16_t classID, uint16_t instanceID, uint16_t attrID)
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        return values_.erase(keyOf(classID, instanceID, attrID)) != 0;
+    }
+
+    size_t LastValueCache::snapshot(std::vector<Frame> &frames, const Topic &filter) const
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        const size_t before = frames.size();
+        if (filter.empty())
+        {
+            frames.reserve(before + values_.size());
+        }
+        for (const auto &entry : values_)
+        {
+            if (matches(entry.first, filter))
+            {
+                frames.push_back(entry.second);
+            }
+        }
+        return frames.size() - before;
+    }
+
+    size_t LastValueCache::size() const
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return values_.size();
+    }
+
+    void LastValueCache::clear()
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        values_.clear();
+    }
+
+} // namespace limp
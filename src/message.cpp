@@ -1,10 +1,47 @@
 #include "limp/message.hpp"
+#include "limp/byte_order.hpp"
 #include "limp/utils.hpp"
 #include <cstring>
 
 namespace limp
 {
 
+    namespace
+    {
+        template <typename T>
+        void encodeArray(Frame &frame, PayloadType type, Span<const T> values)
+        {
+            const size_t size = values.size() * sizeof(T);
+            frame.payloadType = type;
+            frame.payloadLen = static_cast<uint16_t>(size);
+            frame.payload.resize(size);
+            utils::htonArray(frame.payload.data(), values.data(), values.size());
+        }
+
+        template <typename T>
+        bool decodeArray(PayloadType actual, ByteSpan payload, PayloadType type, std::vector<T> &values)
+        {
+            if (actual != type || payload.size() % sizeof(T) != 0)
+            {
+                return false;
+            }
+            values.resize(payload.size() / sizeof(T));
+            utils::ntohArray(values.data(), payload.data(), values.size());
+            return true;
+        }
+
+        template <typename T>
+        std::optional<std::vector<T>> decodeArray(PayloadType actual, ByteSpan payload, PayloadType type)
+        {
+            std::vector<T> values;
+            if (!decodeArray(actual, payload, type, values))
+            {
+                return std::nullopt;
+            }
+            return values;
+        }
+    } // namespace
+
     // MessageBuilder Implementation
 
     MessageBuilder::MessageBuilder()
@@ -155,6 +192,36 @@ namespace limp
         return setPayload(std::string(value));
     }
 
+    MessageBuilder &MessageBuilder::setPayload(Span<const uint16_t> values)
+    {
+        encodeArray(frame_, PayloadType::UINT16_ARRAY, values);
+        return *this;
+    }
+
+    MessageBuilder &MessageBuilder::setPayload(Span<const uint32_t> values)
+    {
+        encodeArray(frame_, PayloadType::UINT32_ARRAY, values);
+        return *this;
+    }
+
+    MessageBuilder &MessageBuilder::setPayload(Span<const uint64_t> values)
+    {
+        encodeArray(frame_, PayloadType::UINT64_ARRAY, values);
+        return *this;
+    }
+
+    MessageBuilder &MessageBuilder::setPayload(Span<const float> values)
+    {
+        encodeArray(frame_, PayloadType::FLOAT32_ARRAY, values);
+        return *this;
+    }
+
+    MessageBuilder &MessageBuilder::setPayload(Span<const double> values)
+    {
+        encodeArray(frame_, PayloadType::FLOAT64_ARRAY, values);
+        return *this;
+    }
+
     MessageBuilder &MessageBuilder::setNoPayload()
     {
         frame_.payloadType = PayloadType::NONE;
@@ -173,6 +240,16 @@ namespace limp
         return std::move(frame_);
     }
 
+    size_t MessageBuilder::serializeTo(uint8_t *buffer, size_t capacity) const
+    {
+        return serializeFrameInto(frame_, buffer, capacity);
+    }
+
+    bool MessageBuilder::serializeTo(std::vector<uint8_t> &buffer) const
+    {
+        return serializeFrame(frame_, buffer);
+    }
+
     MessageBuilder MessageBuilder::request(uint16_t src, uint16_t classID,
                                            uint16_t instanceID, uint16_t attrID)
     {
@@ -261,104 +338,136 @@ namespace limp
         return builder;
     }
 
-    // MessageParser Implementation
+    // MessageView Implementation
 
-    MessageParser::MessageParser(const Frame &frame) : frame_(frame)
+    // A compressed payload holds zstd bytes, not a value: getters see PayloadType::NONE
+
+    MessageView::MessageView(const Frame &frame) noexcept
+        : msgType_(frame.msgType), srcNodeID_(frame.srcNodeID), classID_(frame.classID),
+          instanceID_(frame.instanceID), attrID_(frame.attrID), payloadType_(frame.payloadType),
+          valueType_(frame.isCompressed() ? PayloadType::NONE : frame.payloadType),
+          payload_(frame.payload.data(), frame.payload.size())
     {
     }
 
-    MessageParser::MessageParser(Frame &&frame) noexcept : frame_(std::move(frame))
+    MessageView::MessageView(const FrameView &view) noexcept
+        : msgType_(view.msgType()), srcNodeID_(view.srcNodeID()), classID_(view.classID()),
+          instanceID_(view.instanceID()), attrID_(view.attrID()), payloadType_(view.payloadType()),
+          valueType_(view.isCompressed() ? PayloadType::NONE : view.payloadType()),
+          payload_(view.payload())
     {
     }
 
-    std::optional<uint8_t> MessageParser::getUInt8() const
+    std::optional<uint8_t> MessageView::getUInt8() const noexcept
     {
-        if (frame_.payloadType != PayloadType::UINT8 || frame_.payload.size() != 1)
+        if (valueType_ != PayloadType::UINT8 || payload_.size() != 1)
         {
             return std::nullopt;
         }
-        return frame_.payload[0];
+        return payload_[0];
     }
 
-    std::optional<uint16_t> MessageParser::getUInt16() const
+    std::optional<uint16_t> MessageView::getUInt16() const noexcept
     {
-        if (frame_.payloadType != PayloadType::UINT16 || frame_.payload.size() != 2)
+        if (valueType_ != PayloadType::UINT16 || payload_.size() != 2)
         {
             return std::nullopt;
         }
         uint16_t valueBE;
-        std::memcpy(&valueBE, frame_.payload.data(), 2);
+        std::memcpy(&valueBE, payload_.data(), 2);
         return utils::ntoh16(valueBE);
     }
 
-    std::optional<uint32_t> MessageParser::getUInt32() const
+    std::optional<uint32_t> MessageView::getUInt32() const noexcept
     {
-        if (frame_.payloadType != PayloadType::UINT32 || frame_.payload.size() != 4)
+        if (valueType_ != PayloadType::UINT32 || payload_.size() != 4)
         {
             return std::nullopt;
         }
         uint32_t valueBE;
-        std::memcpy(&valueBE, frame_.payload.data(), 4);
+        std::memcpy(&valueBE, payload_.data(), 4);
         return utils::ntoh32(valueBE);
     }
 
-    std::optional<uint64_t> MessageParser::getUInt64() const
+    std::optional<uint64_t> MessageView::getUInt64() const noexcept
     {
-        if (frame_.payloadType != PayloadType::UINT64 || frame_.payload.size() != 8)
+        if (valueType_ != PayloadType::UINT64 || payload_.size() != 8)
         {
             return std::nullopt;
         }
         uint64_t valueBE;
-        std::memcpy(&valueBE, frame_.payload.data(), 8);
+        std::memcpy(&valueBE, payload_.data(), 8);
         return utils::ntoh64(valueBE);
     }
 
-    std::optional<float> MessageParser::getFloat32() const
+    std::optional<float> MessageView::getFloat32() const noexcept
     {
-        if (frame_.payloadType != PayloadType::FLOAT32 || frame_.payload.size() != 4)
+        if (valueType_ != PayloadType::FLOAT32 || payload_.size() != 4)
         {
             return std::nullopt;
         }
         uint32_t bitsBE;
-        std::memcpy(&bitsBE, frame_.payload.data(), 4);
-        uint32_t bits = utils::ntoh32(bitsBE);
-        return utils::bitsToFloat(bits);
+        std::memcpy(&bitsBE, payload_.data(), 4);
+        return utils::bitsToFloat(utils::ntoh32(bitsBE));
     }
 
-    std::optional<double> MessageParser::getFloat64() const
+    std::optional<double> MessageView::getFloat64() const noexcept
     {
-        if (frame_.payloadType != PayloadType::FLOAT64 || frame_.payload.size() != 8)
+        if (valueType_ != PayloadType::FLOAT64 || payload_.size() != 8)
         {
             return std::nullopt;
         }
         uint64_t bitsBE;
-        std::memcpy(&bitsBE, frame_.payload.data(), 8);
-        uint64_t bits = utils::ntoh64(bitsBE);
-        return utils::bitsToDouble(bits);
+        std::memcpy(&bitsBE, payload_.data(), 8);
+        return utils::bitsToDouble(utils::ntoh64(bitsBE));
     }
 
-    std::optional<std::string> MessageParser::getString() const
+    std::optional<std::string_view> MessageView::getStringView() const noexcept
     {
-        if (frame_.payloadType != PayloadType::STRING)
+        if (valueType_ != PayloadType::STRING)
         {
             return std::nullopt;
         }
-        return std::string(reinterpret_cast<const char *>(frame_.payload.data()),
-                           frame_.payload.size());
+        return std::string_view(reinterpret_cast<const char *>(payload_.data()), payload_.size());
     }
 
-    std::optional<std::vector<uint8_t>> MessageParser::getOpaque() const
+    std::optional<ByteSpan> MessageView::getOpaqueSpan() const noexcept
     {
-        if (frame_.payloadType != PayloadType::OPAQUE)
+        if (valueType_ != PayloadType::OPAQUE)
         {
             return std::nullopt;
         }
-        return frame_.payload;
+        return payload_;
     }
 
-    PayloadValue MessageParser::getValue() const
+    bool MessageView::getUInt16Array(std::vector<uint16_t> &values) const
+    {
+        return decodeArray(valueType_, payload_, PayloadType::UINT16_ARRAY, values);
+    }
+
+    bool MessageView::getUInt32Array(std::vector<uint32_t> &values) const
     {
-        switch (frame_.payloadType)
+        return decodeArray(valueType_, payload_, PayloadType::UINT32_ARRAY, values);
+    }
+
+    bool MessageView::getUInt64Array(std::vector<uint64_t> &values) const
+    {
+        return decodeArray(valueType_, payload_, PayloadType::UINT64_ARRAY, values);
+    }
+
+    bool MessageView::getFloat32Array(std::vector<float> &values) const
+    {
+        return decodeArray(valueType_, payload_, PayloadType::FLOAT32_ARRAY, values);
+    }
+
+    bool MessageView::getFloat64Array(std::vector<double> &values) const
+    {
+        return decodeArray(valueType_, payload_, PayloadType::FLOAT64_ARRAY, values);
+    }
+
+    PayloadValue MessageView::getValue() const
+    {
+        switch (valueType_)
         {
         case PayloadType::NONE:
             return std::monostate{};
@@ -387,24 +496,171 @@ namespace limp
                 return *val;
             break;
         case PayloadType::STRING:
-            if (auto val = getString())
-                return *val;
+            if (auto val = getStringView())
+                return std::string(*val);
             break;
         case PayloadType::OPAQUE:
-            if (auto val = getOpaque())
+        case PayloadType::BATCH: // Decode with BatchParser
+            return std::vector<uint8_t>(payload_.begin(), payload_.end());
+        case PayloadType::UINT16_ARRAY:
+            if (auto val = decodeArray<uint16_t>(valueType_, payload_, PayloadType::UINT16_ARRAY))
+                return *val;
+            break;
+        case PayloadType::UINT32_ARRAY:
+            if (auto val = decodeArray<uint32_t>(valueType_, payload_, PayloadType::UINT32_ARRAY))
+                return *val;
+            break;
+        case PayloadType::UINT64_ARRAY:
+            if (auto val = decodeArray<uint64_t>(valueType_, payload_, PayloadType::UINT64_ARRAY))
+                return *val;
+            break;
+        case PayloadType::FLOAT32_ARRAY:
+            if (auto val = decodeArray<float>(valueType_, payload_, PayloadType::FLOAT32_ARRAY))
+                return *val;
+            break;
+        case PayloadType::FLOAT64_ARRAY:
+            if (auto val = decodeArray<double>(valueType_, payload_, PayloadType::FLOAT64_ARRAY))
                 return *val;
             break;
         }
         return std::monostate{};
     }
 
-    std::optional<uint8_t> MessageParser::getErrorCode() const
+    std::optional<uint8_t> MessageView::getErrorCode() const noexcept
     {
-        if (frame_.msgType != MsgType::ERROR)
+        if (msgType_ != MsgType::ERROR)
         {
             return std::nullopt;
         }
         return getUInt8();
     }
 
+    // MessageParser Implementation
+
+    MessageParser::MessageParser(const Frame &frame) : frame_(frame)
+    {
+    }
+
+    MessageParser::MessageParser(Frame &&frame) noexcept : frame_(std::move(frame))
+    {
+    }
+
+    std::optional<uint8_t> MessageParser::getUInt8() const
+    {
+        return view().getUInt8();
+    }
+
+    std::optional<uint16_t> MessageParser::getUInt16() const
+    {
+        return view().getUInt16();
+    }
+
+    std::optional<uint32_t> MessageParser::getUInt32() const
+    {
+        return view().getUInt32();
+    }
+
+    std::optional<uint64_t> MessageParser::getUInt64() const
+    {
+        return view().getUInt64();
+    }
+
+    std::optional<float> MessageParser::getFloat32() const
+    {
+        return view().getFloat32();
+    }
+
+    std::optional<double> MessageParser::getFloat64() const
+    {
+        return view().getFloat64();
+    }
+
+    std::optional<std::string> MessageParser::getString() const
+    {
+        if (auto value = view().getStringView())
+        {
+            return std::string(*value);
+        }
+        return std::nullopt;
+    }
+
+    std::optional<std::vector<uint8_t>> MessageParser::getOpaque() const
+    {
+        if (auto value = view().getOpaqueSpan())
+        {
+            return std::vector<uint8_t>(value->begin(), value->end());
+        }
+        return std::nullopt;
+    }
+
+    std::optional<std::string_view> MessageParser::getStringView() const noexcept
+    {
+        return view().getStringView();
+    }
+
+    std::optional<ByteSpan> MessageParser::getOpaqueSpan() const noexcept
+    {
+        return view().getOpaqueSpan();
+    }
+
+    std::optional<std::vector<uint16_t>> MessageParser::getUInt16Array() const
+    {
+        return decodeArray<uint16_t>(frame_.payloadType, view().payload(), PayloadType::UINT16_ARRAY);
+    }
+
+    std::optional<std::vector<uint32_t>> MessageParser::getUInt32Array() const
+    {
+        return decodeArray<uint32_t>(frame_.payloadType, view().payload(), PayloadType::UINT32_ARRAY);
+    }
+
+    std::optional<std::vector<uint64_t>> MessageParser::getUInt64Array() const
+    {
+        return decodeArray<uint64_t>(frame_.payloadType, view().payload(), PayloadType::UINT64_ARRAY);
+    }
+
+    std::optional<std::vector<float>> MessageParser::getFloat32Array() const
+    {
+        return decodeArray<float>(frame_.payloadType, view().payload(), PayloadType::FLOAT32_ARRAY);
+    }
+
+    std::optional<std::vector<double>> MessageParser::getFloat64Array() const
+    {
+        return decodeArray<double>(frame_.payloadType, view().payload(), PayloadType::FLOAT64_ARRAY);
+    }
+
+    bool MessageParser::getUInt16Array(std::vector<uint16_t> &values) const
+    {
+        return view().getUInt16Array(values);
+    }
+
+    bool MessageParser::getUInt32Array(std::vector<uint32_t> &values) const
+    {
+        return view().getUInt32Array(values);
+    }
+
+    bool MessageParser::getUInt64Array(std::vector<uint64_t> &values) const
+    {
+        return view().getUInt64Array(values);
+    }
+
+    bool MessageParser::getFloat32Array(std::vector<float> &values) const
+    {
+        return view().getFloat32Array(values);
+    }
+
+    bool MessageParser::getFloat64Array(std::vector<double> &values) const
+    {
+        return view().getFloat64Array(values);
+    }
+
+    PayloadValue MessageParser::getValue() const
+    {
+        return view().getValue();
+    }
+
+    std::optional<uint8_t> MessageParser::getErrorCode() const
+    {
+        return view().getErrorCode();
+    }
+
 } // namespace limp
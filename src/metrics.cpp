@@ -0,0 +1,180 @@
+#include "limp/metrics.hpp"
+
+namespace limp
+{
+
+    namespace
+    {
+        uint64_t load(const std::atomic<uint64_t> &value) noexcept
+        {
+            return value.load(std::memory_order_relaxed);
+        }
+
+        void copyValue(std::atomic<uint64_t> &to, const std::atomic<uint64_t> &from) noexcept
+        {
+            to.store(load(from), std::memory_order_relaxed);
+        }
+    } // namespace
+
+    uint64_t LatencyHistogram::Snapshot::percentile(double quantile) const noexcept
+    {
+        if (count == 0)
+        {
+            return 0;
+        }
+        if (quantile <= 0.0)
+        {
+            quantile = 0.0;
+        }
+        if (quantile >= 1.0)
+        {
+            return max;
+        }
+
+        // Rank of the value at the quantile (1-based, nearest-rank method)
+        uint64_t rank = static_cast<uint64_t>(quantile * static_cast<double>(count)) + 1;
+        if (rank > count)
+        {
+            rank = count;
+        }
+
+        uint64_t seen = 0;
+        for (size_t i = 0; i < BUCKET_COUNT; ++i)
+        {
+            seen += buckets[i];
+            if (seen >= rank)
+            {
+                const uint64_t upper = (i + 1 < BUCKET_COUNT) ? bucketLowerBound(i + 1) - 1 : max;
+                return upper < max ? upper : max;
+            }
+        }
+        return max; // Counts raced with a concurrent record
+    }
+
+    LatencyHistogram::LatencyHistogram() noexcept
+        : sum_(0), max_(0)
+    {
+        for (auto &bucket : buckets_)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    LatencyHistogram::LatencyHistogram(const LatencyHistogram &other) noexcept
+        : LatencyHistogram()
+    {
+        *this = other;
+    }
+
+    LatencyHistogram &LatencyHistogram::operator=(const LatencyHistogram &other) noexcept
+    {
+        if (this != &other)
+        {
+            for (size_t i = 0; i < BUCKET_COUNT; ++i)
+            {
+                copyValue(buckets_[i], other.buckets_[i]);
+            }
+            copyValue(sum_, other.sum_);
+            copyValue(max_, other.max_);
+        }
+        return *this;
+    }
+
+    LatencyHistogram::Snapshot LatencyHistogram::snapshot() const noexcept
+    {
+        Snapshot snapshot;
+        for (size_t i = 0; i < BUCKET_COUNT; ++i)
+        {
+            snapshot.buckets[i] = load(buckets_[i]);
+            snapshot.count += snapshot.buckets[i];
+        }
+        snapshot.sum = load(sum_);
+        snapshot.max = load(max_);
+        return snapshot;
+    }
+
+    void LatencyHistogram::reset() noexcept
+    {
+        for (auto &bucket : buckets_)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        sum_.store(0, std::memory_order_relaxed);
+        max_.store(0, std::memory_order_relaxed);
+    }
+
+    uint64_t TransportStats::totalErrors() const noexcept
+    {
+        uint64_t total = 0;
+        for (uint64_t count : errors)
+        {
+            total += count;
+        }
+        return total;
+    }
+
+    TransportMetrics::TransportMetrics() noexcept
+        : framesSent_(0), framesReceived_(0), bytesSent_(0), bytesReceived_(0)
+    {
+        for (auto &count : errors_)
+        {
+            count.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    TransportMetrics::TransportMetrics(const TransportMetrics &other) noexcept
+        : TransportMetrics()
+    {
+        *this = other;
+    }
+
+    TransportMetrics &TransportMetrics::operator=(const TransportMetrics &other) noexcept
+    {
+        if (this != &other)
+        {
+            copyValue(framesSent_, other.framesSent_);
+            copyValue(framesReceived_, other.framesReceived_);
+            copyValue(bytesSent_, other.bytesSent_);
+            copyValue(bytesReceived_, other.bytesReceived_);
+            for (size_t i = 0; i < TRANSPORT_ERROR_COUNT; ++i)
+            {
+                copyValue(errors_[i], other.errors_[i]);
+            }
+            sendLatency_ = other.sendLatency_;
+            roundTrip_ = other.roundTrip_;
+        }
+        return *this;
+    }
+
+    TransportStats TransportMetrics::snapshot() const noexcept
+    {
+        TransportStats stats;
+        stats.framesSent = load(framesSent_);
+        stats.framesReceived = load(framesReceived_);
+        stats.bytesSent = load(bytesSent_);
+        stats.bytesReceived = load(bytesReceived_);
+        for (size_t i = 0; i < TRANSPORT_ERROR_COUNT; ++i)
+        {
+            stats.errors[i] = load(errors_[i]);
+        }
+        stats.timeouts = stats.errorCount(TransportError::Timeout);
+        stats.sendLatency = sendLatency_.snapshot();
+        stats.roundTrip = roundTrip_.snapshot();
+        return stats;
+    }
+
+    void TransportMetrics::reset() noexcept
+    {
+        framesSent_.store(0, std::memory_order_relaxed);
+        framesReceived_.store(0, std::memory_order_relaxed);
+        bytesSent_.store(0, std::memory_order_relaxed);
+        bytesReceived_.store(0, std::memory_order_relaxed);
+        for (auto &count : errors_)
+        {
+            count.store(0, std::memory_order_relaxed);
+        }
+        sendLatency_.reset();
+        roundTrip_.reset();
+    }
+
+} // namespace limp
@@ -0,0 +1,142 @@
+#include "limp/payload_buffer.hpp"
+#include <cstring>
+
+namespace limp
+{
+
+    PayloadBuffer::PayloadBuffer(PayloadBuffer &&other) noexcept
+        : size_(0), onHeap_(other.onHeap_)
+    {
+        if (onHeap_)
+        {
+            heap_ = std::move(other.heap_);
+        }
+        else
+        {
+            size_ = other.size_;
+            std::memcpy(inline_, other.inline_, size_);
+        }
+        other.reset();
+    }
+
+    PayloadBuffer &PayloadBuffer::operator=(const PayloadBuffer &other)
+    {
+        if (this != &other)
+        {
+            assign(other.data(), other.size());
+        }
+        return *this;
+    }
+
+    PayloadBuffer &PayloadBuffer::operator=(PayloadBuffer &&other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        if (other.onHeap_)
+        {
+            heap_ = std::move(other.heap_);
+            onHeap_ = true;
+        }
+        else
+        {
+            // Inline data always fits inline; any heap capacity we held is dropped
+            heap_ = std::vector<uint8_t>();
+            onHeap_ = false;
+            size_ = other.size_;
+            std::memcpy(inline_, other.inline_, size_);
+        }
+        other.reset();
+        return *this;
+    }
+
+    PayloadBuffer &PayloadBuffer::operator=(const std::vector<uint8_t> &bytes)
+    {
+        assign(bytes.data(), bytes.size());
+        return *this;
+    }
+
+    PayloadBuffer &PayloadBuffer::operator=(std::vector<uint8_t> &&bytes) noexcept
+    {
+        heap_ = std::move(bytes);
+        onHeap_ = true;
+        size_ = 0;
+        return *this;
+    }
+
+    void PayloadBuffer::resize(size_t size)
+    {
+        if (onHeap_)
+        {
+            heap_.resize(size);
+            return;
+        }
+
+        if (size <= INLINE_CAPACITY)
+        {
+            if (size > size_)
+            {
+                std::memset(inline_ + size_, 0, size - size_);
+            }
+            size_ = size;
+            return;
+        }
+
+        // Spill: move inline bytes to the heap, zero-filling the rest
+        heap_.reserve(size + SPILL_HEADROOM);
+        heap_.assign(inline_, inline_ + size_);
+        heap_.resize(size);
+        onHeap_ = true;
+        size_ = 0;
+    }
+
+    void PayloadBuffer::reset() noexcept
+    {
+        heap_.clear();
+        size_ = 0;
+        onHeap_ = false;
+    }
+
+    void PayloadBuffer::clear() noexcept
+    {
+        if (onHeap_)
+        {
+            heap_.clear();
+        }
+        size_ = 0;
+    }
+
+    void PayloadBuffer::assign(const uint8_t *data, size_t size)
+    {
+        if (onHeap_)
+        {
+            heap_.assign(data, data + size);
+            return;
+        }
+
+        if (size <= INLINE_CAPACITY)
+        {
+            if (size > 0)
+            {
+                std::memmove(inline_, data, size);
+            }
+            size_ = size;
+            return;
+        }
+
+        heap_.reserve(size + SPILL_HEADROOM);
+        heap_.assign(data, data + size);
+        onHeap_ = true;
+        size_ = 0;
+    }
+
+    std::vector<uint8_t> PayloadBuffer::release()
+    {
+        std::vector<uint8_t> bytes = onHeap_ ? std::move(heap_) : std::vector<uint8_t>(inline_, inline_ + size_);
+        reset();
+        return bytes;
+    }
+
+} // namespace limp
@@ -0,0 +1,522 @@
+#include "limp/shm/shm_ring.hpp"
+#include "limp/compression.hpp"
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <new>
+#include <thread>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#endif
+
+namespace limp
+{
+
+    /**
+     * @brief Control block at the start of the mapping
+     *
+     * Positions increase monotonically; the record offset is position & (capacity - 1).
+     * Each hot field has its own cache line so writers and the reader do not
+     * false-share.
+     */
+    struct SharedMemoryRing::Header
+    {
+        std::atomic<uint32_t> magic;                   ///< MAGIC once initialized
+        uint32_t version;                              ///< Layout version
+        uint64_t capacity;                             ///< Record area size
+        uint32_t multiProducer;                        ///< Writers reserve with CAS
+        int32_t ownerPid;                              ///< Process that created the ring
+        alignas(64) std::atomic<uint64_t> tail;        ///< Next reservation (writers)
+        alignas(64) std::atomic<uint64_t> head;        ///< Next record to read (reader)
+        alignas(64) std::atomic<uint32_t> dataSignal;  ///< Futex: bumped when a sleeping reader must wake
+        std::atomic<uint32_t> readerWaiting;           ///< Reader is (about to go) asleep
+        alignas(64) std::atomic<uint32_t> spaceSignal; ///< Futex: bumped when sleeping writers must wake
+        std::atomic<uint32_t> writersWaiting;          ///< Writers (about to go) asleep
+    };
+
+    namespace
+    {
+        constexpr uint32_t MAGIC = 0x4C494D50; // "LIMP"
+        constexpr uint32_t LAYOUT_VERSION = 2;
+
+        // Record area starts one page in, after the control block
+        constexpr size_t DATA_OFFSET = 4096;
+
+        // Record header: 4-byte length word, 4 bytes padding; records are 8-byte aligned
+        constexpr size_t RECORD_HEADER = 8;
+        constexpr uint32_t PADDING_RECORD = 0x80000000u;
+
+        static_assert(std::atomic<uint64_t>::is_always_lock_free && std::atomic<uint32_t>::is_always_lock_free,
+                      "Shared memory rings need address-free atomics");
+
+        using Clock = std::chrono::steady_clock;
+
+        size_t recordSize(size_t payload) { return (RECORD_HEADER + payload + 7) & ~static_cast<size_t>(7); }
+
+        std::atomic<uint32_t> &lengthWord(uint8_t *data, uint64_t offset)
+        {
+            return *reinterpret_cast<std::atomic<uint32_t> *>(data + offset);
+        }
+
+        void cpuRelax()
+        {
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#elif defined(__aarch64__)
+            asm volatile("yield");
+#else
+            std::this_thread::yield();
+#endif
+        }
+
+        int remainingMs(Clock::time_point deadline, int timeoutMs)
+        {
+            if (timeoutMs < 0)
+            {
+                return -1;
+            }
+            auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()).count();
+            return left > 0 ? static_cast<int>(left) : 0;
+        }
+
+        // Sleep while signal == expected (shared futex, works across processes)
+        void sleepOn(std::atomic<uint32_t> &signal, uint32_t expected, int timeoutMs)
+        {
+#if defined(__linux__)
+            struct timespec timeout;
+            timeout.tv_sec = timeoutMs / 1000;
+            timeout.tv_nsec = static_cast<long>(timeoutMs % 1000) * 1000000L;
+            ::syscall(SYS_futex, reinterpret_cast<uint32_t *>(&signal), FUTEX_WAIT, expected,
+                      timeoutMs < 0 ? nullptr : &timeout, nullptr, 0);
+#else
+            (void)expected;
+            std::this_thread::sleep_for(std::chrono::microseconds(timeoutMs == 0 ? 0 : 100));
+#endif
+        }
+
+        void wake(std::atomic<uint32_t> &signal)
+        {
+            signal.fetch_add(1, std::memory_order_release);
+#if defined(__linux__)
+            ::syscall(SYS_futex, reinterpret_cast<uint32_t *>(&signal), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#endif
+        }
+
+        /**
+         * Spin, then sleep until ready() holds or the deadline passes.
+         * The waiting flag follows the store-fence-load order shared with wake().
+         */
+        template <typename Ready>
+        bool waitUntil(Ready ready, std::atomic<uint32_t> &signal, std::atomic<uint32_t> &waiting,
+                       int timeoutMs, int spinCount)
+        {
+            for (int spin = 0; spin < spinCount; ++spin)
+            {
+                if (ready())
+                {
+                    return true;
+                }
+                cpuRelax();
+            }
+
+            const Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(timeoutMs < 0 ? 0 : timeoutMs);
+            for (;;)
+            {
+                const uint32_t observed = signal.load(std::memory_order_acquire);
+                waiting.fetch_add(1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (ready())
+                {
+                    waiting.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+
+                const int wait = remainingMs(deadline, timeoutMs);
+                if (wait != 0)
+                {
+                    sleepOn(signal, observed, wait);
+                }
+                waiting.fetch_sub(1, std::memory_order_relaxed);
+                if (wait == 0)
+                {
+                    return ready();
+                }
+            }
+        }
+
+        void notify(std::atomic<uint32_t> &signal, std::atomic<uint32_t> &waiting)
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (waiting.load(std::memory_order_relaxed) != 0)
+            {
+                wake(signal);
+            }
+        }
+    } // namespace
+
+    SharedMemoryRing::SharedMemoryRing() noexcept
+        : header_(nullptr), data_(nullptr), capacity_(0), mappingSize_(0), owner_(false), pendingSize_(0)
+    {
+    }
+
+    SharedMemoryRing::~SharedMemoryRing()
+    {
+        close();
+    }
+
+    bool SharedMemoryRing::map(int fd, size_t size)
+    {
+        void *mapping = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mapping == MAP_FAILED)
+        {
+            return false;
+        }
+
+        header_ = static_cast<Header *>(mapping);
+        data_ = static_cast<uint8_t *>(mapping) + DATA_OFFSET;
+        mappingSize_ = size;
+        return true;
+    }
+
+    bool SharedMemoryRing::ownerIsGone(const std::string &name)
+    {
+        int fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+        if (fd < 0)
+        {
+            return false;
+        }
+        struct stat info;
+        if (::fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < DATA_OFFSET)
+        {
+            ::close(fd);
+            return false;
+        }
+        void *mapping = ::mmap(nullptr, DATA_OFFSET, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mapping == MAP_FAILED)
+        {
+            return false;
+        }
+
+        // magic is stored last, so a ring still being set up counts as in use
+        const Header *header = static_cast<const Header *>(mapping);
+        bool gone = false;
+        if (header->magic.load(std::memory_order_acquire) == MAGIC && header->version == LAYOUT_VERSION &&
+            header->ownerPid > 0)
+        {
+            gone = ::kill(static_cast<pid_t>(header->ownerPid), 0) != 0 && errno == ESRCH;
+        }
+        ::munmap(mapping, DATA_OFFSET);
+        return gone;
+    }
+
+    TransportError SharedMemoryRing::create(const std::string &name, size_t capacity, bool multiProducer)
+    {
+        if (isOpen())
+        {
+            return TransportError::AlreadyConnected;
+        }
+
+        size_t rounded = MIN_CAPACITY;
+        while (rounded < capacity)
+        {
+            rounded <<= 1;
+        }
+
+        int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0 && errno == EEXIST)
+        {
+            if (!ownerIsGone(name))
+            {
+                errno = EEXIST;
+                return TransportError::BindFailed;
+            }
+            // A crashed owner leaves its name behind; replace it
+            ::shm_unlink(name.c_str());
+            fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        }
+        if (fd < 0)
+        {
+            return TransportError::BindFailed;
+        }
+        if (::ftruncate(fd, static_cast<off_t>(DATA_OFFSET + rounded)) != 0)
+        {
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            return TransportError::BindFailed;
+        }
+        if (!map(fd, DATA_OFFSET + rounded))
+        {
+            ::shm_unlink(name.c_str());
+            return TransportError::BindFailed;
+        }
+
+        // Fresh pages are zero, so every record slot already reads as unpublished
+        Header *header = new (header_) Header();
+        header->version = LAYOUT_VERSION;
+        header->capacity = rounded;
+        header->multiProducer = multiProducer ? 1 : 0;
+        header->ownerPid = static_cast<int32_t>(::getpid());
+        header->tail.store(0, std::memory_order_relaxed);
+        header->head.store(0, std::memory_order_relaxed);
+        header->dataSignal.store(0, std::memory_order_relaxed);
+        header->readerWaiting.store(0, std::memory_order_relaxed);
+        header->spaceSignal.store(0, std::memory_order_relaxed);
+        header->writersWaiting.store(0, std::memory_order_relaxed);
+        header->magic.store(MAGIC, std::memory_order_release);
+
+        capacity_ = rounded;
+        name_ = name;
+        owner_ = true;
+        pendingSize_ = 0;
+        return TransportError::None;
+    }
+
+    TransportError SharedMemoryRing::open(const std::string &name)
+    {
+        if (isOpen())
+        {
+            return TransportError::AlreadyConnected;
+        }
+
+        int fd = ::shm_open(name.c_str(), O_RDWR, 0600);
+        if (fd < 0)
+        {
+            return TransportError::ConnectionFailed;
+        }
+
+        struct stat info;
+        if (::fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < DATA_OFFSET + MIN_CAPACITY)
+        {
+            ::close(fd);
+            return TransportError::ConnectionFailed;
+        }
+        if (!map(fd, static_cast<size_t>(info.st_size)))
+        {
+            return TransportError::ConnectionFailed;
+        }
+
+        if (header_->magic.load(std::memory_order_acquire) != MAGIC || header_->version != LAYOUT_VERSION ||
+            DATA_OFFSET + header_->capacity != mappingSize_)
+        {
+            close();
+            return TransportError::ConnectionFailed;
+        }
+
+        capacity_ = static_cast<size_t>(header_->capacity);
+        name_ = name;
+        owner_ = false;
+        pendingSize_ = 0;
+        return TransportError::None;
+    }
+
+    void SharedMemoryRing::close() noexcept
+    {
+        if (header_ != nullptr)
+        {
+            ::munmap(header_, mappingSize_);
+            if (owner_)
+            {
+                ::shm_unlink(name_.c_str());
+            }
+        }
+        header_ = nullptr;
+        data_ = nullptr;
+        capacity_ = mappingSize_ = 0;
+        name_.clear();
+        owner_ = false;
+        pendingSize_ = 0;
+    }
+
+    TransportError SharedMemoryRing::reserve(size_t size, int timeoutMs, int spinCount, uint64_t &position)
+    {
+        const uint64_t mask = capacity_ - 1;
+        const uint64_t needed = recordSize(size);
+        const bool multiProducer = header_->multiProducer != 0;
+        if (needed > capacity_ / 2)
+        {
+            return TransportError::SerializationFailed; // Could never fit next to a padding record
+        }
+
+        uint64_t tail = header_->tail.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            // Records never wrap: pad out the end of the ring first if needed
+            const uint64_t toEnd = capacity_ - (tail & mask);
+            const uint64_t total = needed <= toEnd ? needed : toEnd + needed;
+
+            auto fits = [&]()
+            {
+                return tail + total - header_->head.load(std::memory_order_acquire) <= capacity_;
+            };
+            if (!fits())
+            {
+                if (!waitUntil(fits, header_->spaceSignal, header_->writersWaiting, timeoutMs, spinCount))
+                {
+                    return TransportError::Timeout;
+                }
+                if (multiProducer)
+                {
+                    tail = header_->tail.load(std::memory_order_relaxed);
+                    continue; // Another writer may have moved the tail meanwhile
+                }
+            }
+
+            if (multiProducer)
+            {
+                if (!header_->tail.compare_exchange_weak(tail, tail + total, std::memory_order_relaxed))
+                {
+                    continue; // tail reloaded by the failed CAS
+                }
+            }
+            else
+            {
+                header_->tail.store(tail + total, std::memory_order_relaxed);
+            }
+
+            if (total != needed)
+            {
+                lengthWord(data_, tail & mask).store(PADDING_RECORD | static_cast<uint32_t>(toEnd),
+                                                     std::memory_order_release);
+                tail += toEnd;
+            }
+            position = tail;
+            return TransportError::None;
+        }
+    }
+
+    void SharedMemoryRing::publish(uint64_t position, size_t size) noexcept
+    {
+        lengthWord(data_, position & (capacity_ - 1)).store(static_cast<uint32_t>(size), std::memory_order_release);
+        notify(header_->dataSignal, header_->readerWaiting);
+    }
+
+    TransportError SharedMemoryRing::write(const Frame &frame, int timeoutMs, int spinCount)
+    {
+        if (!isOpen())
+        {
+            return TransportError::NotConnected;
+        }
+        if (!frame.validate())
+        {
+            return TransportError::SerializationFailed;
+        }
+
+        const Frame &wire = detail::wireFrame(frame);
+        const size_t size = wire.totalSize();
+        uint64_t position = 0;
+        TransportError result = reserve(size, timeoutMs, spinCount, position);
+        if (result != TransportError::None)
+        {
+            return result;
+        }
+
+        // Serialize straight into the shared mapping
+        detail::serializeValidatedFrame(wire, data_ + (position & (capacity_ - 1)) + RECORD_HEADER);
+        publish(position, size);
+        return TransportError::None;
+    }
+
+    TransportError SharedMemoryRing::write(const uint8_t *data, size_t size, int timeoutMs, int spinCount)
+    {
+        if (!isOpen())
+        {
+            return TransportError::NotConnected;
+        }
+        if (size == 0)
+        {
+            return TransportError::SerializationFailed;
+        }
+
+        uint64_t position = 0;
+        TransportError result = reserve(size, timeoutMs, spinCount, position);
+        if (result != TransportError::None)
+        {
+            return result;
+        }
+
+        std::memcpy(data_ + (position & (capacity_ - 1)) + RECORD_HEADER, data, size);
+        publish(position, size);
+        return TransportError::None;
+    }
+
+    void SharedMemoryRing::release() noexcept
+    {
+        if (pendingSize_ == 0)
+        {
+            return;
+        }
+
+        // Zero the consumed record so a future record header there reads as unpublished
+        const uint64_t head = header_->head.load(std::memory_order_relaxed);
+        const uint64_t offset = head & (capacity_ - 1);
+        std::memset(data_ + offset + sizeof(uint32_t), 0, pendingSize_ - sizeof(uint32_t));
+        lengthWord(data_, offset).store(0, std::memory_order_relaxed);
+        header_->head.store(head + pendingSize_, std::memory_order_release);
+        pendingSize_ = 0;
+
+        notify(header_->spaceSignal, header_->writersWaiting);
+    }
+
+    TransportError SharedMemoryRing::read(ByteSpan &record, int timeoutMs, int spinCount)
+    {
+        if (!isOpen())
+        {
+            return TransportError::NotConnected;
+        }
+        release();
+
+        const uint64_t mask = capacity_ - 1;
+        for (;;)
+        {
+            const uint64_t head = header_->head.load(std::memory_order_relaxed);
+            const uint64_t offset = head & mask;
+            std::atomic<uint32_t> &word = lengthWord(data_, offset);
+
+            uint32_t length = word.load(std::memory_order_acquire);
+            if (length == 0)
+            {
+                auto published = [&]()
+                {
+                    return word.load(std::memory_order_acquire) != 0;
+                };
+                if (!waitUntil(published, header_->dataSignal, header_->readerWaiting, timeoutMs, spinCount))
+                {
+                    return TransportError::Timeout;
+                }
+                length = word.load(std::memory_order_acquire);
+            }
+
+            if (length & PADDING_RECORD)
+            {
+                // Skip to the start of the ring (the padding body is already zero)
+                word.store(0, std::memory_order_relaxed);
+                header_->head.store(head + (length & ~PADDING_RECORD), std::memory_order_release);
+                notify(header_->spaceSignal, header_->writersWaiting);
+                continue;
+            }
+
+            const uint64_t size = recordSize(length);
+            if (size > capacity_ - offset)
+            {
+                return TransportError::ReceiveFailed; // Corrupted ring
+            }
+
+            record = ByteSpan(data_ + offset + RECORD_HEADER, length);
+            pendingSize_ = size;
+            return TransportError::None;
+        }
+    }
+
+} // namespace limp
@@ -0,0 +1,151 @@
+#include "limp/shm/shm_transport.hpp"
+#include <cstring>
+
+namespace limp
+{
+
+    SHMTransport::SHMTransport(const SHMConfig &config)
+        : config_(config)
+    {
+    }
+
+    SHMTransport::~SHMTransport()
+    {
+        close();
+    }
+
+    bool SHMTransport::ringNames(const std::string &endpoint, std::string &toBound, std::string &toConnected)
+    {
+        const std::string scheme = "shm://";
+        if (endpoint.compare(0, scheme.size(), scheme) != 0 || endpoint.size() == scheme.size())
+        {
+            return false;
+        }
+
+        const std::string name = endpoint.substr(scheme.size());
+        if (name.find_first_not_of("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_-.") !=
+            std::string::npos)
+        {
+            return false;
+        }
+
+        toBound = "/limp." + name + ".in";
+        toConnected = "/limp." + name + ".out";
+        return true;
+    }
+
+    TransportError SHMTransport::bind(const std::string &endpoint)
+    {
+        if (isConnected())
+        {
+            return TransportError::AlreadyConnected;
+        }
+
+        std::string toBound, toConnected;
+        if (!ringNames(endpoint, toBound, toConnected))
+        {
+            return TransportError::InvalidEndpoint;
+        }
+
+        TransportError result = rx_.create(toBound, config_.ringSize, true);
+        if (result == TransportError::None)
+        {
+            result = tx_.create(toConnected, config_.ringSize, false);
+        }
+        if (result != TransportError::None)
+        {
+            close();
+            return result;
+        }
+
+        endpoint_ = endpoint;
+        return TransportError::None;
+    }
+
+    TransportError SHMTransport::connect(const std::string &endpoint)
+    {
+        if (isConnected())
+        {
+            return TransportError::AlreadyConnected;
+        }
+
+        std::string toBound, toConnected;
+        if (!ringNames(endpoint, toBound, toConnected))
+        {
+            return TransportError::InvalidEndpoint;
+        }
+
+        TransportError result = tx_.open(toBound);
+        if (result == TransportError::None)
+        {
+            result = rx_.open(toConnected);
+        }
+        if (result != TransportError::None)
+        {
+            close();
+            return result;
+        }
+
+        endpoint_ = endpoint;
+        return TransportError::None;
+    }
+
+    TransportError SHMTransport::send(const Frame &frame)
+    {
+        return tx_.write(frame, config_.sendTimeout, config_.spinCount);
+    }
+
+    TransportError SHMTransport::sendRaw(const uint8_t *data, size_t size)
+    {
+        return tx_.write(data, size, config_.sendTimeout, config_.spinCount);
+    }
+
+    TransportError SHMTransport::receive(Frame &frame, int timeoutMs)
+    {
+        FrameView view;
+        TransportError result = receiveView(view, timeoutMs);
+        if (result != TransportError::None)
+        {
+            return result;
+        }
+        return view.toFrame(frame) ? TransportError::None : TransportError::DeserializationFailed;
+    }
+
+    TransportError SHMTransport::receiveView(FrameView &view, int timeoutMs)
+    {
+        ByteSpan record;
+        TransportError result = rx_.read(record, timeoutMs < 0 ? config_.receiveTimeout : timeoutMs, config_.spinCount);
+        if (result != TransportError::None)
+        {
+            return result;
+        }
+
+        return deserializeFrameView(record.data(), record.size(), view) ? TransportError::None
+                                                                        : TransportError::DeserializationFailed;
+    }
+
+    std::ptrdiff_t SHMTransport::receiveRaw(uint8_t *buffer, size_t maxSize)
+    {
+        ByteSpan record;
+        TransportError result = rx_.read(record, config_.receiveTimeout, config_.spinCount);
+        if (result == TransportError::Timeout)
+        {
+            return 0;
+        }
+        if (result != TransportError::None || record.size() > maxSize)
+        {
+            return -1;
+        }
+
+        std::memcpy(buffer, record.data(), record.size());
+        return static_cast<std::ptrdiff_t>(record.size());
+    }
+
+    void SHMTransport::close()
+    {
+        tx_.close();
+        rx_.close();
+        endpoint_.clear();
+    }
+
+} // namespace limp
@@ -0,0 +1,400 @@
+#include "limp/tcp/tcp_server.hpp"
+#include "tcp_socket.hpp"
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <cerrno>
+#include <thread>
+
+namespace limp
+{
+
+    /** @brief Per-connection state, shared with send() callers */
+    struct TCPServer::Connection
+    {
+        Connection(ConnectionId connectionId, int socket, const FrameDecoder::Options &options)
+            : id(connectionId), fd(socket), decoder(options)
+        {
+        }
+
+        ConnectionId id;          ///< Connection identifier
+        int fd;                   ///< Socket (-1 once closed; guarded by sendMutex)
+        FrameDecoder decoder;     ///< Stream reassembly (owning worker only)
+        std::mutex sendMutex;     ///< Serializes writers and close
+        Worker *worker = nullptr; ///< Owning event loop
+    };
+
+    /** @brief One epoll event loop */
+    struct TCPServer::Worker
+    {
+        ~Worker()
+        {
+            tcp::closeSocket(epollFd);
+            tcp::closeSocket(wakeFd);
+        }
+
+        int epollFd = -1;                ///< epoll instance
+        int wakeFd = -1;                 ///< eventfd signalled by stop()
+        std::thread thread;              ///< Loop thread
+        std::vector<uint8_t> readBuffer; ///< recv() target shared by the worker's connections
+    };
+
+    namespace
+    {
+        constexpr int MAX_EVENTS = 64;
+
+        bool addToEpoll(int epollFd, int fd, void *tag)
+        {
+            struct epoll_event event;
+            event.events = EPOLLIN | EPOLLRDHUP;
+            event.data.ptr = tag;
+            return ::epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) == 0;
+        }
+    } // namespace
+
+    TCPServer::TCPServer(const TCPConfig &config)
+        : config_(config), listenFd_(-1), running_(false), nextWorker_(0), nextId_(1)
+    {
+        // Connections only buffer partial frames, so allocate their decoder buffers lazily
+        config_.decoder.initialBufferSize = 0;
+    }
+
+    TCPServer::~TCPServer()
+    {
+        stop();
+        tcp::closeSocket(listenFd_);
+    }
+
+    TransportError TCPServer::bind(const std::string &endpoint)
+    {
+        if (listenFd_ >= 0)
+        {
+            return TransportError::AlreadyConnected;
+        }
+
+        tcp::Endpoint parsed;
+        if (!tcp::parseEndpoint(endpoint, parsed))
+        {
+            return TransportError::InvalidEndpoint;
+        }
+
+        TransportError result = tcp::listenSocket(parsed, config_, listenFd_);
+        if (result != TransportError::None)
+        {
+            handleError("bind");
+        }
+        return result;
+    }
+
+    uint16_t TCPServer::port() const
+    {
+        return listenFd_ >= 0 ? tcp::localPort(listenFd_) : 0;
+    }
+
+    TransportError TCPServer::start(const Handlers &handlers, size_t threads)
+    {
+        if (listenFd_ < 0)
+        {
+            return TransportError::NotConnected;
+        }
+        if (isRunning())
+        {
+            return TransportError::AlreadyConnected;
+        }
+
+        handlers_ = handlers;
+        workers_.clear();
+        for (size_t i = 0; i < (threads > 0 ? threads : 1); ++i)
+        {
+            auto worker = std::make_unique<Worker>();
+            worker->epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+            worker->wakeFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            // nullptr tags the wake-up eventfd
+            if (worker->epollFd < 0 || worker->wakeFd < 0 || !addToEpoll(worker->epollFd, worker->wakeFd, nullptr))
+            {
+                handleError("epoll setup");
+                workers_.clear();
+                return TransportError::InternalError;
+            }
+            worker->readBuffer.resize(READ_BUFFER_SIZE);
+            workers_.push_back(std::move(worker));
+        }
+
+        // The server itself tags the listener (worker 0 accepts)
+        if (!addToEpoll(workers_[0]->epollFd, listenFd_, this))
+        {
+            handleError("epoll setup");
+            workers_.clear();
+            return TransportError::InternalError;
+        }
+
+        running_.store(true, std::memory_order_release);
+        for (auto &worker : workers_)
+        {
+            Worker *loop = worker.get();
+            worker->thread = std::thread([this, loop]()
+                                         { run(*loop); });
+        }
+        return TransportError::None;
+    }
+
+    void TCPServer::stop()
+    {
+        if (!running_.exchange(false, std::memory_order_acq_rel))
+        {
+            return;
+        }
+
+        for (auto &worker : workers_)
+        {
+            const uint64_t one = 1;
+            ssize_t written = ::write(worker->wakeFd, &one, sizeof(one));
+            (void)written;
+        }
+        for (auto &worker : workers_)
+        {
+            if (worker->thread.joinable())
+            {
+                worker->thread.join();
+            }
+        }
+
+        ::epoll_ctl(workers_[0]->epollFd, EPOLL_CTL_DEL, listenFd_, nullptr);
+
+        std::vector<std::shared_ptr<Connection>> open;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto &entry : connections_)
+            {
+                open.push_back(entry.second);
+            }
+        }
+        for (auto &connection : open)
+        {
+            closeConnection(*connection);
+        }
+        workers_.clear();
+    }
+
+    void TCPServer::run(Worker &worker)
+    {
+        struct epoll_event events[MAX_EVENTS];
+        while (running_.load(std::memory_order_acquire))
+        {
+            int count = ::epoll_wait(worker.epollFd, events, MAX_EVENTS, -1);
+            if (count < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                handleError("epoll_wait");
+                return;
+            }
+
+            for (int i = 0; i < count; ++i)
+            {
+                void *tag = events[i].data.ptr;
+                if (tag == nullptr)
+                {
+                    return; // Woken by stop()
+                }
+                if (tag == this)
+                {
+                    acceptConnections();
+                    continue;
+                }
+
+                // Only the owning worker erases a connection, so the pointer is live here
+                readConnection(worker, *static_cast<Connection *>(tag));
+            }
+        }
+    }
+
+    void TCPServer::acceptConnections()
+    {
+        for (;;)
+        {
+            int fd = ::accept4(listenFd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if (fd < 0)
+            {
+                if (errno == EINTR || errno == ECONNABORTED)
+                {
+                    continue;
+                }
+                if (errno != EAGAIN && errno != EWOULDBLOCK)
+                {
+                    handleError("accept");
+                }
+                return;
+            }
+            if (!tcp::configureSocket(fd, config_))
+            {
+                handleError("socket configuration");
+                tcp::closeSocket(fd);
+                continue;
+            }
+
+            auto connection = std::make_shared<Connection>(nextId_++, fd, config_.decoder);
+            connection->worker = workers_[nextWorker_++ % workers_.size()].get();
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                connections_[connection->id] = connection;
+            }
+
+            // onConnect runs before the worker can see any data
+            if (handlers_.onConnect)
+            {
+                handlers_.onConnect(connection->id);
+            }
+            if (!addToEpoll(connection->worker->epollFd, fd, connection.get()))
+            {
+                handleError("epoll_ctl");
+                closeConnection(*connection);
+            }
+        }
+    }
+
+    void TCPServer::readConnection(Worker &worker, Connection &connection)
+    {
+        for (;;)
+        {
+            std::ptrdiff_t received = tcp::readSome(connection.fd, worker.readBuffer.data(), worker.readBuffer.size());
+            if (received < 0)
+            {
+                closeConnection(connection);
+                return;
+            }
+            if (received == 0)
+            {
+                return; // Drained (level-triggered: more data wakes us again)
+            }
+
+            const ConnectionId id = connection.id;
+            connection.decoder.feed(worker.readBuffer.data(), static_cast<size_t>(received),
+                                    [this, id](const FrameView &view)
+                                    {
+                                        if (handlers_.onFrame)
+                                        {
+                                            handlers_.onFrame(id, view);
+                                        }
+                                    });
+
+            if (static_cast<size_t>(received) < worker.readBuffer.size())
+            {
+                return; // Short read: the socket is empty, skip the EAGAIN round trip
+            }
+        }
+    }
+
+    void TCPServer::closeConnection(Connection &connection)
+    {
+        {
+            std::lock_guard<std::mutex> lock(connection.sendMutex);
+            if (connection.fd < 0)
+            {
+                return;
+            }
+            ::epoll_ctl(connection.worker->epollFd, EPOLL_CTL_DEL, connection.fd, nullptr);
+            tcp::closeSocket(connection.fd);
+        }
+
+        const ConnectionId id = connection.id;
+        std::shared_ptr<Connection> keep; // Destroy the connection outside the lock
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = connections_.find(id);
+            if (it != connections_.end())
+            {
+                keep = std::move(it->second);
+                connections_.erase(it);
+            }
+        }
+
+        if (handlers_.onDisconnect)
+        {
+            handlers_.onDisconnect(id);
+        }
+    }
+
+    std::shared_ptr<TCPServer::Connection> TCPServer::find(ConnectionId id) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = connections_.find(id);
+        return it != connections_.end() ? it->second : nullptr;
+    }
+
+    TransportError TCPServer::send(ConnectionId id, const Frame &frame)
+    {
+        size_t sent = 0;
+        return sendBatch(id, Span<const Frame>(&frame, 1), sent);
+    }
+
+    TransportError TCPServer::sendBatch(ConnectionId id, Span<const Frame> frames, size_t &sent)
+    {
+        sent = 0;
+        std::shared_ptr<Connection> connection = find(id);
+        if (!connection)
+        {
+            return TransportError::NotConnected;
+        }
+
+        std::lock_guard<std::mutex> lock(connection->sendMutex);
+        if (connection->fd < 0)
+        {
+            return TransportError::NotConnected;
+        }
+
+        bool torn = false;
+        TransportError result =
+            tcp::writeFrames(connection->fd, frames.data(), frames.size(), config_.sendTimeout, sent, torn);
+        if (torn)
+        {
+            // Half a frame is on the stream: drop the connection; the owning worker
+            // sees the hangup, closes the socket and reports the disconnect
+            handleError("send (partial frame written, connection closed)");
+            ::shutdown(connection->fd, SHUT_RDWR);
+            return TransportError::SocketClosed;
+        }
+        if (result == TransportError::SendFailed)
+        {
+            handleError("send");
+        }
+        return result;
+    }
+
+    bool TCPServer::disconnect(ConnectionId id)
+    {
+        std::shared_ptr<Connection> connection = find(id);
+        if (!connection)
+        {
+            return false;
+        }
+
+        // Wake the owning worker, which closes the socket and reports the disconnect
+        std::lock_guard<std::mutex> lock(connection->sendMutex);
+        if (connection->fd >= 0)
+        {
+            ::shutdown(connection->fd, SHUT_RDWR);
+        }
+        return true;
+    }
+
+    size_t TCPServer::connectionCount() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return connections_.size();
+    }
+
+    void TCPServer::setErrorCallback(ErrorCallback callback)
+    {
+        errorCallback_ = std::move(callback);
+    }
+
+    void TCPServer::handleError(const char *operation)
+    {
+        tcp::reportError(errorCallback_, operation);
+    }
+
+} // namespace limp
@@ -0,0 +1,418 @@
+#include "tcp_socket.hpp"
+#include "limp/compression.hpp"
+#include "limp/crc.hpp"
+#include "limp/utils.hpp"
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace limp
+{
+    namespace tcp
+    {
+
+        namespace
+        {
+#if defined(MSG_NOSIGNAL)
+            constexpr int SEND_FLAGS = MSG_NOSIGNAL; // Report EPIPE instead of raising SIGPIPE
+#else
+            constexpr int SEND_FLAGS = 0;
+#endif
+
+            // Frames per gather write (3 iovecs each, well below IOV_MAX)
+            constexpr size_t FRAMES_PER_WRITE = 64;
+
+            using Clock = std::chrono::steady_clock;
+
+            int remainingMs(Clock::time_point deadline, int timeoutMs)
+            {
+                if (timeoutMs < 0)
+                {
+                    return -1;
+                }
+                auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()).count();
+                return left > 0 ? static_cast<int>(left) : 0;
+            }
+
+            // Write all iovecs, resuming after short writes; written counts the bytes that made it out
+            TransportError writeVector(int fd, struct iovec *iov, size_t count, int timeoutMs, size_t &written)
+            {
+                written = 0;
+                const Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(timeoutMs < 0 ? 0 : timeoutMs);
+                while (count > 0)
+                {
+                    struct msghdr message;
+                    std::memset(&message, 0, sizeof(message));
+                    message.msg_iov = iov;
+                    message.msg_iovlen = count;
+
+                    // sendmsg is writev plus flags (MSG_NOSIGNAL)
+                    ssize_t result = ::sendmsg(fd, &message, SEND_FLAGS);
+                    if (result < 0)
+                    {
+                        if (errno == EINTR)
+                        {
+                            continue;
+                        }
+                        if (errno == EAGAIN || errno == EWOULDBLOCK)
+                        {
+                            int ready = waitFor(fd, POLLOUT, remainingMs(deadline, timeoutMs));
+                            if (ready == 0)
+                            {
+                                return TransportError::Timeout;
+                            }
+                            if (ready < 0)
+                            {
+                                return TransportError::SendFailed;
+                            }
+                            continue;
+                        }
+                        return (errno == EPIPE || errno == ECONNRESET) ? TransportError::SocketClosed
+                                                                       : TransportError::SendFailed;
+                    }
+
+                    // Skip fully written iovecs, trim the partially written one
+                    size_t done = static_cast<size_t>(result);
+                    written += done;
+                    while (count > 0 && done >= iov->iov_len)
+                    {
+                        done -= iov->iov_len;
+                        ++iov;
+                        --count;
+                    }
+                    if (count > 0)
+                    {
+                        iov->iov_base = static_cast<uint8_t *>(iov->iov_base) + done;
+                        iov->iov_len -= done;
+                    }
+                }
+                return TransportError::None;
+            }
+        } // namespace
+
+        bool parseEndpoint(const std::string &endpoint, Endpoint &out)
+        {
+            const std::string scheme = "tcp://";
+            if (endpoint.compare(0, scheme.size(), scheme) != 0)
+            {
+                return false;
+            }
+
+            const size_t colon = endpoint.rfind(':');
+            if (colon == std::string::npos || colon < scheme.size() || colon + 1 >= endpoint.size())
+            {
+                return false;
+            }
+
+            out.host = endpoint.substr(scheme.size(), colon - scheme.size());
+            out.port = endpoint.substr(colon + 1);
+            if (out.host.size() > 2 && out.host.front() == '[' && out.host.back() == ']')
+            {
+                out.host = out.host.substr(1, out.host.size() - 2); // [IPv6]
+            }
+            return out.port.find_first_not_of("0123456789") == std::string::npos;
+        }
+
+        bool configureSocket(int fd, const TCPConfig &config)
+        {
+            int flags = ::fcntl(fd, F_GETFL, 0);
+            if (flags < 0 || ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0)
+            {
+                return false;
+            }
+
+            int on = 1;
+            if (config.noDelay)
+            {
+                ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+            }
+            if (config.keepAlive)
+            {
+                ::setsockopt(fd, SOL_SOCKET, SO_KEEPALIVE, &on, sizeof(on));
+            }
+            if (config.sendBufferSize > 0)
+            {
+                ::setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &config.sendBufferSize, sizeof(config.sendBufferSize));
+            }
+            if (config.receiveBufferSize > 0)
+            {
+                ::setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &config.receiveBufferSize, sizeof(config.receiveBufferSize));
+            }
+#if defined(SO_NOSIGPIPE)
+            ::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+            return true;
+        }
+
+        TransportError connectSocket(const Endpoint &endpoint, const TCPConfig &config, int &fd)
+        {
+            struct addrinfo hints;
+            std::memset(&hints, 0, sizeof(hints));
+            hints.ai_family = AF_UNSPEC;
+            hints.ai_socktype = SOCK_STREAM;
+
+            struct addrinfo *addresses = nullptr;
+            if (::getaddrinfo(endpoint.host.c_str(), endpoint.port.c_str(), &hints, &addresses) != 0)
+            {
+                return TransportError::InvalidEndpoint;
+            }
+
+            TransportError result = TransportError::ConnectionFailed;
+            for (struct addrinfo *address = addresses; address != nullptr; address = address->ai_next)
+            {
+                fd = ::socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+                if (fd < 0)
+                {
+                    continue;
+                }
+                if (!configureSocket(fd, config))
+                {
+                    closeSocket(fd);
+                    continue;
+                }
+
+                if (::connect(fd, address->ai_addr, address->ai_addrlen) == 0)
+                {
+                    result = TransportError::None;
+                    break;
+                }
+                if (errno == EINPROGRESS && waitFor(fd, POLLOUT, config.connectTimeout) > 0)
+                {
+                    int error = 0;
+                    socklen_t length = sizeof(error);
+                    if (::getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &length) == 0 && error == 0)
+                    {
+                        result = TransportError::None;
+                        break;
+                    }
+                    errno = error; // Report the connect failure, not EINPROGRESS
+                }
+                else if (errno == EINPROGRESS)
+                {
+                    result = TransportError::Timeout;
+                }
+                closeSocket(fd);
+            }
+
+            ::freeaddrinfo(addresses);
+            return result;
+        }
+
+        TransportError listenSocket(const Endpoint &endpoint, const TCPConfig &config, int &fd)
+        {
+            struct addrinfo hints;
+            std::memset(&hints, 0, sizeof(hints));
+            hints.ai_family = AF_UNSPEC;
+            hints.ai_socktype = SOCK_STREAM;
+            hints.ai_flags = AI_PASSIVE;
+
+            const bool any = endpoint.host.empty() || endpoint.host == "*";
+            struct addrinfo *addresses = nullptr;
+            if (::getaddrinfo(any ? nullptr : endpoint.host.c_str(), endpoint.port.c_str(), &hints, &addresses) != 0)
+            {
+                return TransportError::InvalidEndpoint;
+            }
+
+            TransportError result = TransportError::BindFailed;
+            for (struct addrinfo *address = addresses; address != nullptr; address = address->ai_next)
+            {
+                fd = ::socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+                if (fd < 0)
+                {
+                    continue;
+                }
+
+                int on = 1;
+                ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+                if (configureSocket(fd, config) && ::bind(fd, address->ai_addr, address->ai_addrlen) == 0 &&
+                    ::listen(fd, config.listenBacklog) == 0)
+                {
+                    result = TransportError::None;
+                    break;
+                }
+                closeSocket(fd);
+            }
+
+            ::freeaddrinfo(addresses);
+            return result;
+        }
+
+        uint16_t localPort(int fd)
+        {
+            struct sockaddr_storage address;
+            socklen_t length = sizeof(address);
+            if (::getsockname(fd, reinterpret_cast<struct sockaddr *>(&address), &length) != 0)
+            {
+                return 0;
+            }
+            if (address.ss_family == AF_INET)
+            {
+                return ntohs(reinterpret_cast<struct sockaddr_in *>(&address)->sin_port);
+            }
+            if (address.ss_family == AF_INET6)
+            {
+                return ntohs(reinterpret_cast<struct sockaddr_in6 *>(&address)->sin6_port);
+            }
+            return 0;
+        }
+
+        int waitFor(int fd, short events, int timeoutMs)
+        {
+            struct pollfd item;
+            item.fd = fd;
+            item.events = events;
+            item.revents = 0;
+
+            for (;;)
+            {
+                int ready = ::poll(&item, 1, timeoutMs);
+                if (ready < 0 && errno == EINTR)
+                {
+                    continue;
+                }
+                if (ready <= 0)
+                {
+                    return ready;
+                }
+                // Report hangups as ready so the following read/write sees the error
+                return 1;
+            }
+        }
+
+        TransportError writeFrames(int fd, const Frame *frames, size_t count, int timeoutMs, size_t &sent, bool &torn)
+        {
+            sent = 0;
+            torn = false;
+            uint8_t headers[FRAMES_PER_WRITE][HEADER_SIZE];
+            uint8_t crcs[FRAMES_PER_WRITE][CRC_SIZE];
+            size_t ends[FRAMES_PER_WRITE]; // Stream offset just past each frame of the batch
+            struct iovec iov[FRAMES_PER_WRITE * 3];
+            thread_local Frame compressed[FRAMES_PER_WRITE]; // Wire form of frames sent compressed
+
+            while (sent < count)
+            {
+                size_t batch = 0;
+                size_t iovCount = 0;
+                size_t total = 0;
+                for (; batch < FRAMES_PER_WRITE && sent + batch < count; ++batch)
+                {
+                    const Frame &source = frames[sent + batch];
+                    if (!source.validate())
+                    {
+                        if (batch == 0)
+                        {
+                            return TransportError::SerializationFailed;
+                        }
+                        break; // Send the valid frames before it first
+                    }
+                    const Frame &frame = detail::compressForWire(source, compressed[batch]) ? compressed[batch] : source;
+
+                    serializeFrameHeader(frame, headers[batch]);
+                    iov[iovCount].iov_base = headers[batch];
+                    iov[iovCount++].iov_len = HEADER_SIZE;
+                    if (frame.payloadLen > 0)
+                    {
+                        iov[iovCount].iov_base = const_cast<uint8_t *>(frame.payload.data());
+                        iov[iovCount++].iov_len = frame.payloadLen;
+                    }
+                    if (frame.hasCRC())
+                    {
+                        Crc16 crc;
+                        crc.update(headers[batch], HEADER_SIZE).update(frame.payload.data(), frame.payloadLen);
+                        uint16_t crcBE = utils::hton16(crc.finalize());
+                        std::memcpy(crcs[batch], &crcBE, CRC_SIZE);
+                        iov[iovCount].iov_base = crcs[batch];
+                        iov[iovCount++].iov_len = CRC_SIZE;
+                    }
+                    total += frame.totalSize();
+                    ends[batch] = total;
+                }
+
+                size_t written = 0;
+                TransportError result = writeVector(fd, iov, iovCount, timeoutMs, written);
+                if (result != TransportError::None)
+                {
+                    // Count the frames that made it out whole; anything else means the
+                    // stream now ends inside a frame
+                    size_t complete = 0;
+                    while (complete < batch && ends[complete] <= written)
+                    {
+                        ++complete;
+                    }
+                    sent += complete;
+                    torn = written > (complete > 0 ? ends[complete - 1] : 0);
+                    return result;
+                }
+                sent += batch;
+            }
+            return TransportError::None;
+        }
+
+        TransportError writeBytes(int fd, const uint8_t *data, size_t size, int timeoutMs, size_t &written)
+        {
+            struct iovec iov;
+            iov.iov_base = const_cast<uint8_t *>(data);
+            iov.iov_len = size;
+            return writeVector(fd, &iov, 1, timeoutMs, written);
+        }
+
+        std::ptrdiff_t readSome(int fd, uint8_t *buffer, size_t size)
+        {
+            for (;;)
+            {
+                ssize_t received = ::recv(fd, buffer, size, 0);
+                if (received > 0)
+                {
+                    return received;
+                }
+                if (received == 0)
+                {
+                    return -1; // Orderly shutdown by the peer
+                }
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+            }
+        }
+
+        void closeSocket(int &fd) noexcept
+        {
+            if (fd >= 0)
+            {
+                ::close(fd);
+                fd = -1;
+            }
+        }
+
+        std::string lastError(const char *operation)
+        {
+            return std::string("TCP error during ") + operation + ": " + std::strerror(errno) + " (code: " +
+                   std::to_string(errno) + ")";
+        }
+
+        void reportError(const ErrorCallback &callback, const char *operation)
+        {
+            std::string message = lastError(operation);
+            if (callback)
+            {
+                callback(message);
+            }
+            else
+            {
+                std::cerr << message << std::endl;
+            }
+        }
+
+    } // namespace tcp
+} // namespace limp
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "limp/frame.hpp"
+#include "limp/tcp/tcp_config.hpp"
+#include "limp/transport.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace limp
+{
+
+    /**
+     * @brief POSIX socket helpers shared by TCPTransport and TCPServer
+     *
+     * All sockets are non-blocking; timeouts are applied with poll().
+     */
+    namespace tcp
+    {
+
+        /** @brief Parsed "tcp://host:port" endpoint */
+        struct Endpoint
+        {
+            std::string host; ///< Host name or address ("*" or empty: any interface)
+            std::string port; ///< Port number
+        };
+
+        /** @brief Parse a ZeroMQ-style TCP endpoint */
+        bool parseEndpoint(const std::string &endpoint, Endpoint &out);
+
+        /** @brief Open a non-blocking connection (fd >= 0 on success) */
+        TransportError connectSocket(const Endpoint &endpoint, const TCPConfig &config, int &fd);
+
+        /** @brief Open a non-blocking listening socket */
+        TransportError listenSocket(const Endpoint &endpoint, const TCPConfig &config, int &fd);
+
+        /** @brief Make a socket non-blocking and apply TCPConfig options */
+        bool configureSocket(int fd, const TCPConfig &config);
+
+        /** @brief Local port a socket is bound to (0 on error) */
+        uint16_t localPort(int fd);
+
+        /**
+         * @brief Wait until a socket is ready
+         * @return 1 if ready, 0 on timeout, -1 on error
+         */
+        int waitFor(int fd, short events, int timeoutMs);
+
+        /**
+         * @brief Write frames with one gather write per batch
+         *
+         * Header, payload and CRC of each frame go out as separate iovecs
+         * straight from the Frame, so nothing is serialized into a buffer.
+         *
+         * On failure the stream may end inside a frame (a timeout after a
+         * short write). The peer cannot resync past that without dropping
+         * frames, so callers must close the connection when torn is set.
+         *
+         * @param sent Number of frames completely written, including those of a failed batch
+         * @param torn Output: true if part of a frame was written
+         */
+        TransportError writeFrames(int fd, const Frame *frames, size_t count, int timeoutMs, size_t &sent, bool &torn);
+
+        /**
+         * @brief Write raw bytes completely
+         * @param written Output: bytes written, less than size on failure
+         */
+        TransportError writeBytes(int fd, const uint8_t *data, size_t size, int timeoutMs, size_t &written);
+
+        /**
+         * @brief Receive available bytes
+         * @return Bytes read, 0 if none are available, -1 if the peer closed or on error
+         */
+        std::ptrdiff_t readSome(int fd, uint8_t *buffer, size_t size);
+
+        /** @brief Close a socket and set fd to -1 */
+        void closeSocket(int &fd) noexcept;
+
+        /** @brief Describe the current errno for error callbacks */
+        std::string lastError(const char *operation);
+
+        /** @brief Pass lastError() to callback, or print it to std::cerr if none is set */
+        void reportError(const ErrorCallback &callback, const char *operation);
+
+    } // namespace tcp
+} // namespace limp
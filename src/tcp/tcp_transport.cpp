@@ -0,0 +1,199 @@
+#include "limp/tcp/tcp_transport.hpp"
+#include "tcp_socket.hpp"
+#include <poll.h>
+#include <chrono>
+#include <cstring>
+
+namespace limp
+{
+
+    TCPTransport::TCPTransport(const TCPConfig &config)
+        : config_(config), decoder_(config.decoder), fd_(-1)
+    {
+    }
+
+    TCPTransport::TCPTransport(int fd, const TCPConfig &config)
+        : config_(config), decoder_(config.decoder), fd_(fd)
+    {
+        if (fd_ >= 0 && !tcp::configureSocket(fd_, config_))
+        {
+            handleError("socket configuration");
+        }
+    }
+
+    TCPTransport::~TCPTransport()
+    {
+        close();
+    }
+
+    TransportError TCPTransport::connect(const std::string &endpoint)
+    {
+        if (fd_ >= 0)
+        {
+            return TransportError::AlreadyConnected;
+        }
+
+        tcp::Endpoint parsed;
+        if (!tcp::parseEndpoint(endpoint, parsed))
+        {
+            return TransportError::InvalidEndpoint;
+        }
+
+        TransportError result = tcp::connectSocket(parsed, config_, fd_);
+        if (result != TransportError::None)
+        {
+            handleError("connect");
+            return result;
+        }
+
+        endpoint_ = endpoint;
+        decoder_.reset();
+        return TransportError::None;
+    }
+
+    TransportError TCPTransport::send(const Frame &frame)
+    {
+        size_t sent = 0;
+        return sendBatch(Span<const Frame>(&frame, 1), sent);
+    }
+
+    TransportError TCPTransport::sendBatch(Span<const Frame> frames, size_t &sent)
+    {
+        sent = 0;
+        if (fd_ < 0)
+        {
+            return TransportError::NotConnected;
+        }
+
+        bool torn = false;
+        TransportError result = tcp::writeFrames(fd_, frames.data(), frames.size(), config_.sendTimeout, sent, torn);
+        if (torn)
+        {
+            // Half a frame is on the stream: anything sent after it would be misparsed
+            handleError("send (partial frame written, connection closed)");
+            tcp::closeSocket(fd_);
+            return TransportError::SocketClosed;
+        }
+        if (result == TransportError::SendFailed || result == TransportError::SocketClosed)
+        {
+            handleError("send");
+        }
+        return result;
+    }
+
+    TransportError TCPTransport::sendRaw(const uint8_t *data, size_t size)
+    {
+        if (fd_ < 0)
+        {
+            return TransportError::NotConnected;
+        }
+
+        size_t written = 0;
+        TransportError result = tcp::writeBytes(fd_, data, size, config_.sendTimeout, written);
+        if (result != TransportError::None && written > 0)
+        {
+            handleError("send (partial write, connection closed)");
+            tcp::closeSocket(fd_);
+            return TransportError::SocketClosed;
+        }
+        if (result == TransportError::SendFailed || result == TransportError::SocketClosed)
+        {
+            handleError("send");
+        }
+        return result;
+    }
+
+    TransportError TCPTransport::receive(Frame &frame, int timeoutMs)
+    {
+        FrameView view;
+        TransportError result = receiveView(view, timeoutMs);
+        if (result != TransportError::None)
+        {
+            return result;
+        }
+        return view.toFrame(frame) ? TransportError::None : TransportError::DeserializationFailed;
+    }
+
+    TransportError TCPTransport::receiveView(FrameView &view, int timeoutMs)
+    {
+        if (fd_ < 0)
+        {
+            return TransportError::NotConnected;
+        }
+
+        using Clock = std::chrono::steady_clock;
+        const int timeout = timeoutMs < 0 ? config_.receiveTimeout : timeoutMs;
+        const Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(timeout < 0 ? 0 : timeout);
+
+        for (;;)
+        {
+            if (decoder_.next(view))
+            {
+                return TransportError::None;
+            }
+
+            int wait = -1;
+            if (timeout >= 0)
+            {
+                auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()).count();
+                wait = left > 0 ? static_cast<int>(left) : 0;
+            }
+
+            int ready = tcp::waitFor(fd_, POLLIN, wait);
+            if (ready == 0)
+            {
+                return TransportError::Timeout;
+            }
+            if (ready < 0)
+            {
+                handleError("receive");
+                return TransportError::ReceiveFailed;
+            }
+
+            Span<uint8_t> space = decoder_.prepare(RECEIVE_CHUNK);
+            std::ptrdiff_t received = tcp::readSome(fd_, space.data(), space.size());
+            if (received < 0)
+            {
+                // Peer closed the stream (or it broke); drop the socket
+                tcp::closeSocket(fd_);
+                return TransportError::SocketClosed;
+            }
+            decoder_.commit(static_cast<size_t>(received));
+        }
+    }
+
+    std::ptrdiff_t TCPTransport::receiveRaw(uint8_t *buffer, size_t maxSize)
+    {
+        FrameView view;
+        TransportError result = receiveView(view);
+        if (result == TransportError::Timeout)
+        {
+            return 0;
+        }
+        if (result != TransportError::None || view.size() > maxSize)
+        {
+            return -1;
+        }
+
+        std::memcpy(buffer, view.data(), view.size());
+        return static_cast<std::ptrdiff_t>(view.size());
+    }
+
+    void TCPTransport::close()
+    {
+        tcp::closeSocket(fd_);
+        decoder_.reset();
+        endpoint_.clear();
+    }
+
+    void TCPTransport::setErrorCallback(ErrorCallback callback)
+    {
+        errorCallback_ = std::move(callback);
+    }
+
+    void TCPTransport::handleError(const char *operation)
+    {
+        tcp::reportError(errorCallback_, operation);
+    }
+
+} // namespace limp
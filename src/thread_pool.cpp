@@ -0,0 +1,55 @@
+#include "limp/thread_pool.hpp"
+#include <algorithm>
+
+namespace limp
+{
+
+    ThreadPool::ThreadPool(size_t threads)
+    {
+        const size_t count = std::max<size_t>(threads, 1);
+        workers_.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            workers_.emplace_back(&ThreadPool::workerLoop, this);
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        for (auto &worker : workers_)
+        {
+            worker.join();
+        }
+    }
+
+    void ThreadPool::workerLoop()
+    {
+        for (;;)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+                if (tasks_.empty())
+                {
+                    return; // Stopping and drained
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop();
+            }
+            task();
+        }
+    }
+
+    ThreadPool &getThreadPool()
+    {
+        static ThreadPool pool(4);
+        return pool;
+    }
+
+} // namespace limp
@@ -0,0 +1,63 @@
+#include "limp/trace.hpp"
+#include <chrono>
+
+namespace limp
+{
+
+    namespace detail
+    {
+        std::atomic<Tracer *> activeTracer{nullptr};
+
+        void emitTrace(Tracer &tracer, TraceEvent event, const uint8_t *frame, size_t size,
+                       TransportError error, const char *operation) noexcept
+        {
+            TraceRecord record{};
+            record.event = event;
+            record.timestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                         std::chrono::steady_clock::now().time_since_epoch())
+                                                         .count());
+            record.operation = operation;
+            record.error = error;
+            record.size = size;
+            record.hasHeader = frame && size >= HEADER_SIZE;
+            if (record.hasHeader)
+            {
+                record.msgType = static_cast<MsgType>(frame[1]);
+                record.srcNodeID = static_cast<uint16_t>((frame[2] << 8) | frame[3]);
+                record.classID = static_cast<uint16_t>((frame[4] << 8) | frame[5]);
+                record.instanceID = static_cast<uint16_t>((frame[6] << 8) | frame[7]);
+                record.attrID = static_cast<uint16_t>((frame[8] << 8) | frame[9]);
+                record.flags = frame[13];
+            }
+            tracer.onEvent(record);
+        }
+    } // namespace detail
+
+    const char *toString(TraceEvent event) noexcept
+    {
+        switch (event)
+        {
+        case TraceEvent::FrameReceived:
+            return "FrameReceived";
+        case TraceEvent::DeserializeComplete:
+            return "DeserializeComplete";
+        case TraceEvent::SendEnqueued:
+            return "SendEnqueued";
+        case TraceEvent::SendComplete:
+            return "SendComplete";
+        default:
+            return "Unknown";
+        }
+    }
+
+    void setTracer(Tracer *tracer) noexcept
+    {
+        detail::activeTracer.store(tracer, std::memory_order_release);
+    }
+
+    Tracer *getTracer() noexcept
+    {
+        return detail::activeTracer.load(std::memory_order_acquire);
+    }
+
+} // namespace limp
@@ -0,0 +1,353 @@
+#include "limp/transaction_tracker.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace limp
+{
+
+    TransactionTracker::TransactionTracker(std::chrono::milliseconds tickResolution)
+        : epoch_(Clock::now()),
+          tickResolution_(std::max<Clock::duration>(tickResolution, std::chrono::milliseconds(1))),
+          nextTransactionId_(1),
+          pending_(0),
+          registered_(0),
+          completed_(0),
+          failed_(0),
+          timedOut_(0)
+    {
+    }
+
+    uint64_t TransactionTracker::tickOf(Clock::time_point time) const noexcept
+    {
+        if (time <= epoch_)
+        {
+            return 0;
+        }
+        return static_cast<uint64_t>((time - epoch_) / tickResolution_);
+    }
+
+    bool TransactionTracker::insertLocked(Shard &shard, uint16_t transactionId, Clock::time_point now,
+                                          const std::string &sourceId, const std::string &destId,
+                                          CompletionHandler &&handler)
+    {
+        const uint64_t tick = tickOf(now);
+        auto result = shard.transactions.try_emplace(
+            transactionId, Entry{TransactionInfo{transactionId, now, sourceId, destId, false}, tick, 0, {}});
+        if (!result.second)
+        {
+            return false;
+        }
+
+        Entry &entry = result.first->second;
+        auto &slot = shard.wheel[tick & (WHEEL_SLOTS - 1)];
+        entry.handler = std::move(handler);
+        entry.slotIndex = slot.size();
+        slot.push_back(&entry);
+        pending_.fetch_add(1, std::memory_order_relaxed);
+        registered_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void TransactionTracker::unlinkLocked(Shard &shard, EntryMap::iterator it)
+    {
+        // Swap-remove: the slot's last entry takes this entry's position
+        auto &slot = shard.wheel[it->second.tick & (WHEEL_SLOTS - 1)];
+        Entry *moved = slot.back();
+        moved->slotIndex = it->second.slotIndex;
+        slot[moved->slotIndex] = moved;
+        slot.pop_back();
+        shard.transactions.erase(it);
+    }
+
+    uint16_t TransactionTracker::registerTransaction(const std::string &sourceId, const std::string &destId)
+    {
+        const Clock::time_point now = Clock::now();
+        for (size_t attempt = 0; attempt <= std::numeric_limits<uint16_t>::max(); ++attempt)
+        {
+            const uint16_t id = nextTransactionId_.fetch_add(1, std::memory_order_relaxed);
+            if (id == 0)
+            {
+                continue; // 0 means "no transaction"
+            }
+
+            Shard &shard = shardFor(id);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if (insertLocked(shard, id, now, sourceId, destId, CompletionHandler()))
+            {
+                return id;
+            }
+        }
+        return 0;
+    }
+
+    bool TransactionTracker::registerTransaction(uint16_t transactionId,
+                                                 const std::string &sourceId,
+                                                 const std::string &destId)
+    {
+        return registerTransaction(transactionId, sourceId, destId, CompletionHandler());
+    }
+
+    bool TransactionTracker::registerTransaction(uint16_t transactionId,
+                                                 const std::string &sourceId,
+                                                 const std::string &destId,
+                                                 CompletionHandler handler)
+    {
+        if (transactionId == 0)
+        {
+            return false;
+        }
+
+        const Clock::time_point now = Clock::now();
+        Shard &shard = shardFor(transactionId);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return insertLocked(shard, transactionId, now, sourceId, destId, std::move(handler));
+    }
+
+    bool TransactionTracker::finish(uint16_t transactionId, bool success, TransportError error, const Frame *reply)
+    {
+        CompletionHandler handler;
+        Clock::time_point registeredAt;
+        Shard &shard = shardFor(transactionId);
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto it = shard.transactions.find(transactionId);
+            if (it == shard.transactions.end())
+            {
+                return false;
+            }
+            handler = std::move(it->second.handler);
+            registeredAt = it->second.info.timestamp;
+            unlinkLocked(shard, it);
+        }
+
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+        (success ? completed_ : failed_).fetch_add(1, std::memory_order_relaxed);
+        if (success && metricsEnabled())
+        {
+            roundTrip_.record(static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - registeredAt).count()));
+        }
+        if (handler)
+        {
+            handler(error, reply);
+        }
+        return true;
+    }
+
+    bool TransactionTracker::completeTransaction(uint16_t transactionId, bool success)
+    {
+        return finish(transactionId, success, success ? TransportError::None : TransportError::InternalError, nullptr);
+    }
+
+    bool TransactionTracker::track(MsgType type, uint16_t transactionId,
+                                   const std::string &sourceId, const std::string &destId,
+                                   const Frame *reply)
+    {
+        if (transactionId == 0)
+        {
+            return false;
+        }
+
+        switch (type)
+        {
+        case MsgType::REQUEST:
+            return registerTransaction(transactionId, sourceId, destId);
+        case MsgType::RESPONSE:
+        case MsgType::ACK:
+            return finish(transactionId, true, TransportError::None, reply);
+        case MsgType::ERROR:
+            // Application-level failure; the handler still gets the reply
+            return finish(transactionId, false, TransportError::None, reply);
+        default:
+            return false;
+        }
+    }
+
+    bool TransactionTracker::track(const Frame &frame, const std::string &sourceId, const std::string &destId)
+    {
+        return track(frame.msgType, frame.attrID, sourceId, destId, &frame);
+    }
+
+    bool TransactionTracker::trackRaw(const uint8_t *data, size_t size,
+                                      const std::string &sourceId, const std::string &destId)
+    {
+        std::optional<uint16_t> id = extractTransactionId(data, size);
+        if (!id)
+        {
+            return false;
+        }
+        return track(static_cast<MsgType>(data[1]), *id, sourceId, destId, nullptr);
+    }
+
+    bool TransactionTracker::untrack(const Frame &frame, TransportError error)
+    {
+        return frame.msgType == MsgType::REQUEST && frame.attrID != 0 &&
+               finish(frame.attrID, false, error, nullptr);
+    }
+
+    bool TransactionTracker::untrackRaw(const uint8_t *data, size_t size, TransportError error)
+    {
+        std::optional<uint16_t> id = extractTransactionId(data, size);
+        return id && static_cast<MsgType>(data[1]) == MsgType::REQUEST && finish(*id, false, error, nullptr);
+    }
+
+    bool TransactionTracker::isPending(uint16_t transactionId) const
+    {
+        const Shard &shard = shardFor(transactionId);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.transactions.count(transactionId) != 0;
+    }
+
+    std::optional<TransactionTracker::TransactionInfo> TransactionTracker::getTransaction(uint16_t transactionId) const
+    {
+        const Shard &shard = shardFor(transactionId);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.transactions.find(transactionId);
+        if (it == shard.transactions.end())
+        {
+            return std::nullopt;
+        }
+        return it->second.info;
+    }
+
+    std::vector<uint16_t> TransactionTracker::getPendingTransactions() const
+    {
+        std::vector<uint16_t> ids;
+        ids.reserve(getPendingCount());
+        for (const Shard &shard : shards_)
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            for (const auto &entry : shard.transactions)
+            {
+                ids.push_back(entry.first);
+            }
+        }
+        return ids;
+    }
+
+    template <typename Visitor>
+    void TransactionTracker::forEachExpiredLocked(const Shard &shard, uint64_t cutoffTick,
+                                                  Clock::time_point cutoff, Visitor &&visit)
+    {
+        if (cutoffTick < shard.sweptTick)
+        {
+            return;
+        }
+
+        // Visit each slot at most once, even after a long idle period
+        const uint64_t span = std::min<uint64_t>(cutoffTick - shard.sweptTick + 1, WHEEL_SLOTS);
+        for (uint64_t tick = cutoffTick + 1 - span; tick <= cutoffTick; ++tick)
+        {
+            for (Entry *entry : shard.wheel[tick & (WHEEL_SLOTS - 1)])
+            {
+                // Slots are shared by every wheel revolution; skip newer entries
+                if (entry->tick <= cutoffTick && entry->info.timestamp <= cutoff)
+                {
+                    visit(entry->info.transactionId);
+                }
+            }
+        }
+    }
+
+    std::vector<uint16_t> TransactionTracker::getTimedOutTransactions(std::chrono::milliseconds timeout) const
+    {
+        std::vector<uint16_t> ids;
+        const Clock::time_point cutoff = Clock::now() - timeout;
+        if (cutoff < epoch_)
+        {
+            return ids;
+        }
+
+        const uint64_t cutoffTick = tickOf(cutoff);
+        for (const Shard &shard : shards_)
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            forEachExpiredLocked(shard, cutoffTick, cutoff, [&ids](uint16_t id) { ids.push_back(id); });
+        }
+        return ids;
+    }
+
+    size_t TransactionTracker::cleanupTimedOutTransactions(std::chrono::milliseconds timeout)
+    {
+        const Clock::time_point cutoff = Clock::now() - timeout;
+        if (cutoff < epoch_)
+        {
+            return 0;
+        }
+
+        const uint64_t cutoffTick = tickOf(cutoff);
+        std::vector<uint16_t> expired;
+        std::vector<CompletionHandler> handlers;
+        size_t removed = 0;
+        for (Shard &shard : shards_)
+        {
+            {
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                expired.clear();
+                forEachExpiredLocked(shard, cutoffTick, cutoff, [&expired](uint16_t id) { expired.push_back(id); });
+                for (uint16_t id : expired)
+                {
+                    auto it = shard.transactions.find(id);
+                    if (it->second.handler)
+                    {
+                        handlers.push_back(std::move(it->second.handler));
+                    }
+                    unlinkLocked(shard, it);
+                }
+                // Everything registered before cutoffTick is gone; the cutoff slot may still hold newer entries
+                shard.sweptTick = std::max(shard.sweptTick, cutoffTick);
+                removed += expired.size();
+            }
+            pending_.fetch_sub(expired.size(), std::memory_order_relaxed);
+            timedOut_.fetch_add(expired.size(), std::memory_order_relaxed);
+
+            for (auto &handler : handlers)
+            {
+                handler(TransportError::Timeout, nullptr);
+            }
+            handlers.clear();
+        }
+        return removed;
+    }
+
+    TransactionTracker::Stats TransactionTracker::getStats() const noexcept
+    {
+        Stats stats;
+        stats.registered = registered_.load(std::memory_order_relaxed);
+        stats.completed = completed_.load(std::memory_order_relaxed);
+        stats.failed = failed_.load(std::memory_order_relaxed);
+        stats.timedOut = timedOut_.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    void TransactionTracker::clear()
+    {
+        std::vector<CompletionHandler> handlers;
+        for (Shard &shard : shards_)
+        {
+            {
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                pending_.fetch_sub(shard.transactions.size(), std::memory_order_relaxed);
+                for (auto &entry : shard.transactions)
+                {
+                    if (entry.second.handler)
+                    {
+                        handlers.push_back(std::move(entry.second.handler));
+                    }
+                }
+                shard.transactions.clear();
+                for (auto &slot : shard.wheel)
+                {
+                    slot.clear();
+                }
+            }
+
+            for (auto &handler : handlers)
+            {
+                handler(TransportError::InternalError, nullptr);
+            }
+            handlers.clear();
+        }
+    }
+
+} // namespace limp
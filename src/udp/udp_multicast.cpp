@@ -0,0 +1,690 @@
+#include "limp/udp/udp_multicast.hpp"
+#include "limp/compression.hpp"
+#include "limp/crc.hpp"
+#include "limp/utils.hpp"
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+namespace limp
+{
+
+    namespace
+    {
+        // Upper bound for UDPConfig::batchSize (stack arrays per system call)
+        constexpr size_t MAX_BATCH = 64;
+
+        using Clock = std::chrono::steady_clock;
+
+        bool parseGroup(const std::string &endpoint, uint32_t &address, uint16_t &port)
+        {
+            const std::string scheme = "udp://";
+            if (endpoint.compare(0, scheme.size(), scheme) != 0)
+            {
+                return false;
+            }
+
+            const size_t colon = endpoint.rfind(':');
+            if (colon == std::string::npos || colon <= scheme.size() || colon + 1 >= endpoint.size())
+            {
+                return false;
+            }
+
+            const std::string host = endpoint.substr(scheme.size(), colon - scheme.size());
+            const std::string portText = endpoint.substr(colon + 1);
+            if (portText.size() > 5 || portText.find_first_not_of("0123456789") != std::string::npos)
+            {
+                return false;
+            }
+            const unsigned long value = std::stoul(portText);
+            if (value == 0 || value > 65535)
+            {
+                return false;
+            }
+
+            struct in_addr parsed;
+            if (::inet_pton(AF_INET, host.c_str(), &parsed) != 1)
+            {
+                return false;
+            }
+            address = parsed.s_addr;
+            port = htons(static_cast<uint16_t>(value));
+            return true;
+        }
+
+        struct sockaddr_in makeAddress(uint32_t address, uint16_t port)
+        {
+            struct sockaddr_in result;
+            std::memset(&result, 0, sizeof(result));
+            result.sin_family = AF_INET;
+            result.sin_addr.s_addr = address;
+            result.sin_port = port;
+            return result;
+        }
+
+        int remainingMs(Clock::time_point deadline, int timeoutMs)
+        {
+            if (timeoutMs < 0)
+            {
+                return -1;
+            }
+            auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()).count();
+            return left > 0 ? static_cast<int>(left) : 0;
+        }
+
+        // 1 if ready, 0 on timeout, -1 on error
+        int waitFor(int fd, short events, int timeoutMs)
+        {
+            struct pollfd item;
+            item.fd = fd;
+            item.events = events;
+            item.revents = 0;
+            for (;;)
+            {
+                int ready = ::poll(&item, 1, timeoutMs);
+                if (ready < 0 && errno == EINTR)
+                {
+                    continue;
+                }
+                return ready < 0 ? -1 : (ready > 0 ? 1 : 0);
+            }
+        }
+
+        // Send count prepared datagrams; done counts the ones handed to the kernel
+        TransportError sendMessages(int fd, struct msghdr *messages, size_t count, int timeoutMs, size_t &done)
+        {
+            const Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(timeoutMs < 0 ? 0 : timeoutMs);
+            done = 0;
+            while (done < count)
+            {
+#if defined(__linux__)
+                struct mmsghdr batch[MAX_BATCH];
+                const size_t n = count - done;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    batch[i].msg_hdr = messages[done + i];
+                    batch[i].msg_len = 0;
+                }
+                int result = ::sendmmsg(fd, batch, static_cast<unsigned int>(n), 0);
+#else
+                int result = ::sendmsg(fd, &messages[done], 0) < 0 ? -1 : 1;
+#endif
+                if (result >= 0)
+                {
+                    done += static_cast<size_t>(result);
+                    continue;
+                }
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS)
+                {
+                    int ready = waitFor(fd, POLLOUT, remainingMs(deadline, timeoutMs));
+                    if (ready == 0)
+                    {
+                        return TransportError::Timeout;
+                    }
+                    if (ready > 0)
+                    {
+                        continue;
+                    }
+                }
+                return TransportError::SendFailed;
+            }
+            return TransportError::None;
+        }
+    } // namespace
+
+    UDPMulticastTransport::UDPMulticastTransport(const UDPConfig &config)
+        : config_(config), fd_(-1), groupAddress_(0), groupPort_(0), interfaceAddress_(htonl(INADDR_ANY)),
+          joined_(false), sequence_(0), slotCount_(0), slotNext_(0)
+    {
+        config_.batchSize = std::min(std::max<size_t>(config_.batchSize, 1), MAX_BATCH);
+    }
+
+    UDPMulticastTransport::~UDPMulticastTransport()
+    {
+        close();
+    }
+
+    TransportError UDPMulticastTransport::connect(const std::string &endpoint)
+    {
+        return open(endpoint, false);
+    }
+
+    TransportError UDPMulticastTransport::join(const std::string &endpoint)
+    {
+        return open(endpoint, true);
+    }
+
+    TransportError UDPMulticastTransport::open(const std::string &endpoint, bool receiver)
+    {
+        if (fd_ >= 0)
+        {
+            return TransportError::AlreadyConnected;
+        }
+
+        if (!parseGroup(endpoint, groupAddress_, groupPort_) || (receiver && !IN_MULTICAST(ntohl(groupAddress_))))
+        {
+            return TransportError::InvalidEndpoint;
+        }
+
+        interfaceAddress_ = htonl(INADDR_ANY);
+        if (!config_.interfaceAddress.empty())
+        {
+            struct in_addr parsed;
+            if (::inet_pton(AF_INET, config_.interfaceAddress.c_str(), &parsed) != 1)
+            {
+                return TransportError::ConfigurationError;
+            }
+            interfaceAddress_ = parsed.s_addr;
+        }
+
+        fd_ = ::socket(AF_INET, SOCK_DGRAM, 0);
+        if (fd_ < 0)
+        {
+            handleError("socket creation");
+            return TransportError::InternalError;
+        }
+
+        // Multicast options take u_char on BSD; Linux accepts both
+        const unsigned char ttl = static_cast<unsigned char>(config_.ttl);
+        const unsigned char loop = config_.loopback ? 1 : 0;
+        struct in_addr outgoing;
+        outgoing.s_addr = interfaceAddress_;
+        int flags = ::fcntl(fd_, F_GETFL, 0);
+        if (flags < 0 || ::fcntl(fd_, F_SETFL, flags | O_NONBLOCK) < 0 ||
+            ::setsockopt(fd_, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl)) < 0 ||
+            ::setsockopt(fd_, IPPROTO_IP, IP_MULTICAST_LOOP, &loop, sizeof(loop)) < 0 ||
+            (!config_.interfaceAddress.empty() &&
+             ::setsockopt(fd_, IPPROTO_IP, IP_MULTICAST_IF, &outgoing, sizeof(outgoing)) < 0))
+        {
+            handleError("socket configuration");
+            close();
+            return TransportError::ConfigurationError;
+        }
+        if (config_.sendBufferSize > 0)
+        {
+            ::setsockopt(fd_, SOL_SOCKET, SO_SNDBUF, &config_.sendBufferSize, sizeof(config_.sendBufferSize));
+        }
+        if (config_.receiveBufferSize > 0)
+        {
+            ::setsockopt(fd_, SOL_SOCKET, SO_RCVBUF, &config_.receiveBufferSize, sizeof(config_.receiveBufferSize));
+        }
+
+        if (receiver)
+        {
+            // Let several receivers on one host share the group port
+            int on = 1;
+            ::setsockopt(fd_, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+#if defined(SO_REUSEPORT)
+            ::setsockopt(fd_, SOL_SOCKET, SO_REUSEPORT, &on, sizeof(on));
+#endif
+
+#if defined(__linux__)
+            // Binding the group address filters out other groups on the same port
+            struct sockaddr_in local = makeAddress(groupAddress_, groupPort_);
+#else
+            struct sockaddr_in local = makeAddress(htonl(INADDR_ANY), groupPort_);
+#endif
+            if (::bind(fd_, reinterpret_cast<struct sockaddr *>(&local), sizeof(local)) < 0)
+            {
+                handleError("bind");
+                close();
+                return TransportError::BindFailed;
+            }
+
+            struct ip_mreq membership;
+            membership.imr_multiaddr.s_addr = groupAddress_;
+            membership.imr_interface.s_addr = interfaceAddress_;
+            if (::setsockopt(fd_, IPPROTO_IP, IP_ADD_MEMBERSHIP, &membership, sizeof(membership)) < 0)
+            {
+                handleError("join");
+                close();
+                return TransportError::BindFailed;
+            }
+            joined_ = true;
+
+            slots_.resize(config_.batchSize);
+            for (auto &slot : slots_)
+            {
+                slot.data.resize(MAX_DATAGRAM_SIZE);
+            }
+        }
+
+        endpoint_ = endpoint;
+        stats_ = Stats();
+        expected_.clear();
+        return TransportError::None;
+    }
+
+    TransportError UDPMulticastTransport::send(const Frame &frame)
+    {
+        size_t sent = 0;
+        return sendBatch(Span<const Frame>(&frame, 1), sent);
+    }
+
+    TransportError UDPMulticastTransport::sendBatch(Span<const Frame> frames, size_t &sent)
+    {
+        sent = 0;
+        if (fd_ < 0)
+        {
+            return TransportError::NotConnected;
+        }
+
+        struct sockaddr_in group = makeAddress(groupAddress_, groupPort_);
+        uint8_t headers[MAX_BATCH][HEADER_SIZE];
+        uint8_t trailers[MAX_BATCH][CRC_SIZE + SEQUENCE_SIZE]; // CRC, then sequence number
+        struct iovec iov[MAX_BATCH][3];
+        struct msghdr messages[MAX_BATCH];
+        thread_local Frame compressed[MAX_BATCH]; // Wire form of frames sent compressed
+
+        while (sent < frames.size())
+        {
+            // Prepare up to batchSize datagrams straight from the frames
+            TransportError failure = TransportError::None;
+            size_t count = 0;
+            for (; count < config_.batchSize && sent + count < frames.size(); ++count)
+            {
+                const Frame &source = frames[sent + count];
+                if (!source.validate())
+                {
+                    failure = TransportError::SerializationFailed;
+                    break;
+                }
+                const Frame &frame = detail::compressForWire(source, compressed[count]) ? compressed[count] : source;
+                const size_t trailerSize = (frame.hasCRC() ? CRC_SIZE : 0) + (config_.sequenced ? SEQUENCE_SIZE : 0);
+                if (HEADER_SIZE + frame.payloadLen + trailerSize > MAX_DATAGRAM_SIZE)
+                {
+                    failure = TransportError::SerializationFailed;
+                    break;
+                }
+
+                uint8_t *header = headers[count];
+                serializeFrameHeader(frame, header);
+                header[13] = static_cast<uint8_t>((frame.flags & ~Flags::SEQUENCED) |
+                                                  (config_.sequenced ? Flags::SEQUENCED : 0));
+
+                uint8_t *trailer = trailers[count];
+                size_t offset = 0;
+                if (frame.hasCRC())
+                {
+                    Crc16 crc;
+                    crc.update(header, HEADER_SIZE).update(frame.payload.data(), frame.payloadLen);
+                    uint16_t crcBE = utils::hton16(crc.finalize());
+                    std::memcpy(trailer, &crcBE, CRC_SIZE);
+                    offset += CRC_SIZE;
+                }
+                if (config_.sequenced)
+                {
+                    uint32_t sequenceBE = utils::hton32(sequence_ + static_cast<uint32_t>(count));
+                    std::memcpy(trailer + offset, &sequenceBE, SEQUENCE_SIZE);
+                }
+
+                iov[count][0].iov_base = header;
+                iov[count][0].iov_len = HEADER_SIZE;
+                iov[count][1].iov_base = const_cast<uint8_t *>(frame.payload.data());
+                iov[count][1].iov_len = frame.payloadLen;
+                iov[count][2].iov_base = trailer;
+                iov[count][2].iov_len = trailerSize;
+
+                std::memset(&messages[count], 0, sizeof(messages[count]));
+                messages[count].msg_name = &group;
+                messages[count].msg_namelen = sizeof(group);
+                messages[count].msg_iov = iov[count];
+                messages[count].msg_iovlen = 3;
+            }
+
+            size_t done = 0;
+            TransportError result = sendMessages(fd_, messages, count, config_.sendTimeout, done);
+            sent += done;
+            sequence_ += static_cast<uint32_t>(done);
+            stats_.framesSent += done;
+            if (result != TransportError::None)
+            {
+                if (result == TransportError::SendFailed)
+                {
+                    handleError("send");
+                }
+                return result;
+            }
+            if (failure != TransportError::None)
+            {
+                return failure;
+            }
+        }
+        return TransportError::None;
+    }
+
+    TransportError UDPMulticastTransport::sendRaw(const uint8_t *data, size_t size)
+    {
+        if (fd_ < 0)
+        {
+            return TransportError::NotConnected;
+        }
+        if (size > MAX_DATAGRAM_SIZE)
+        {
+            return TransportError::SerializationFailed;
+        }
+
+        struct sockaddr_in group = makeAddress(groupAddress_, groupPort_);
+        struct iovec iov;
+        iov.iov_base = const_cast<uint8_t *>(data);
+        iov.iov_len = size;
+        struct msghdr message;
+        std::memset(&message, 0, sizeof(message));
+        message.msg_name = &group;
+        message.msg_namelen = sizeof(group);
+        message.msg_iov = &iov;
+        message.msg_iovlen = 1;
+
+        size_t done = 0;
+        TransportError result = sendMessages(fd_, &message, 1, config_.sendTimeout, done);
+        if (result == TransportError::SendFailed)
+        {
+            handleError("send");
+        }
+        return result;
+    }
+
+    TransportError UDPMulticastTransport::fill(int timeoutMs)
+    {
+        slotCount_ = slotNext_ = 0;
+
+        int ready = waitFor(fd_, POLLIN, timeoutMs);
+        if (ready == 0)
+        {
+            return TransportError::Timeout;
+        }
+        if (ready < 0)
+        {
+            handleError("receive");
+            return TransportError::ReceiveFailed;
+        }
+
+        struct iovec iov[MAX_BATCH];
+        struct sockaddr_in sources[MAX_BATCH];
+        struct msghdr messages[MAX_BATCH];
+        const size_t count = slots_.size();
+        for (size_t i = 0; i < count; ++i)
+        {
+            iov[i].iov_base = slots_[i].data.data();
+            iov[i].iov_len = slots_[i].data.size();
+            std::memset(&messages[i], 0, sizeof(messages[i]));
+            messages[i].msg_name = &sources[i];
+            messages[i].msg_namelen = sizeof(sources[i]);
+            messages[i].msg_iov = &iov[i];
+            messages[i].msg_iovlen = 1;
+        }
+
+#if defined(__linux__)
+        struct mmsghdr batch[MAX_BATCH];
+        for (size_t i = 0; i < count; ++i)
+        {
+            batch[i].msg_hdr = messages[i];
+            batch[i].msg_len = 0;
+        }
+
+        int received;
+        do
+        {
+            received = ::recvmmsg(fd_, batch, static_cast<unsigned int>(count), MSG_DONTWAIT, nullptr);
+        } while (received < 0 && errno == EINTR);
+
+        for (int i = 0; i < received; ++i)
+        {
+            messages[i] = batch[i].msg_hdr;
+            slots_[i].size = batch[i].msg_len;
+        }
+#else
+        int received = 0;
+        while (static_cast<size_t>(received) < count)
+        {
+            ssize_t size = ::recvmsg(fd_, &messages[received], MSG_DONTWAIT);
+            if (size < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                break;
+            }
+            slots_[received++].size = static_cast<size_t>(size);
+        }
+        if (received == 0)
+        {
+            received = -1;
+        }
+#endif
+
+        if (received < 0)
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                return TransportError::Timeout; // Readiness was spurious
+            }
+            handleError("receive");
+            return TransportError::ReceiveFailed;
+        }
+
+        for (int i = 0; i < received; ++i)
+        {
+            Slot &slot = slots_[i];
+            slot.truncated = (messages[i].msg_flags & MSG_TRUNC) != 0;
+            slot.source = (static_cast<uint64_t>(sources[i].sin_addr.s_addr) << 16) | sources[i].sin_port;
+        }
+        slotCount_ = static_cast<size_t>(received);
+        return TransportError::None;
+    }
+
+    bool UDPMulticastTransport::accept(const Slot &slot, FrameView &view)
+    {
+        if (slot.truncated || slot.size < HEADER_SIZE)
+        {
+            ++stats_.invalidDatagrams;
+            return false;
+        }
+
+        // The sequence trailer follows the frame and is not part of it
+        const FrameView header(slot.data.data(), HEADER_SIZE);
+        const size_t frameSize = HEADER_SIZE + header.payloadLen() + (header.hasCRC() ? CRC_SIZE : 0);
+        const bool sequenced = header.isSequenced();
+        if (slot.size != frameSize + (sequenced ? SEQUENCE_SIZE : 0))
+        {
+            ++stats_.invalidDatagrams;
+            return false;
+        }
+
+        view = FrameView(slot.data.data(), frameSize);
+        if (!view.validate())
+        {
+            ++stats_.invalidDatagrams;
+            return false;
+        }
+
+        if (sequenced)
+        {
+            uint32_t sequenceBE;
+            std::memcpy(&sequenceBE, slot.data.data() + frameSize, SEQUENCE_SIZE);
+            const uint32_t sequence = utils::ntoh32(sequenceBE);
+
+            auto it = expected_.find(slot.source);
+            if (it == expected_.end())
+            {
+                expected_.emplace(slot.source, sequence + 1); // First datagram from this sender
+            }
+            else
+            {
+                // Serial number arithmetic: survives wrap-around
+                const int32_t ahead = static_cast<int32_t>(sequence - it->second);
+                if (ahead >= 0)
+                {
+                    if (ahead > 0)
+                    {
+                        ++stats_.gaps;
+                        stats_.lostFrames += static_cast<uint64_t>(ahead);
+                        if (gapCallback_)
+                        {
+                            gapCallback_(view.srcNodeID(), static_cast<uint32_t>(ahead));
+                        }
+                    }
+                    it->second = sequence + 1;
+                }
+                else
+                {
+                    ++stats_.reordered;
+                }
+            }
+        }
+
+        ++stats_.framesReceived;
+        return true;
+    }
+
+    TransportError UDPMulticastTransport::receiveView(FrameView &view, int timeoutMs)
+    {
+        if (fd_ < 0 || slots_.empty())
+        {
+            return TransportError::NotConnected; // Receiving needs join()
+        }
+
+        const int timeout = timeoutMs < 0 ? config_.receiveTimeout : timeoutMs;
+        const Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(timeout < 0 ? 0 : timeout);
+
+        for (;;)
+        {
+            while (slotNext_ < slotCount_)
+            {
+                if (accept(slots_[slotNext_++], view))
+                {
+                    return TransportError::None;
+                }
+            }
+
+            const int wait = remainingMs(deadline, timeout);
+            TransportError result = fill(wait);
+            if (result == TransportError::Timeout && wait != 0)
+            {
+                continue;
+            }
+            if (result != TransportError::None)
+            {
+                return result;
+            }
+        }
+    }
+
+    TransportError UDPMulticastTransport::receive(Frame &frame, int timeoutMs)
+    {
+        FrameView view;
+        TransportError result = receiveView(view, timeoutMs);
+        if (result != TransportError::None)
+        {
+            return result;
+        }
+        return view.toFrame(frame) ? TransportError::None : TransportError::DeserializationFailed;
+    }
+
+    TransportError UDPMulticastTransport::receiveBatch(std::vector<Frame> &frames, size_t maxFrames, int timeoutMs)
+    {
+        size_t count = 0;
+        FrameView view;
+        TransportError result = TransportError::None;
+        while (count < maxFrames)
+        {
+            result = receiveView(view, count == 0 ? timeoutMs : 0);
+            if (result != TransportError::None)
+            {
+                break;
+            }
+
+            if (count == frames.size())
+            {
+                frames.emplace_back();
+            }
+            if (view.toFrame(frames[count]))
+            {
+                ++count;
+            }
+        }
+        frames.resize(count);
+
+        if (count > 0 || maxFrames == 0)
+        {
+            return TransportError::None;
+        }
+        return result;
+    }
+
+    std::ptrdiff_t UDPMulticastTransport::receiveRaw(uint8_t *buffer, size_t maxSize)
+    {
+        FrameView view;
+        TransportError result = receiveView(view);
+        if (result == TransportError::Timeout)
+        {
+            return 0;
+        }
+        if (result != TransportError::None || view.size() > maxSize)
+        {
+            return -1;
+        }
+
+        std::memcpy(buffer, view.data(), view.size());
+        return static_cast<std::ptrdiff_t>(view.size());
+    }
+
+    void UDPMulticastTransport::close()
+    {
+        if (fd_ >= 0)
+        {
+            if (joined_)
+            {
+                struct ip_mreq membership;
+                membership.imr_multiaddr.s_addr = groupAddress_;
+                membership.imr_interface.s_addr = interfaceAddress_;
+                ::setsockopt(fd_, IPPROTO_IP, IP_DROP_MEMBERSHIP, &membership, sizeof(membership));
+            }
+            ::close(fd_);
+            fd_ = -1;
+        }
+        joined_ = false;
+        slots_.clear();
+        slotCount_ = slotNext_ = 0;
+        endpoint_.clear();
+    }
+
+    void UDPMulticastTransport::setErrorCallback(ErrorCallback callback)
+    {
+        errorCallback_ = std::move(callback);
+    }
+
+    void UDPMulticastTransport::setGapCallback(GapCallback callback)
+    {
+        gapCallback_ = std::move(callback);
+    }
+
+    void UDPMulticastTransport::handleError(const char *operation)
+    {
+        std::string message = std::string("UDP error during ") + operation + ": " + std::strerror(errno) +
+                              " (code: " + std::to_string(errno) + ")";
+        if (errorCallback_)
+        {
+            errorCallback_(message);
+        }
+        else
+        {
+            std::cerr << message << std::endl;
+        }
+    }
+
+} // namespace limp
@@ -49,6 +49,18 @@ namespace limp
             return "STRING";
         case PayloadType::OPAQUE:
             return "OPAQUE";
+        case PayloadType::BATCH:
+            return "BATCH";
+        case PayloadType::UINT16_ARRAY:
+            return "UINT16_ARRAY";
+        case PayloadType::UINT32_ARRAY:
+            return "UINT32_ARRAY";
+        case PayloadType::UINT64_ARRAY:
+            return "UINT64_ARRAY";
+        case PayloadType::FLOAT32_ARRAY:
+            return "FLOAT32_ARRAY";
+        case PayloadType::FLOAT64_ARRAY:
+            return "FLOAT64_ARRAY";
         default:
             return "UNKNOWN";
         }
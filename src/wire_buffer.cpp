@@ -0,0 +1,121 @@
+#include "limp/wire_buffer.hpp"
+#include "limp/compression.hpp"
+#include <cstring>
+#include <new>
+
+namespace limp
+{
+
+    WireBuffer::Block *WireBuffer::allocate(size_t size)
+    {
+        // Header and bytes share one allocation; bytes follow the header
+        void *memory = ::operator new(sizeof(Block) + size);
+        Block *block = new (memory) Block;
+        block->refs.store(1, std::memory_order_relaxed);
+        block->size = size;
+        return block;
+    }
+
+    void WireBuffer::unref(Block *block) noexcept
+    {
+        if (block && block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            block->~Block();
+            ::operator delete(block);
+        }
+    }
+
+    WireBuffer WireBuffer::serialize(const Frame &frame)
+    {
+        WireBuffer buffer;
+        if (!frame.validate())
+        {
+            return buffer;
+        }
+
+        const Frame &wire = detail::wireFrame(frame);
+        buffer.block_ = allocate(wire.totalSize());
+        detail::serializeValidatedFrame(wire, bytes(buffer.block_));
+        return buffer;
+    }
+
+    WireBuffer WireBuffer::copyOf(const uint8_t *data, size_t size)
+    {
+        WireBuffer buffer;
+        buffer.block_ = allocate(size);
+        if (size > 0)
+        {
+            std::memcpy(bytes(buffer.block_), data, size);
+        }
+        return buffer;
+    }
+
+    WireBuffer::WireBuffer(const WireBuffer &other) noexcept : block_(other.block_)
+    {
+        if (block_)
+        {
+            block_->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    WireBuffer &WireBuffer::operator=(const WireBuffer &other) noexcept
+    {
+        if (block_ != other.block_)
+        {
+            if (other.block_)
+            {
+                other.block_->refs.fetch_add(1, std::memory_order_relaxed);
+            }
+            unref(block_);
+            block_ = other.block_;
+        }
+        return *this;
+    }
+
+    WireBuffer &WireBuffer::operator=(WireBuffer &&other) noexcept
+    {
+        if (this != &other)
+        {
+            unref(block_);
+            block_ = other.block_;
+            other.block_ = nullptr;
+        }
+        return *this;
+    }
+
+    WireBuffer::~WireBuffer()
+    {
+        unref(block_);
+    }
+
+    const uint8_t *WireBuffer::data() const noexcept
+    {
+        return block_ ? bytes(block_) : nullptr;
+    }
+
+    size_t WireBuffer::size() const noexcept
+    {
+        return block_ ? block_->size : 0;
+    }
+
+    size_t WireBuffer::useCount() const noexcept
+    {
+        return block_ ? block_->refs.load(std::memory_order_relaxed) : 0;
+    }
+
+    void *WireBuffer::retain() const noexcept
+    {
+        if (block_)
+        {
+            block_->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+        return block_;
+    }
+
+    void WireBuffer::release(void *data, void *hint) noexcept
+    {
+        (void)data;
+        unref(static_cast<Block *>(hint));
+    }
+
+} // namespace limp
@@ -0,0 +1,411 @@
+#include "limp/zmq/zmq_broker.hpp"
+#include "limp/zmq/zmq_context.hpp"
+#include "limp/compression.hpp"
+#include "zmq_internal.hpp"
+#include <algorithm>
+#include <chrono>
+
+namespace limp
+{
+
+    namespace
+    {
+        std::atomic<unsigned> nextBrokerId{0};
+
+        ByteSpan messageBytes(const zmq::message_t &message)
+        {
+            return ByteSpan(static_cast<const uint8_t *>(message.data()), message.size());
+        }
+
+        void sendMultipart(zmq::socket_t &socket, std::vector<zmq::message_t> &parts, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                socket.send(parts[i], (i + 1 < count) ? zmq::send_flags::sndmore : zmq::send_flags::none);
+            }
+        }
+
+        /** @brief Serialize a frame (compressed if enabled) into a new message; false if it is invalid */
+        bool serializeMessage(const Frame &frame, zmq::message_t &message)
+        {
+            if (!frame.validate())
+            {
+                return false;
+            }
+            const Frame &wire = detail::wireFrame(frame);
+            message.rebuild(wire.totalSize());
+            detail::serializeValidatedFrame(wire, static_cast<uint8_t *>(message.data()));
+            return true;
+        }
+
+        void configurePipe(zmq::socket_t &socket)
+        {
+            // Unlimited queues: the I/O thread and a worker send to each other,
+            // so a blocking send on either side could deadlock the pair
+            socket.set(zmq::sockopt::linger, 0);
+            socket.set(zmq::sockopt::sndhwm, 0);
+            socket.set(zmq::sockopt::rcvhwm, 0);
+        }
+    } // namespace
+
+    ZMQBroker::ZMQBroker(const ZMQConfig &config, size_t workers)
+        : config_(config), workerCount_(std::max<size_t>(workers, 1)), running_(false), stopRequested_(false),
+          frontendBind_(true), errors_("ZMQ"), received_(0), routed_(0), dropped_(0)
+    {
+        context_ = ZMQContextRegistry::resolve(config_);
+        workerPrefix_ = "inproc://limp-broker-" + std::to_string(nextBrokerId++) + "-worker-";
+    }
+
+    ZMQBroker::~ZMQBroker()
+    {
+        stop();
+    }
+
+    TransportError ZMQBroker::setFrontend(const std::string &endpoint, bool bind)
+    {
+        if (running_.load() || ioThread_)
+        {
+            handleError(TransportError::ConfigurationError, TransportOperation::Setup, "broker set frontend",
+                        "broker is running");
+            return TransportError::ConfigurationError;
+        }
+
+        frontendEndpoint_ = endpoint;
+        frontendBind_ = bind;
+        return TransportError::None;
+    }
+
+    TransportError ZMQBroker::setHandler(Handler handler)
+    {
+        if (running_.load() || ioThread_)
+        {
+            handleError(TransportError::ConfigurationError, TransportOperation::Setup, "broker set handler",
+                        "broker is running");
+            return TransportError::ConfigurationError;
+        }
+
+        handler_ = std::move(handler);
+        return TransportError::None;
+    }
+
+    void ZMQBroker::setErrorCallback(std::function<void(const std::string &)> callback)
+    {
+        std::lock_guard<std::mutex> lock(errorMutex_);
+        errors_.setMessageCallback(std::move(callback));
+    }
+
+    void ZMQBroker::setErrorEventCallback(ErrorEventCallback callback)
+    {
+        std::lock_guard<std::mutex> lock(errorMutex_);
+        errors_.setEventCallback(std::move(callback));
+    }
+
+    TransportError ZMQBroker::start()
+    {
+        if (running_.load() || ioThread_)
+        {
+            handleError(TransportError::ConfigurationError, TransportOperation::Setup, "broker start",
+                        "already running");
+            return TransportError::ConfigurationError;
+        }
+
+        if (frontendEndpoint_.empty())
+        {
+            handleError(TransportError::InvalidEndpoint, TransportOperation::Setup, "broker start",
+                        "frontend endpoint not set");
+            return TransportError::InvalidEndpoint;
+        }
+
+        if (!handler_)
+        {
+            handleError(TransportError::ConfigurationError, TransportOperation::Setup, "broker start",
+                        "routing handler not set");
+            return TransportError::ConfigurationError;
+        }
+
+        // Bind on the caller's thread so a bad or busy endpoint fails start(); the
+        // sockets then move to the I/O thread (the thread start is a full barrier)
+        zmq::socket_t frontend;
+        std::vector<zmq::socket_t> pipes;
+        TransportOperation stage = frontendBind_ ? TransportOperation::Bind : TransportOperation::Connect;
+        try
+        {
+            frontend = zmq::socket_t(*context_, zmq::socket_type::router);
+            configureSocket(frontend, config_);
+            if (frontendBind_)
+            {
+                frontend.bind(frontendEndpoint_);
+            }
+            else
+            {
+                frontend.connect(frontendEndpoint_);
+            }
+
+            stage = TransportOperation::Setup;
+            pipes.reserve(workerCount_);
+            for (size_t i = 0; i < workerCount_; ++i)
+            {
+                pipes.emplace_back(*context_, zmq::socket_type::pair);
+                configurePipe(pipes.back());
+                pipes.back().bind(workerEndpoint(i));
+            }
+        }
+        catch (const zmq::error_t &e)
+        {
+            handleError(e, stage, stage == TransportOperation::Setup ? "broker worker pipes" : "broker frontend");
+            return zmq_internal::errorFor(stage);
+        }
+
+        stopRequested_ = false;
+        running_ = true;
+        ioThread_ = std::make_unique<std::thread>(&ZMQBroker::ioThread, this, std::move(frontend), std::move(pipes));
+
+        workers_.reserve(workerCount_);
+        for (size_t i = 0; i < workerCount_; ++i)
+        {
+            workers_.emplace_back(&ZMQBroker::workerThread, this, i);
+        }
+        return TransportError::None;
+    }
+
+    void ZMQBroker::stop()
+    {
+        if (!ioThread_)
+        {
+            return;
+        }
+
+        stopRequested_ = true;
+
+        if (ioThread_->joinable())
+        {
+            ioThread_->join();
+        }
+        for (auto &worker : workers_)
+        {
+            if (worker.joinable())
+            {
+                worker.join();
+            }
+        }
+
+        ioThread_.reset();
+        workers_.clear();
+        running_ = false;
+    }
+
+    ZMQBroker::Stats ZMQBroker::getStats() const noexcept
+    {
+        Stats stats;
+        stats.received = received_.load(std::memory_order_relaxed);
+        stats.routed = routed_.load(std::memory_order_relaxed);
+        stats.dropped = dropped_.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    std::string ZMQBroker::workerEndpoint(size_t index) const
+    {
+        return workerPrefix_ + std::to_string(index);
+    }
+
+    void ZMQBroker::handleError(const zmq::error_t &e, TransportOperation operation, const char *context)
+    {
+        std::lock_guard<std::mutex> lock(errorMutex_);
+        errors_.report(ErrorEvent{zmq_internal::errorFor(operation), operation, e.num(), context, e.what()});
+    }
+
+    void ZMQBroker::handleError(TransportError error, TransportOperation operation, const char *context,
+                                const char *reason)
+    {
+        std::lock_guard<std::mutex> lock(errorMutex_);
+        errors_.report(ErrorEvent{error, operation, 0, context, reason});
+    }
+
+    void ZMQBroker::ioThread(zmq::socket_t frontend, std::vector<zmq::socket_t> pipes)
+    {
+        try
+        {
+            std::vector<zmq::pollitem_t> items;
+            items.push_back({frontend.handle(), 0, ZMQ_POLLIN, 0});
+            for (auto &pipe : pipes)
+            {
+                items.push_back({pipe.handle(), 0, ZMQ_POLLIN, 0});
+            }
+
+            std::vector<zmq::message_t> parts(4);
+            while (!stopRequested_.load())
+            {
+                zmq::poll(items.data(), items.size(), std::chrono::milliseconds(POLL_INTERVAL_MS));
+
+                // Frontend → worker chosen by source identity (keeps per-peer order)
+                if (items[0].revents & ZMQ_POLLIN)
+                {
+                    for (size_t n = 0; n < IO_BATCH; ++n)
+                    {
+                        size_t count = zmq_internal::receiveMultipart(frontend, parts);
+                        if (count == 0)
+                        {
+                            break;
+                        }
+                        size_t worker = PeerId(messageBytes(parts[0])).hash() % workerCount_;
+                        sendMultipart(pipes[worker], parts, count);
+                        received_.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+
+                // Workers → frontend (parts start with the destination identity)
+                for (size_t i = 0; i < pipes.size(); ++i)
+                {
+                    if (!(items[i + 1].revents & ZMQ_POLLIN))
+                    {
+                        continue;
+                    }
+                    for (size_t n = 0; n < IO_BATCH; ++n)
+                    {
+                        size_t count = zmq_internal::receiveMultipart(pipes[i], parts);
+                        if (count == 0)
+                        {
+                            break;
+                        }
+                        sendMultipart(frontend, parts, count);
+                    }
+                }
+            }
+        }
+        catch (const zmq::error_t &e)
+        {
+            if (e.num() != ETERM && !stopRequested_.load())
+            {
+                handleError(e, TransportOperation::Receive, "broker I/O thread");
+            }
+        }
+
+        // Workers exit on their own stop check; make sure they do if I/O failed
+        stopRequested_ = true;
+        running_ = false;
+    }
+
+    void ZMQBroker::workerThread(size_t index)
+    {
+        try
+        {
+            zmq::socket_t pipe(*context_, zmq::socket_type::pair);
+            configurePipe(pipe);
+            pipe.connect(workerEndpoint(index));
+
+            zmq::pollitem_t item = {pipe.handle(), 0, ZMQ_POLLIN, 0};
+            std::vector<zmq::message_t> parts(4);
+            PeerId source;
+            PeerId destination;
+
+            while (!stopRequested_.load())
+            {
+                if (zmq::poll(&item, 1, std::chrono::milliseconds(POLL_INTERVAL_MS)) <= 0)
+                {
+                    continue;
+                }
+
+                for (size_t n = 0; n < IO_BATCH; ++n)
+                {
+                    // [source][delimiter][data] or [source][destination][delimiter][data]
+                    size_t count = zmq_internal::receiveMultipart(pipe, parts);
+                    if (count == 0)
+                    {
+                        break;
+                    }
+
+                    zmq::message_t &data = parts[count - 1];
+                    FrameView view;
+                    if ((count != 3 && count != 4) || !deserializeFrameView(static_cast<const uint8_t *>(data.data()),
+                                                                            data.size(), view))
+                    {
+                        dropped_.fetch_add(1, std::memory_order_relaxed);
+                        continue;
+                    }
+
+                    ByteSpan sourceBytes = messageBytes(parts[0]);
+                    source.assign(sourceBytes.data(), sourceBytes.size());
+                    if (count == 4)
+                    {
+                        ByteSpan destinationBytes = messageBytes(parts[1]);
+                        destination.assign(destinationBytes.data(), destinationBytes.size());
+                    }
+                    else
+                    {
+                        destination.assign(nullptr, 0);
+                    }
+
+                    Output output(*this, pipe, data, index);
+                    try
+                    {
+                        handler_(source, destination, view, output);
+                    }
+                    catch (const std::exception &)
+                    {
+                        // what() has no static storage, so the event cannot carry it
+                        handleError(TransportError::InternalError, TransportOperation::Receive, "broker handler",
+                                    "handler threw an exception");
+                    }
+                }
+            }
+        }
+        catch (const zmq::error_t &e)
+        {
+            if (e.num() != ETERM && !stopRequested_.load())
+            {
+                handleError(e, TransportOperation::Receive, "broker worker");
+            }
+        }
+    }
+
+    void ZMQBroker::Output::emit(const PeerId &destination, const PeerId *source, zmq::message_t &&data)
+    {
+        socket_.send(zmq::message_t(destination.data(), destination.size()), zmq::send_flags::sndmore);
+        if (source)
+        {
+            socket_.send(zmq::message_t(source->data(), source->size()), zmq::send_flags::sndmore);
+        }
+        socket_.send(zmq::message_t(), zmq::send_flags::sndmore);
+        socket_.send(std::move(data), zmq::send_flags::none);
+        broker_.routed_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void ZMQBroker::Output::send(const PeerId &destination, const Frame &frame)
+    {
+        zmq::message_t data;
+        if (!serializeMessage(frame, data))
+        {
+            broker_.handleError(TransportError::SerializationFailed, TransportOperation::Send, "broker send",
+                                "frame serialization failed");
+            return;
+        }
+        emit(destination, nullptr, std::move(data));
+    }
+
+    void ZMQBroker::Output::send(const PeerId &destination, const PeerId &source, const Frame &frame)
+    {
+        zmq::message_t data;
+        if (!serializeMessage(frame, data))
+        {
+            broker_.handleError(TransportError::SerializationFailed, TransportOperation::Send, "broker send",
+                                "frame serialization failed");
+            return;
+        }
+        emit(destination, &source, std::move(data));
+    }
+
+    void ZMQBroker::Output::forward(const PeerId &destination)
+    {
+        zmq::message_t data;
+        data.copy(data_); // Reference-counted for large messages
+        emit(destination, nullptr, std::move(data));
+    }
+
+    void ZMQBroker::Output::forward(const PeerId &destination, const PeerId &source)
+    {
+        zmq::message_t data;
+        data.copy(data_);
+        emit(destination, &source, std::move(data));
+    }
+
+} // namespace limp
@@ -1,5 +1,4 @@
 #include "limp/zmq/zmq_client.hpp"
-#include <cstring>
 
 namespace limp
 {
@@ -26,7 +25,7 @@ namespace limp
         }
         catch (const zmq::error_t &e)
         {
-            handleError(e, "client connect");
+            handleError(e, TransportOperation::Connect, "client connect");
             return TransportError::ConnectionFailed;
         }
     }
@@ -38,88 +37,109 @@ namespace limp
             return TransportError::NotConnected;
         }
 
+        zmq::message_t message;
         try
         {
-            zmq::message_t message(data, size);
-            auto result = socket_->send(message, zmq::send_flags::none);
-            return result.has_value() ? TransportError::None : TransportError::SendFailed;
+            message.rebuild(data, size);
         }
         catch (const zmq::error_t &e)
         {
-            handleError(e, "client send");
+            handleError(e, TransportOperation::Send, "client send");
             return TransportError::SendFailed;
         }
+
+        return markRequestSent(sendParts(&message, 1, "client send"));
     }
 
     std::ptrdiff_t ZMQClient::receiveRaw(uint8_t *buffer, size_t maxSize)
     {
-        if (!isConnected())
+        std::ptrdiff_t parts = receiveParts(1, "client receive");
+        if (parts <= 0)
         {
-            return -1;
+            return parts;
         }
 
-        try
-        {
-            zmq::message_t message;
-            auto result = socket_->recv(message, zmq::recv_flags::none);
+        markReplyReceived();
+        return copyPart(0, buffer, maxSize);
+    }
 
-            if (!result)
-            {
-                return 0; // Timeout
-            }
+    TransportError ZMQClient::receiveView(FrameView &view, int timeoutMs)
+    {
+        std::ptrdiff_t parts = receiveParts(1, "client receive", timeoutMs);
+        if (parts < 0)
+        {
+            return TransportError::ReceiveFailed;
+        }
+        if (parts == 0)
+        {
+            return TransportError::Timeout;
+        }
 
-            size_t receivedSize = message.size();
-            if (receivedSize > maxSize)
-            {
-                handleError(zmq::error_t(), "received message larger than buffer");
-                return -1;
-            }
+        markReplyReceived();
+        return viewPart(0, view);
+    }
 
-            std::memcpy(buffer, message.data(), receivedSize);
-            return static_cast<std::ptrdiff_t>(receivedSize);
+    TransportError ZMQClient::send(const Frame &frame)
+    {
+        if (!isConnected())
+        {
+            return TransportError::NotConnected;
         }
-        catch (const zmq::error_t &e)
+
+        zmq::message_t message;
+        if (!serializeToMessage(frame, message))
         {
-            handleError(e, "client receive");
-            return -1;
+            return TransportError::SerializationFailed;
         }
+
+        return markRequestSent(sendParts(&message, 1, "client send"));
     }
 
-    TransportError ZMQClient::send(const Frame &frame)
+    TransportError ZMQClient::send(Frame &&frame)
     {
-        std::vector<uint8_t> buffer;
-        if (!serializeFrame(frame, buffer))
+        if (!isConnected())
+        {
+            return TransportError::NotConnected;
+        }
+
+        zmq::message_t message;
+        if (!serializeToMessage(std::move(frame), message))
         {
             return TransportError::SerializationFailed;
         }
-        
-        return sendRaw(buffer.data(), buffer.size());
+
+        return markRequestSent(sendParts(&message, 1, "client send"));
     }
 
-    TransportError ZMQClient::receive(Frame &frame, int timeoutMs)
+    TransportError ZMQClient::markRequestSent(TransportError result) noexcept
     {
-        (void)timeoutMs; // Timeout is set via socket options
-        
-        std::vector<uint8_t> buffer(4096); // Initial buffer size
-        std::ptrdiff_t received = receiveRaw(buffer.data(), buffer.size());
-        
-        if (received < 0)
+        if (result == TransportError::None)
         {
-            return TransportError::ReceiveFailed;
+            requestSentAt_ = LatencyHistogram::now();
         }
-        if (received == 0)
+        return result;
+    }
+
+    void ZMQClient::markReplyReceived() noexcept
+    {
+        if (requestSentAt_ != 0)
         {
-            return TransportError::Timeout;
+            metrics_.roundTrip().recordSince(requestSentAt_);
+            requestSentAt_ = 0;
         }
-        
-        buffer.resize(static_cast<size_t>(received));
-        
-        if (!deserializeFrame(buffer, frame))
+    }
+
+    TransportError ZMQClient::receive(Frame &frame, int timeoutMs)
+    {
+        FrameView view;
+        TransportError error = receiveView(view, timeoutMs);
+        if (error != TransportError::None)
         {
-            return TransportError::DeserializationFailed;
+            return error;
         }
-        
-        return TransportError::None;
+
+        // Payload is sized from the received message; a reused Frame keeps its capacity
+        return view.toFrame(frame) ? TransportError::None : TransportError::DeserializationFailed;
     }
 
 } // namespace limp
@@ -0,0 +1,461 @@
+#include "limp/zmq/zmq_concurrent_sender.hpp"
+#include "limp/zmq/zmq_dealer.hpp"
+#include "limp/zmq/zmq_publisher.hpp"
+#include "limp/queue.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <zmq.hpp>
+
+namespace limp
+{
+
+    namespace
+    {
+        std::atomic<uint64_t> nextSenderId{1};
+
+        /**
+         * @brief Errors meaning "socket full or peer away": keep the frames and retry
+         *
+         * The transports report a refused send (EAGAIN) and a failed socket
+         * (ETERM, ENOTSOCK, ...) both as SendFailed; zmq_errno() tells them
+         * apart. Call on the sending thread, straight after the send.
+         */
+        bool isRetryable(TransportError error) noexcept
+        {
+            return error == TransportError::Timeout ||
+                   (error == TransportError::SendFailed && zmq_errno() == EAGAIN);
+        }
+
+        /** @brief Counts a send() between its running check and its push */
+        class SendScope
+        {
+        public:
+            explicit SendScope(std::atomic<size_t> &count) : count_(count) { count_.fetch_add(1); }
+            ~SendScope() { count_.fetch_sub(1); }
+
+            SendScope(const SendScope &) = delete;
+            SendScope &operator=(const SendScope &) = delete;
+
+        private:
+            std::atomic<size_t> &count_;
+        };
+    } // namespace
+
+    /** @brief Per-producer buffer; shared with the owning thread's LaneCache */
+    struct ConcurrentSender::Lane
+    {
+        explicit Lane(size_t capacity) : queue(capacity), claimed(true), rejected(0) {}
+
+        SPSCQueue<Frame> queue;         ///< Frames from the owning thread
+        std::atomic<bool> claimed;      ///< A live thread is the producer of queue
+        std::atomic<uint64_t> rejected; ///< Timed-out sends (written by the owner only)
+    };
+
+    /** @brief Lanes held by one thread, released when the thread exits */
+    struct ConcurrentSender::LaneCache
+    {
+        struct Entry
+        {
+            uint64_t owner;
+            std::shared_ptr<Lane> lane;
+        };
+
+        ~LaneCache()
+        {
+            for (auto &entry : entries)
+            {
+                entry.lane->claimed.store(false, std::memory_order_release);
+            }
+        }
+
+        std::vector<Entry> entries;
+    };
+
+    ConcurrentSender::ConcurrentSender(ZMQDealer &dealer, const Options &options)
+        : ConcurrentSender([&dealer](Span<const Frame> frames, size_t &sent)
+                           { return dealer.sendBatch(frames, sent); },
+                           options)
+    {
+    }
+
+    ConcurrentSender::ConcurrentSender(ZMQPublisher &publisher, const Options &options)
+        : ConcurrentSender([&publisher](Span<const Frame> frames, size_t &sent)
+                           { return publisher.publishBatch(frames, sent); },
+                           options)
+    {
+    }
+
+    ConcurrentSender::ConcurrentSender(BatchSink sink, const Options &options)
+        : id_(nextSenderId++), sink_(std::move(sink)), options_(options), laneCount_(0), running_(false),
+          stopRequested_(false), draining_(false), sleeping_(false), sendsInFlight_(0), spaceWaiters_(0),
+          wakeRequested_(false), discard_(false), errors_("ZMQ"), sent_(0), retried_(0), dropped_(0)
+    {
+        options_.batchSize = std::max<size_t>(options_.batchSize, 1);
+        options_.maxProducers = std::max<size_t>(options_.maxProducers, 1);
+        lanes_.resize(options_.maxProducers);
+    }
+
+    ConcurrentSender::~ConcurrentSender()
+    {
+        stop();
+    }
+
+    TransportError ConcurrentSender::start()
+    {
+        if (running_.load() || ioThread_)
+        {
+            handleError(TransportError::ConfigurationError, TransportOperation::Setup, 0, "concurrent sender start",
+                        "already running");
+            return TransportError::ConfigurationError;
+        }
+
+        stopRequested_ = false;
+        discard_ = false;
+        running_ = true;
+        ioThread_ = std::make_unique<std::thread>(&ConcurrentSender::ioThread, this);
+        return TransportError::None;
+    }
+
+    void ConcurrentSender::stop()
+    {
+        if (!ioThread_)
+        {
+            return;
+        }
+
+        stopRequested_ = true;
+        wake();
+        {
+            // Producers waiting for lane space give up instead of waiting out their timeout
+            std::lock_guard<std::mutex> lock(spaceMutex_);
+            spaceAvailable_.notify_all();
+        }
+        if (ioThread_->joinable())
+        {
+            ioThread_->join();
+        }
+
+        ioThread_.reset();
+        running_ = false;
+    }
+
+    TransportError ConcurrentSender::send(const Frame &frame)
+    {
+        if (!frame.validate())
+        {
+            return TransportError::InvalidFrame;
+        }
+
+        Frame copy(frame);
+        return send(std::move(copy));
+    }
+
+    TransportError ConcurrentSender::send(Frame &&frame)
+    {
+        // Counted before the stop check: the I/O thread only exits once no send can still push
+        SendScope scope(sendsInFlight_);
+        if (!running_.load() || stopRequested_.load())
+        {
+            return TransportError::NotConnected;
+        }
+        if (!frame.validate())
+        {
+            return TransportError::InvalidFrame;
+        }
+
+        Lane *lane = localLane();
+        if (lane == nullptr)
+        {
+            return TransportError::ConfigurationError;
+        }
+
+        if (!lane->queue.tryPush(std::move(frame)))
+        {
+            // Lane full: the socket is at its high-water mark or the I/O thread is behind
+            TransportError error = waitForSpace(*lane, frame);
+            if (error != TransportError::None)
+            {
+                return error;
+            }
+        }
+
+        // Pairs with the fence in ioThread(): either it sees the frame or we see it asleep
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleeping_.load(std::memory_order_relaxed))
+        {
+            wake();
+        }
+        return TransportError::None;
+    }
+
+    TransportError ConcurrentSender::waitForSpace(Lane &lane, Frame &frame)
+    {
+        using Clock = std::chrono::steady_clock;
+        const int timeout = options_.sendTimeout;
+        const Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(timeout);
+
+        TransportError result = TransportError::Timeout;
+        if (timeout != 0)
+        {
+            // Registered before the first retry; pairs with the fence in ioThread()
+            spaceWaiters_.fetch_add(1);
+            std::unique_lock<std::mutex> lock(spaceMutex_);
+            for (;;)
+            {
+                if (lane.queue.tryPush(std::move(frame)))
+                {
+                    result = TransportError::None;
+                    break;
+                }
+                if (stopRequested_.load())
+                {
+                    result = TransportError::NotConnected;
+                    break;
+                }
+
+                // Bounded wait: also rechecks the stop flag while the I/O thread is blocked on the socket
+                Clock::duration wait = std::chrono::milliseconds(POLL_INTERVAL_MS);
+                if (timeout > 0)
+                {
+                    const Clock::time_point now = Clock::now();
+                    if (now >= deadline)
+                    {
+                        break;
+                    }
+                    wait = std::min(wait, deadline - now);
+                }
+                spaceAvailable_.wait_for(lock, wait);
+            }
+            lock.unlock();
+            spaceWaiters_.fetch_sub(1);
+        }
+
+        if (result == TransportError::Timeout)
+        {
+            lane.rejected.store(lane.rejected.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    bool ConcurrentSender::flush(int timeoutMs)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+        for (;;)
+        {
+            // Lanes first: a frame popped before this check keeps draining_ set until it is sent
+            bool empty = true;
+            const size_t count = laneCount_.load(std::memory_order_acquire);
+            for (size_t i = 0; i < count && empty; ++i)
+            {
+                empty = lanes_[i]->queue.empty();
+            }
+            if (empty && !draining_.load())
+            {
+                return true;
+            }
+            if (!running_.load() || (timeoutMs >= 0 && std::chrono::steady_clock::now() >= deadline))
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+
+    void ConcurrentSender::setErrorCallback(ErrorCallback callback)
+    {
+        std::lock_guard<std::mutex> lock(errorMutex_);
+        errors_.setMessageCallback(std::move(callback));
+    }
+
+    void ConcurrentSender::setErrorEventCallback(ErrorEventCallback callback)
+    {
+        std::lock_guard<std::mutex> lock(errorMutex_);
+        errors_.setEventCallback(std::move(callback));
+    }
+
+    ConcurrentSender::Stats ConcurrentSender::getStats() const noexcept
+    {
+        Stats stats;
+        stats.sent = sent_.load(std::memory_order_relaxed);
+        stats.retried = retried_.load(std::memory_order_relaxed);
+        stats.dropped = dropped_.load(std::memory_order_relaxed);
+
+        const size_t count = laneCount_.load(std::memory_order_acquire);
+        for (size_t i = 0; i < count; ++i)
+        {
+            stats.rejected += lanes_[i]->rejected.load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
+    ConcurrentSender::Lane *ConcurrentSender::localLane()
+    {
+        thread_local LaneCache cache;
+        for (auto &entry : cache.entries)
+        {
+            if (entry.owner == id_)
+            {
+                return entry.lane.get();
+            }
+        }
+
+        // First send from this thread: drop lanes of destroyed senders, then claim one
+        cache.entries.erase(std::remove_if(cache.entries.begin(), cache.entries.end(),
+                                           [](const LaneCache::Entry &entry)
+                                           { return entry.lane.use_count() == 1; }),
+                            cache.entries.end());
+
+        std::shared_ptr<Lane> lane;
+        {
+            std::lock_guard<std::mutex> lock(laneMutex_);
+            const size_t count = laneCount_.load(std::memory_order_relaxed);
+            for (size_t i = 0; i < count && !lane; ++i)
+            {
+                // Reuse a lane whose thread exited; frames it left are still drained in order
+                if (!lanes_[i]->claimed.exchange(true, std::memory_order_acq_rel))
+                {
+                    lane = lanes_[i];
+                }
+            }
+            if (!lane && count < lanes_.size())
+            {
+                lane = std::make_shared<Lane>(options_.laneCapacity);
+                lanes_[count] = lane;
+                laneCount_.store(count + 1, std::memory_order_release);
+            }
+        }
+
+        if (!lane)
+        {
+            handleError(TransportError::ConfigurationError, TransportOperation::Send, 0, "concurrent sender send",
+                        "more than maxProducers producer threads");
+            return nullptr;
+        }
+
+        cache.entries.push_back(LaneCache::Entry{id_, lane});
+        return lane.get();
+    }
+
+    void ConcurrentSender::ioThread()
+    {
+        std::vector<Frame> batch(options_.batchSize);
+
+        for (;;)
+        {
+            // Read after the stop flag: with no send in flight, all frames that will ever be queued are visible
+            const bool stopping = stopRequested_.load() && sendsInFlight_.load() == 0;
+
+            draining_.store(true);
+            size_t moved = 0;
+            const size_t count = laneCount_.load(std::memory_order_acquire);
+            for (size_t i = 0; i < count; ++i)
+            {
+                // One batch per lane per round keeps a busy producer from starving the others
+                const size_t n = lanes_[i]->queue.popBatch(batch.data(), batch.size());
+                if (n > 0)
+                {
+                    deliver(batch.data(), n);
+                    moved += n;
+                }
+            }
+            draining_.store(false);
+
+            if (moved > 0)
+            {
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (spaceWaiters_.load(std::memory_order_relaxed) > 0)
+                {
+                    std::lock_guard<std::mutex> lock(spaceMutex_);
+                    spaceAvailable_.notify_all();
+                }
+                continue;
+            }
+            if (stopping)
+            {
+                break; // Lanes were empty after the stop request and the last in-flight send
+            }
+            if (stopRequested_.load())
+            {
+                std::this_thread::yield(); // A send() is about to push or give up
+                continue;
+            }
+
+            sleeping_.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            bool idle = true;
+            for (size_t i = 0; i < count && idle; ++i)
+            {
+                idle = lanes_[i]->queue.empty();
+            }
+            if (idle && laneCount_.load(std::memory_order_acquire) == count && !stopRequested_.load())
+            {
+                std::unique_lock<std::mutex> lock(wakeMutex_);
+                wakeup_.wait_for(lock, std::chrono::milliseconds(POLL_INTERVAL_MS), [this]
+                                 { return wakeRequested_; });
+                wakeRequested_ = false;
+            }
+            sleeping_.store(false, std::memory_order_relaxed);
+        }
+
+        running_ = false;
+    }
+
+    void ConcurrentSender::deliver(Frame *frames, size_t count)
+    {
+        size_t offset = 0;
+        while (offset < count)
+        {
+            if (discard_)
+            {
+                dropped_.fetch_add(count - offset, std::memory_order_relaxed);
+                return;
+            }
+
+            size_t sent = 0;
+            const TransportError error = sink_(Span<const Frame>(frames + offset, count - offset), sent);
+            offset += std::min(sent, count - offset);
+            sent_.fetch_add(sent, std::memory_order_relaxed);
+            if (error == TransportError::None)
+            {
+                return;
+            }
+
+            if (stopRequested_.load())
+            {
+                // Shutting down: do not wait out a peer that stopped reading
+                handleError(error, TransportOperation::Send, zmq_errno(), "concurrent sender stop",
+                            "dropping queued frames");
+                discard_ = true;
+                continue;
+            }
+
+            if (isRetryable(error))
+            {
+                // Socket at its high-water mark: hold the frames, producers see full lanes
+                retried_.fetch_add(1, std::memory_order_relaxed);
+                std::this_thread::sleep_for(std::chrono::milliseconds(options_.retryInterval));
+                continue;
+            }
+
+            handleError(error, TransportOperation::Send, zmq_errno(), "concurrent sender send", "frame dropped");
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            ++offset;
+        }
+    }
+
+    void ConcurrentSender::wake()
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        wakeRequested_ = true;
+        wakeup_.notify_one();
+    }
+
+    void ConcurrentSender::handleError(TransportError error, TransportOperation operation, int errnum,
+                                       const char *context, const char *reason)
+    {
+        std::lock_guard<std::mutex> lock(errorMutex_);
+        errors_.report(ErrorEvent{error, operation, errnum, context, reason});
+    }
+
+} // namespace limp
@@ -0,0 +1,147 @@
+#include "limp/zmq/zmq_context.hpp"
+#include <mutex>
+
+namespace limp
+{
+
+    namespace
+    {
+        std::mutex sharedMutex;
+        std::weak_ptr<zmq::context_t> sharedContext;
+
+        // I/O threads start with the first socket, so these still apply after construction
+        void applyContextOptions(zmq::context_t &context, const ZMQConfig &config)
+        {
+#ifdef ZMQ_THREAD_PRIORITY
+            if (config.ioThreadPriority >= 0)
+            {
+                context.set(zmq::ctxopt::thread_priority, config.ioThreadPriority);
+            }
+#endif
+#ifdef ZMQ_THREAD_SCHED_POLICY
+            if (config.ioThreadSchedulingPolicy >= 0)
+            {
+                context.set(zmq::ctxopt::thread_sched_policy, config.ioThreadSchedulingPolicy);
+            }
+#endif
+#ifdef ZMQ_THREAD_AFFINITY_CPU_ADD
+            for (int cpu : config.ioThreadCpus)
+            {
+                context.set(zmq::ctxopt::thread_affinity_cpu_add, cpu);
+            }
+#endif
+#ifdef ZMQ_ZERO_COPY_RECV
+            if (!config.zeroCopyReceive)
+            {
+                context.set(zmq::ctxopt::zero_copy_recv, 0);
+            }
+#endif
+            // Unused if libzmq has none of the options
+            (void)context;
+            (void)config;
+        }
+    } // namespace
+
+    std::shared_ptr<zmq::context_t> ZMQContextRegistry::shared(int ioThreads)
+    {
+        ZMQConfig config;
+        config.ioThreads = ioThreads;
+        return shared(config);
+    }
+
+    std::shared_ptr<zmq::context_t> ZMQContextRegistry::shared(const ZMQConfig &config)
+    {
+        std::lock_guard<std::mutex> lock(sharedMutex);
+
+        // Held weakly so the context never outlives its last user (no static teardown ordering issues)
+        std::shared_ptr<zmq::context_t> context = sharedContext.lock();
+        if (!context)
+        {
+            context = create(config);
+            sharedContext = context;
+        }
+        return context;
+    }
+
+    std::shared_ptr<zmq::context_t> ZMQContextRegistry::create(const ZMQConfig &config)
+    {
+        auto context = std::make_shared<zmq::context_t>(config.ioThreads);
+        applyContextOptions(*context, config);
+        return context;
+    }
+
+    std::shared_ptr<zmq::context_t> ZMQContextRegistry::resolve(const ZMQConfig &config)
+    {
+        if (config.context)
+        {
+            return config.context;
+        }
+        if (config.useSharedContext)
+        {
+            return shared(config);
+        }
+        return create(config);
+    }
+
+    void configureSocket(zmq::socket_t &socket, const ZMQConfig &config)
+    {
+        socket.set(zmq::sockopt::sndtimeo, config.sendTimeout);
+        socket.set(zmq::sockopt::rcvtimeo, config.receiveTimeout);
+        socket.set(zmq::sockopt::linger, config.lingerTime);
+
+        if (config.sendBufferSize > 0)
+        {
+            socket.set(zmq::sockopt::sndbuf, config.sendBufferSize);
+        }
+        if (config.receiveBufferSize > 0)
+        {
+            socket.set(zmq::sockopt::rcvbuf, config.receiveBufferSize);
+        }
+
+        socket.set(zmq::sockopt::reconnect_ivl, config.reconnectInterval);
+        if (config.reconnectIntervalMax > 0)
+        {
+            socket.set(zmq::sockopt::reconnect_ivl_max, config.reconnectIntervalMax);
+        }
+        socket.set(zmq::sockopt::immediate, config.immediate ? 1 : 0);
+
+        // Queueing
+        if (config.sendHighWaterMark >= 0)
+        {
+            socket.set(zmq::sockopt::sndhwm, config.sendHighWaterMark);
+        }
+        if (config.receiveHighWaterMark >= 0)
+        {
+            socket.set(zmq::sockopt::rcvhwm, config.receiveHighWaterMark);
+        }
+        if (config.conflate)
+        {
+            socket.set(zmq::sockopt::conflate, true);
+        }
+
+        // I/O thread placement
+        if (config.affinity != 0)
+        {
+            socket.set(zmq::sockopt::affinity, config.affinity);
+        }
+
+        // TCP keep-alive
+        if (config.tcpKeepAlive >= 0)
+        {
+            socket.set(zmq::sockopt::tcp_keepalive, config.tcpKeepAlive);
+        }
+        if (config.tcpKeepAliveIdle >= 0)
+        {
+            socket.set(zmq::sockopt::tcp_keepalive_idle, config.tcpKeepAliveIdle);
+        }
+        if (config.tcpKeepAliveCount >= 0)
+        {
+            socket.set(zmq::sockopt::tcp_keepalive_cnt, config.tcpKeepAliveCount);
+        }
+        if (config.tcpKeepAliveInterval >= 0)
+        {
+            socket.set(zmq::sockopt::tcp_keepalive_intvl, config.tcpKeepAliveInterval);
+        }
+    }
+
+} // namespace limp
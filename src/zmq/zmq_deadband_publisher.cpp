@@ -0,0 +1,92 @@
+#include "limp/zmq/zmq_deadband_publisher.hpp"
+#include "limp/zmq/zmq_publisher.hpp"
+
+namespace limp
+{
+
+    DeadbandPublisher::DeadbandPublisher(ZMQPublisher &publisher, const Options &options)
+        : publisher_(publisher), filter_(options)
+    {
+    }
+
+    template <typename Send>
+    TransportError DeadbandPublisher::publishIfChanged(const Frame &frame, Send &&send)
+    {
+        if (!filter_.check(frame))
+        {
+            return TransportError::None;
+        }
+
+        TransportError error = send();
+        if (error != TransportError::None)
+        {
+            filter_.invalidate(frame);
+        }
+        return error;
+    }
+
+    TransportError DeadbandPublisher::publish(const Frame &frame)
+    {
+        return publishIfChanged(frame, [&]()
+                                { return publisher_.publish(frame); });
+    }
+
+    TransportError DeadbandPublisher::publish(const Topic &topic, const Frame &frame)
+    {
+        return publishIfChanged(frame, [&]()
+                                { return publisher_.publish(topic, frame); });
+    }
+
+    TransportError DeadbandPublisher::publish(const std::string &topic, const Frame &frame)
+    {
+        return publishIfChanged(frame, [&]()
+                                { return publisher_.publish(topic, frame); });
+    }
+
+    TransportError DeadbandPublisher::publishBatch(Span<const Frame> frames, size_t &handled)
+    {
+        handled = 0;
+        size_t runStart = 0;
+
+        // Publish [runStart, end) as one batch; frames after a failure are forgotten by the filter
+        auto flush = [&](size_t end) -> TransportError
+        {
+            if (end == runStart)
+            {
+                return TransportError::None;
+            }
+            size_t sent = 0;
+            TransportError error = publisher_.publishBatch(Span<const Frame>(frames.data() + runStart, end - runStart), sent);
+            if (error != TransportError::None)
+            {
+                for (size_t i = runStart + sent; i < end; ++i)
+                {
+                    filter_.invalidate(frames[i]);
+                }
+                handled = runStart + sent;
+            }
+            return error;
+        };
+
+        for (size_t i = 0; i < frames.size(); ++i)
+        {
+            if (!filter_.check(frames[i]))
+            {
+                TransportError error = flush(i);
+                if (error != TransportError::None)
+                {
+                    return error;
+                }
+                runStart = i + 1;
+            }
+        }
+
+        TransportError error = flush(frames.size());
+        if (error == TransportError::None)
+        {
+            handled = frames.size();
+        }
+        return error;
+    }
+
+} // namespace limp
@@ -1,5 +1,4 @@
 #include "limp/zmq/zmq_dealer.hpp"
-#include <cstring>
 
 namespace limp
 {
@@ -14,7 +13,7 @@ namespace limp
     {
         if (connected_)
         {
-            handleError(zmq::error_t(), "cannot set identity after connection");
+            handleError(TransportError::AlreadyConnected, TransportOperation::Setup, "dealer set identity", "cannot set identity after connection");
             return TransportError::AlreadyConnected;
         }
 
@@ -31,7 +30,7 @@ namespace limp
         }
         catch (const zmq::error_t &e)
         {
-            handleError(e, "dealer set identity");
+            handleError(e, TransportOperation::Setup, "dealer set identity");
             return TransportError::ConfigurationError;
         }
     }
@@ -52,7 +51,7 @@ namespace limp
         }
         catch (const zmq::error_t &e)
         {
-            handleError(e, "dealer connect");
+            handleError(e, TransportOperation::Connect, "dealer connect");
             return TransportError::ConnectionFailed;
         }
     }
@@ -64,150 +63,139 @@ namespace limp
             return TransportError::NotConnected;
         }
 
+        // [delimiter][data]
+        zmq::message_t parts[2];
         try
         {
-            zmq::message_t delimiterMsg;
-            auto delimiterResult = socket_->send(delimiterMsg, zmq::send_flags::sndmore);
-            if (!delimiterResult)
-            {
-                return TransportError::SendFailed;
-            }
-
-            zmq::message_t dataMsg(data, size);
-            auto result = socket_->send(dataMsg, zmq::send_flags::none);
-            return result.has_value() ? TransportError::None : TransportError::SendFailed;
+            parts[1].rebuild(data, size);
         }
         catch (const zmq::error_t &e)
         {
-            handleError(e, "dealer send");
+            handleError(e, TransportOperation::Send, "dealer send");
             return TransportError::SendFailed;
         }
+
+        return sendParts(parts, 2, "dealer send");
     }
 
     std::ptrdiff_t ZMQDealer::receiveRaw(uint8_t *buffer, size_t maxSize)
     {
-        if (!isConnected())
+        return receiveRaw(buffer, maxSize, -1);
+    }
+
+    std::ptrdiff_t ZMQDealer::receiveRaw(uint8_t *buffer, size_t maxSize, int timeoutMs)
+    {
+        // [delimiter][data]
+        std::ptrdiff_t parts = receiveParts(2, "dealer receive", timeoutMs);
+        if (parts <= 0)
         {
-            return -1;
+            return parts;
         }
 
-        try
-        {
-            std::vector<zmq::message_t> parts;
-            while (true)
-            {
-                zmq::message_t msg;
-                auto result = socket_->recv(msg, zmq::recv_flags::none);
+        return copyPart(1, buffer, maxSize);
+    }
 
-                if (!result)
-                {
-                    return 0;
-                }
+    std::ptrdiff_t ZMQDealer::receiveRaw(std::string &sourceIdentity,
+                                          uint8_t *buffer,
+                                          size_t maxSize,
+                                          int timeoutMs)
+    {
+        // [source_identity][delimiter][data]
+        std::ptrdiff_t parts = receiveParts(3, "dealer receiveRaw with identity", timeoutMs);
+        if (parts <= 0)
+        {
+            return parts;
+        }
 
-                parts.push_back(std::move(msg));
+        ByteSpan identity = partBytes(0);
+        sourceIdentity.assign(reinterpret_cast<const char *>(identity.data()), identity.size());
+        return copyPart(2, buffer, maxSize);
+    }
 
-                auto more = socket_->get(zmq::sockopt::rcvmore);
-                if (!more)
-                {
-                    break;
-                }
-            }
+    TransportError ZMQDealer::receiveView(FrameView &view, int timeoutMs)
+    {
+        std::ptrdiff_t parts = receiveParts(2, "dealer receive", timeoutMs);
+        if (parts < 0)
+        {
+            return TransportError::ReceiveFailed;
+        }
+        if (parts == 0)
+        {
+            return TransportError::Timeout;
+        }
 
-            if (parts.size() != 2)
-            {
-                handleError(zmq::error_t(), "dealer receive: expected 2 parts, got " + std::to_string(parts.size()));
-                return -1;
-            }
+        return viewPart(1, view);
+    }
 
-            const auto &dataMsg = parts[1];
-            size_t receivedSize = dataMsg.size();
+    TransportError ZMQDealer::receiveView(ByteSpan &sourceIdentity, FrameView &view, int timeoutMs)
+    {
+        std::ptrdiff_t parts = receiveParts(3, "dealer receive with identity", timeoutMs);
+        if (parts < 0)
+        {
+            return TransportError::ReceiveFailed;
+        }
+        if (parts == 0)
+        {
+            return TransportError::Timeout;
+        }
 
-            if (receivedSize > maxSize)
-            {
-                handleError(zmq::error_t(), "received message larger than buffer");
-                return -1;
-            }
+        sourceIdentity = partBytes(0);
+        return viewPart(2, view);
+    }
 
-            std::memcpy(buffer, dataMsg.data(), receivedSize);
-            return static_cast<std::ptrdiff_t>(receivedSize);
+    TransportError ZMQDealer::receiveAnyView(ByteSpan &sourceIdentity, FrameView &view, int timeoutMs)
+    {
+        std::ptrdiff_t parts = receiveParts(0, "dealer receive", timeoutMs);
+        if (parts < 0)
+        {
+            return TransportError::ReceiveFailed;
         }
-        catch (const zmq::error_t &e)
+        if (parts == 0)
+        {
+            return TransportError::Timeout;
+        }
+        if (parts != 2 && parts != 3)
         {
-            handleError(e, "dealer receive");
-            return -1;
+            handleError(TransportError::ReceiveFailed, TransportOperation::Receive, "dealer receive", "expected 2 or 3 message parts");
+            return TransportError::ReceiveFailed;
         }
+
+        sourceIdentity = (parts == 3) ? partBytes(0) : ByteSpan();
+        return viewPart(static_cast<size_t>(parts) - 1, view);
     }
 
-    std::ptrdiff_t ZMQDealer::receiveRaw(std::string &sourceIdentity,
-                                          uint8_t *buffer,
-                                          size_t maxSize)
+    TransportError ZMQDealer::send(const Frame &frame)
     {
         if (!isConnected())
         {
-            return -1;
+            return TransportError::NotConnected;
         }
 
-        try
+        // [delimiter][data]
+        zmq::message_t parts[2];
+        if (!serializeToMessage(frame, parts[1]))
         {
-            std::vector<zmq::message_t> parts;
-            while (true)
-            {
-                zmq::message_t msg;
-                auto result = socket_->recv(msg, zmq::recv_flags::none);
-
-                if (!result)
-                {
-                    return 0; // Timeout
-                }
-
-                parts.push_back(std::move(msg));
-
-                auto more = socket_->get(zmq::sockopt::rcvmore);
-                if (!more)
-                {
-                    break;
-                }
-            }
-
-            if (parts.size() != 3)
-            {
-                handleError(zmq::error_t(), "dealer receiveRaw with identity: expected 3 parts, got " + std::to_string(parts.size()));
-                return -1;
-            }
-
-            // Extract source identity from first part
-            const auto &identityMsg = parts[0];
-            sourceIdentity = std::string(static_cast<const char*>(identityMsg.data()), identityMsg.size());
-
-            // Data is in the third part (after delimiter)
-            const auto &dataMsg = parts[2];
-            size_t receivedSize = dataMsg.size();
-
-            if (receivedSize > maxSize)
-            {
-                handleError(zmq::error_t(), "received message larger than buffer");
-                return -1;
-            }
-
-            std::memcpy(buffer, dataMsg.data(), receivedSize);
-            return static_cast<std::ptrdiff_t>(receivedSize);
-        }
-        catch (const zmq::error_t &e)
-        {
-            handleError(e, "dealer receiveRaw with identity");
-            return -1;
+            return TransportError::SerializationFailed;
         }
+
+        return sendParts(parts, 2, "dealer send");
     }
 
-    TransportError ZMQDealer::send(const Frame &frame)
+    TransportError ZMQDealer::send(Frame &&frame)
     {
-        std::vector<uint8_t> buffer;
-        if (!serializeFrame(frame, buffer))
+        if (!isConnected())
+        {
+            return TransportError::NotConnected;
+        }
+
+        // [delimiter][data]
+        zmq::message_t parts[2];
+        if (!serializeToMessage(std::move(frame), parts[1]))
         {
             return TransportError::SerializationFailed;
         }
-        
-        return sendRaw(buffer.data(), buffer.size());
+
+        return sendParts(parts, 2, "dealer send");
     }
 
     TransportError ZMQDealer::sendRaw(const std::string &destinationIdentity,
@@ -219,91 +207,124 @@ namespace limp
             return TransportError::NotConnected;
         }
 
+        // [destination_identity][delimiter][data]
+        zmq::message_t parts[3];
         try
         {
-            zmq::message_t destMsg(destinationIdentity.data(), destinationIdentity.size());
-            zmq::message_t emptyMsg;
-            zmq::message_t dataMsg(data, size);
-
-            if (!socket_->send(destMsg, zmq::send_flags::sndmore))
-            {
-                return TransportError::SendFailed;
-            }
-            if (!socket_->send(emptyMsg, zmq::send_flags::sndmore))
-            {
-                return TransportError::SendFailed;
-            }
-            auto result = socket_->send(dataMsg, zmq::send_flags::none);
-            return result.has_value() ? TransportError::None : TransportError::SendFailed;
+            parts[0].rebuild(destinationIdentity.data(), destinationIdentity.size());
+            parts[2].rebuild(data, size);
         }
         catch (const zmq::error_t &e)
         {
-            handleError(e, "dealer sendRaw");
+            handleError(e, TransportOperation::Send, "dealer sendRaw");
             return TransportError::SendFailed;
         }
+
+        return sendParts(parts, 3, "dealer sendRaw");
     }
 
     TransportError ZMQDealer::send(const std::string &destinationIdentity, const Frame &frame)
     {
-        std::vector<uint8_t> buffer;
-        if (!serializeFrame(frame, buffer))
+        if (!isConnected())
+        {
+            return TransportError::NotConnected;
+        }
+
+        // [destination_identity][delimiter][data]
+        zmq::message_t parts[3];
+        if (!serializeToMessage(frame, parts[2]))
         {
             return TransportError::SerializationFailed;
         }
-        
-        return sendRaw(destinationIdentity, buffer.data(), buffer.size());
+
+        try
+        {
+            parts[0].rebuild(destinationIdentity.data(), destinationIdentity.size());
+        }
+        catch (const zmq::error_t &e)
+        {
+            handleError(e, TransportOperation::Send, "dealer send");
+            return TransportError::SendFailed;
+        }
+
+        return sendParts(parts, 3, "dealer send");
     }
 
-    TransportError ZMQDealer::receive(Frame &frame, int timeoutMs)
+    TransportError ZMQDealer::send(const std::string &destinationIdentity, Frame &&frame)
     {
-        (void)timeoutMs; // Timeout is set via socket options
+        if (!isConnected())
+        {
+            return TransportError::NotConnected;
+        }
 
-        std::vector<uint8_t> buffer(4096); // Initial buffer size
-        std::ptrdiff_t received = receiveRaw(buffer.data(), buffer.size());
-        
-        if (received < 0)
+        // [destination_identity][delimiter][data]
+        zmq::message_t parts[3];
+        if (!serializeToMessage(std::move(frame), parts[2]))
         {
-            return TransportError::ReceiveFailed;
+            return TransportError::SerializationFailed;
         }
-        if (received == 0)
+
+        try
         {
-            return TransportError::Timeout;
+            parts[0].rebuild(destinationIdentity.data(), destinationIdentity.size());
         }
-        
-        buffer.resize(static_cast<size_t>(received));
-        
-        if (!deserializeFrame(buffer, frame))
+        catch (const zmq::error_t &e)
         {
-            return TransportError::DeserializationFailed;
+            handleError(e, TransportOperation::Send, "dealer send");
+            return TransportError::SendFailed;
         }
-        
-        return TransportError::None;
+
+        return sendParts(parts, 3, "dealer send");
     }
 
-    TransportError ZMQDealer::receive(std::string &sourceIdentity, Frame &frame, int timeoutMs)
+    TransportError ZMQDealer::sendBatch(Span<const Frame> frames, size_t &sent)
     {
-        (void)timeoutMs; // Timeout is set via socket options
+        // [delimiter][data] per frame
+        const ByteSpan envelope[] = {ByteSpan()};
+        return sendFrameBatch(envelope, frames, sent, "dealer send batch");
+    }
 
-        std::vector<uint8_t> buffer(4096); // Initial buffer size
-        std::ptrdiff_t received = receiveRaw(sourceIdentity, buffer.data(), buffer.size());
-        
-        if (received < 0)
-        {
-            return TransportError::ReceiveFailed;
-        }
-        if (received == 0)
+    TransportError ZMQDealer::sendBatch(const std::string &destinationIdentity,
+                                        Span<const Frame> frames,
+                                        size_t &sent)
+    {
+        // [destination_identity][delimiter][data] per frame
+        const ByteSpan envelope[] = {
+            ByteSpan(reinterpret_cast<const uint8_t *>(destinationIdentity.data()), destinationIdentity.size()),
+            ByteSpan()};
+        return sendFrameBatch(envelope, frames, sent, "dealer send batch");
+    }
+
+    TransportError ZMQDealer::receiveBatch(std::vector<Frame> &frames, size_t maxFrames, size_t &received, int timeoutMs)
+    {
+        return receiveFrameBatch(2, frames, maxFrames, received, timeoutMs, "dealer receive batch");
+    }
+
+    TransportError ZMQDealer::receive(Frame &frame, int timeoutMs)
+    {
+        FrameView view;
+        TransportError error = receiveView(view, timeoutMs);
+        if (error != TransportError::None)
         {
-            return TransportError::Timeout;
+            return error;
         }
-        
-        buffer.resize(static_cast<size_t>(received));
-        
-        if (!deserializeFrame(buffer, frame))
+
+        // Payload is sized from the received message; a reused Frame keeps its capacity
+        return view.toFrame(frame) ? TransportError::None : TransportError::DeserializationFailed;
+    }
+
+    TransportError ZMQDealer::receive(std::string &sourceIdentity, Frame &frame, int timeoutMs)
+    {
+        ByteSpan identity;
+        FrameView view;
+        TransportError error = receiveView(identity, view, timeoutMs);
+        if (error != TransportError::None)
         {
-            return TransportError::DeserializationFailed;
+            return error;
         }
-        
-        return TransportError::None;
+
+        sourceIdentity.assign(reinterpret_cast<const char *>(identity.data()), identity.size());
+        return view.toFrame(frame) ? TransportError::None : TransportError::DeserializationFailed;
     }
 
 } // namespace limp
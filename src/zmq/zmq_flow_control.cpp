@@ -0,0 +1,245 @@
+#include "limp/zmq/zmq_flow_control.hpp"
+#include "limp/zmq/zmq_dealer.hpp"
+#include "limp/zmq/zmq_router.hpp"
+#include <algorithm>
+#include <chrono>
+
+namespace limp
+{
+
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        Clock::time_point deadlineFor(int timeoutMs)
+        {
+            return Clock::now() + std::chrono::milliseconds(std::max(timeoutMs, 0));
+        }
+
+        /** @brief Milliseconds left until deadline (-1 stays infinite) */
+        int remainingMs(Clock::time_point deadline, int timeoutMs)
+        {
+            if (timeoutMs < 0)
+            {
+                return -1;
+            }
+            auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()).count();
+            return left > 0 ? static_cast<int>(left) : 0;
+        }
+    } // namespace
+
+    // CreditDealer
+
+    CreditDealer::CreditDealer(ZMQDealer &dealer, const Options &options)
+        : dealer_(dealer), options_(options), credits_(0)
+    {
+    }
+
+    TransportError CreditDealer::requestCredit()
+    {
+        credits_ = 0;
+        return dealer_.send(makeCreditFrame(options_.srcNodeID, 0));
+    }
+
+    TransportError CreditDealer::sendNow(const Frame &frame)
+    {
+        TransportError error = dealer_.send(frame);
+        if (error == TransportError::None)
+        {
+            --credits_;
+        }
+        return error;
+    }
+
+    TransportError CreditDealer::drainQueue()
+    {
+        while (!queue_.empty() && credits_ > 0)
+        {
+            TransportError error = sendNow(queue_.front());
+            if (error != TransportError::None)
+            {
+                return error;
+            }
+            queue_.pop_front();
+        }
+        return TransportError::None;
+    }
+
+    TransportError CreditDealer::pump(int timeoutMs)
+    {
+        Frame incoming;
+        TransportError error = dealer_.receive(incoming, timeoutMs);
+        if (error != TransportError::None)
+        {
+            return error;
+        }
+
+        uint32_t credits = 0;
+        if (parseCreditFrame(incoming, credits))
+        {
+            credits_ += credits;
+            return drainQueue();
+        }
+
+        inbox_.push_back(std::move(incoming));
+        return TransportError::None;
+    }
+
+    TransportError CreditDealer::send(const Frame &frame)
+    {
+        // Queued frames go first to keep the order
+        TransportError error = drainQueue();
+        if (error != TransportError::None)
+        {
+            return error;
+        }
+
+        const auto deadline = deadlineFor(options_.sendTimeout);
+        while (credits_ == 0 && queue_.size() >= options_.queueCapacity)
+        {
+            const int remaining = remainingMs(deadline, options_.sendTimeout);
+            if (remaining == 0)
+            {
+                return TransportError::Timeout;
+            }
+
+            error = pump(remaining);
+            if (error != TransportError::None && error != TransportError::Timeout)
+            {
+                return error;
+            }
+        }
+
+        if (credits_ > 0 && queue_.empty())
+        {
+            return sendNow(frame);
+        }
+        queue_.push_back(frame);
+        return TransportError::None;
+    }
+
+    TransportError CreditDealer::receive(Frame &frame, int timeoutMs)
+    {
+        const auto deadline = deadlineFor(timeoutMs);
+        while (inbox_.empty())
+        {
+            TransportError error = pump(remainingMs(deadline, timeoutMs));
+            if (error != TransportError::None)
+            {
+                return error;
+            }
+            if (inbox_.empty() && remainingMs(deadline, timeoutMs) == 0)
+            {
+                return TransportError::Timeout;
+            }
+        }
+
+        frame = std::move(inbox_.front());
+        inbox_.pop_front();
+        return TransportError::None;
+    }
+
+    TransportError CreditDealer::flush(int timeoutMs)
+    {
+        const auto deadline = deadlineFor(timeoutMs);
+        while (!queue_.empty())
+        {
+            const int remaining = remainingMs(deadline, timeoutMs);
+            if (remaining == 0)
+            {
+                return TransportError::Timeout;
+            }
+
+            TransportError error = pump(remaining);
+            if (error != TransportError::None && error != TransportError::Timeout)
+            {
+                return error;
+            }
+        }
+        return TransportError::None;
+    }
+
+    // CreditRouter
+
+    CreditRouter::CreditRouter(ZMQRouter &router, const Options &options)
+        : router_(router), options_(options), holdsCredit_(false)
+    {
+        // A batch larger than the window would never be returned
+        options_.window = std::max<uint32_t>(options_.window, 1);
+        if (options_.grantBatch == 0)
+        {
+            options_.grantBatch = std::max<uint32_t>(options_.window / 4, 1);
+        }
+        options_.grantBatch = std::min(options_.grantBatch, options_.window);
+    }
+
+    void CreditRouter::returnCredit()
+    {
+        if (!holdsCredit_)
+        {
+            return;
+        }
+        holdsCredit_ = false;
+
+        auto it = consumed_.find(delivered_);
+        if (it == consumed_.end())
+        {
+            return;
+        }
+
+        // Kept on failure, so the credit goes out with the next grant
+        if (++it->second >= options_.grantBatch &&
+            router_.send(delivered_, makeCreditFrame(options_.srcNodeID, it->second)) == TransportError::None)
+        {
+            it->second = 0;
+        }
+    }
+
+    TransportError CreditRouter::receive(PeerId &sourceIdentity, Frame &frame, int timeoutMs)
+    {
+        returnCredit();
+
+        const auto deadline = deadlineFor(timeoutMs);
+        for (;;)
+        {
+            TransportError error = router_.receive(sourceIdentity, frame, remainingMs(deadline, timeoutMs));
+            if (error != TransportError::None)
+            {
+                return error;
+            }
+
+            uint32_t credits = 0;
+            if (!parseCreditFrame(frame, credits))
+            {
+                if (consumed_.count(sourceIdentity) > 0)
+                {
+                    delivered_ = sourceIdentity;
+                    holdsCredit_ = true;
+                }
+                return TransportError::None;
+            }
+
+            // Credit request: (re)start the dealer with a full window
+            if (credits == 0)
+            {
+                consumed_[sourceIdentity] = 0;
+                router_.send(sourceIdentity, makeCreditFrame(options_.srcNodeID, options_.window));
+            }
+
+            if (remainingMs(deadline, timeoutMs) == 0)
+            {
+                return TransportError::Timeout;
+            }
+        }
+    }
+
+    void CreditRouter::forget(const PeerId &identity)
+    {
+        consumed_.erase(identity);
+        if (holdsCredit_ && delivered_ == identity)
+        {
+            holdsCredit_ = false;
+        }
+    }
+
+} // namespace limp
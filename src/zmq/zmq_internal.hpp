@@ -0,0 +1,134 @@
+#pragma once
+
+#include "limp/zmq/zmq_transport_base.hpp"
+#include <zmq.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+namespace limp
+{
+
+    /**
+     * @brief Helpers shared by the ZeroMQ sources (not installed)
+     */
+    namespace zmq_internal
+    {
+        /** @brief Error code reported for a ZeroMQ exception during an operation */
+        inline TransportError errorFor(TransportOperation operation) noexcept
+        {
+            switch (operation)
+            {
+            case TransportOperation::Setup:
+            case TransportOperation::Subscribe:
+                return TransportError::ConfigurationError;
+            case TransportOperation::Connect:
+                return TransportError::ConnectionFailed;
+            case TransportOperation::Bind:
+                return TransportError::BindFailed;
+            case TransportOperation::Send:
+                return TransportError::SendFailed;
+            case TransportOperation::Receive:
+                return TransportError::ReceiveFailed;
+            case TransportOperation::Close:
+                return TransportError::SocketClosed;
+            default:
+                return TransportError::InternalError;
+            }
+        }
+
+        /**
+         * @brief Receive one multipart message without blocking
+         *
+         * parts grows as needed and is reused between calls.
+         *
+         * @return Number of parts, 0 if nothing was queued
+         */
+        inline size_t receiveMultipart(zmq::socket_t &socket, std::vector<zmq::message_t> &parts)
+        {
+            size_t count = 0;
+            bool more = true;
+            while (more)
+            {
+                if (count == parts.size())
+                {
+                    parts.emplace_back();
+                }
+                // Multipart delivery is atomic, so only the first part can be missing
+                auto result = socket.recv(parts[count], count == 0 ? zmq::recv_flags::dontwait
+                                                                   : zmq::recv_flags::none);
+                if (!result)
+                {
+                    return 0;
+                }
+                more = parts[count].more();
+                ++count;
+            }
+            return count;
+        }
+
+        /** @brief Longest wait on a notification descriptor before retrying a receive */
+        constexpr int WAIT_SLICE_MS = 10;
+
+        /**
+         * @brief Receive from a socket guarded by a mutex without holding it while waiting
+         *
+         * attempt() runs under the lock and makes one non-blocking receive;
+         * it returns false if nothing was queued. Between attempts the thread
+         * waits on the socket's notification descriptor with the lock
+         * released, so senders are never queued behind a waiting receiver.
+         * The descriptor is edge-triggered and other socket calls may
+         * consume its signal, so each wait is capped at WAIT_SLICE_MS.
+         *
+         * @param mutex Lock serializing access to the transport's socket
+         * @param transport Transport attempt() receives from
+         * @param timeoutMs Total wait (0=one attempt, -1=until attempt() succeeds)
+         * @param attempt Callable returning true once it produced a result
+         */
+        template <typename Attempt>
+        void receiveUnlocked(std::mutex &mutex, const ZMQTransport &transport, int timeoutMs, Attempt &&attempt)
+        {
+            using Clock = std::chrono::steady_clock;
+            const Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(timeoutMs < 0 ? 0 : timeoutMs);
+
+            for (;;)
+            {
+                zmq::fd_t fd;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (attempt() || !transport.notificationHandle(fd))
+                    {
+                        return;
+                    }
+                }
+
+                int wait = WAIT_SLICE_MS;
+                if (timeoutMs >= 0)
+                {
+                    auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()).count();
+                    if (left <= 0)
+                    {
+                        return;
+                    }
+                    wait = std::min(wait, static_cast<int>(left));
+                }
+
+                zmq::pollitem_t item = {nullptr, fd, ZMQ_POLLIN, 0};
+                try
+                {
+                    zmq::poll(&item, 1, std::chrono::milliseconds(wait));
+                }
+                catch (const zmq::error_t &e)
+                {
+                    if (e.num() != EINTR)
+                    {
+                        return; // The next receive on the socket reports the failure
+                    }
+                }
+            }
+        }
+
+    } // namespace zmq_internal
+} // namespace limp
@@ -1,14 +1,100 @@
 #include "limp/zmq/zmq_proxy.hpp"
-#include <iostream>
+#include "limp/zmq/zmq_context.hpp"
+#include "zmq_internal.hpp"
+#include <chrono>
+#include <cstring>
+#include <vector>
 
 namespace limp
 {
 
+    namespace
+    {
+        std::atomic<unsigned> nextProxyId{0};
+
+        /** @brief Maximum messages routed per socket per poll */
+        constexpr size_t ROUTE_BATCH = 64;
+
+        uint32_t instanceKey(uint16_t classID, uint16_t instanceID)
+        {
+            return (static_cast<uint32_t>(classID) << 16) | instanceID;
+        }
+
+        /** @brief Outcome of routeTo() */
+        enum class RouteResult
+        {
+            Sent,
+            Unreachable, ///< Destination not connected to this socket
+            Full         ///< Destination's queue at its high-water mark
+        };
+
+        /**
+         * @brief Send [destination][source][delimiter][data] through a ROUTER
+         *
+         * With router_mandatory the destination part fails before anything is
+         * queued, so data is left intact for another attempt. The first part
+         * is sent without waiting: a full destination must not stall the loop
+         * for everyone else. Once it is accepted the rest cannot block.
+         */
+        RouteResult routeTo(zmq::socket_t &socket, const uint8_t *destination, size_t destinationSize,
+                            const zmq::message_t &source, zmq::message_t &data, ZMQProxy::Counters &sent)
+        {
+            try
+            {
+                if (!socket.send(zmq::message_t(destination, destinationSize),
+                                 zmq::send_flags::sndmore | zmq::send_flags::dontwait))
+                {
+                    return RouteResult::Full;
+                }
+            }
+            catch (const zmq::error_t &e)
+            {
+                if (e.num() == EHOSTUNREACH)
+                {
+                    return RouteResult::Unreachable;
+                }
+                throw;
+            }
+            sent.bytes += destinationSize + source.size() + data.size();
+            sent.messages += 4;
+            socket.send(zmq::message_t(source.data(), source.size()), zmq::send_flags::sndmore);
+            socket.send(zmq::message_t(), zmq::send_flags::sndmore);
+            socket.send(data, zmq::send_flags::none);
+            return RouteResult::Sent;
+        }
+
+        bool isCommand(const zmq::message_t &message, const char *command)
+        {
+            const size_t length = std::strlen(command);
+            return message.size() == length && std::memcmp(message.data(), command, length) == 0;
+        }
+
+        /** @brief Parts in a STATISTICS reply: libzmq's 8, then dropped, unroutable and malformed */
+        constexpr size_t STATISTICS_PARTS = 11;
+
+        /** @brief Reply to STATISTICS in libzmq's format, extended with the drop counters */
+        void sendStatistics(zmq::socket_t &control, const ZMQProxy::Stats &stats)
+        {
+            const uint64_t values[STATISTICS_PARTS] = {
+                stats.frontendReceived.messages, stats.frontendReceived.bytes,
+                stats.frontendSent.messages, stats.frontendSent.bytes,
+                stats.backendReceived.messages, stats.backendReceived.bytes,
+                stats.backendSent.messages, stats.backendSent.bytes,
+                stats.dropped, stats.unroutable, stats.malformed};
+            for (size_t i = 0; i < STATISTICS_PARTS; ++i)
+            {
+                control.send(zmq::message_t(&values[i], sizeof(uint64_t)),
+                             (i + 1 < STATISTICS_PARTS) ? zmq::send_flags::sndmore : zmq::send_flags::none);
+            }
+        }
+    } // namespace
+
     ZMQProxy::ZMQProxy(ProxyType type, const ZMQConfig &config)
         : type_(type), config_(config), running_(false), stopRequested_(false), 
-          frontendBind_(true), backendBind_(true)
+          frontendBind_(true), backendBind_(true), errors_("ZMQ"), paused_(false)
     {
-        context_ = std::make_unique<zmq::context_t>(config_.ioThreads);
+        context_ = ZMQContextRegistry::resolve(config_);
+        controlEndpoint_ = "inproc://limp-proxy-control-" + std::to_string(nextProxyId++);
     }
 
     ZMQProxy::~ZMQProxy()
@@ -20,10 +106,8 @@ namespace limp
     {
         if (running_.load())
         {
-            if (errorCallback_)
-            {
-                errorCallback_("Cannot set frontend while proxy is running");
-            }
+            handleError(TransportError::ConfigurationError, TransportOperation::Setup, "proxy set frontend",
+                        "proxy is running");
             return TransportError::ConfigurationError;
         }
 
@@ -36,10 +120,8 @@ namespace limp
     {
         if (running_.load())
         {
-            if (errorCallback_)
-            {
-                errorCallback_("Cannot set backend while proxy is running");
-            }
+            handleError(TransportError::ConfigurationError, TransportOperation::Setup, "proxy set backend",
+                        "proxy is running");
             return TransportError::ConfigurationError;
         }
 
@@ -52,10 +134,8 @@ namespace limp
     {
         if (running_.load())
         {
-            if (errorCallback_)
-            {
-                errorCallback_("Cannot set capture while proxy is running");
-            }
+            handleError(TransportError::ConfigurationError, TransportOperation::Setup, "proxy set capture",
+                        "proxy is running");
             return TransportError::ConfigurationError;
         }
 
@@ -63,33 +143,212 @@ namespace limp
         return TransportError::None;
     }
 
-    void ZMQProxy::setErrorCallback(std::function<void(const std::string &)> callback)
+    TransportError ZMQProxy::checkRoutable(const char *operation)
     {
-        errorCallback_ = callback;
+        if (running_.load())
+        {
+            handleError(TransportError::ConfigurationError, TransportOperation::Setup, operation, "proxy is running");
+            return TransportError::ConfigurationError;
+        }
+        if (type_ != ProxyType::ROUTER_ROUTER)
+        {
+            handleError(TransportError::ConfigurationError, TransportOperation::Setup, operation,
+                        "header routing requires a ROUTER-ROUTER proxy");
+            return TransportError::ConfigurationError;
+        }
+        return TransportError::None;
     }
 
-    TransportError ZMQProxy::start()
+    TransportError ZMQProxy::addRoute(uint16_t classID, uint16_t instanceID, const std::string &destinationIdentity)
+    {
+        TransportError error = checkRoutable("proxy add route");
+        if (error == TransportError::None)
+        {
+            instanceRoutes_[instanceKey(classID, instanceID)] = PeerId(destinationIdentity);
+        }
+        return error;
+    }
+
+    TransportError ZMQProxy::addRoute(uint16_t classID, const std::string &destinationIdentity)
+    {
+        TransportError error = checkRoutable("proxy add route");
+        if (error == TransportError::None)
+        {
+            classRoutes_[classID] = PeerId(destinationIdentity);
+        }
+        return error;
+    }
+
+    TransportError ZMQProxy::addNodeRoute(uint16_t srcNodeID, const std::string &destinationIdentity)
+    {
+        TransportError error = checkRoutable("proxy add route");
+        if (error == TransportError::None)
+        {
+            nodeRoutes_[srcNodeID] = PeerId(destinationIdentity);
+        }
+        return error;
+    }
+
+    TransportError ZMQProxy::clearRoutes()
     {
         if (running_.load())
         {
-            if (errorCallback_)
+            handleError(TransportError::ConfigurationError, TransportOperation::Setup, "proxy clear routes",
+                        "proxy is running");
+            return TransportError::ConfigurationError;
+        }
+
+        instanceRoutes_.clear();
+        classRoutes_.clear();
+        nodeRoutes_.clear();
+        return TransportError::None;
+    }
+
+    bool ZMQProxy::hasHeaderRouting() const
+    {
+        return type_ == ProxyType::ROUTER_ROUTER &&
+               (!instanceRoutes_.empty() || !classRoutes_.empty() || !nodeRoutes_.empty());
+    }
+
+    const PeerId *ZMQProxy::findRoute(const FrameView &header) const
+    {
+        if (!instanceRoutes_.empty())
+        {
+            auto it = instanceRoutes_.find(instanceKey(header.classID(), header.instanceID()));
+            if (it != instanceRoutes_.end())
+            {
+                return &it->second;
+            }
+        }
+        if (!classRoutes_.empty())
+        {
+            auto it = classRoutes_.find(header.classID());
+            if (it != classRoutes_.end())
+            {
+                return &it->second;
+            }
+        }
+        if (!nodeRoutes_.empty())
+        {
+            auto it = nodeRoutes_.find(header.srcNodeID());
+            if (it != nodeRoutes_.end())
             {
-                errorCallback_("Proxy is already running");
+                return &it->second;
             }
+        }
+        return nullptr;
+    }
+
+    void ZMQProxy::setErrorCallback(std::function<void(const std::string &)> callback)
+    {
+        std::lock_guard<std::mutex> lock(errorMutex_);
+        errors_.setMessageCallback(std::move(callback));
+    }
+
+    void ZMQProxy::setErrorEventCallback(ErrorEventCallback callback)
+    {
+        std::lock_guard<std::mutex> lock(errorMutex_);
+        errors_.setEventCallback(std::move(callback));
+    }
+
+    TransportError ZMQProxy::start()
+    {
+        if (running_.load())
+        {
+            handleError(TransportError::ConfigurationError, TransportOperation::Setup, "proxy start",
+                        "already running");
             return TransportError::ConfigurationError;
         }
 
         if (frontendEndpoint_.empty() || backendEndpoint_.empty())
         {
-            if (errorCallback_)
+            handleError(TransportError::InvalidEndpoint, TransportOperation::Setup, "proxy start",
+                        "frontend and backend endpoints must be set");
+            return TransportError::InvalidEndpoint;
+        }
+
+        // A proxy thread that ended on an error is still joinable
+        stop();
+
+        // Bind on the caller's thread so a bad or busy endpoint fails start(); the
+        // sockets then move to the proxy thread (the thread start is a full barrier)
+        zmq::socket_t frontend;
+        zmq::socket_t backend;
+        zmq::socket_t capture;
+        zmq::socket_t control;
+        TransportOperation stage = TransportOperation::Setup;
+        const char *context = "proxy frontend";
+        try
+        {
+            frontend = zmq::socket_t(*context_, getFrontendSocketType());
+            configureSocket(frontend, config_);
+            stage = frontendBind_ ? TransportOperation::Bind : TransportOperation::Connect;
+            if (frontendBind_)
             {
-                errorCallback_("Frontend and backend endpoints must be set");
+                frontend.bind(frontendEndpoint_);
             }
-            return TransportError::InvalidEndpoint;
+            else
+            {
+                frontend.connect(frontendEndpoint_);
+            }
+
+            context = "proxy backend";
+            stage = TransportOperation::Setup;
+            backend = zmq::socket_t(*context_, getBackendSocketType());
+            configureSocket(backend, config_);
+            stage = backendBind_ ? TransportOperation::Bind : TransportOperation::Connect;
+            if (backendBind_)
+            {
+                backend.bind(backendEndpoint_);
+            }
+            else
+            {
+                backend.connect(backendEndpoint_);
+            }
+
+            stage = TransportOperation::Setup;
+            if (hasHeaderRouting())
+            {
+                frontend.set(zmq::sockopt::router_mandatory, 1);
+                backend.set(zmq::sockopt::router_mandatory, 1);
+            }
+
+            if (!captureEndpoint_.empty())
+            {
+                context = "proxy capture";
+                capture = zmq::socket_t(*context_, zmq::socket_type::pub);
+                configureSocket(capture, config_);
+                stage = TransportOperation::Bind;
+                capture.bind(captureEndpoint_);
+            }
+
+            // One steering socket pair for the proxy's lifetime: stop() sends TERMINATE here
+            context = "proxy control socket";
+            stage = TransportOperation::Setup;
+            control = zmq::socket_t(*context_, zmq::socket_type::pair);
+            control.set(zmq::sockopt::linger, 0);
+            control.bind(controlEndpoint_);
+
+            std::lock_guard<std::mutex> lock(controlMutex_);
+            control_ = std::make_unique<zmq::socket_t>(*context_, zmq::socket_type::pair);
+            control_->set(zmq::sockopt::linger, 0);
+            control_->connect(controlEndpoint_);
+        }
+        catch (const zmq::error_t &e)
+        {
+            {
+                std::lock_guard<std::mutex> lock(controlMutex_);
+                control_.reset();
+            }
+            handleError(e, stage, context);
+            return zmq_internal::errorFor(stage);
         }
 
         stopRequested_ = false;
-        thread_ = std::make_unique<std::thread>(&ZMQProxy::proxyThread, this);
+        paused_ = false;
+        running_ = true;
+        thread_ = std::make_unique<std::thread>(&ZMQProxy::proxyThread, this, std::move(frontend), std::move(backend),
+                                                std::move(control), std::move(capture));
         return TransportError::None;
     }
 
@@ -102,10 +361,20 @@ namespace limp
 
         stopRequested_ = true;
 
-        // Shutdown context to terminate proxy
-        if (context_)
+        // Ask the proxy loop to terminate
         {
-            context_->shutdown();
+            std::lock_guard<std::mutex> lock(controlMutex_);
+            try
+            {
+                if (control_)
+                {
+                    control_->send(zmq::str_buffer("TERMINATE"), zmq::send_flags::dontwait);
+                }
+            }
+            catch (const zmq::error_t &e)
+            {
+                handleError(e, TransportOperation::Send, "proxy stop");
+            }
         }
 
         // Wait for thread to finish
@@ -115,10 +384,117 @@ namespace limp
         }
 
         thread_.reset();
+        {
+            std::lock_guard<std::mutex> lock(controlMutex_);
+            control_.reset();
+        }
         running_ = false;
+        paused_ = false;
+    }
+
+    TransportError ZMQProxy::sendCommand(const char *command)
+    {
+        std::lock_guard<std::mutex> lock(controlMutex_);
+        if (!control_ || !running_.load())
+        {
+            return TransportError::NotConnected;
+        }
+
+        try
+        {
+            if (!control_->send(zmq::buffer(command, std::strlen(command)), zmq::send_flags::dontwait))
+            {
+                return TransportError::SendFailed;
+            }
+        }
+        catch (const zmq::error_t &e)
+        {
+            handleError(e, TransportOperation::Send, "proxy command");
+            return TransportError::SendFailed;
+        }
+        return TransportError::None;
+    }
+
+    TransportError ZMQProxy::pause()
+    {
+        TransportError error = sendCommand("PAUSE");
+        if (error == TransportError::None)
+        {
+            paused_ = true;
+        }
+        return error;
+    }
+
+    TransportError ZMQProxy::resume()
+    {
+        TransportError error = sendCommand("RESUME");
+        if (error == TransportError::None)
+        {
+            paused_ = false;
+        }
+        return error;
+    }
+
+    TransportError ZMQProxy::stats(Stats &stats, int timeoutMs)
+    {
+        std::lock_guard<std::mutex> lock(controlMutex_);
+        if (!control_ || !running_.load())
+        {
+            return TransportError::NotConnected;
+        }
+
+        try
+        {
+            // Discard a reply that arrived after an earlier call timed out
+            zmq::message_t stale;
+            while (control_->recv(stale, zmq::recv_flags::dontwait))
+            {
+            }
+
+            if (!control_->send(zmq::str_buffer("STATISTICS"), zmq::send_flags::dontwait))
+            {
+                return TransportError::SendFailed;
+            }
+
+            zmq::pollitem_t item = {control_->handle(), 0, ZMQ_POLLIN, 0};
+            if (zmq::poll(&item, 1, std::chrono::milliseconds(timeoutMs)) <= 0)
+            {
+                return TransportError::Timeout;
+            }
+
+            // zmq::proxy_steerable replies with 8 parts, the header-routing loop with 11
+            uint64_t values[STATISTICS_PARTS] = {};
+            for (size_t i = 0; i < STATISTICS_PARTS; ++i)
+            {
+                zmq::message_t part;
+                if (!control_->recv(part, zmq::recv_flags::none))
+                {
+                    return TransportError::ReceiveFailed;
+                }
+                if (part.size() == sizeof(uint64_t))
+                {
+                    std::memcpy(&values[i], part.data(), sizeof(uint64_t));
+                }
+                if (!part.more())
+                {
+                    break;
+                }
+            }
 
-        // Recreate context for potential restart
-        context_ = std::make_unique<zmq::context_t>(config_.ioThreads);
+            stats.frontendReceived = {values[0], values[1]};
+            stats.frontendSent = {values[2], values[3]};
+            stats.backendReceived = {values[4], values[5]};
+            stats.backendSent = {values[6], values[7]};
+            stats.dropped = values[8];
+            stats.unroutable = values[9];
+            stats.malformed = values[10];
+        }
+        catch (const zmq::error_t &e)
+        {
+            handleError(e, TransportOperation::Receive, "proxy stats");
+            return TransportError::ReceiveFailed;
+        }
+        return TransportError::None;
     }
 
     zmq::socket_type ZMQProxy::getFrontendSocketType() const
@@ -153,105 +529,183 @@ namespace limp
         }
     }
 
-    void ZMQProxy::handleError(const zmq::error_t &error, const std::string &context)
+    void ZMQProxy::handleError(const zmq::error_t &e, TransportOperation operation, const char *context)
     {
-        if (errorCallback_)
-        {
-            std::string errorMsg = context;
-            if (error.num() != 0)
-            {
-                errorMsg += ": " + std::string(error.what());
-            }
-            errorCallback_(errorMsg);
-        }
+        std::lock_guard<std::mutex> lock(errorMutex_);
+        errors_.report(ErrorEvent{zmq_internal::errorFor(operation), operation, e.num(), context, e.what()});
+    }
+
+    void ZMQProxy::handleError(TransportError error, TransportOperation operation, const char *context,
+                               const char *reason)
+    {
+        std::lock_guard<std::mutex> lock(errorMutex_);
+        errors_.report(ErrorEvent{error, operation, 0, context, reason});
     }
 
-    void ZMQProxy::proxyThread()
+    void ZMQProxy::proxyThread(zmq::socket_t frontend, zmq::socket_t backend, zmq::socket_t control,
+                               zmq::socket_t capture)
     {
+        const bool capturing = capture.handle() != nullptr;
         try
         {
-            // Create frontend socket
-            zmq::socket_t frontend(*context_, getFrontendSocketType());
-
-            // Configure frontend socket
-            frontend.set(zmq::sockopt::linger, config_.lingerTime);
-            if (config_.sendTimeout >= 0)
-            {
-                frontend.set(zmq::sockopt::sndtimeo, config_.sendTimeout);
-            }
-            if (config_.receiveTimeout >= 0)
+            if (hasHeaderRouting())
             {
-                frontend.set(zmq::sockopt::rcvtimeo, config_.receiveTimeout);
-            }
-
-            // Bind or connect frontend
-            if (frontendBind_)
-            {
-                frontend.bind(frontendEndpoint_);
+                routeLoop(frontend, backend, control, capturing ? &capture : nullptr);
             }
             else
             {
-                frontend.connect(frontendEndpoint_);
-            }
-
-            // Create backend socket
-            zmq::socket_t backend(*context_, getBackendSocketType());
-
-            // Configure backend socket
-            backend.set(zmq::sockopt::linger, config_.lingerTime);
-            if (config_.sendTimeout >= 0)
-            {
-                backend.set(zmq::sockopt::sndtimeo, config_.sendTimeout);
+                // Blocks until TERMINATE or context terminated
+                zmq::proxy_steerable(zmq::socket_ref(frontend), zmq::socket_ref(backend),
+                                     capturing ? zmq::socket_ref(capture) : zmq::socket_ref(),
+                                     zmq::socket_ref(control));
             }
-            if (config_.receiveTimeout >= 0)
-            {
-                backend.set(zmq::sockopt::rcvtimeo, config_.receiveTimeout);
-            }
-
-            // Bind or connect backend
-            if (backendBind_)
+        }
+        catch (const zmq::error_t &e)
+        {
+            // Check if this is due to stop request (context termination)
+            if (e.num() != ETERM && !stopRequested_.load())
             {
-                backend.bind(backendEndpoint_);
+                handleError(e, TransportOperation::Unknown, "proxy thread");
             }
-            else
+        }
+        catch (const std::exception &)
+        {
+            if (!stopRequested_.load())
             {
-                backend.connect(backendEndpoint_);
+                handleError(TransportError::InternalError, TransportOperation::Unknown, "proxy thread",
+                            "unexpected exception");
             }
+        }
 
-            running_ = true;
+        running_ = false;
+    }
 
-            // Run proxy with optional capture socket
-            if (!captureEndpoint_.empty())
+    void ZMQProxy::routeLoop(zmq::socket_t &frontend, zmq::socket_t &backend,
+                             zmq::socket_t &control, zmq::socket_t *capture)
+    {
+        zmq::pollitem_t items[] = {
+            {frontend.handle(), 0, ZMQ_POLLIN, 0},
+            {backend.handle(), 0, ZMQ_POLLIN, 0},
+            {control.handle(), 0, ZMQ_POLLIN, 0}};
+        zmq::socket_t *sides[] = {&frontend, &backend};
+        std::vector<zmq::message_t> parts(4);
+        Stats stats;
+        Counters *received[] = {&stats.frontendReceived, &stats.backendReceived};
+        Counters *sent[] = {&stats.frontendSent, &stats.backendSent};
+        bool paused = false;
+
+        while (true)
+        {
+            // While paused only the control socket is watched
+            if (paused)
             {
-                zmq::socket_t capture(*context_, zmq::socket_type::pub);
-                capture.bind(captureEndpoint_);
-
-                // Run proxy with capture (blocks until context terminated)
-                zmq::proxy(zmq::socket_ref(frontend), zmq::socket_ref(backend), zmq::socket_ref(capture));
+                zmq::poll(&items[2], 1, std::chrono::milliseconds(-1));
+                items[0].revents = 0;
+                items[1].revents = 0;
             }
             else
             {
-                // Run proxy (blocks until context terminated)
-                zmq::proxy(zmq::socket_ref(frontend), zmq::socket_ref(backend));
+                zmq::poll(items, 3, std::chrono::milliseconds(-1));
             }
-        }
-        catch (const zmq::error_t &e)
-        {
-            // Check if this is due to stop request (context termination)
-            if (e.num() != ETERM && !stopRequested_.load())
+
+            if (items[2].revents & ZMQ_POLLIN)
             {
-                handleError(e, "proxy thread error");
+                zmq::message_t command;
+                if (control.recv(command, zmq::recv_flags::dontwait))
+                {
+                    if (isCommand(command, "TERMINATE"))
+                    {
+                        return;
+                    }
+                    if (isCommand(command, "PAUSE"))
+                    {
+                        paused = true;
+                    }
+                    else if (isCommand(command, "RESUME"))
+                    {
+                        paused = false;
+                    }
+                    else if (isCommand(command, "STATISTICS"))
+                    {
+                        sendStatistics(control, stats);
+                    }
+                }
             }
-        }
-        catch (const std::exception &e)
-        {
-            if (errorCallback_ && !stopRequested_.load())
+
+            for (size_t side = 0; side < 2; ++side)
             {
-                errorCallback_(std::string("proxy thread exception: ") + e.what());
+                if (!(items[side].revents & ZMQ_POLLIN))
+                {
+                    continue;
+                }
+
+                zmq::socket_t &input = *sides[side];
+                zmq::socket_t &opposite = *sides[1 - side];
+                for (size_t n = 0; n < ROUTE_BATCH; ++n)
+                {
+                    // [source][delimiter][data] or [source][destination][delimiter][data]
+                    size_t count = zmq_internal::receiveMultipart(input, parts);
+                    if (count == 0)
+                    {
+                        break;
+                    }
+                    received[side]->messages += count;
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        received[side]->bytes += parts[i].size();
+                    }
+
+                    zmq::message_t &data = parts[count - 1];
+                    if ((count != 3 && count != 4) || data.size() < HEADER_SIZE)
+                    {
+                        ++stats.malformed;
+                        continue;
+                    }
+
+                    // Only the header is read; payload and CRC are forwarded untouched
+                    const uint8_t *destination = nullptr;
+                    size_t destinationSize = 0;
+                    if (const PeerId *route = findRoute(FrameView(static_cast<const uint8_t *>(data.data()),
+                                                                  data.size())))
+                    {
+                        destination = route->data();
+                        destinationSize = route->size();
+                    }
+                    else if (count == 4 && parts[1].size() > 0)
+                    {
+                        destination = static_cast<const uint8_t *>(parts[1].data());
+                        destinationSize = parts[1].size();
+                    }
+                    else
+                    {
+                        ++stats.unroutable;
+                        continue;
+                    }
+
+                    if (capture)
+                    {
+                        zmq::message_t copy;
+                        copy.copy(data);
+                        capture->send(copy, zmq::send_flags::dontwait);
+                    }
+
+                    RouteResult result = routeTo(opposite, destination, destinationSize, parts[0], data,
+                                                 *sent[1 - side]);
+                    if (result == RouteResult::Unreachable)
+                    {
+                        result = routeTo(input, destination, destinationSize, parts[0], data, *sent[side]);
+                    }
+                    if (result == RouteResult::Full)
+                    {
+                        ++stats.dropped;
+                    }
+                    else if (result == RouteResult::Unreachable)
+                    {
+                        ++stats.unroutable;
+                    }
+                }
             }
         }
-
-        running_ = false;
     }
 
 } // namespace limp
@@ -0,0 +1,186 @@
+#include "limp/zmq/zmq_proxy_cluster.hpp"
+#include <cstdint>
+
+namespace limp
+{
+
+    namespace
+    {
+        void add(ZMQProxy::Counters &total, const ZMQProxy::Counters &shard)
+        {
+            total.messages += shard.messages;
+            total.bytes += shard.bytes;
+        }
+    } // namespace
+
+    ZMQProxyCluster::ZMQProxyCluster(const ZMQConfig &config)
+        : config_(config), errors_("ZMQ"), running_(false)
+    {
+    }
+
+    ZMQProxyCluster::~ZMQProxyCluster()
+    {
+        stop();
+    }
+
+    TransportError ZMQProxyCluster::addShard(const std::string &frontendEndpoint,
+                                             const std::string &backendEndpoint, bool bind)
+    {
+        if (running_)
+        {
+            handleError(TransportError::ConfigurationError, TransportOperation::Setup, "cluster add shard",
+                        "cluster is running");
+            return TransportError::ConfigurationError;
+        }
+
+        if (frontendEndpoint.empty() || backendEndpoint.empty())
+        {
+            handleError(TransportError::InvalidEndpoint, TransportOperation::Setup, "cluster add shard",
+                        "frontend and backend endpoints must be set");
+            return TransportError::InvalidEndpoint;
+        }
+
+        auto proxy = std::make_unique<ZMQProxy>(ZMQProxy::ProxyType::XPUB_XSUB, config_);
+        proxy->setErrorEventCallback([this](const ErrorEvent &event) { report(event); });
+        proxy->setFrontend(frontendEndpoint, bind);
+        proxy->setBackend(backendEndpoint, bind);
+        shards_.push_back(std::move(proxy));
+        return TransportError::None;
+    }
+
+    void ZMQProxyCluster::setErrorCallback(std::function<void(const std::string &)> callback)
+    {
+        std::lock_guard<std::mutex> lock(errorMutex_);
+        errors_.setMessageCallback(std::move(callback));
+    }
+
+    void ZMQProxyCluster::setErrorEventCallback(ErrorEventCallback callback)
+    {
+        std::lock_guard<std::mutex> lock(errorMutex_);
+        errors_.setEventCallback(std::move(callback));
+    }
+
+    TransportError ZMQProxyCluster::start()
+    {
+        if (running_ || shards_.empty())
+        {
+            handleError(TransportError::ConfigurationError, TransportOperation::Setup, "cluster start",
+                        running_ ? "already running" : "no shards added");
+            return TransportError::ConfigurationError;
+        }
+
+        for (size_t i = 0; i < shards_.size(); ++i)
+        {
+            // ZMQProxy::start() binds on this thread, so a busy endpoint fails here
+            TransportError error = shards_[i]->start();
+            if (error != TransportError::None)
+            {
+                while (i > 0)
+                {
+                    shards_[--i]->stop();
+                }
+                return error;
+            }
+        }
+
+        running_ = true;
+        return TransportError::None;
+    }
+
+    void ZMQProxyCluster::stop()
+    {
+        for (auto &shard : shards_)
+        {
+            shard->stop();
+        }
+        running_ = false;
+    }
+
+    size_t ZMQProxyCluster::shardFor(std::string_view topic) const noexcept
+    {
+        if (shards_.empty())
+        {
+            return 0;
+        }
+
+        uint64_t h = 14695981039346656037ull;
+        for (char c : topic)
+        {
+            h = (h ^ static_cast<uint8_t>(c)) * 1099511628211ull;
+        }
+        return static_cast<size_t>(h % shards_.size());
+    }
+
+    TransportError ZMQProxyCluster::pause()
+    {
+        TransportError result = TransportError::None;
+        for (auto &shard : shards_)
+        {
+            TransportError error = shard->pause();
+            if (result == TransportError::None)
+            {
+                result = error;
+            }
+        }
+        return result;
+    }
+
+    TransportError ZMQProxyCluster::resume()
+    {
+        TransportError result = TransportError::None;
+        for (auto &shard : shards_)
+        {
+            TransportError error = shard->resume();
+            if (result == TransportError::None)
+            {
+                result = error;
+            }
+        }
+        return result;
+    }
+
+    TransportError ZMQProxyCluster::stats(size_t shard, ZMQProxy::Stats &stats, int timeoutMs)
+    {
+        if (shard >= shards_.size())
+        {
+            return TransportError::ConfigurationError;
+        }
+        return shards_[shard]->stats(stats, timeoutMs);
+    }
+
+    TransportError ZMQProxyCluster::stats(ZMQProxy::Stats &stats, int timeoutMs)
+    {
+        ZMQProxy::Stats total;
+        for (auto &shard : shards_)
+        {
+            ZMQProxy::Stats shardStats;
+            TransportError error = shard->stats(shardStats, timeoutMs);
+            if (error != TransportError::None)
+            {
+                return error;
+            }
+            add(total.frontendReceived, shardStats.frontendReceived);
+            add(total.frontendSent, shardStats.frontendSent);
+            add(total.backendReceived, shardStats.backendReceived);
+            add(total.backendSent, shardStats.backendSent);
+            total.dropped += shardStats.dropped;
+            total.unroutable += shardStats.unroutable;
+            total.malformed += shardStats.malformed;
+        }
+        stats = total;
+        return TransportError::None;
+    }
+
+    void ZMQProxyCluster::handleError(TransportError error, TransportOperation operation, const char *context,
+                                      const char *reason)
+    {
+        report(ErrorEvent{error, operation, 0, context, reason});
+    }
+
+    void ZMQProxyCluster::report(const ErrorEvent &event)
+    {
+        std::lock_guard<std::mutex> lock(errorMutex_);
+        errors_.report(event);
+    }
+
+} // namespace limp
@@ -25,7 +25,7 @@ namespace limp
         }
         catch (const zmq::error_t &e)
         {
-            handleError(e, "publisher bind");
+            handleError(e, TransportOperation::Bind, "publisher bind");
             return TransportError::BindFailed;
         }
     }
@@ -37,46 +37,136 @@ namespace limp
             return TransportError::NotConnected;
         }
 
+        // [topic][data], or [data] alone for an empty topic
+        zmq::message_t parts[2];
         try
         {
-            // Send topic as first part (if not empty)
-            if (!topic.empty())
-            {
-                zmq::message_t topicMsg(topic.data(), topic.size());
-                auto result = socket_->send(topicMsg, zmq::send_flags::sndmore);
-                if (!result)
-                {
-                    return TransportError::SendFailed;
-                }
-            }
-
-            // Send data as second part
-            zmq::message_t dataMsg(data, size);
-            auto result = socket_->send(dataMsg, zmq::send_flags::none);
-            return result.has_value() ? TransportError::None : TransportError::SendFailed;
+            parts[0].rebuild(topic.data(), topic.size());
+            parts[1].rebuild(data, size);
         }
         catch (const zmq::error_t &e)
         {
-            handleError(e, "publisher send");
+            handleError(e, TransportOperation::Send, "publisher send");
             return TransportError::SendFailed;
         }
+
+        return topic.empty() ? sendParts(&parts[1], 1, "publisher send") : sendParts(parts, 2, "publisher send");
     }
 
     TransportError ZMQPublisher::publish(const std::string &topic, const Frame &frame)
     {
-        std::vector<uint8_t> buffer;
-        if (!serializeFrame(frame, buffer))
+        return publishWithTopic(topic.data(), topic.size(), frame);
+    }
+
+    TransportError ZMQPublisher::publish(const Topic &topic, const Frame &frame)
+    {
+        return publishWithTopic(topic.data(), topic.size(), frame);
+    }
+
+    TransportError ZMQPublisher::publish(const Frame &frame)
+    {
+        const Topic topic = Topic::forFrame(frame);
+        return publishWithTopic(topic.data(), topic.size(), frame);
+    }
+
+    TransportError ZMQPublisher::publishWithTopic(const void *topic, size_t size, const Frame &frame, bool record)
+    {
+        if (!isConnected())
+        {
+            return TransportError::NotConnected;
+        }
+
+        // [topic][data], or just [data] when the topic is empty
+        zmq::message_t parts[2];
+        if (!serializeToMessage(frame, parts[1]))
         {
             return TransportError::SerializationFailed;
         }
-        
-        return publishRaw(topic, buffer.data(), buffer.size());
+
+        if (size != 0)
+        {
+            try
+            {
+                parts[0].rebuild(topic, size);
+            }
+            catch (const zmq::error_t &e)
+            {
+                handleError(e, TransportOperation::Send, "publisher send");
+                return TransportError::SendFailed;
+            }
+        }
+
+        TransportError error = size == 0 ? sendParts(&parts[1], 1, "publisher send")
+                                         : sendParts(parts, 2, "publisher send");
+        // Cache only what subscribers could actually have seen
+        if (error == TransportError::None && record && cache_)
+        {
+            cache_->update(frame);
+        }
+        return error;
+    }
+
+    TransportError ZMQPublisher::publishBatch(const std::string &topic, Span<const Frame> frames, size_t &sent)
+    {
+        // [topic][data] per frame, or just [data] when the topic is empty
+        const ByteSpan envelope[] = {
+            ByteSpan(reinterpret_cast<const uint8_t *>(topic.data()), topic.size())};
+        TransportError error = sendFrameBatch(Span<const ByteSpan>(envelope, topic.empty() ? 0 : 1),
+                                              frames, sent, "publisher send batch");
+        if (cache_)
+        {
+            for (size_t i = 0; i < sent; ++i)
+            {
+                cache_->update(frames[i]);
+            }
+        }
+        return error;
+    }
+
+    TransportError ZMQPublisher::publishBatch(Span<const Frame> frames, size_t &sent)
+    {
+        sent = 0;
+        for (const Frame &frame : frames)
+        {
+            TransportError error = publish(frame);
+            if (error != TransportError::None)
+            {
+                return error;
+            }
+            ++sent;
+        }
+        return TransportError::None;
+    }
+
+    TransportError ZMQPublisher::publishSnapshot(size_t &sent, const Topic &filter)
+    {
+        sent = 0;
+        if (!cache_)
+        {
+            handleError(TransportError::ConfigurationError, TransportOperation::Send, "publisher snapshot", "no last-value cache set");
+            return TransportError::ConfigurationError;
+        }
+
+        std::vector<Frame> frames;
+        cache_->snapshot(frames, filter);
+        for (const Frame &frame : frames)
+        {
+            // Already the cached values; do not record them again
+            const Topic topic = Topic::forFrame(frame);
+            TransportError error = publishWithTopic(topic.data(), topic.size(), frame, false);
+            if (error != TransportError::None)
+            {
+                return error;
+            }
+            ++sent;
+        }
+        return TransportError::None;
     }
 
     TransportError ZMQPublisher::send(const Frame &frame)
     {
         (void)frame;
-        handleError(zmq::error_t(), "publisher: use publish() instead of send()");
+        handleError(TransportError::InternalError, TransportOperation::Send, "publisher send", "use publish() instead of send()");
         return TransportError::InternalError;
     }
 
@@ -84,7 +174,7 @@ namespace limp
     {
         (void)data;
         (void)size;
-        handleError(zmq::error_t(), "publisher: use publishRaw() instead of sendRaw()");
+        handleError(TransportError::InternalError, TransportOperation::Send, "publisher sendRaw", "use publishRaw() instead of sendRaw()");
         return TransportError::InternalError;
     }
 
@@ -92,15 +182,23 @@ namespace limp
     {
         (void)buffer;
         (void)maxSize;
-        handleError(zmq::error_t(), "publisher: publishers cannot receive, only publish");
+        handleError(TransportError::InternalError, TransportOperation::Receive, "publisher receive", "publishers cannot receive, only publish");
         return -1; // Publishers don't receive
     }
 
+    TransportError ZMQPublisher::receiveView(FrameView &view, int timeoutMs)
+    {
+        (void)view;
+        (void)timeoutMs;
+        handleError(TransportError::InternalError, TransportOperation::Receive, "publisher receive", "publishers cannot receive, only publish");
+        return TransportError::InternalError; // Publishers don't receive
+    }
+
     TransportError ZMQPublisher::receive(Frame &frame, int timeoutMs)
     {
         (void)frame;
         (void)timeoutMs;
-        handleError(zmq::error_t(), "publisher: publishers cannot receive, only publish");
+        handleError(TransportError::InternalError, TransportOperation::Receive, "publisher receive", "publishers cannot receive, only publish");
         return TransportError::InternalError; // Publishers don't receive
     }
 
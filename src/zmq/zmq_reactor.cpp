@@ -0,0 +1,226 @@
+#include "limp/zmq/zmq_reactor.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <thread>
+
+namespace limp
+{
+
+    ZMQReactor::ZMQReactor()
+        : errors_("ZMQ"), stopRequested_(false), dispatching_(false), removed_(false)
+    {
+    }
+
+    void ZMQReactor::add(ZMQTransport &transport, FrameCallback callback)
+    {
+        Registration registration{&transport, Kind::Decoded, std::move(callback), {}, {}, true};
+        insert(std::move(registration));
+    }
+
+    void ZMQReactor::addView(ZMQTransport &transport, FrameViewCallback callback)
+    {
+        Registration registration{&transport, Kind::View, {}, std::move(callback), {}, true};
+        insert(std::move(registration));
+    }
+
+    void ZMQReactor::addHandler(ZMQTransport &transport, ReadableCallback callback)
+    {
+        Registration registration{&transport, Kind::Handler, {}, {}, std::move(callback), true};
+        insert(std::move(registration));
+    }
+
+    void ZMQReactor::insert(Registration registration)
+    {
+        remove(*registration.transport);
+        registrations_.push_back(std::make_unique<Registration>(std::move(registration)));
+    }
+
+    bool ZMQReactor::remove(ZMQTransport &transport)
+    {
+        bool found = false;
+        for (auto &registration : registrations_)
+        {
+            if (registration->active && registration->transport == &transport)
+            {
+                // Erased after dispatch; the callback may be the one running
+                registration->active = false;
+                found = true;
+            }
+        }
+
+        if (found)
+        {
+            removed_ = true;
+            if (!dispatching_)
+            {
+                purge();
+            }
+        }
+        return found;
+    }
+
+    size_t ZMQReactor::size() const noexcept
+    {
+        return static_cast<size_t>(std::count_if(registrations_.begin(), registrations_.end(),
+                                                 [](const std::unique_ptr<Registration> &registration)
+                                                 { return registration->active; }));
+    }
+
+    void ZMQReactor::setErrorCallback(ErrorCallback callback)
+    {
+        errors_.setMessageCallback(std::move(callback));
+    }
+
+    void ZMQReactor::setErrorEventCallback(ErrorEventCallback callback)
+    {
+        errors_.setEventCallback(std::move(callback));
+    }
+
+    void ZMQReactor::purge()
+    {
+        registrations_.erase(std::remove_if(registrations_.begin(), registrations_.end(),
+                                            [](const std::unique_ptr<Registration> &registration)
+                                            { return !registration->active; }),
+                             registrations_.end());
+        removed_ = false;
+    }
+
+    void ZMQReactor::reportError(TransportError error, int errnum, const char *context, const char *reason)
+    {
+        errors_.report(ErrorEvent{error, TransportOperation::Receive, errnum, context, reason});
+    }
+
+    int ZMQReactor::poll(int timeoutMs)
+    {
+        // Rebuild the poll set from live sockets (storage is reused between polls)
+        items_.clear();
+        itemOwners_.clear();
+        for (auto &registration : registrations_)
+        {
+            ZMQTransport &transport = *registration->transport;
+            if (registration->active && transport.isConnected())
+            {
+                items_.push_back({transport.socket_->handle(), 0, ZMQ_POLLIN, 0});
+                itemOwners_.push_back(registration.get());
+            }
+        }
+
+        if (items_.empty())
+        {
+            // Nothing to watch; honor the timeout so run() does not spin
+            if (timeoutMs > 0)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMs));
+            }
+            return 0;
+        }
+
+        try
+        {
+            if (zmq::poll(items_.data(), items_.size(), std::chrono::milliseconds(timeoutMs)) <= 0)
+            {
+                return 0;
+            }
+        }
+        catch (const zmq::error_t &e)
+        {
+            if (e.num() == EINTR)
+            {
+                return 0; // Interrupted by a signal; the caller polls again
+            }
+            reportError(TransportError::ReceiveFailed, e.num(), "reactor poll", e.what());
+            return -1;
+        }
+
+        // Ends dispatch even when a callback throws, so later removals are not deferred forever
+        struct DispatchScope
+        {
+            ZMQReactor &reactor;
+            ~DispatchScope()
+            {
+                reactor.dispatching_ = false;
+                if (reactor.removed_)
+                {
+                    reactor.purge();
+                }
+            }
+        };
+
+        size_t dispatched = 0;
+        dispatching_ = true;
+        DispatchScope scope{*this};
+        for (size_t i = 0; i < items_.size(); ++i)
+        {
+            Registration &registration = *itemOwners_[i];
+            if ((items_[i].revents & ZMQ_POLLIN) && registration.active)
+            {
+                dispatched += dispatch(registration);
+            }
+        }
+        return static_cast<int>(dispatched);
+    }
+
+    size_t ZMQReactor::dispatch(Registration &registration)
+    {
+        ZMQTransport &transport = *registration.transport;
+
+        if (registration.kind == Kind::Handler)
+        {
+            registration.onReadable();
+            return 1;
+        }
+
+        size_t count = 0;
+        while (count < DISPATCH_BATCH && registration.active)
+        {
+            TransportError error;
+            if (registration.kind == Kind::Decoded)
+            {
+                error = transport.receive(frame_, 0);
+                if (error == TransportError::None)
+                {
+                    registration.onFrame(frame_);
+                }
+            }
+            else
+            {
+                FrameView view;
+                error = transport.receiveView(view, 0);
+                if (error == TransportError::None)
+                {
+                    registration.onView(view);
+                }
+            }
+
+            if (error == TransportError::Timeout)
+            {
+                break; // Queue drained
+            }
+            if (error != TransportError::None)
+            {
+                reportError(error, 0, "reactor receive", nullptr);
+                if (error != TransportError::DeserializationFailed)
+                {
+                    break;
+                }
+                // Bad frame consumed; it counts against the batch so a flood cannot starve other sockets
+            }
+            ++count;
+        }
+        return count;
+    }
+
+    void ZMQReactor::run(int pollIntervalMs)
+    {
+        while (!stopRequested_.load())
+        {
+            if (poll(pollIntervalMs) < 0)
+            {
+                break;
+            }
+        }
+        stopRequested_ = false;
+    }
+
+} // namespace limp
@@ -1,5 +1,4 @@
 #include "limp/zmq/zmq_router.hpp"
-#include <cstring>
 
 namespace limp
 {
@@ -26,317 +25,404 @@ namespace limp
         }
         catch (const zmq::error_t &e)
         {
-            handleError(e, "router bind");
+            handleError(e, TransportOperation::Bind, "router bind");
             return TransportError::BindFailed;
         }
     }
 
     std::ptrdiff_t ZMQRouter::receiveRaw(std::vector<uint8_t> &identity,
                                          uint8_t *buffer,
-                                         size_t maxSize)
+                                         size_t maxSize,
+                                         int timeoutMs)
     {
-        if (!isConnected())
+        // [identity][delimiter][data]
+        std::ptrdiff_t parts = receiveParts(3, "router receive", timeoutMs);
+        if (parts <= 0)
         {
-            return -1;
+            return parts;
         }
 
-        try
-        {
-            // Receive all message parts
-            std::vector<zmq::message_t> parts;
+        ByteSpan identityBytes = partBytes(0);
+        identity.assign(identityBytes.begin(), identityBytes.end());
+        return copyPart(2, buffer, maxSize);
+    }
 
-            while (true)
-            {
-                zmq::message_t msg;
-                auto result = socket_->recv(msg, zmq::recv_flags::none);
+    TransportError ZMQRouter::receive(std::string &sourceIdentity,
+                            Frame &frame,
+                            int timeoutMs)
+    {
+        ByteSpan source;
+        FrameView view;
+        TransportError error = receiveView(source, view, timeoutMs);
+        if (error != TransportError::None)
+        {
+            return error;
+        }
 
-                if (!result)
-                {
-                    return 0;
-                }
+        sourceIdentity.assign(reinterpret_cast<const char *>(source.data()), source.size());
+        return view.toFrame(frame) ? TransportError::None : TransportError::DeserializationFailed;
+    }
 
-                parts.push_back(std::move(msg));
+    std::ptrdiff_t ZMQRouter::receiveRaw(std::vector<uint8_t> &sourceIdentity,
+                                         std::vector<uint8_t> &destinationIdentity,
+                                         uint8_t *buffer,
+                                         size_t maxSize,
+                                         int timeoutMs)
+    {
+        // [source_identity][destination_identity][delimiter][data]
+        std::ptrdiff_t parts = receiveParts(4, "router receive", timeoutMs);
+        if (parts <= 0)
+        {
+            return parts;
+        }
 
-                auto more = socket_->get(zmq::sockopt::rcvmore);
-                if (!more)
-                {
-                    break;
-                }
-            }
+        ByteSpan sourceBytes = partBytes(0);
+        sourceIdentity.assign(sourceBytes.begin(), sourceBytes.end());
 
-            if (parts.size() != 3)
-            {
-                handleError(zmq::error_t(), "router receive: expected 3 parts, got " + std::to_string(parts.size()));
-                return -1;
-            }
+        ByteSpan destinationBytes = partBytes(1);
+        destinationIdentity.assign(destinationBytes.begin(), destinationBytes.end());
 
-            const auto &identityMsg = parts[0];
-            identity.assign(static_cast<const uint8_t *>(identityMsg.data()),
-                            static_cast<const uint8_t *>(identityMsg.data()) + identityMsg.size());
+        return copyPart(3, buffer, maxSize);
+    }
 
-            const auto &dataMsg = parts[2];
-            size_t receivedSize = dataMsg.size();
+    TransportError ZMQRouter::receiveView(ByteSpan &sourceIdentity,
+                                          FrameView &view,
+                                          int timeoutMs)
+    {
+        std::ptrdiff_t parts = receiveParts(3, "router receive", timeoutMs);
+        if (parts < 0)
+        {
+            return TransportError::ReceiveFailed;
+        }
+        if (parts == 0)
+        {
+            return TransportError::Timeout;
+        }
 
-            if (receivedSize > maxSize)
-            {
-                handleError(zmq::error_t(), "received message larger than buffer");
-                return -1;
-            }
+        sourceIdentity = partBytes(0);
+        return viewPart(2, view);
+    }
 
-            std::memcpy(buffer, dataMsg.data(), receivedSize);
-            return static_cast<std::ptrdiff_t>(receivedSize);
+    TransportError ZMQRouter::receiveView(ByteSpan &sourceIdentity,
+                                          ByteSpan &destinationIdentity,
+                                          FrameView &view,
+                                          int timeoutMs)
+    {
+        std::ptrdiff_t parts = receiveParts(4, "router receive", timeoutMs);
+        if (parts < 0)
+        {
+            return TransportError::ReceiveFailed;
         }
-        catch (const zmq::error_t &e)
+        if (parts == 0)
         {
-            handleError(e, "router receive");
-            return -1;
+            return TransportError::Timeout;
         }
+
+        sourceIdentity = partBytes(0);
+        destinationIdentity = partBytes(1);
+        return viewPart(3, view);
     }
 
     TransportError ZMQRouter::receive(std::string &sourceIdentity,
+                            std::string &destinationIdentity,
                             Frame &frame,
                             int timeoutMs)
     {
-        (void)timeoutMs; // Timeout is set via socket options
+        ByteSpan source;
+        ByteSpan destination;
+        FrameView view;
+        TransportError error = receiveView(source, destination, view, timeoutMs);
+        if (error != TransportError::None)
+        {
+            return error;
+        }
+
+        sourceIdentity.assign(reinterpret_cast<const char *>(source.data()), source.size());
+        destinationIdentity.assign(reinterpret_cast<const char *>(destination.data()), destination.size());
+        return view.toFrame(frame) ? TransportError::None : TransportError::DeserializationFailed;
+    }
 
-        std::vector<uint8_t> identityVec;
-        std::vector<uint8_t> buffer(4096); // Initial buffer size
-        std::ptrdiff_t received = receiveRaw(identityVec, buffer.data(), buffer.size());
-        
-        if (received < 0)
+    namespace
+    {
+        ByteSpan bytesOf(const std::string &identity) noexcept
         {
-            return TransportError::ReceiveFailed;
+            return ByteSpan(reinterpret_cast<const uint8_t *>(identity.data()), identity.size());
         }
-        if (received == 0)
+
+        ByteSpan bytesOf(const std::vector<uint8_t> &identity) noexcept
         {
-            return TransportError::Timeout;
+            return ByteSpan(identity.data(), identity.size());
         }
-        
-        // Convert identity vector to string
-        sourceIdentity.assign(identityVec.begin(), identityVec.end());
-        buffer.resize(static_cast<size_t>(received));
-        
-        if (!deserializeFrame(buffer, frame))
+
+        ByteSpan bytesOf(const PeerId &identity) noexcept
         {
-            return TransportError::DeserializationFailed;
+            return ByteSpan(identity.data(), identity.size());
         }
-        
-        return TransportError::None;
-    }
+    } // namespace
 
-    std::ptrdiff_t ZMQRouter::receiveRaw(std::vector<uint8_t> &sourceIdentity,
-                                         std::vector<uint8_t> &destinationIdentity,
-                                         uint8_t *buffer,
-                                         size_t maxSize)
+    TransportError ZMQRouter::sendEnvelope(Span<const ByteSpan> envelope, zmq::message_t &body)
     {
         if (!isConnected())
         {
-            return -1;
+            return TransportError::NotConnected;
         }
 
+        // [client_identity][source_identity]?[delimiter][data]
+        zmq::message_t parts[MAX_ENVELOPE_PARTS + 1];
         try
         {
-            // Receive all message parts
-            std::vector<zmq::message_t> parts;
-
-            while (true)
+            for (size_t i = 0; i < envelope.size(); ++i)
             {
-                zmq::message_t msg;
-                auto result = socket_->recv(msg, zmq::recv_flags::none);
-
-                if (!result)
-                {
-                    return 0;
-                }
-
-                parts.push_back(std::move(msg));
-
-                // Check if more parts are coming
-                auto more = socket_->get(zmq::sockopt::rcvmore);
-                if (!more)
+                if (!envelope[i].empty())
                 {
-                    break;
+                    parts[i].rebuild(envelope[i].data(), envelope[i].size());
                 }
             }
+        }
+        catch (const zmq::error_t &e)
+        {
+            handleError(e, TransportOperation::Send, "router send");
+            return TransportError::SendFailed;
+        }
+        parts[envelope.size()].move(body);
 
-            if (parts.size() != 4)
-            {
-                handleError(zmq::error_t(), "router receive: expected 4 parts, got " + std::to_string(parts.size()));
-                return -1;
-            }
-
-            const auto &srcIdentityMsg = parts[0];
-            sourceIdentity.assign(static_cast<const uint8_t *>(srcIdentityMsg.data()),
-                                  static_cast<const uint8_t *>(srcIdentityMsg.data()) + srcIdentityMsg.size());
-
-            const auto &destIdentityMsg = parts[1];
-            destinationIdentity.assign(static_cast<const uint8_t *>(destIdentityMsg.data()),
-                                       static_cast<const uint8_t *>(destIdentityMsg.data()) + destIdentityMsg.size());
+        return sendParts(parts, envelope.size() + 1, "router send");
+    }
 
-            const auto &dataMsg = parts[3];
-            size_t receivedSize = dataMsg.size();
+    TransportError ZMQRouter::sendRaw(const std::vector<uint8_t> &identity,
+                            const uint8_t *data,
+                            size_t size)
+    {
+        zmq::message_t body;
+        try
+        {
+            body.rebuild(data, size);
+        }
+        catch (const zmq::error_t &e)
+        {
+            handleError(e, TransportOperation::Send, "router send");
+            return TransportError::SendFailed;
+        }
 
-            if (receivedSize > maxSize)
-            {
-                handleError(zmq::error_t(), "received message larger than buffer");
-                return -1;
-            }
+        const ByteSpan envelope[] = {bytesOf(identity), ByteSpan()};
+        return sendEnvelope(envelope, body);
+    }
 
-            std::memcpy(buffer, dataMsg.data(), receivedSize);
-            return static_cast<std::ptrdiff_t>(receivedSize);
+    TransportError ZMQRouter::sendRaw(const std::vector<uint8_t> &clientIdentity,
+                            const std::vector<uint8_t> &sourceIdentity,
+                            const uint8_t *data,
+                            size_t size)
+    {
+        zmq::message_t body;
+        try
+        {
+            body.rebuild(data, size);
         }
         catch (const zmq::error_t &e)
         {
-            handleError(e, "router receive");
-            return -1;
+            handleError(e, TransportOperation::Send, "router send");
+            return TransportError::SendFailed;
         }
+
+        const ByteSpan envelope[] = {bytesOf(clientIdentity), bytesOf(sourceIdentity), ByteSpan()};
+        return sendEnvelope(envelope, body);
     }
 
-    TransportError ZMQRouter::receive(std::string &sourceIdentity,
-                            std::string &destinationIdentity,
-                            Frame &frame,
-                            int timeoutMs)
+    TransportError ZMQRouter::send(const std::string &clientIdentity, const Frame &frame)
     {
-        (void)timeoutMs; // Timeout is set via socket options
+        zmq::message_t body;
+        if (!serializeToMessage(frame, body))
+        {
+            return TransportError::SerializationFailed;
+        }
+
+        const ByteSpan envelope[] = {bytesOf(clientIdentity), ByteSpan()};
+        return sendEnvelope(envelope, body);
+    }
 
-        std::vector<uint8_t> sourceIdentityVec;
-        std::vector<uint8_t> destinationIdentityVec;
-        std::vector<uint8_t> buffer(4096); // Initial buffer size
-        std::ptrdiff_t received = receiveRaw(sourceIdentityVec, destinationIdentityVec, buffer.data(), buffer.size());
-        
-        if (received < 0)
+    TransportError ZMQRouter::send(const std::string &clientIdentity, Frame &&frame)
+    {
+        zmq::message_t body;
+        if (!serializeToMessage(std::move(frame), body))
         {
-            return TransportError::ReceiveFailed;
+            return TransportError::SerializationFailed;
         }
-        if (received == 0)
+
+        const ByteSpan envelope[] = {bytesOf(clientIdentity), ByteSpan()};
+        return sendEnvelope(envelope, body);
+    }
+
+    TransportError ZMQRouter::send(const std::string &clientIdentity,
+                         const std::string &sourceIdentity,
+                         const Frame &frame)
+    {
+        zmq::message_t body;
+        if (!serializeToMessage(frame, body))
         {
-            return TransportError::Timeout;
+            return TransportError::SerializationFailed;
         }
-        
-        // Convert identity vectors to strings
-        sourceIdentity.assign(sourceIdentityVec.begin(), sourceIdentityVec.end());
-        destinationIdentity.assign(destinationIdentityVec.begin(), destinationIdentityVec.end());
-        buffer.resize(static_cast<size_t>(received));
-        
-        if (!deserializeFrame(buffer, frame))
+
+        const ByteSpan envelope[] = {bytesOf(clientIdentity), bytesOf(sourceIdentity), ByteSpan()};
+        return sendEnvelope(envelope, body);
+    }
+
+    TransportError ZMQRouter::receive(PeerId &sourceIdentity, Frame &frame, int timeoutMs)
+    {
+        ByteSpan source;
+        FrameView view;
+        TransportError error = receiveView(source, view, timeoutMs);
+        if (error != TransportError::None)
         {
-            return TransportError::DeserializationFailed;
+            return error;
         }
-        
-        return TransportError::None;
+
+        sourceIdentity = PeerId(source);
+        return view.toFrame(frame) ? TransportError::None : TransportError::DeserializationFailed;
     }
 
-    TransportError ZMQRouter::sendRaw(const std::vector<uint8_t> &identity,
-                            const uint8_t *data,
-                            size_t size)
+    TransportError ZMQRouter::receive(PeerId &sourceIdentity,
+                                      PeerId &destinationIdentity,
+                                      Frame &frame,
+                                      int timeoutMs)
     {
-        if (!isConnected())
+        ByteSpan source;
+        ByteSpan destination;
+        FrameView view;
+        TransportError error = receiveView(source, destination, view, timeoutMs);
+        if (error != TransportError::None)
         {
-            return TransportError::NotConnected;
+            return error;
         }
 
-        try
+        sourceIdentity = PeerId(source);
+        destinationIdentity = PeerId(destination);
+        return view.toFrame(frame) ? TransportError::None : TransportError::DeserializationFailed;
+    }
+
+    TransportError ZMQRouter::send(const PeerId &clientIdentity, const Frame &frame)
+    {
+        zmq::message_t body;
+        if (!serializeToMessage(frame, body))
         {
-            zmq::message_t identityMsg(identity.data(), identity.size());
-            auto identityResult = socket_->send(identityMsg, zmq::send_flags::sndmore);
-            if (!identityResult)
-            {
-                return TransportError::SendFailed;
-            }
+            return TransportError::SerializationFailed;
+        }
 
-            zmq::message_t delimiterMsg;
-            auto delimiterResult = socket_->send(delimiterMsg, zmq::send_flags::sndmore);
-            if (!delimiterResult)
-            {
-                return TransportError::SendFailed;
-            }
+        const ByteSpan envelope[] = {bytesOf(clientIdentity), ByteSpan()};
+        return sendEnvelope(envelope, body);
+    }
 
-            zmq::message_t dataMsg(data, size);
-            auto dataResult = socket_->send(dataMsg, zmq::send_flags::none);
-            return dataResult.has_value() ? TransportError::None : TransportError::SendFailed;
+    TransportError ZMQRouter::send(const PeerId &clientIdentity, Frame &&frame)
+    {
+        zmq::message_t body;
+        if (!serializeToMessage(std::move(frame), body))
+        {
+            return TransportError::SerializationFailed;
         }
-        catch (const zmq::error_t &e)
+
+        const ByteSpan envelope[] = {bytesOf(clientIdentity), ByteSpan()};
+        return sendEnvelope(envelope, body);
+    }
+
+    TransportError ZMQRouter::send(const PeerId &clientIdentity, const PeerId &sourceIdentity, const Frame &frame)
+    {
+        zmq::message_t body;
+        if (!serializeToMessage(frame, body))
         {
-            handleError(e, "router send");
-            return TransportError::SendFailed;
+            return TransportError::SerializationFailed;
         }
+
+        const ByteSpan envelope[] = {bytesOf(clientIdentity), bytesOf(sourceIdentity), ByteSpan()};
+        return sendEnvelope(envelope, body);
     }
 
-    TransportError ZMQRouter::sendRaw(const std::vector<uint8_t> &clientIdentity,
-                            const std::vector<uint8_t> &sourceIdentity,
-                            const uint8_t *data,
-                            size_t size)
+    TransportError ZMQRouter::send(const PeerId &clientIdentity, const WireBuffer &wire)
     {
-        if (!isConnected())
+        zmq::message_t body;
+        if (!attachWire(wire, body))
         {
-            return TransportError::NotConnected;
+            return TransportError::InvalidFrame;
         }
 
-        try
+        const ByteSpan envelope[] = {bytesOf(clientIdentity), ByteSpan()};
+        return sendEnvelope(envelope, body);
+    }
+
+    TransportError ZMQRouter::send(const PeerId &clientIdentity, const PeerId &sourceIdentity, const WireBuffer &wire)
+    {
+        zmq::message_t body;
+        if (!attachWire(wire, body))
         {
-            zmq::message_t clientIdentityMsg(clientIdentity.data(), clientIdentity.size());
-            auto clientIdentityResult = socket_->send(clientIdentityMsg, zmq::send_flags::sndmore);
-            if (!clientIdentityResult)
-            {
-                return TransportError::SendFailed;
-            }
+            return TransportError::InvalidFrame;
+        }
 
-            zmq::message_t sourceIdentityMsg(sourceIdentity.data(), sourceIdentity.size());
-            auto sourceIdentityResult = socket_->send(sourceIdentityMsg, zmq::send_flags::sndmore);
-            if (!sourceIdentityResult)
-            {
-                return TransportError::SendFailed;
-            }
+        const ByteSpan envelope[] = {bytesOf(clientIdentity), bytesOf(sourceIdentity), ByteSpan()};
+        return sendEnvelope(envelope, body);
+    }
 
-            zmq::message_t delimiterMsg;
-            auto delimiterResult = socket_->send(delimiterMsg, zmq::send_flags::sndmore);
-            if (!delimiterResult)
-            {
-                return TransportError::SendFailed;
-            }
+    TransportError ZMQRouter::receiveBatch(std::vector<std::string> &sourceIdentities,
+                                           std::vector<Frame> &frames,
+                                           size_t maxFrames,
+                                           size_t &received,
+                                           int timeoutMs)
+    {
+        // [source_identity][delimiter][data] per frame
+        return receiveFrameBatch(3, frames, maxFrames, received, timeoutMs, "router receive batch", &sourceIdentities);
+    }
 
-            zmq::message_t dataMsg(data, size);
-            auto dataResult = socket_->send(dataMsg, zmq::send_flags::none);
-            return dataResult.has_value() ? TransportError::None : TransportError::SendFailed;
-        }
-        catch (const zmq::error_t &e)
+    TransportError ZMQRouter::sendBatch(const std::string &clientIdentity, Span<const Frame> frames, size_t &sent)
+    {
+        // [client_identity][delimiter][data] per frame
+        const ByteSpan envelope[] = {bytesOf(clientIdentity), ByteSpan()};
+        return sendFrameBatch(envelope, frames, sent, "router send batch");
+    }
+
+    TransportError ZMQRouter::receive(std::string &sourceIdentity, PooledFrame &frame, int timeoutMs)
+    {
+        if (!frame)
         {
-            handleError(e, "router send");
-            return TransportError::SendFailed;
+            frame = FramePool::acquire();
         }
+        return receive(sourceIdentity, *frame, timeoutMs);
     }
 
-    TransportError ZMQRouter::send(const std::string &clientIdentity, const Frame &frame)
+    TransportError ZMQRouter::receive(std::string &sourceIdentity,
+                                      std::string &destinationIdentity,
+                                      PooledFrame &frame,
+                                      int timeoutMs)
     {
-        std::vector<uint8_t> buffer;
-        if (!serializeFrame(frame, buffer))
+        if (!frame)
         {
-            return TransportError::SerializationFailed;
+            frame = FramePool::acquire();
         }
+        return receive(sourceIdentity, destinationIdentity, *frame, timeoutMs);
+    }
 
-        std::vector<uint8_t> identityVec(clientIdentity.begin(), clientIdentity.end());
-        return sendRaw(identityVec, buffer.data(), buffer.size());
+    TransportError ZMQRouter::send(const std::string &clientIdentity, PooledFrame &&frame)
+    {
+        PooledFrame held(std::move(frame));
+        if (!held)
+        {
+            return TransportError::InvalidFrame;
+        }
+        return send(clientIdentity, *held);
     }
 
     TransportError ZMQRouter::send(const std::string &clientIdentity,
-                         const std::string &sourceIdentity,
-                         const Frame &frame)
+                                   const std::string &sourceIdentity,
+                                   PooledFrame &&frame)
     {
-        std::vector<uint8_t> buffer;
-        if (!serializeFrame(frame, buffer))
+        PooledFrame held(std::move(frame));
+        if (!held)
         {
-            return TransportError::SerializationFailed;
+            return TransportError::InvalidFrame;
         }
-
-        std::vector<uint8_t> clientIdentityVec(clientIdentity.begin(), clientIdentity.end());
-        std::vector<uint8_t> sourceIdentityVec(sourceIdentity.begin(), sourceIdentity.end());
-        return sendRaw(clientIdentityVec, sourceIdentityVec, buffer.data(), buffer.size());
+        return send(clientIdentity, sourceIdentity, *held);
     }
 
     TransportError ZMQRouter::send(const Frame &frame)
     {
         (void)frame;
-        handleError(zmq::error_t(), "router requires client identity for send");
+        handleError(TransportError::InternalError, TransportOperation::Send, "router send", "client identity required");
         return TransportError::InternalError;
     }
 
@@ -344,7 +430,7 @@ namespace limp
     {
         (void)data;
         (void)size;
-        handleError(zmq::error_t(), "router requires client identity for send");
+        handleError(TransportError::InternalError, TransportOperation::Send, "router send", "client identity required");
         return TransportError::InternalError;
     }
 
@@ -352,7 +438,15 @@ namespace limp
     {
         (void)frame;
         (void)timeoutMs;
-        handleError(zmq::error_t(), "router requires identity output for receive");
+        handleError(TransportError::InternalError, TransportOperation::Receive, "router receive", "identity output required");
+        return TransportError::InternalError;
+    }
+
+    TransportError ZMQRouter::receiveView(FrameView &view, int timeoutMs)
+    {
+        (void)view;
+        (void)timeoutMs;
+        handleError(TransportError::InternalError, TransportOperation::Receive, "router receive", "identity output required");
         return TransportError::InternalError;
     }
 
@@ -360,7 +454,7 @@ namespace limp
     {
         (void)buffer;
         (void)maxSize;
-        handleError(zmq::error_t(), "router requires identity output for receive");
+        handleError(TransportError::InternalError, TransportOperation::Receive, "router receive", "identity output required");
         return -1;
     }
 
@@ -0,0 +1,128 @@
+#include "limp/zmq/zmq_routing_table.hpp"
+#include <algorithm>
+
+namespace limp
+{
+
+    RoutingTable::RoutingTable()
+        : slots_(new std::atomic<const Route *>[SLOT_COUNT]), count_(0), snapshot_(new Snapshot()), stale_(false)
+    {
+        for (size_t i = 0; i < SLOT_COUNT; ++i)
+        {
+            slots_[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    RoutingTable::~RoutingTable()
+    {
+        for (uint16_t nodeID : nodes_)
+        {
+            delete slots_[nodeID].load(std::memory_order_relaxed);
+        }
+        delete snapshot_.load(std::memory_order_relaxed);
+    }
+
+    bool RoutingTable::add(uint16_t nodeID, const PeerId &identity)
+    {
+        // Fast path: every frame of a known node lands here
+        const Route *current = lookup(nodeID);
+        if (current && current->identity == identity)
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        current = slots_[nodeID].load(std::memory_order_relaxed);
+        if (current && current->identity == identity)
+        {
+            return false;
+        }
+        publish(nodeID, new Route{nodeID, identity});
+        return true;
+    }
+
+    bool RoutingTable::remove(uint16_t nodeID)
+    {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        if (!slots_[nodeID].load(std::memory_order_relaxed))
+        {
+            return false;
+        }
+        publish(nodeID, nullptr);
+        return true;
+    }
+
+    void RoutingTable::clear()
+    {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        for (uint16_t nodeID : nodes_)
+        {
+            retiredRoutes_.emplace_back(slots_[nodeID].load(std::memory_order_relaxed));
+            slots_[nodeID].store(nullptr, std::memory_order_release);
+        }
+        nodes_.clear();
+        count_.store(0, std::memory_order_release);
+        stale_.store(true, std::memory_order_release);
+    }
+
+    void RoutingTable::publish(uint16_t nodeID, const Route *route)
+    {
+        const Route *previous = slots_[nodeID].load(std::memory_order_relaxed);
+
+        // Readers see either the old or the new route, never a partial one
+        slots_[nodeID].store(route, std::memory_order_release);
+
+        auto position = std::lower_bound(nodes_.begin(), nodes_.end(), nodeID);
+        if (previous)
+        {
+            retiredRoutes_.emplace_back(previous);
+            if (!route)
+            {
+                nodes_.erase(position);
+            }
+        }
+        else
+        {
+            nodes_.insert(position, nodeID);
+        }
+        count_.store(nodes_.size(), std::memory_order_release);
+        stale_.store(true, std::memory_order_release);
+    }
+
+    const RoutingTable::Snapshot *RoutingTable::currentSnapshot() const
+    {
+        if (!stale_.load(std::memory_order_acquire))
+        {
+            return snapshot_.load(std::memory_order_acquire);
+        }
+
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        const Snapshot *old = snapshot_.load(std::memory_order_relaxed);
+        if (!stale_.load(std::memory_order_relaxed))
+        {
+            return old; // Rebuilt by another reader meanwhile
+        }
+
+        std::unique_ptr<Snapshot> next(new Snapshot());
+        next->routes.reserve(nodes_.size());
+        for (uint16_t nodeID : nodes_)
+        {
+            next->routes.push_back(slots_[nodeID].load(std::memory_order_relaxed));
+        }
+        const Snapshot *built = next.release();
+        snapshot_.store(built, std::memory_order_release);
+        stale_.store(false, std::memory_order_release);
+        retiredSnapshots_.emplace_back(old);
+        return built;
+    }
+
+    size_t RoutingTable::reclaim()
+    {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        const size_t count = retiredRoutes_.size();
+        retiredRoutes_.clear();
+        retiredSnapshots_.clear();
+        return count;
+    }
+
+} // namespace limp
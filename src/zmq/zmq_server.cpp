@@ -1,5 +1,4 @@
 #include "limp/zmq/zmq_server.hpp"
-#include <cstring>
 
 namespace limp
 {
@@ -26,7 +25,7 @@ namespace limp
         }
         catch (const zmq::error_t &e)
         {
-            handleError(e, "server bind");
+            handleError(e, TransportOperation::Bind, "server bind");
             return TransportError::BindFailed;
         }
     }
@@ -38,88 +37,89 @@ namespace limp
             return TransportError::NotConnected;
         }
 
+        zmq::message_t message;
         try
         {
-            zmq::message_t message(data, size);
-            auto result = socket_->send(message, zmq::send_flags::none);
-            return result.has_value() ? TransportError::None : TransportError::SendFailed;
+            message.rebuild(data, size);
         }
         catch (const zmq::error_t &e)
         {
-            handleError(e, "server send");
+            handleError(e, TransportOperation::Send, "server send");
             return TransportError::SendFailed;
         }
+
+        return sendParts(&message, 1, "server send");
     }
 
     std::ptrdiff_t ZMQServer::receiveRaw(uint8_t *buffer, size_t maxSize)
     {
-        if (!isConnected())
+        std::ptrdiff_t parts = receiveParts(1, "server receive");
+        if (parts <= 0)
         {
-            return -1;
+            return parts;
         }
 
-        try
+        return copyPart(0, buffer, maxSize);
+    }
+
+    TransportError ZMQServer::receiveView(FrameView &view, int timeoutMs)
+    {
+        std::ptrdiff_t parts = receiveParts(1, "server receive", timeoutMs);
+        if (parts < 0)
         {
-            zmq::message_t message;
-            auto result = socket_->recv(message, zmq::recv_flags::none);
-
-            if (!result)
-            {
-                return 0; // Timeout
-            }
-
-            size_t receivedSize = message.size();
-            if (receivedSize > maxSize)
-            {
-                handleError(zmq::error_t(), "received message larger than buffer");
-                return -1;
-            }
-
-            std::memcpy(buffer, message.data(), receivedSize);
-            return static_cast<std::ptrdiff_t>(receivedSize);
+            return TransportError::ReceiveFailed;
         }
-        catch (const zmq::error_t &e)
+        if (parts == 0)
         {
-            handleError(e, "server receive");
-            return -1;
+            return TransportError::Timeout;
         }
+
+        return viewPart(0, view);
     }
 
     TransportError ZMQServer::send(const Frame &frame)
     {
-        std::vector<uint8_t> buffer;
-        if (!serializeFrame(frame, buffer))
+        if (!isConnected())
+        {
+            return TransportError::NotConnected;
+        }
+
+        zmq::message_t message;
+        if (!serializeToMessage(frame, message))
         {
             return TransportError::SerializationFailed;
         }
-        
-        return sendRaw(buffer.data(), buffer.size());
+
+        return sendParts(&message, 1, "server send");
     }
 
-    TransportError ZMQServer::receive(Frame &frame, int timeoutMs)
+    TransportError ZMQServer::send(Frame &&frame)
     {
-        (void)timeoutMs; // Timeout is set via socket options
-        
-        std::vector<uint8_t> buffer(4096); // Initial buffer size
-        std::ptrdiff_t received = receiveRaw(buffer.data(), buffer.size());
-        
-        if (received < 0)
+        if (!isConnected())
         {
-            return TransportError::ReceiveFailed;
+            return TransportError::NotConnected;
         }
-        if (received == 0)
+
+        zmq::message_t message;
+        if (!serializeToMessage(std::move(frame), message))
         {
-            return TransportError::Timeout;
+            return TransportError::SerializationFailed;
         }
-        
-        buffer.resize(static_cast<size_t>(received));
-        
-        if (!deserializeFrame(buffer, frame))
+
+        return sendParts(&message, 1, "server send");
+    }
+
+    TransportError ZMQServer::receive(Frame &frame, int timeoutMs)
+    {
+        FrameView view;
+        TransportError error = receiveView(view, timeoutMs);
+        if (error != TransportError::None)
         {
-            return TransportError::DeserializationFailed;
+            return error;
         }
-        
-        return TransportError::None;
+
+        // Payload is sized from the received message; a reused Frame keeps its capacity
+        return view.toFrame(frame) ? TransportError::None : TransportError::DeserializationFailed;
     }
 
 } // namespace limp
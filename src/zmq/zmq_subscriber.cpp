@@ -1,5 +1,4 @@
 #include "limp/zmq/zmq_subscriber.hpp"
-#include <cstring>
 #include <vector>
 
 namespace limp
@@ -27,7 +26,7 @@ namespace limp
         }
         catch (const zmq::error_t &e)
         {
-            handleError(e, "subscriber connect");
+            handleError(e, TransportOperation::Subscribe, "subscriber connect");
             return TransportError::ConnectionFailed;
         }
     }
@@ -46,7 +45,7 @@ namespace limp
         }
         catch (const zmq::error_t &e)
         {
-            handleError(e, "subscriber subscribe");
+            handleError(e, TransportOperation::Subscribe, "subscriber subscribe");
             return TransportError::ConfigurationError;
         }
     }
@@ -65,7 +64,45 @@ namespace limp
         }
         catch (const zmq::error_t &e)
         {
-            handleError(e, "subscriber unsubscribe");
+            handleError(e, TransportOperation::Subscribe, "subscriber unsubscribe");
+            return TransportError::ConfigurationError;
+        }
+    }
+
+    TransportError ZMQSubscriber::subscribe(const Topic &topic)
+    {
+        if (!socket_)
+        {
+            return TransportError::SocketClosed;
+        }
+
+        try
+        {
+            socket_->set(zmq::sockopt::subscribe, zmq::buffer(topic.data(), topic.size()));
+            return TransportError::None;
+        }
+        catch (const zmq::error_t &e)
+        {
+            handleError(e, TransportOperation::Subscribe, "subscriber subscribe");
+            return TransportError::ConfigurationError;
+        }
+    }
+
+    TransportError ZMQSubscriber::unsubscribe(const Topic &topic)
+    {
+        if (!socket_)
+        {
+            return TransportError::SocketClosed;
+        }
+
+        try
+        {
+            socket_->set(zmq::sockopt::unsubscribe, zmq::buffer(topic.data(), topic.size()));
+            return TransportError::None;
+        }
+        catch (const zmq::error_t &e)
+        {
+            handleError(e, TransportOperation::Subscribe, "subscriber unsubscribe");
             return TransportError::ConfigurationError;
         }
     }
@@ -73,7 +110,7 @@ namespace limp
     TransportError ZMQSubscriber::send(const Frame &frame)
     {
         (void)frame;
-        handleError(zmq::error_t(), "subscriber: subscribers cannot send, only receive");
+        handleError(TransportError::InternalError, TransportOperation::Send, "subscriber send", "subscribers cannot send, only receive");
         return TransportError::InternalError;
     }
 
@@ -81,92 +118,126 @@ namespace limp
     {
         (void)data;
         (void)size;
-        handleError(zmq::error_t(), "subscriber: subscribers cannot send, only receive");
+        handleError(TransportError::InternalError, TransportOperation::Send, "subscriber send", "subscribers cannot send, only receive");
         return TransportError::InternalError;
     }
 
     TransportError ZMQSubscriber::receive(Frame &frame, int timeoutMs)
     {
-        (void)timeoutMs; // Timeout is set via socket options
-        
-        std::vector<uint8_t> buffer(4096); // Initial buffer size
-        std::ptrdiff_t received = receiveRaw(buffer.data(), buffer.size());
-        
-        if (received < 0)
+        FrameView view;
+        TransportError error = receiveView(view, timeoutMs);
+        if (error != TransportError::None)
+        {
+            return error;
+        }
+
+        // Payload is sized from the received message; a reused Frame keeps its capacity
+        return view.toFrame(frame) ? TransportError::None : TransportError::DeserializationFailed;
+    }
+
+    TransportError ZMQSubscriber::receive(std::string &topic, Frame &frame, int timeoutMs)
+    {
+        std::string_view topicView;
+        FrameView view;
+        TransportError error = receiveView(topicView, view, timeoutMs);
+        if (error != TransportError::None)
+        {
+            return error;
+        }
+
+        topic.assign(topicView.data(), topicView.size());
+        return view.toFrame(frame) ? TransportError::None : TransportError::DeserializationFailed;
+    }
+
+    TransportError ZMQSubscriber::receiveView(std::string_view &topic, FrameView &view, int timeoutMs)
+    {
+        // [topic][data] or [data]
+        std::ptrdiff_t parts = receiveParts(0, "subscriber receive", timeoutMs);
+        if (parts < 0)
         {
             return TransportError::ReceiveFailed;
         }
-        if (received == 0)
+        if (parts == 0)
         {
             return TransportError::Timeout;
         }
-        
-        buffer.resize(static_cast<size_t>(received));
-        
-        if (!deserializeFrame(buffer, frame))
+        if (parts > 2)
         {
-            return TransportError::DeserializationFailed;
+            handleError(TransportError::ReceiveFailed, TransportOperation::Receive, "subscriber receive", "expected 1 or 2 message parts");
+            return TransportError::ReceiveFailed;
         }
-        
-        return TransportError::None;
+
+        if (parts == 2)
+        {
+            ByteSpan topicBytes = partBytes(0);
+            topic = std::string_view(reinterpret_cast<const char *>(topicBytes.data()), topicBytes.size());
+        }
+        else
+        {
+            topic = std::string_view();
+        }
+        return viewPart(static_cast<size_t>(parts) - 1, view);
+    }
+
+    TransportError ZMQSubscriber::receiveBatch(std::vector<Frame> &frames, size_t maxFrames, size_t &received, int timeoutMs)
+    {
+        // [topic][data] or [data]; the frame is always the last part
+        return receiveFrameBatch(0, frames, maxFrames, received, timeoutMs, "subscriber receive batch");
     }
 
     std::ptrdiff_t ZMQSubscriber::receiveRaw(uint8_t *buffer, size_t maxSize)
     {
-        if (!isConnected())
+        // Either [data] or [topic][data]; the frame is always the last part
+        std::ptrdiff_t parts = receiveParts(0, "subscriber receive");
+        if (parts <= 0)
         {
-            return -1;
+            return parts;
         }
 
-        try
-        {
-            // Receive all parts of the message
-            std::vector<zmq::message_t> messages;
+        return copyPart(static_cast<size_t>(parts) - 1, buffer, maxSize);
+    }
 
-            while (true)
+    TransportError ZMQSubscriber::receiveInto(LastValueCache &cache, size_t maxFrames, size_t &received,
+                                              int timeoutMs)
+    {
+        received = 0;
+        int wait = timeoutMs;
+        for (size_t n = 0; maxFrames == 0 || n < maxFrames; ++n, wait = 0)
+        {
+            FrameView view;
+            TransportError error = receiveView(view, wait);
+            if (error == TransportError::Timeout)
             {
-                zmq::message_t message;
-                auto result = socket_->recv(message, zmq::recv_flags::none);
-
-                if (!result)
-                {
-                    return 0; // Timeout
-                }
-
-                messages.push_back(std::move(message));
-
-                // Check if more parts are coming
-                auto more = socket_->get(zmq::sockopt::rcvmore);
-
-                if (!more)
-                {
-                    break;
-                }
+                break; // Queue drained
             }
-
-            // If there are multiple parts, the first part is the topic (skip it)
-            // The actual frame data is in the last part
-            size_t dataPartIndex = (messages.size() > 1) ? messages.size() - 1 : 0;
-            
-            const auto &dataMsg = messages[dataPartIndex];
-            size_t dataSize = dataMsg.size();
-
-            if (dataSize > maxSize)
+            if (error == TransportError::DeserializationFailed)
+            {
+                continue;
+            }
+            if (error != TransportError::None)
             {
-                handleError(zmq::error_t(), "received message larger than buffer");
-                return -1;
+                return error;
             }
 
-            // Copy only the data part to buffer (skip topic if present)
-            std::memcpy(buffer, dataMsg.data(), dataSize);
+            cache.update(view);
+            ++received;
+        }
+        return received > 0 ? TransportError::None : TransportError::Timeout;
+    }
 
-            return static_cast<std::ptrdiff_t>(dataSize);
+    TransportError ZMQSubscriber::receiveView(FrameView &view, int timeoutMs)
+    {
+        std::ptrdiff_t parts = receiveParts(0, "subscriber receive", timeoutMs);
+        if (parts < 0)
+        {
+            return TransportError::ReceiveFailed;
         }
-        catch (const zmq::error_t &e)
+        if (parts == 0)
         {
-            handleError(e, "subscriber receive");
-            return -1;
+            return TransportError::Timeout;
         }
+
+        return viewPart(static_cast<size_t>(parts) - 1, view);
     }
 
 } // namespace limp
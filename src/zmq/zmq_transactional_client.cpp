@@ -0,0 +1,124 @@
+#include "limp/zmq/zmq_transactional_client.hpp"
+#include "limp/thread_pool.hpp"
+
+namespace limp
+{
+
+    TransactionalClient::TransactionalClient(std::shared_ptr<TransactionTracker> tracker, const ZMQConfig &config)
+        : client_(config), tracker_(std::move(tracker))
+    {
+    }
+
+    TransportError TransactionalClient::connect(const std::string &endpoint)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return client_.connect(endpoint);
+    }
+
+    TransportError TransactionalClient::send(const Frame &frame)
+    {
+        // Register before sending so a fast reply always finds its transaction. Only roll
+        // back a registration made here: a duplicate AttrID belongs to an earlier request.
+        const bool registered = tracker_->track(frame) && frame.msgType == MsgType::REQUEST;
+
+        TransportError error;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            error = client_.send(frame);
+            if (error == TransportError::None && frame.msgType == MsgType::REQUEST && frame.attrID != 0)
+            {
+                lastTransactionId_ = frame.attrID;
+            }
+        }
+
+        if (error != TransportError::None && registered)
+        {
+            tracker_->untrack(frame);
+        }
+        return error;
+    }
+
+    TransportError TransactionalClient::receive(Frame &frame, int timeoutMs)
+    {
+        TransportError error;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            error = client_.receive(frame, timeoutMs);
+        }
+
+        if (error == TransportError::None)
+        {
+            tracker_->track(frame);
+        }
+        return error;
+    }
+
+    TransportError TransactionalClient::sendRaw(const uint8_t *data, size_t size)
+    {
+        const bool registered = tracker_->trackRaw(data, size) && static_cast<MsgType>(data[1]) == MsgType::REQUEST;
+
+        TransportError error;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            error = client_.sendRaw(data, size);
+        }
+
+        if (error != TransportError::None && registered)
+        {
+            tracker_->untrackRaw(data, size);
+        }
+        return error;
+    }
+
+    std::ptrdiff_t TransactionalClient::receiveRaw(uint8_t *buffer, size_t maxSize)
+    {
+        std::ptrdiff_t received;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            received = client_.receiveRaw(buffer, maxSize);
+        }
+
+        if (received > 0)
+        {
+            tracker_->trackRaw(buffer, static_cast<size_t>(received));
+        }
+        return received;
+    }
+
+    std::future<TransportError> TransactionalClient::sendAsync(const Frame &frame)
+    {
+        return getThreadPool().submit([this, frame]() { return send(frame); });
+    }
+
+    std::future<std::pair<TransportError, Frame>> TransactionalClient::receiveAsync(int timeoutMs)
+    {
+        return getThreadPool().submit([this, timeoutMs]()
+                                      {
+                                          Frame frame;
+                                          TransportError error = receive(frame, timeoutMs);
+                                          return std::make_pair(error, std::move(frame)); });
+    }
+
+    std::future<TransportError> TransactionalClient::sendRawAsync(std::vector<uint8_t> data)
+    {
+        return getThreadPool().submit([this, data = std::move(data)]()
+                                      { return sendRaw(data.data(), data.size()); });
+    }
+
+    std::future<std::pair<std::ptrdiff_t, std::vector<uint8_t>>> TransactionalClient::receiveRawAsync(size_t maxSize)
+    {
+        return getThreadPool().submit([this, maxSize]()
+                                      {
+                                          std::vector<uint8_t> buffer(maxSize);
+                                          std::ptrdiff_t received = receiveRaw(buffer.data(), buffer.size());
+                                          buffer.resize(received > 0 ? static_cast<size_t>(received) : 0);
+                                          return std::make_pair(received, std::move(buffer)); });
+    }
+
+    std::optional<uint16_t> TransactionalClient::getLastTransactionId() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return lastTransactionId_;
+    }
+
+} // namespace limp
@@ -0,0 +1,354 @@
+#include "limp/zmq/zmq_transactional_dealer.hpp"
+#include "limp/thread_pool.hpp"
+#include "zmq_internal.hpp"
+
+namespace limp
+{
+
+    TransactionalDealer::TransactionalDealer(std::shared_ptr<TransactionTracker> tracker, const ZMQConfig &config)
+        : dealer_(config), tracker_(std::move(tracker)), receiveTimeout_(config.receiveTimeout)
+    {
+    }
+
+    TransportError TransactionalDealer::setIdentity(const std::string &identity)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return dealer_.setIdentity(identity);
+    }
+
+    TransportError TransactionalDealer::connect(const std::string &endpoint)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return dealer_.connect(endpoint);
+    }
+
+    const std::string &TransactionalDealer::getIdentity() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return dealer_.getIdentity();
+    }
+
+    TransportError TransactionalDealer::send(const Frame &frame)
+    {
+        return send(std::string(), frame);
+    }
+
+    TransportError TransactionalDealer::send(const std::string &destinationIdentity, const Frame &frame)
+    {
+        // Register before sending so a fast reply always finds its transaction. Only roll
+        // back a registration made here: a duplicate AttrID belongs to an earlier request.
+        const bool registered = tracker_->track(frame, std::string(), destinationIdentity) &&
+                                frame.msgType == MsgType::REQUEST;
+
+        TransportError error;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            error = destinationIdentity.empty() ? dealer_.send(frame) : dealer_.send(destinationIdentity, frame);
+            if (error == TransportError::None && frame.msgType == MsgType::REQUEST && frame.attrID != 0)
+            {
+                lastTransactionId_ = frame.attrID;
+            }
+        }
+
+        if (error != TransportError::None && registered)
+        {
+            tracker_->untrack(frame);
+        }
+        return error;
+    }
+
+    TransportError TransactionalDealer::receive(Frame &frame, int timeoutMs)
+    {
+        TransportError error = TransportError::Timeout;
+        zmq_internal::receiveUnlocked(mutex_, dealer_, waitTimeout(timeoutMs), [&]()
+                                      {
+                                          error = dealer_.receive(frame, 0);
+                                          return error != TransportError::Timeout; });
+
+        if (error == TransportError::None)
+        {
+            tracker_->track(frame);
+        }
+        return error;
+    }
+
+    TransportError TransactionalDealer::receive(std::string &sourceIdentity, Frame &frame, int timeoutMs)
+    {
+        TransportError error = TransportError::Timeout;
+        zmq_internal::receiveUnlocked(mutex_, dealer_, waitTimeout(timeoutMs), [&]()
+                                      {
+                                          error = dealer_.receive(sourceIdentity, frame, 0);
+                                          return error != TransportError::Timeout; });
+
+        if (error == TransportError::None)
+        {
+            tracker_->track(frame, sourceIdentity);
+        }
+        return error;
+    }
+
+    TransportError TransactionalDealer::sendRaw(const uint8_t *data, size_t size)
+    {
+        return sendRaw(std::string(), data, size);
+    }
+
+    TransportError TransactionalDealer::sendRaw(const std::string &destinationIdentity,
+                                                const uint8_t *data, size_t size)
+    {
+        const bool registered = tracker_->trackRaw(data, size, std::string(), destinationIdentity) &&
+                                static_cast<MsgType>(data[1]) == MsgType::REQUEST;
+
+        TransportError error;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            error = destinationIdentity.empty() ? dealer_.sendRaw(data, size)
+                                                : dealer_.sendRaw(destinationIdentity, data, size);
+        }
+
+        if (error != TransportError::None && registered)
+        {
+            tracker_->untrackRaw(data, size);
+        }
+        return error;
+    }
+
+    std::ptrdiff_t TransactionalDealer::receiveRaw(uint8_t *buffer, size_t maxSize)
+    {
+        std::ptrdiff_t received = 0;
+        zmq_internal::receiveUnlocked(mutex_, dealer_, waitTimeout(-1), [&]()
+                                      {
+                                          received = dealer_.receiveRaw(buffer, maxSize, 0);
+                                          return received != 0; });
+
+        if (received > 0)
+        {
+            tracker_->trackRaw(buffer, static_cast<size_t>(received));
+        }
+        return received;
+    }
+
+    std::ptrdiff_t TransactionalDealer::receiveRaw(std::string &sourceIdentity, uint8_t *buffer, size_t maxSize)
+    {
+        std::ptrdiff_t received = 0;
+        zmq_internal::receiveUnlocked(mutex_, dealer_, waitTimeout(-1), [&]()
+                                      {
+                                          received = dealer_.receiveRaw(sourceIdentity, buffer, maxSize, 0);
+                                          return received != 0; });
+
+        if (received > 0)
+        {
+            tracker_->trackRaw(buffer, static_cast<size_t>(received), sourceIdentity);
+        }
+        return received;
+    }
+
+    std::future<TransportError> TransactionalDealer::sendAsync(const Frame &frame)
+    {
+        return getThreadPool().submit([this, frame]() { return send(frame); });
+    }
+
+    std::future<std::pair<TransportError, Frame>> TransactionalDealer::receiveAsync(int timeoutMs)
+    {
+        return getThreadPool().submit([this, timeoutMs]()
+                                      {
+                                          Frame frame;
+                                          TransportError error = receive(frame, timeoutMs);
+                                          return std::make_pair(error, std::move(frame)); });
+    }
+
+    std::future<TransportError> TransactionalDealer::sendAsyncWithRouting(const std::string &destinationIdentity,
+                                                                          const Frame &frame)
+    {
+        return getThreadPool().submit([this, destinationIdentity, frame]()
+                                      { return send(destinationIdentity, frame); });
+    }
+
+    std::future<std::tuple<TransportError, std::string, Frame>>
+    TransactionalDealer::receiveAsyncWithRouting(int timeoutMs)
+    {
+        return getThreadPool().submit([this, timeoutMs]()
+                                      {
+                                          std::string sourceIdentity;
+                                          Frame frame;
+                                          TransportError error = receive(sourceIdentity, frame, timeoutMs);
+                                          return std::make_tuple(error, std::move(sourceIdentity), std::move(frame)); });
+    }
+
+    std::future<TransportError> TransactionalDealer::sendRawAsync(std::vector<uint8_t> data)
+    {
+        return getThreadPool().submit([this, data = std::move(data)]()
+                                      { return sendRaw(data.data(), data.size()); });
+    }
+
+    std::future<std::pair<std::ptrdiff_t, std::vector<uint8_t>>> TransactionalDealer::receiveRawAsync(size_t maxSize)
+    {
+        return getThreadPool().submit([this, maxSize]()
+                                      {
+                                          std::vector<uint8_t> buffer(maxSize);
+                                          std::ptrdiff_t received = receiveRaw(buffer.data(), buffer.size());
+                                          buffer.resize(received > 0 ? static_cast<size_t>(received) : 0);
+                                          return std::make_pair(received, std::move(buffer)); });
+    }
+
+    std::future<TransportError> TransactionalDealer::sendRawAsyncWithRouting(const std::string &destinationIdentity,
+                                                                             std::vector<uint8_t> data)
+    {
+        return getThreadPool().submit([this, destinationIdentity, data = std::move(data)]()
+                                      { return sendRaw(destinationIdentity, data.data(), data.size()); });
+    }
+
+    std::future<std::tuple<std::ptrdiff_t, std::string, std::vector<uint8_t>>>
+    TransactionalDealer::receiveRawAsyncWithRouting(size_t maxSize)
+    {
+        return getThreadPool().submit([this, maxSize]()
+                                      {
+                                          std::string sourceIdentity;
+                                          std::vector<uint8_t> buffer(maxSize);
+                                          std::ptrdiff_t received = receiveRaw(sourceIdentity, buffer.data(), buffer.size());
+                                          buffer.resize(received > 0 ? static_cast<size_t>(received) : 0);
+                                          return std::make_tuple(received, std::move(sourceIdentity), std::move(buffer)); });
+    }
+
+    TransportError TransactionalDealer::asyncRequest(const Frame &request, ReplyHandler handler)
+    {
+        return asyncRequest(std::string(), request, std::move(handler));
+    }
+
+    TransportError TransactionalDealer::asyncRequest(const std::string &destinationIdentity, const Frame &request,
+                                                     ReplyHandler handler)
+    {
+        if (request.msgType != MsgType::REQUEST ||
+            !tracker_->registerTransaction(request.attrID, std::string(), destinationIdentity, std::move(handler)))
+        {
+            return TransportError::InvalidFrame;
+        }
+
+        TransportError error;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            error = destinationIdentity.empty() ? dealer_.send(request) : dealer_.send(destinationIdentity, request);
+            if (error == TransportError::None)
+            {
+                lastTransactionId_ = request.attrID;
+            }
+        }
+
+        if (error != TransportError::None)
+        {
+            tracker_->untrack(request, error); // Reports the error through the handler
+        }
+        return TransportError::None;
+    }
+
+    std::future<Frame> TransactionalDealer::asyncRequest(const Frame &request)
+    {
+        return asyncRequest(std::string(), request);
+    }
+
+    std::future<Frame> TransactionalDealer::asyncRequest(const std::string &destinationIdentity, const Frame &request)
+    {
+        auto promise = std::make_shared<std::promise<Frame>>();
+        std::future<Frame> future = promise->get_future();
+
+        TransportError error = asyncRequest(destinationIdentity, request,
+                                            [promise](TransportError result, const Frame *reply)
+                                            {
+                                                if (result == TransportError::None && reply &&
+                                                    reply->msgType == MsgType::ERROR)
+                                                {
+                                                    promise->set_exception(std::make_exception_ptr(TransactionFailure(*reply)));
+                                                }
+                                                else if (result == TransportError::None && reply)
+                                                {
+                                                    promise->set_value(*reply);
+                                                }
+                                                else
+                                                {
+                                                    TransportError failure = (result != TransportError::None)
+                                                                                 ? result
+                                                                                 : TransportError::InternalError;
+                                                    promise->set_exception(std::make_exception_ptr(TransactionFailure(failure)));
+                                                }
+                                            });
+        if (error != TransportError::None)
+        {
+            promise->set_exception(std::make_exception_ptr(TransactionFailure(error)));
+        }
+        return future;
+    }
+
+    size_t TransactionalDealer::pollResponses(int timeoutMs)
+    {
+        size_t received = 0;
+        Frame frame;
+        FrameCallback unsolicited;
+        FrameCallback unmatched;
+
+        for (int wait = waitTimeout(timeoutMs);; wait = 0)
+        {
+            TransportError error = TransportError::Timeout;
+            bool converted = false;
+            zmq_internal::receiveUnlocked(mutex_, dealer_, wait, [&]()
+                                          {
+                                              ByteSpan source;
+                                              FrameView view;
+                                              error = dealer_.receiveAnyView(source, view, 0);
+                                              if (error == TransportError::None)
+                                              {
+                                                  converted = view.toFrame(frame);
+                                                  unsolicited = unsolicitedCallback_;
+                                                  unmatched = unmatchedCallback_;
+                                              }
+                                              return error != TransportError::Timeout; });
+            if (error != TransportError::None)
+            {
+                break; // Timeout: queue drained; other errors are reported by the dealer
+            }
+            if (!converted)
+            {
+                continue;
+            }
+            ++received;
+
+            // Complete outside the socket lock; handlers may issue new requests
+            const bool reply = frame.msgType == MsgType::RESPONSE || frame.msgType == MsgType::ACK ||
+                               frame.msgType == MsgType::ERROR;
+            if (!reply)
+            {
+                if (unsolicited)
+                {
+                    unsolicited(frame);
+                }
+            }
+            else if (!tracker_->track(frame) && unmatched)
+            {
+                unmatched(frame);
+            }
+        }
+        return received;
+    }
+
+    void TransactionalDealer::setUnsolicitedCallback(FrameCallback callback)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        unsolicitedCallback_ = std::move(callback);
+    }
+
+    void TransactionalDealer::setUnmatchedReplyCallback(FrameCallback callback)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        unmatchedCallback_ = std::move(callback);
+    }
+
+    int TransactionalDealer::waitTimeout(int timeoutMs) const noexcept
+    {
+        return timeoutMs < 0 ? receiveTimeout_ : timeoutMs;
+    }
+
+    std::optional<uint16_t> TransactionalDealer::getLastTransactionId() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return lastTransactionId_;
+    }
+
+} // namespace limp
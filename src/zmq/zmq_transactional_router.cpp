@@ -0,0 +1,263 @@
+#include "limp/zmq/zmq_transactional_router.hpp"
+#include "limp/thread_pool.hpp"
+#include "zmq_internal.hpp"
+
+namespace limp
+{
+
+    namespace
+    {
+        std::string toIdentity(const std::vector<uint8_t> &bytes)
+        {
+            return std::string(bytes.begin(), bytes.end());
+        }
+
+        TransportError rawError(std::ptrdiff_t received)
+        {
+            return received < 0 ? TransportError::ReceiveFailed : TransportError::None;
+        }
+    } // namespace
+
+    TransactionalRouter::TransactionalRouter(std::shared_ptr<TransactionTracker> tracker, const ZMQConfig &config)
+        : router_(config), tracker_(std::move(tracker)), receiveTimeout_(config.receiveTimeout)
+    {
+    }
+
+    TransportError TransactionalRouter::bind(const std::string &endpoint)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return router_.bind(endpoint);
+    }
+
+    TransportError TransactionalRouter::receive(std::string &sourceIdentity, Frame &frame, int timeoutMs)
+    {
+        TransportError error = TransportError::Timeout;
+        zmq_internal::receiveUnlocked(mutex_, router_, waitTimeout(timeoutMs), [&]()
+                                      {
+                                          error = router_.receive(sourceIdentity, frame, 0);
+                                          return error != TransportError::Timeout; });
+
+        if (error == TransportError::None)
+        {
+            tracker_->track(frame, sourceIdentity);
+        }
+        return error;
+    }
+
+    TransportError TransactionalRouter::receive(std::string &sourceIdentity,
+                                                std::string &destinationIdentity,
+                                                Frame &frame, int timeoutMs)
+    {
+        TransportError error = TransportError::Timeout;
+        zmq_internal::receiveUnlocked(mutex_, router_, waitTimeout(timeoutMs), [&]()
+                                      {
+                                          error = router_.receive(sourceIdentity, destinationIdentity, frame, 0);
+                                          return error != TransportError::Timeout; });
+
+        if (error == TransportError::None)
+        {
+            tracker_->track(frame, sourceIdentity, destinationIdentity);
+        }
+        return error;
+    }
+
+    TransportError TransactionalRouter::send(const std::string &clientIdentity, const Frame &frame)
+    {
+        // Register before sending so a fast reply always finds its transaction. Only roll
+        // back a registration made here: a duplicate AttrID belongs to an earlier request.
+        const bool registered = tracker_->track(frame, std::string(), clientIdentity) &&
+                                frame.msgType == MsgType::REQUEST;
+
+        TransportError error;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            error = router_.send(clientIdentity, frame);
+        }
+
+        if (error != TransportError::None && registered)
+        {
+            tracker_->untrack(frame);
+        }
+        return error;
+    }
+
+    TransportError TransactionalRouter::send(const std::string &clientIdentity,
+                                             const std::string &sourceIdentity,
+                                             const Frame &frame)
+    {
+        const bool registered = tracker_->track(frame, sourceIdentity, clientIdentity) &&
+                                frame.msgType == MsgType::REQUEST;
+
+        TransportError error;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            error = router_.send(clientIdentity, sourceIdentity, frame);
+        }
+
+        if (error != TransportError::None && registered)
+        {
+            tracker_->untrack(frame);
+        }
+        return error;
+    }
+
+    TransportError TransactionalRouter::sendRaw(const std::vector<uint8_t> &clientIdentity,
+                                                const uint8_t *data, size_t size)
+    {
+        const bool registered = tracker_->trackRaw(data, size, std::string(), toIdentity(clientIdentity)) &&
+                                static_cast<MsgType>(data[1]) == MsgType::REQUEST;
+
+        TransportError error;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            error = router_.sendRaw(clientIdentity, data, size);
+        }
+
+        if (error != TransportError::None && registered)
+        {
+            tracker_->untrackRaw(data, size);
+        }
+        return error;
+    }
+
+    TransportError TransactionalRouter::sendRaw(const std::vector<uint8_t> &clientIdentity,
+                                                const std::vector<uint8_t> &sourceIdentity,
+                                                const uint8_t *data, size_t size)
+    {
+        const bool registered =
+            tracker_->trackRaw(data, size, toIdentity(sourceIdentity), toIdentity(clientIdentity)) &&
+            static_cast<MsgType>(data[1]) == MsgType::REQUEST;
+
+        TransportError error;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            error = router_.sendRaw(clientIdentity, sourceIdentity, data, size);
+        }
+
+        if (error != TransportError::None && registered)
+        {
+            tracker_->untrackRaw(data, size);
+        }
+        return error;
+    }
+
+    std::ptrdiff_t TransactionalRouter::receiveRaw(std::vector<uint8_t> &identity,
+                                                   uint8_t *buffer, size_t maxSize)
+    {
+        std::ptrdiff_t received = 0;
+        zmq_internal::receiveUnlocked(mutex_, router_, waitTimeout(-1), [&]()
+                                      {
+                                          received = router_.receiveRaw(identity, buffer, maxSize, 0);
+                                          return received != 0; });
+
+        if (received > 0)
+        {
+            tracker_->trackRaw(buffer, static_cast<size_t>(received), toIdentity(identity));
+        }
+        return received;
+    }
+
+    std::ptrdiff_t TransactionalRouter::receiveRaw(std::vector<uint8_t> &sourceIdentity,
+                                                   std::vector<uint8_t> &destinationIdentity,
+                                                   uint8_t *buffer, size_t maxSize)
+    {
+        std::ptrdiff_t received = 0;
+        zmq_internal::receiveUnlocked(mutex_, router_, waitTimeout(-1), [&]()
+                                      {
+                                          received = router_.receiveRaw(sourceIdentity, destinationIdentity,
+                                                                        buffer, maxSize, 0);
+                                          return received != 0; });
+
+        if (received > 0)
+        {
+            tracker_->trackRaw(buffer, static_cast<size_t>(received),
+                               toIdentity(sourceIdentity), toIdentity(destinationIdentity));
+        }
+        return received;
+    }
+
+    int TransactionalRouter::waitTimeout(int timeoutMs) const noexcept
+    {
+        return timeoutMs < 0 ? receiveTimeout_ : timeoutMs;
+    }
+
+    std::future<std::tuple<TransportError, std::string, Frame>> TransactionalRouter::receiveAsync(int timeoutMs)
+    {
+        return getThreadPool().submit([this, timeoutMs]()
+                                      {
+                                          std::string sourceIdentity;
+                                          Frame frame;
+                                          TransportError error = receive(sourceIdentity, frame, timeoutMs);
+                                          return std::make_tuple(error, std::move(sourceIdentity), std::move(frame)); });
+    }
+
+    std::future<TransportError> TransactionalRouter::sendAsync(const std::string &clientIdentity, const Frame &frame)
+    {
+        return getThreadPool().submit([this, clientIdentity, frame]()
+                                      { return send(clientIdentity, frame); });
+    }
+
+    std::future<std::tuple<TransportError, std::string, std::string, Frame>>
+    TransactionalRouter::receiveAsyncWithRouting(int timeoutMs)
+    {
+        return getThreadPool().submit([this, timeoutMs]()
+                                      {
+                                          std::string sourceIdentity;
+                                          std::string destinationIdentity;
+                                          Frame frame;
+                                          TransportError error = receive(sourceIdentity, destinationIdentity, frame, timeoutMs);
+                                          return std::make_tuple(error, std::move(sourceIdentity),
+                                                                 std::move(destinationIdentity), std::move(frame)); });
+    }
+
+    std::future<TransportError> TransactionalRouter::sendAsyncWithRouting(const std::string &clientIdentity,
+                                                                          const std::string &sourceIdentity,
+                                                                          const Frame &frame)
+    {
+        return getThreadPool().submit([this, clientIdentity, sourceIdentity, frame]()
+                                      { return send(clientIdentity, sourceIdentity, frame); });
+    }
+
+    std::future<std::tuple<TransportError, std::vector<uint8_t>, std::vector<uint8_t>>>
+    TransactionalRouter::receiveRawAsync(size_t maxSize)
+    {
+        return getThreadPool().submit([this, maxSize]()
+                                      {
+                                          std::vector<uint8_t> identity;
+                                          std::vector<uint8_t> buffer(maxSize);
+                                          std::ptrdiff_t received = receiveRaw(identity, buffer.data(), buffer.size());
+                                          buffer.resize(received > 0 ? static_cast<size_t>(received) : 0);
+                                          return std::make_tuple(rawError(received), std::move(identity), std::move(buffer)); });
+    }
+
+    std::future<std::tuple<TransportError, std::vector<uint8_t>, std::vector<uint8_t>, std::vector<uint8_t>>>
+    TransactionalRouter::receiveRawAsyncWithRouting(size_t maxSize)
+    {
+        return getThreadPool().submit([this, maxSize]()
+                                      {
+                                          std::vector<uint8_t> sourceIdentity;
+                                          std::vector<uint8_t> destinationIdentity;
+                                          std::vector<uint8_t> buffer(maxSize);
+                                          std::ptrdiff_t received = receiveRaw(sourceIdentity, destinationIdentity,
+                                                                               buffer.data(), buffer.size());
+                                          buffer.resize(received > 0 ? static_cast<size_t>(received) : 0);
+                                          return std::make_tuple(rawError(received), std::move(sourceIdentity),
+                                                                 std::move(destinationIdentity), std::move(buffer)); });
+    }
+
+    std::future<TransportError> TransactionalRouter::sendRawAsync(const std::vector<uint8_t> &clientIdentity,
+                                                                  std::vector<uint8_t> data)
+    {
+        return getThreadPool().submit([this, clientIdentity, data = std::move(data)]()
+                                      { return sendRaw(clientIdentity, data.data(), data.size()); });
+    }
+
+    std::future<TransportError> TransactionalRouter::sendRawAsyncWithRouting(const std::vector<uint8_t> &clientIdentity,
+                                                                             const std::vector<uint8_t> &sourceIdentity,
+                                                                             std::vector<uint8_t> data)
+    {
+        return getThreadPool().submit([this, clientIdentity, sourceIdentity, data = std::move(data)]()
+                                      { return sendRaw(clientIdentity, sourceIdentity, data.data(), data.size()); });
+    }
+
+} // namespace limp
@@ -1,19 +1,72 @@
 #include "limp/zmq/zmq_transport_base.hpp"
-#include <iostream>
+#include "limp/zmq/zmq_context.hpp"
+#include "limp/compression.hpp"
+#include "limp/crc.hpp"
+#include "limp/trace.hpp"
+#include "limp/utils.hpp"
+#include "zmq_internal.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <memory>
 
 namespace limp
 {
 
+    namespace
+    {
+        /** @brief Smallest payload worth serializing in place; below it a copy is cheaper than the bookkeeping */
+        constexpr size_t ADOPT_MIN_PAYLOAD = 4096;
+
+        /** @brief zmq_free_fn for messages that own an adopted payload vector */
+        void freeAdopted(void *, void *hint) noexcept
+        {
+            delete static_cast<std::vector<uint8_t> *>(hint);
+        }
+
+        /** @brief Reports SendEnqueued/SendComplete, keeping the header a send empties out of the message */
+        class SendTrace
+        {
+        public:
+            SendTrace(const zmq::message_t &frame, const char *operation) noexcept
+                : size_(frame.size()), operation_(operation), active_(isTracing())
+            {
+                if (active_)
+                {
+                    if (size_ > 0)
+                    {
+                        std::memcpy(header_, frame.data(), std::min<size_t>(size_, HEADER_SIZE));
+                    }
+                    traceFrame(TraceEvent::SendEnqueued, header_, size_, TransportError::None, operation_);
+                }
+            }
+
+            void complete(TransportError error) noexcept
+            {
+                if (active_)
+                {
+                    traceFrame(TraceEvent::SendComplete, header_, size_, error, operation_);
+                }
+            }
+
+        private:
+            uint8_t header_[HEADER_SIZE];
+            size_t size_;
+            const char *operation_;
+            bool active_;
+        };
+    } // namespace
+
     ZMQTransport::ZMQTransport(const ZMQConfig &config)
-        : config_(config), connected_(false)
+        : config_(config), errors_("ZMQ"), connected_(false)
     {
         try
         {
-            context_ = std::make_shared<zmq::context_t>(config_.ioThreads);
+            context_ = ZMQContextRegistry::resolve(config_);
         }
         catch (const zmq::error_t &e)
         {
-            handleError(e, "context creation");
+            handleError(e, TransportOperation::Setup, "context creation");
             throw;
         }
     }
@@ -28,6 +81,23 @@ namespace limp
         return connected_ && socket_ != nullptr;
     }
 
+    bool ZMQTransport::notificationHandle(zmq::fd_t &fd) const
+    {
+        if (!socket_)
+        {
+            return false;
+        }
+        try
+        {
+            fd = socket_->get(zmq::sockopt::fd);
+            return true;
+        }
+        catch (const zmq::error_t &)
+        {
+            return false;
+        }
+    }
+
     void ZMQTransport::close()
     {
         if (socket_)
@@ -38,7 +108,7 @@ namespace limp
             }
             catch (const zmq::error_t &e)
             {
-                handleError(e, "socket close");
+                handleError(e, TransportOperation::Close, "socket close");
             }
             socket_.reset();
         }
@@ -48,7 +118,17 @@ namespace limp
 
     void ZMQTransport::setErrorCallback(ErrorCallback callback)
     {
-        errorCallback_ = std::move(callback);
+        errors_.setMessageCallback(std::move(callback));
+    }
+
+    void ZMQTransport::setErrorEventCallback(ErrorEventCallback callback)
+    {
+        errors_.setEventCallback(std::move(callback));
+    }
+
+    void ZMQTransport::setErrorRateLimit(size_t burst, std::chrono::milliseconds interval)
+    {
+        errors_.setRateLimit(burst, interval);
     }
 
     void ZMQTransport::createSocket(zmq::socket_type socketType)
@@ -60,7 +140,7 @@ namespace limp
         }
         catch (const zmq::error_t &e)
         {
-            handleError(e, "socket creation");
+            handleError(e, TransportOperation::Setup, "socket creation");
             throw;
         }
     }
@@ -72,58 +152,382 @@ namespace limp
 
         try
         {
-            // Set send timeout
-            socket_->set(zmq::sockopt::sndtimeo, config_.sendTimeout);
+            configureSocket(*socket_, config_);
+        }
+        catch (const zmq::error_t &e)
+        {
+            handleError(e, TransportOperation::Setup, "socket option setting");
+            throw;
+        }
+    }
+
+    void ZMQTransport::handleError(const zmq::error_t &e, TransportOperation operation, const char *context)
+    {
+        errors_.report(ErrorEvent{zmq_internal::errorFor(operation), operation, e.num(), context, e.what()});
+    }
+
+    void ZMQTransport::handleError(TransportError error, TransportOperation operation, const char *context,
+                                   const char *reason)
+    {
+        errors_.report(ErrorEvent{error, operation, 0, context, reason});
+    }
+
+    std::ptrdiff_t ZMQTransport::receiveParts(size_t expectedParts, const char *operation, int timeoutMs)
+    {
+        if (!isConnected())
+        {
+            metrics_.recordError(TransportError::NotConnected);
+            return -1;
+        }
 
-            // Set receive timeout
-            socket_->set(zmq::sockopt::rcvtimeo, config_.receiveTimeout);
+        try
+        {
+            const bool dontWait = (timeoutMs >= 0);
+            if (timeoutMs > 0)
+            {
+                zmq::pollitem_t item = {socket_->handle(), 0, ZMQ_POLLIN, 0};
+                if (zmq::poll(&item, 1, std::chrono::milliseconds(timeoutMs)) == 0)
+                {
+                    metrics_.recordError(TransportError::Timeout);
+                    return 0;
+                }
+            }
 
-            // Set linger time
-            socket_->set(zmq::sockopt::linger, config_.lingerTime);
+            size_t count = 0;
+            bool more = true;
+            zmq::message_t overflow;
 
-            // Set send buffer size if specified
-            if (config_.sendBufferSize > 0)
+            while (more)
             {
-                socket_->set(zmq::sockopt::sndbuf, config_.sendBufferSize);
+                zmq::message_t &part = (count < MAX_RECEIVE_PARTS) ? rxParts_[count] : overflow;
+                const bool first = (count == 0);
+                auto result = socket_->recv(part, (first && dontWait) ? zmq::recv_flags::dontwait
+                                                                      : zmq::recv_flags::none);
+
+                if (!result)
+                {
+                    // Multipart delivery is atomic, so only the first part can time out.
+                    // A non-blocking poll that finds nothing is not counted as a timeout.
+                    if (timeoutMs != 0)
+                    {
+                        metrics_.recordError(TransportError::Timeout);
+                    }
+                    return 0;
+                }
+
+                more = part.more();
+                ++count;
             }
 
-            // Set receive buffer size if specified
-            if (config_.receiveBufferSize > 0)
+            if (count > MAX_RECEIVE_PARTS || (expectedParts != 0 && count != expectedParts))
             {
-                socket_->set(zmq::sockopt::rcvbuf, config_.receiveBufferSize);
+                handleError(TransportError::ReceiveFailed, TransportOperation::Receive, operation,
+                            "unexpected number of message parts");
+                metrics_.recordError(TransportError::ReceiveFailed);
+                return -1;
             }
 
-            // Set reconnect interval
-            socket_->set(zmq::sockopt::reconnect_ivl, config_.reconnectInterval);
+            // The frame is the last part
+            const zmq::message_t &frame = rxParts_[count - 1];
+            metrics_.recordReceive(1, frame.size());
+            traceFrame(TraceEvent::FrameReceived, static_cast<const uint8_t *>(frame.data()), frame.size(),
+                       TransportError::None, operation);
+            return static_cast<std::ptrdiff_t>(count);
+        }
+        catch (const zmq::error_t &e)
+        {
+            handleError(e, TransportOperation::Receive, operation);
+            metrics_.recordError(TransportError::ReceiveFailed);
+            return -1;
+        }
+    }
+
+    TransportError ZMQTransport::viewPart(size_t index, FrameView &view) const
+    {
+        ByteSpan bytes = partBytes(index);
+        const TransportError error = deserializeFrameView(bytes.data(), bytes.size(), view)
+                                         ? TransportError::None
+                                         : TransportError::DeserializationFailed;
+        metrics_.recordError(error);
+        traceFrame(TraceEvent::DeserializeComplete, bytes.data(), bytes.size(), error, "deserialize");
+        return error;
+    }
+
+    std::ptrdiff_t ZMQTransport::copyPart(size_t index, uint8_t *buffer, size_t maxSize)
+    {
+        ByteSpan bytes = partBytes(index);
+        if (bytes.size() > maxSize)
+        {
+            handleError(TransportError::ReceiveFailed, TransportOperation::Receive, "receive", "message larger than buffer");
+            return -1;
+        }
+
+        if (!bytes.empty())
+        {
+            std::memcpy(buffer, bytes.data(), bytes.size());
+        }
+        return static_cast<std::ptrdiff_t>(bytes.size());
+    }
+
+    bool ZMQTransport::serializeToMessage(const Frame &frame, zmq::message_t &message)
+    {
+        if (!frame.validate())
+        {
+            metrics_.recordError(TransportError::SerializationFailed);
+            return false;
+        }
+
+        const Frame &wire = detail::wireFrame(frame);
+        try
+        {
+            message.rebuild(wire.totalSize());
+        }
+        catch (const zmq::error_t &e)
+        {
+            handleError(e, TransportOperation::Send, "message allocation");
+            return false;
+        }
+
+        detail::serializeValidatedFrame(wire, static_cast<uint8_t *>(message.data()));
+        return true;
+    }
+
+    bool ZMQTransport::serializeToMessage(Frame &&frame, zmq::message_t &message)
+    {
+        const size_t total = frame.totalSize();
+        if (frame.payload.isInline() || frame.payloadLen < ADOPT_MIN_PAYLOAD || frame.payload.capacity() < total ||
+            !frame.validate() || detail::wantsCompression(frame))
+        {
+            return serializeToMessage(static_cast<const Frame &>(frame), message);
+        }
+
+        // Grow the payload's allocation into the wire format: shift the bytes
+        // past the header (within capacity, so nothing is reallocated)
+        auto wire = std::make_unique<std::vector<uint8_t>>(frame.payload.release());
+        wire->resize(total);
+        std::memmove(wire->data() + HEADER_SIZE, wire->data(), frame.payloadLen);
+        serializeFrameHeader(frame, wire->data());
+        if (frame.hasCRC())
+        {
+            const uint16_t crcBE = utils::hton16(calculateCRC16(wire->data(), HEADER_SIZE + frame.payloadLen));
+            std::memcpy(wire->data() + HEADER_SIZE + frame.payloadLen, &crcBE, 2);
+        }
+        frame.payloadLen = 0;
+
+        try
+        {
+            message.rebuild(wire->data(), wire->size(), &freeAdopted, wire.get());
+        }
+        catch (const zmq::error_t &e)
+        {
+            handleError(e, TransportOperation::Send, "message allocation");
+            return false;
+        }
+        wire.release(); // Owned by the message now
+        return true;
+    }
+
+    bool ZMQTransport::attachWire(const WireBuffer &wire, zmq::message_t &message)
+    {
+        if (!wire)
+        {
+            return false;
+        }
+
+        void *hint = wire.retain();
+        try
+        {
+            message.rebuild(const_cast<uint8_t *>(wire.data()), wire.size(), &WireBuffer::release, hint);
+        }
+        catch (const zmq::error_t &e)
+        {
+            // ZeroMQ did not take ownership
+            WireBuffer::release(nullptr, hint);
+            handleError(e, TransportOperation::Send, "message allocation");
+            return false;
+        }
+        return true;
+    }
 
-            // Set maximum reconnect interval if specified
-            if (config_.reconnectIntervalMax > 0)
+    TransportError ZMQTransport::sendParts(zmq::message_t *parts, size_t count, const char *operation)
+    {
+        const uint64_t start = LatencyHistogram::now();
+        const size_t bytes = parts[count - 1].size(); // Sending empties the messages
+        SendTrace trace(parts[count - 1], operation);
+        try
+        {
+            for (size_t i = 0; i < count; ++i)
             {
-                socket_->set(zmq::sockopt::reconnect_ivl_max, config_.reconnectIntervalMax);
+                const bool last = (i + 1 == count);
+                auto result = socket_->send(parts[i], last ? zmq::send_flags::none : zmq::send_flags::sndmore);
+                if (!result)
+                {
+                    metrics_.recordError(TransportError::SendFailed);
+                    trace.complete(TransportError::SendFailed);
+                    return TransportError::SendFailed;
+                }
             }
+            metrics_.recordSend(1, bytes);
+            metrics_.sendLatency().recordSince(start);
+            trace.complete(TransportError::None);
+            return TransportError::None;
+        }
+        catch (const zmq::error_t &e)
+        {
+            handleError(e, TransportOperation::Send, operation);
+            metrics_.recordError(TransportError::SendFailed);
+            trace.complete(TransportError::SendFailed);
+            return TransportError::SendFailed;
+        }
+    }
+
+    TransportError ZMQTransport::sendFrameBatch(Span<const ByteSpan> envelope,
+                                                Span<const Frame> frames,
+                                                size_t &sent,
+                                                const char *operation)
+    {
+        sent = 0;
+        if (!isConnected())
+        {
+            metrics_.recordError(TransportError::NotConnected);
+            return TransportError::NotConnected;
+        }
 
-            // Set immediate mode
-            socket_->set(zmq::sockopt::immediate, config_.immediate ? 1 : 0);
+        const uint64_t start = LatencyHistogram::now();
+        size_t bytes = 0;
+        zmq::message_t data;
+        TransportError error = TransportError::None;
+        try
+        {
+            for (const Frame &frame : frames)
+            {
+                if (!serializeToMessage(frame, data))
+                {
+                    error = TransportError::SerializationFailed;
+                    break;
+                }
+
+                const size_t size = data.size();
+                SendTrace trace(data, operation);
+                for (size_t i = 0; i <= envelope.size() && error == TransportError::None; ++i)
+                {
+                    const bool last = (i == envelope.size());
+                    zmq::message_t part;
+                    zmq::message_t &message = last ? data : part;
+                    if (!last)
+                    {
+                        part.rebuild(envelope[i].data(), envelope[i].size());
+                    }
+
+                    const zmq::send_flags more = last ? zmq::send_flags::none : zmq::send_flags::sndmore;
+                    if (i == 0)
+                    {
+                        // Only the first part can block; the rest of a multipart message is queued atomically
+                        auto result = socket_->send(message, more | zmq::send_flags::dontwait);
+                        if (!result)
+                        {
+                            result = socket_->send(message, more);
+                        }
+                        if (!result)
+                        {
+                            error = TransportError::SendFailed;
+                        }
+                    }
+                    else if (!socket_->send(message, more))
+                    {
+                        error = TransportError::SendFailed;
+                    }
+                }
+                trace.complete(error);
+                if (error != TransportError::None)
+                {
+                    metrics_.recordError(error);
+                    break;
+                }
+                bytes += size;
+                ++sent;
+            }
         }
         catch (const zmq::error_t &e)
         {
-            handleError(e, "socket option setting");
-            throw;
+            handleError(e, TransportOperation::Send, operation);
+            metrics_.recordError(TransportError::SendFailed);
+            error = TransportError::SendFailed;
         }
+
+        metrics_.recordSend(sent, bytes);
+        if (sent > 0)
+        {
+            metrics_.sendLatency().recordSince(start);
+        }
+        return error;
     }
 
-    void ZMQTransport::handleError(const zmq::error_t &e, const std::string &operation)
+    TransportError ZMQTransport::receiveFrameBatch(size_t expectedParts,
+                                                   std::vector<Frame> &frames,
+                                                   size_t maxFrames,
+                                                   size_t &received,
+                                                   int timeoutMs,
+                                                   const char *operation,
+                                                   std::vector<std::string> *identities)
     {
-        std::string errorMsg = "ZMQ error during " + operation + ": " + e.what() + " (code: " + std::to_string(e.num()) + ")";
+        size_t count = 0;
+        TransportError error = TransportError::None;
 
-        if (errorCallback_)
+        while (maxFrames == 0 || count < maxFrames)
         {
-            errorCallback_(errorMsg);
+            std::ptrdiff_t parts = receiveParts(expectedParts, operation, count > 0 ? 0 : timeoutMs);
+            if (parts <= 0)
+            {
+                if (parts < 0)
+                {
+                    error = TransportError::ReceiveFailed;
+                }
+                else if (count == 0)
+                {
+                    error = TransportError::Timeout;
+                }
+                break;
+            }
+
+            FrameView view;
+            error = viewPart(static_cast<size_t>(parts) - 1, view);
+            if (error != TransportError::None)
+            {
+                break;
+            }
+
+            // Reuse existing elements so their payload capacity is kept
+            if (count == frames.size())
+            {
+                frames.emplace_back();
+            }
+            if (!view.toFrame(frames[count]))
+            {
+                metrics_.recordError(TransportError::DeserializationFailed);
+                error = TransportError::DeserializationFailed;
+                break;
+            }
+
+            if (identities)
+            {
+                if (count == identities->size())
+                {
+                    identities->emplace_back();
+                }
+                ByteSpan identity = partBytes(0);
+                (*identities)[count].assign(reinterpret_cast<const char *>(identity.data()), identity.size());
+            }
+            ++count;
         }
-        else
+
+        frames.resize(count);
+        if (identities)
         {
-            std::cerr << errorMsg << std::endl;
+            identities->resize(count);
         }
+        received = count;
+        return error;
     }
 
 } // namespace limp
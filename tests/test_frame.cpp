@@ -1,6 +1,40 @@
 #include <limp/limp.hpp>
 #include <iostream>
 #include <cassert>
+#include <cstring>
+#include <thread>
+#include <algorithm>
+
+#ifdef LIMP_HAS_TCP
+#include <limp/tcp/tcp.hpp>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#ifdef LIMP_HAS_CAPTURE
+#include <limp/capture/capture.hpp>
+#include <unistd.h>
+#include <cstdio>
+#endif
+
+#ifdef LIMP_HAS_SHM
+#include <limp/shm/shm.hpp>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cerrno>
+#include <chrono>
+#endif
+
+#ifdef LIMP_HAS_UDP
+#include <limp/udp/udp.hpp>
+#include <unistd.h>
+#endif
+
+#ifdef LIMP_HAS_ZMQ
+#include <limp/zmq/zmq.hpp>
+#include <cerrno>
+#include <stdexcept>
+#endif
 
 using namespace limp;
 
@@ -96,6 +130,2039 @@ void testCRC()
     std::cout << "PASS\n";
 }
 
+void testCRCEngines()
+{
+    std::cout << "Test: CRC Engines and Incremental Accumulator... ";
+
+    // MODBUS check value
+    const char *check = "123456789";
+    const auto *checkBytes = reinterpret_cast<const uint8_t *>(check);
+    assert(calculateCRC16(checkBytes, 9) == 0x4B37);
+
+    std::vector<uint8_t> data(1500);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<uint8_t>((i * 131u + 7u) ^ (i >> 3));
+    }
+
+    // All engines agree on every length and alignment
+    for (size_t offset = 0; offset < 3; ++offset)
+    {
+        for (size_t len = 0; len + offset <= data.size(); len += (len < 300 ? 1 : 97))
+        {
+            const uint8_t *p = data.data() + offset;
+            uint16_t expected = calculateCRC16(p, len, CRC16Engine::Table);
+            assert(calculateCRC16(p, len, CRC16Engine::Slice8) == expected);
+            assert(calculateCRC16(p, len, CRC16Engine::CLMul) == expected);
+            assert(calculateCRC16(p, len) == expected);
+        }
+    }
+
+    // Incremental accumulation matches one-shot
+    Crc16 crc;
+    crc.update(data.data(), 14).update(data.data() + 14, 200).update(data.data() + 214, 1286);
+    assert(crc.finalize() == calculateCRC16(data.data(), data.size()));
+    crc.reset();
+    assert(crc.finalize() == CRC16_INITIAL);
+
+    std::cout << "PASS (" << toString(activeCRC16Engine()) << ")\n";
+}
+
+void testFrameView()
+{
+    std::cout << "Test: Zero-Copy Frame View... ";
+
+    auto frame = MessageBuilder::event(0x1234, 0x3000, 7, 0x0042)
+                     .setPayload("view me")
+                     .enableCRC()
+                     .build();
+
+    std::vector<uint8_t> buffer;
+    assert(serializeFrame(frame, buffer));
+
+    FrameView view;
+    assert(deserializeFrameView(buffer.data(), buffer.size(), view));
+    assert(view.msgType() == MsgType::EVENT);
+    assert(view.srcNodeID() == 0x1234);
+    assert(view.classID() == 0x3000);
+    assert(view.instanceID() == 7);
+    assert(view.attrID() == 0x0042);
+    assert(view.payloadType() == PayloadType::STRING);
+    assert(view.payloadLen() == 7);
+    assert(view.hasCRC() && view.crc().has_value());
+
+    // Payload points into the wire buffer
+    assert(view.payload().data() == buffer.data() + HEADER_SIZE);
+    assert(std::memcmp(view.payload().data(), "view me", 7) == 0);
+
+    Frame owned;
+    assert(view.toFrame(owned));
+    assert(owned.payload == frame.payload);
+    assert(owned.crc == view.crc());
+
+    // Corruption and truncation are rejected
+    buffer[HEADER_SIZE] ^= 0xFF;
+    assert(!deserializeFrameView(buffer.data(), buffer.size(), view));
+    buffer[HEADER_SIZE] ^= 0xFF;
+    assert(!deserializeFrameView(buffer.data(), buffer.size() - 1, view));
+
+    std::cout << "PASS\n";
+}
+
+void testSerializeInto()
+{
+    std::cout << "Test: Serialize Into Caller Buffer... ";
+
+    auto frame = MessageBuilder::response(0x0010, 0x5000, 3, 0x0001)
+                     .setPayload(3.25f)
+                     .enableCRC()
+                     .build();
+
+    std::vector<uint8_t> expected;
+    assert(serializeFrame(frame, expected));
+
+    uint8_t buffer[64];
+    size_t written = serializeFrameInto(frame, buffer, sizeof(buffer));
+    assert(written == frame.totalSize());
+    assert(written == expected.size());
+    assert(std::memcmp(buffer, expected.data(), written) == 0);
+
+    // Too small a buffer or an invalid frame writes nothing
+    assert(serializeFrameInto(frame, buffer, written - 1) == 0);
+    Frame invalid = frame;
+    invalid.payloadLen = 2;
+    assert(serializeFrameInto(invalid, buffer, sizeof(buffer)) == 0);
+
+    // The builder writes the same bytes without building a Frame
+    auto builder = MessageBuilder::response(0x0010, 0x5000, 3, 0x0001).setPayload(3.25f).enableCRC();
+    assert(builder.serializeTo(buffer, sizeof(buffer)) == expected.size());
+    assert(std::memcmp(buffer, expected.data(), expected.size()) == 0);
+    std::vector<uint8_t> viaBuilder;
+    assert(builder.serializeTo(viaBuilder) && viaBuilder == expected);
+
+    std::cout << "PASS\n";
+}
+
+void testPayloadBuffer()
+{
+    std::cout << "Test: Inline Payload Storage... ";
+
+    // Scalar payloads stay inline
+    auto scalar = MessageBuilder::response(0x0010, 0x5000, 1, 0x0001)
+                      .setPayload(2.5)
+                      .build();
+    assert(scalar.payload.isInline());
+    assert(scalar.payload.size() == 8);
+
+    std::vector<uint8_t> buffer;
+    assert(serializeFrame(scalar, buffer));
+    Frame decoded;
+    assert(deserializeFrame(buffer, decoded));
+    assert(decoded.payload.isInline());
+    assert(decoded.payload == scalar.payload);
+
+    // Large payloads spill to the heap, preserving contents
+    PayloadBuffer payload{0x01, 0x02, 0x03};
+    payload.resize(100);
+    assert(!payload.isInline());
+    assert(payload.size() == 100);
+    assert(payload[0] == 0x01 && payload[2] == 0x03 && payload[99] == 0x00);
+
+    // A moved-in vector is adopted, not copied
+    std::vector<uint8_t> blob(64, 0xAB);
+    const uint8_t *blobData = blob.data();
+    PayloadBuffer adopted(std::move(blob));
+    assert(adopted.data() == blobData);
+    assert(adopted == std::vector<uint8_t>(64, 0xAB));
+
+    // Moves leave the source empty; small copies of spilled buffers go inline
+    PayloadBuffer moved(std::move(adopted));
+    assert(moved.data() == blobData);
+    assert(adopted.empty() && adopted.isInline());
+    moved.resize(4);
+    PayloadBuffer copy(moved);
+    assert(copy.isInline() && copy == moved);
+
+    // Spilled payloads keep room for a header and CRC; release() hands the allocation over
+    PayloadBuffer spilled;
+    spilled.resize(1000);
+    assert(spilled.capacity() >= 1000 + PayloadBuffer::SPILL_HEADROOM);
+    const uint8_t *spilledData = spilled.data();
+    std::vector<uint8_t> released = spilled.release();
+    assert(released.data() == spilledData && released.size() == 1000);
+    assert(spilled.empty() && spilled.isInline());
+    assert(copy.release() == std::vector<uint8_t>({0xAB, 0xAB, 0xAB, 0xAB}) && copy.empty());
+
+    // Range assignment picks inline or heap storage from the range length
+    std::vector<uint8_t> range(48);
+    for (size_t i = 0; i < range.size(); ++i)
+    {
+        range[i] = static_cast<uint8_t>(i + 1);
+    }
+    PayloadBuffer ranged;
+    ranged.assign(range.begin(), range.begin() + 8);
+    assert(ranged.isInline() && ranged.size() == 8 && ranged[7] == 8);
+    ranged.assign(range.begin(), range.end());
+    assert(!ranged.isInline() && ranged == range);
+    assert(ranged.capacity() >= range.size() + PayloadBuffer::SPILL_HEADROOM);
+    ranged.assign(range.begin(), range.begin() + 2);
+    assert(ranged.size() == 2 && ranged[1] == 2);
+
+    std::cout << "PASS\n";
+}
+
+void testPools()
+{
+    std::cout << "Test: Frame and Buffer Pools... ";
+
+    FramePool::trim();
+    Frame *recycled = nullptr;
+    {
+        PooledFrame frame = FramePool::acquire();
+        assert(frame);
+        *frame = MessageBuilder::event(0x0010, 0x4000, 1, 2).setPayload(std::vector<uint8_t>(200, 0xAB)).build();
+        frame->setCRCEnabled(true);
+        frame->crc = 0x1234;
+        recycled = frame.get();
+    }
+    assert(FramePool::cached() == 1);
+
+    // Released frames are handed out again in their default state, with their payload capacity
+    PooledFrame again = FramePool::acquire();
+    assert(again.get() == recycled);
+    assert(again->payload.capacity() >= 200 && again->payload.empty());
+    assert(again->classID == 0 && again->payloadLen == 0 && again->flags == 0 && !again->crc);
+    assert(FramePool::cached() == 0);
+
+    PooledFrame moved(std::move(again));
+    assert(!again && moved.get() == recycled);
+    moved.reset();
+    assert(!moved && FramePool::cached() == 1);
+
+    // Buffers are cleared on release
+    BufferPool::reserve(4);
+    assert(BufferPool::cached() == 4);
+    {
+        PooledBuffer buffer = BufferPool::acquire();
+        buffer->assign(64, 0xEE);
+    }
+    PooledBuffer buffer = BufferPool::acquire();
+    assert(buffer->empty());
+
+    // A handle released after its thread's free list is gone frees the object
+    std::thread exiting([]
+                        {
+        thread_local PooledFrame late; // Constructed before the free list, so destroyed after it
+        late = FramePool::acquire(); });
+    exiting.join();
+
+    std::cout << "PASS\n";
+}
+
+void testWireBuffer()
+{
+    std::cout << "Test: Shared Wire Buffer... ";
+
+    auto frame = MessageBuilder::event(0x0020, 0x4000, 2, 0x0003)
+                     .setPayload(std::string(100, 'x'))
+                     .enableCRC()
+                     .build();
+
+    std::vector<uint8_t> expected;
+    assert(serializeFrame(frame, expected));
+
+    WireBuffer wire = WireBuffer::serialize(frame);
+    assert(wire && wire.size() == expected.size());
+    assert(std::memcmp(wire.data(), expected.data(), expected.size()) == 0);
+
+    // Copies share the bytes; retain/release model an external owner
+    WireBuffer fanOut = wire;
+    assert(fanOut.data() == wire.data() && wire.useCount() == 2);
+    void *hint = wire.retain();
+    assert(wire.useCount() == 3);
+    WireBuffer::release(nullptr, hint);
+    assert(wire.useCount() == 2);
+
+    Frame invalid = frame;
+    invalid.payloadLen = 1;
+    assert(!WireBuffer::serialize(invalid));
+
+    std::cout << "PASS\n";
+}
+
+void testTopics()
+{
+    std::cout << "Test: Binary Topics... ";
+
+    auto frame = MessageBuilder::event(0x0020, 0x4000, 0x0102, 0x0A0B).setPayload(1.5f).build();
+    Topic topic = Topic::forFrame(frame);
+    const uint8_t expected[] = {0x40, 0x00, 0x01, 0x02, 0x0A, 0x0B};
+    assert(topic.size() == Topic::MAX_SIZE);
+    assert(std::memcmp(topic.data(), expected, sizeof(expected)) == 0);
+    assert(topic.classID() == 0x4000 && topic.instanceID() == 0x0102 && topic.attrID() == 0x0A0B);
+
+    // Header bytes give the same topic as the decoded frame
+    std::vector<uint8_t> wire;
+    assert(serializeFrame(frame, wire));
+    FrameView view;
+    assert(deserializeFrameView(wire.data(), wire.size(), view));
+    assert(std::memcmp(Topic::forFrame(view).data(), expected, sizeof(expected)) == 0);
+
+    // Class and instance topics are prefixes of the attribute topic
+    assert(Topic::forClass(0x4000).size() == 2 && Topic::forClass(0x4000).matches(topic.data(), topic.size()));
+    assert(Topic::forInstance(0x4000, 0x0102).matches(topic.data(), topic.size()));
+    assert(!Topic::forInstance(0x4000, 0x0103).matches(topic.data(), topic.size()));
+    assert(Topic().empty() && Topic().matches(topic.data(), topic.size()));
+    assert(topic.str().size() == Topic::MAX_SIZE);
+
+    std::cout << "PASS\n";
+}
+
+void testLastValueCache()
+{
+    std::cout << "Test: Last-Value Cache... ";
+
+    LastValueCache cache;
+    for (int i = 0; i < 100; ++i)
+    {
+        assert(cache.update(MessageBuilder::event(0x0010, 0x4000, 1, 2).setPayload(static_cast<float>(i)).build()) ==
+               (i == 0));
+    }
+    assert(cache.update(MessageBuilder::event(0x0010, 0x4000, 1, 3).setPayload(7u).build()));
+    assert(cache.update(MessageBuilder::event(0x0010, 0x4000, 2, 2).setPayload(8u).build()));
+    assert(cache.update(MessageBuilder::event(0x0010, 0x5000, 1, 2).setPayload(9u).build()));
+
+    // Only the newest value per attribute is kept
+    assert(cache.size() == 4 && cache.updates() == 103);
+    Frame latest;
+    assert(cache.get(0x4000, 1, 2, latest));
+    assert(MessageBuilder::event(0, 0, 0, 0).setPayload(99.0f).build().payload == latest.payload);
+    assert(!cache.get(0x4000, 9, 9));
+
+    // Received frames update in place
+    std::vector<uint8_t> wire;
+    assert(serializeFrame(MessageBuilder::event(0x0010, 0x5000, 1, 2).setPayload(10u).build(), wire));
+    FrameView view;
+    assert(deserializeFrameView(wire.data(), wire.size(), view));
+    assert(!cache.update(view));
+    assert(cache.get(0x5000, 1, 2)->payload == MessageBuilder::event(0, 0, 0, 0).setPayload(10u).build().payload);
+
+    // A view that does not decode is not cached
+    Frame corrupt = MessageBuilder::event(0x0010, 0x6000, 1, 2).setPayload(std::vector<uint8_t>{1, 2, 3, 4}).build();
+    corrupt.flags |= Flags::COMPRESSED;
+    assert(serializeFrame(corrupt, wire) && deserializeFrameView(wire.data(), wire.size(), view));
+    assert(!cache.update(view) && !cache.contains(0x6000, 1, 2) && cache.updates() == 104);
+
+    // Snapshots by class, instance and attribute prefix
+    std::vector<Frame> frames;
+    assert(cache.snapshot(frames) == 4);
+    frames.clear();
+    assert(cache.snapshot(frames, Topic::forClass(0x4000)) == 3);
+    frames.clear();
+    assert(cache.snapshot(frames, Topic::forInstance(0x4000, 1)) == 2);
+    frames.clear();
+    assert(cache.snapshot(frames, Topic::forAttribute(0x5000, 1, 2)) == 1 && frames[0].classID == 0x5000);
+
+    assert(cache.erase(0x5000, 1, 2) && !cache.contains(0x5000, 1, 2));
+    cache.clear();
+    assert(cache.size() == 0);
+
+    std::cout << "PASS\n";
+}
+
+void testBatch()
+{
+    std::cout << "Test: Batch Payloads... ";
+
+    BatchBuilder builder = BatchBuilder::response(0x0030, 0x3000, 7, 0x1234);
+    for (uint16_t tag = 1; tag <= 100; ++tag)
+    {
+        builder.add(tag, static_cast<float>(tag) * 0.5f);
+    }
+    builder.add(200, uint16_t(0xBEEF)).add(201, "running").add(202, std::vector<uint8_t>{1, 2, 3}).add(203);
+    assert(builder.size() == 104);
+
+    Frame frame;
+    assert(builder.build(frame));
+    assert(frame.payloadType == PayloadType::BATCH && frame.attrID == 0x1234);
+    assert(frame.payloadLen == builder.payloadSize() && frame.payloadLen == frame.payload.size());
+
+    // Round trip through the wire format
+    std::vector<uint8_t> wire;
+    assert(serializeFrame(frame, wire));
+    FrameView view;
+    assert(deserializeFrameView(wire.data(), wire.size(), view));
+
+    BatchParser batch(view);
+    assert(batch.valid() && batch.size() == 104);
+
+    std::vector<uint16_t> ids;
+    std::vector<float> values;
+    assert(batch.get(ids, values) == 100);
+    assert(ids[0] == 1 && values[0] == 0.5f && ids[99] == 100 && values[99] == 50.0f);
+
+    assert(std::get<uint16_t>(batch.find(200)->getValue()) == 0xBEEF);
+    assert(std::get<std::string>(batch.find(201)->getValue()) == "running");
+    assert(std::get<std::vector<uint8_t>>(batch.find(202)->getValue()).size() == 3);
+    assert(batch.find(203)->type == PayloadType::NONE && !batch.find(999));
+
+    size_t visited = 0;
+    batch.forEach([&visited](const BatchRecord &) { ++visited; });
+    assert(visited == 104 && batch.records().size() == 104);
+
+    // Truncated and non-batch payloads are rejected
+    assert(!BatchParser(ByteSpan(frame.payload.data(), frame.payload.size() - 1)).valid());
+    assert(!BatchParser(MessageBuilder::event(0x0010, 0x3000, 7, 1).setPayload(1u).build()).valid());
+
+    builder.clear();
+    assert(builder.empty() && builder.payloadSize() == 0 && builder.fits(PayloadType::UINT32));
+
+    std::cout << "PASS\n";
+}
+
+void testArrayPayloads()
+{
+    std::cout << "Test: Array Payloads... ";
+
+    // Every engine matches the scalar swap, including unaligned tails and in-place use
+    std::vector<uint8_t> input(8 * 1037 + 1);
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        input[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+    for (size_t width : {2u, 4u, 8u})
+    {
+        const size_t count = (input.size() - 1) / width;
+        std::vector<uint8_t> expected(count * width);
+        byteSwap(expected.data(), input.data() + 1, count, width, ByteSwapEngine::Scalar);
+        assert(expected[0] == input[width] && expected[width - 1] == input[1]);
+
+        for (ByteSwapEngine engine : {ByteSwapEngine::SSSE3, ByteSwapEngine::AVX2, ByteSwapEngine::NEON})
+        {
+            std::vector<uint8_t> out(count * width);
+            byteSwap(out.data(), input.data() + 1, count, width, engine);
+            assert(out == expected);
+
+            std::vector<uint8_t> inPlace(input.begin() + 1, input.begin() + 1 + static_cast<std::ptrdiff_t>(count * width));
+            byteSwap(inPlace.data(), inPlace.data(), count, width, engine);
+            assert(inPlace == expected);
+        }
+    }
+    assert(isByteSwapEngineSupported(activeByteSwapEngine()));
+
+    // 16K-sample spectrum round trip through the wire format
+    std::vector<float> spectrum(16383);
+    for (size_t i = 0; i < spectrum.size(); ++i)
+    {
+        spectrum[i] = static_cast<float>(i) * 0.25f - 100.0f;
+    }
+    Frame frame = MessageBuilder::event(0x0010, 0x5000, 1, 4).setPayload(spectrum).build();
+    assert(frame.payloadType == PayloadType::FLOAT32_ARRAY && frame.payloadLen == spectrum.size() * 4);
+    assert(frame.payload[0] == 0xC2 && frame.payload[1] == 0xC8); // -100.0f big-endian
+
+    std::vector<uint8_t> wire;
+    assert(serializeFrame(frame, wire));
+    Frame decoded;
+    assert(deserializeFrame(wire, decoded));
+    MessageParser parser(decoded);
+    assert(parser.getFloat32Array() == spectrum);
+    assert(!parser.getFloat64Array() && !parser.getOpaque());
+
+    std::vector<float> reused;
+    reused.reserve(spectrum.size());
+    assert(parser.getFloat32Array(reused) && reused == spectrum);
+
+    std::vector<uint16_t> trend = {1, 0x0203, 0xFFFF};
+    Frame counts = MessageBuilder::response(0x0030, 0x3000, 1, 1).setPayload(trend).build();
+    assert(counts.payload == std::vector<uint8_t>({0x00, 0x01, 0x02, 0x03, 0xFF, 0xFF}));
+    assert(std::get<std::vector<uint16_t>>(MessageParser(counts).getValue()) == trend);
+
+    std::vector<double> single = {3.5};
+    assert(MessageParser(MessageBuilder::event(1, 2, 3, 4).setPayload(single).build()).getFloat64Array() == single);
+
+    // Array payloads must hold whole elements
+    counts.payload.resize(5);
+    counts.payloadLen = 5;
+    assert(!counts.validate());
+
+    std::cout << "PASS\n";
+}
+
+void testMessageView()
+{
+    std::cout << "Test: Message View... ";
+
+    Frame text = MessageBuilder::response(0x0030, 0x3000, 7, 1).setPayload("Pump-07").build();
+    MessageView message(text);
+    assert(message.getStringView() == std::string_view("Pump-07"));
+    assert(message.getStringView()->data() == reinterpret_cast<const char *>(text.payload.data())); // No copy
+    assert(!message.getOpaqueSpan() && !message.getUInt8() && message.isResponse());
+    assert(message.classID() == 0x3000 && message.instanceID() == 7 && message.srcNode() == 0x0030);
+
+    // Views over received wire bytes reference the receive buffer
+    std::vector<uint8_t> blob = {0xDE, 0xAD, 0xBE, 0xEF};
+    std::vector<uint8_t> wire;
+    assert(serializeFrame(MessageBuilder::event(0x0010, 0x4000, 1, 2).setPayload(blob).enableCRC().build(), wire));
+    FrameView received;
+    assert(deserializeFrameView(wire.data(), wire.size(), received));
+    MessageView event(received);
+    auto bytes = event.getOpaqueSpan();
+    assert(bytes && bytes->size() == 4 && bytes->data() == wire.data() + HEADER_SIZE && (*bytes)[3] == 0xEF);
+    assert(std::get<std::vector<uint8_t>>(event.getValue()) == blob);
+
+    Frame scalar = MessageBuilder::event(0x0010, 0x4000, 1, 3).setPayload(1.5).build();
+    assert(MessageView(scalar).getFloat64() == 1.5 && !MessageView(scalar).getFloat32());
+    assert(MessageView(MessageBuilder::error(1, 2, 3, 4).setPayload(uint8_t(9)).build()).getErrorCode() == 9);
+
+    // MessageParser exposes the same views into its own frame
+    MessageParser parser(text);
+    assert(parser.getStringView() == std::string_view("Pump-07"));
+    assert(parser.getStringView()->data() == reinterpret_cast<const char *>(parser.frame().payload.data()));
+    assert(parser.getString() == std::string("Pump-07") && !parser.getOpaqueSpan());
+
+    // Compressed payloads are not readable in place, with or without zstd built in
+    Frame packed = MessageBuilder::event(0x0010, 0x4000, 1, 5).setPayload(blob).build();
+    packed.flags |= Flags::COMPRESSED;
+    assert(serializeFrame(packed, wire) && deserializeFrameView(wire.data(), wire.size(), received));
+    for (const MessageView &compressed : {MessageView(packed), MessageView(received)})
+    {
+        assert(compressed.isCompressed() && compressed.payloadType() == PayloadType::OPAQUE);
+        assert(!compressed.getOpaqueSpan() && !compressed.getStringView() && compressed.payload().size() == 4);
+        assert(std::holds_alternative<std::monostate>(compressed.getValue()));
+    }
+    assert(!MessageParser(packed).getOpaque() && !MessageView(text).isCompressed());
+
+    std::cout << "PASS\n";
+}
+
+void testTypedAttributes()
+{
+    std::cout << "Test: Typed Attributes... ";
+
+    using MotorSpeed = Attribute<0x4000, 0x0002, float>;
+    using MotorState = Attribute<0x4000, 0x0003, uint16_t>;
+    static_assert(MotorSpeed::WIRE_SIZE == HEADER_SIZE + 4, "FLOAT32 frame size");
+    static_assert(MotorSpeed::HEADER[4] == 0x40 && MotorSpeed::HEADER[9] == 0x02 &&
+                      MotorSpeed::HEADER[10] == static_cast<uint8_t>(PayloadType::FLOAT32),
+                  "Header precomputed at compile time");
+
+    // Byte-identical to the generic builder, with and without CRC
+    for (bool crc : {false, true})
+    {
+        uint8_t wire[MotorSpeed::MAX_WIRE_SIZE];
+        size_t size = build<MotorSpeed>(wire, sizeof(wire), MsgType::EVENT, 0x0010, 7, 1450.5f, crc);
+        std::vector<uint8_t> expected;
+        assert(serializeFrame(MessageBuilder::event(0x0010, 0x4000, 7, 0x0002).setPayload(1450.5f).enableCRC(crc).build(),
+                              expected));
+        assert(size == expected.size() && std::memcmp(wire, expected.data(), size) == 0);
+
+        FrameView view;
+        assert(deserializeFrameView(wire, size, view));
+        assert(parse<MotorSpeed>(view) == 1450.5f);
+        assert(!parse<MotorState>(view) && !matches<MotorState>(view));
+    }
+
+    uint8_t small[MotorState::WIRE_SIZE - 1];
+    assert(build<MotorState>(small, sizeof(small), MsgType::EVENT, 1, 1, 3) == 0);
+
+    std::vector<uint8_t> buffer;
+    assert(build<MotorState>(buffer, MsgType::RESPONSE, 0x0030, 2, 0xBEEF));
+    Frame frame;
+    assert(deserializeFrame(buffer, frame) && frame.msgType == MsgType::RESPONSE && frame.instanceID == 2);
+    assert(parse<MotorState>(frame) == 0xBEEF && !parse<MotorSpeed>(frame));
+
+    std::cout << "PASS\n";
+}
+
+void testFrameDecoder()
+{
+    std::cout << "Test: Streaming Frame Decoder... ";
+
+    // A byte stream of 50 frames with noise in front and between frames
+    std::vector<uint8_t> stream = {0x00, 0xFF, 0x01, 0x42};
+    std::vector<Frame> sent;
+    for (uint16_t i = 0; i < 50; ++i)
+    {
+        MessageBuilder builder = MessageBuilder::event(0x0010, 0x4000, i, 2);
+        if (i % 3 == 0)
+        {
+            builder.setPayload("reading " + std::to_string(i));
+        }
+        else
+        {
+            builder.setPayload(static_cast<float>(i));
+        }
+        sent.push_back(builder.enableCRC().build());
+
+        std::vector<uint8_t> wire;
+        assert(serializeFrame(sent.back(), wire));
+        if (i == 20)
+        {
+            wire[wire.size() - 1] ^= 0xFF; // Corrupt CRC: dropped, decoder resyncs
+        }
+        stream.insert(stream.end(), wire.begin(), wire.end());
+        if (i == 30)
+        {
+            stream.insert(stream.end(), {0x01, 0x03, 0x00}); // Truncated header noise
+        }
+    }
+
+    // Feed in awkward chunk sizes so frames straddle chunk boundaries
+    for (size_t chunk : {size_t(1), size_t(7), size_t(13), size_t(4096)})
+    {
+        FrameDecoder decoder(FrameDecoder::Options{true});
+        std::vector<Frame> frames;
+        for (size_t offset = 0; offset < stream.size(); offset += chunk)
+        {
+            decoder.feed(stream.data() + offset, std::min(chunk, stream.size() - offset), frames);
+        }
+
+        assert(frames.size() == 49 && decoder.stats().frames == 49);
+        assert(decoder.stats().discardedBytes > 0 && decoder.stats().resyncs == 3);
+        assert(decoder.buffered() == 0);
+        for (size_t i = 0, expected = 0; i < frames.size(); ++i, ++expected)
+        {
+            expected += (expected == 20) ? 1 : 0;
+            assert(frames[i].instanceID == expected && frames[i].payload == sent[expected].payload);
+        }
+    }
+
+    // Views reference the caller's chunk on the fast path
+    std::vector<uint8_t> wire;
+    assert(serializeFrame(MessageBuilder::request(1, 2, 3, 4).build(), wire));
+    FrameDecoder decoder;
+    const uint8_t *seen = nullptr;
+    assert(decoder.feed(wire.data(), wire.size(), [&seen](const FrameView &view) { seen = view.data(); }) == 1);
+    assert(seen == wire.data());
+
+    // A partial frame waits for its remainder
+    assert(decoder.feed(wire.data(), 5, [](const FrameView &) {}) == 0 && decoder.buffered() == 5);
+    assert(decoder.feed(wire.data() + 5, wire.size() - 5, [](const FrameView &) {}) == 1);
+    decoder.reset();
+    assert(decoder.buffered() == 0 && decoder.stats().frames == 0);
+
+    // Pull style: receive straight into the decoder, then drain complete frames
+    FrameDecoder pull(FrameDecoder::Options{true, 0});
+    size_t pulled = 0;
+    for (size_t offset = 0; offset < stream.size(); offset += 1000)
+    {
+        const size_t size = std::min(size_t(1000), stream.size() - offset);
+        Span<uint8_t> space = pull.prepare(size);
+        std::memcpy(space.data(), stream.data() + offset, size);
+        pull.commit(size);
+        for (FrameView view; pull.next(view); ++pulled)
+        {
+            assert(view.validate());
+        }
+    }
+    assert(pulled == 49 && pull.buffered() == 0);
+
+    // A stream torn mid-frame (a sender that gave up after a short write) and then
+    // resumed with whole frames: the torn frame is lost, the ones after it are not
+    std::vector<std::vector<uint8_t>> wires(4);
+    for (uint16_t i = 0; i < wires.size(); ++i)
+    {
+        assert(serializeFrame(MessageBuilder::event(0x0010, 0x5000, i, 2)
+                                  .setPayload(std::vector<uint8_t>(300, static_cast<uint8_t>(i)))
+                                  .enableCRC()
+                                  .build(),
+                              wires[i]));
+    }
+    std::vector<uint8_t> torn(wires[0]);
+    torn.insert(torn.end(), wires[1].begin(), wires[1].begin() + HEADER_SIZE + 100);
+    for (size_t i = 2; i < wires.size(); ++i)
+    {
+        torn.insert(torn.end(), wires[i].begin(), wires[i].end());
+    }
+    for (size_t chunk : {size_t(1), size_t(64), torn.size()})
+    {
+        FrameDecoder resumed(FrameDecoder::Options{true});
+        std::vector<Frame> frames;
+        for (size_t offset = 0; offset < torn.size(); offset += chunk)
+        {
+            resumed.feed(torn.data() + offset, std::min(chunk, torn.size() - offset), frames);
+        }
+        assert(frames.size() == 3 && resumed.buffered() == 0 && resumed.stats().resyncs == 1);
+        assert(frames[0].instanceID == 0 && frames[1].instanceID == 2 && frames[2].instanceID == 3);
+    }
+
+    // Truncated at the end, then the rest arrives on a reconnect: reset() drops the
+    // stale prefix so the new stream decodes cleanly
+    FrameDecoder reconnect(FrameDecoder::Options{true});
+    std::vector<Frame> frames;
+    assert(reconnect.feed(wires[0].data(), HEADER_SIZE + 10, frames) == 0 && reconnect.buffered() > 0);
+    reconnect.reset();
+    assert(reconnect.feed(wires[1].data(), wires[1].size(), frames) == 1 && frames[0].instanceID == 1);
+    assert(reconnect.stats().resyncs == 0 && reconnect.buffered() == 0);
+
+    std::cout << "PASS\n";
+}
+
+#ifdef LIMP_HAS_TCP
+void testTcpPartialWrite()
+{
+    std::cout << "Test: TCP Partial Write... ";
+
+    int fds[2];
+    assert(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+
+    // Nobody reads the other end, so the send buffer fills and the batch times out
+    TCPConfig config;
+    config.sendTimeout = 20;
+    config.sendBufferSize = 4096;
+    TCPTransport sender(fds[0], config);
+    sender.setErrorCallback([](const std::string &) {});
+
+    std::vector<Frame> batch;
+    for (uint16_t i = 0; i < 256; ++i)
+    {
+        batch.push_back(MessageBuilder::event(0x0010, 0x6000, i, 2)
+                            .setPayload(std::vector<uint8_t>(4000, static_cast<uint8_t>(i)))
+                            .build());
+    }
+    size_t sent = 0;
+    TransportError result = sender.sendBatch(Span<const Frame>(batch.data(), batch.size()), sent);
+    assert(result == TransportError::Timeout || result == TransportError::SocketClosed);
+    assert(sent < batch.size());
+
+    const bool torn = result == TransportError::SocketClosed;
+    assert(torn == !sender.isConnected());
+    sender.close();
+
+    // The peer decodes exactly the frames reported as sent; only a torn frame is left over
+    FrameDecoder decoder;
+    std::vector<Frame> received;
+    uint8_t chunk[8192];
+    ssize_t n;
+    while ((n = ::recv(fds[1], chunk, sizeof(chunk), 0)) > 0)
+    {
+        decoder.feed(chunk, static_cast<size_t>(n), received);
+    }
+    assert(received.size() == sent && (decoder.buffered() > 0) == torn);
+    for (size_t i = 0; i < received.size(); ++i)
+    {
+        assert(received[i].instanceID == i && received[i].payload == batch[i].payload);
+    }
+
+    ::close(fds[1]);
+    std::cout << "PASS\n";
+}
+#endif
+
+#ifdef LIMP_HAS_ZMQ
+void testZmqReactor()
+{
+    std::cout << "Test: ZMQ Reactor... ";
+
+    // inproc endpoints only connect sockets of the same context
+    ZMQConfig config;
+    config.useSharedContext = true;
+    ZMQRouter router(config);
+    ZMQDealer dealer(config);
+    assert(router.bind("inproc://limp-test-reactor") == TransportError::None);
+    assert(dealer.setIdentity("reactor-peer") == TransportError::None);
+    assert(dealer.connect("inproc://limp-test-reactor") == TransportError::None);
+
+    // The router can only address the dealer once it has heard from it
+    std::string identity;
+    Frame hello;
+    assert(dealer.send(MessageBuilder::event(0x0001, 0x4000, 1, 1).build()) == TransportError::None);
+    assert(router.receive(identity, hello, 1000) == TransportError::None && identity == "reactor-peer");
+
+    ZMQReactor reactor;
+    std::vector<uint16_t> seen;
+    size_t errors = 0;
+    reactor.setErrorCallback([](const std::string &) {});
+    reactor.setErrorEventCallback([&](const ErrorEvent &event)
+                                  { assert(event.error == TransportError::DeserializationFailed); ++errors; });
+    reactor.add(dealer, [&](const Frame &frame) { seen.push_back(frame.instanceID); });
+
+    // Undecodable frames count against the batch: the good frame behind them waits for the next poll
+    const std::vector<uint8_t> peer(identity.begin(), identity.end());
+    const uint8_t junk[3] = {0xDE, 0xAD, 0x00};
+    for (size_t i = 0; i < ZMQReactor::DISPATCH_BATCH; ++i)
+    {
+        assert(router.sendRaw(peer, junk, sizeof(junk)) == TransportError::None);
+    }
+    assert(router.send(identity, MessageBuilder::event(0x0001, 0x4000, 7, 1).build()) == TransportError::None);
+    assert(reactor.poll(1000) == static_cast<int>(ZMQReactor::DISPATCH_BATCH));
+    assert(seen.empty() && errors == ZMQReactor::DISPATCH_BATCH);
+    assert(reactor.poll(1000) == 1 && seen.size() == 1 && seen[0] == 7);
+
+    // A throwing callback propagates out of poll() and leaves the reactor usable
+    bool throwNext = true;
+    reactor.add(dealer, [&](const Frame &frame)
+                {
+                    if (throwNext)
+                    {
+                        throwNext = false;
+                        throw std::runtime_error("callback failed");
+                    }
+                    seen.push_back(frame.instanceID);
+                });
+    assert(router.send(identity, MessageBuilder::event(0x0001, 0x4000, 8, 1).build()) == TransportError::None);
+    assert(router.send(identity, MessageBuilder::event(0x0001, 0x4000, 9, 1).build()) == TransportError::None);
+    bool thrown = false;
+    try
+    {
+        reactor.poll(1000);
+    }
+    catch (const std::runtime_error &)
+    {
+        thrown = true;
+    }
+    assert(thrown && reactor.poll(1000) == 1 && seen.back() == 9);
+    assert(reactor.remove(dealer) && reactor.size() == 0);
+
+    // A stop() issued before run() is honored, then cleared for the next run
+    reactor.stop();
+    reactor.run(10);
+    std::thread runner([&] { reactor.run(10); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    reactor.stop();
+    runner.join();
+
+    std::cout << "PASS\n";
+}
+
+void testTransactionalDealer()
+{
+    std::cout << "Test: Transactional Dealer Async Requests... ";
+
+    ZMQConfig config;
+    config.useSharedContext = true;
+    ZMQRouter router(config);
+    assert(router.bind("inproc://limp-test-transactional") == TransportError::None);
+
+    auto tracker = std::make_shared<TransactionTracker>();
+    TransactionalDealer dealer(tracker, config);
+    assert(dealer.setIdentity("plc-client") == TransportError::None);
+    assert(dealer.connect("inproc://limp-test-transactional") == TransportError::None);
+
+    std::vector<uint16_t> unsolicited;
+    std::vector<uint16_t> unmatched;
+    dealer.setUnsolicitedCallback([&](const Frame &frame)
+                                  { unsolicited.push_back(frame.attrID); });
+    dealer.setUnmatchedReplyCallback([&](const Frame &frame)
+                                     { unmatched.push_back(frame.attrID); });
+
+    // A reply completes its future
+    std::future<Frame> ok = dealer.asyncRequest(MessageBuilder::request(0x0010, 0x4000, 1, 0x0101).build());
+    std::string identity;
+    Frame request;
+    assert(router.receive(identity, request, 1000) == TransportError::None && request.attrID == 0x0101);
+    assert(router.send(identity, MessageBuilder::response(0x0030, 0x4000, 1, 0x0101).setPayload(42u).build()) ==
+           TransportError::None);
+    assert(dealer.pollResponses(1000) == 1);
+    assert(ok.get().msgType == MsgType::RESPONSE && tracker->getPendingCount() == 0);
+
+    // An ERROR reply fails it, carrying the frame
+    std::future<Frame> rejected = dealer.asyncRequest(MessageBuilder::request(0x0010, 0x4000, 1, 0x0102).build());
+    assert(router.receive(identity, request, 1000) == TransportError::None);
+    assert(router.send(identity, MessageBuilder::error(0x0030, 0x4000, 1, 0x0102).setPayload(uint8_t(3)).build()) ==
+           TransportError::None);
+    assert(dealer.pollResponses(1000) == 1);
+    try
+    {
+        rejected.get();
+        assert(false);
+    }
+    catch (const TransactionFailure &failure)
+    {
+        assert(failure.error() == TransportError::None && failure.reply());
+        assert(failure.reply()->msgType == MsgType::ERROR && failure.reply()->attrID == 0x0102);
+    }
+
+    // An unanswered request times out through the tracker; a duplicate AttrID is refused
+    TransportError outcome = TransportError::None;
+    const Frame slow = MessageBuilder::request(0x0010, 0x4000, 1, 0x0103).build();
+    assert(dealer.asyncRequest(slow, [&](TransportError error, const Frame *)
+                               { outcome = error; }) == TransportError::None);
+    assert(dealer.asyncRequest(slow, [](TransportError, const Frame *) {}) == TransportError::InvalidFrame);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    assert(tracker->cleanupTimedOutTransactions(std::chrono::milliseconds(1)) == 1);
+    assert(outcome == TransportError::Timeout && tracker->getPendingCount() == 0);
+
+    // Its late reply and a non-reply frame go to separate callbacks
+    assert(router.receive(identity, request, 1000) == TransportError::None && request.attrID == 0x0103);
+    assert(router.send(identity, MessageBuilder::response(0x0030, 0x4000, 1, 0x0103).build()) == TransportError::None);
+    assert(router.send(identity, MessageBuilder::event(0x0030, 0x4000, 1, 0x0200).build()) == TransportError::None);
+    size_t polled = 0;
+    for (int attempt = 0; attempt < 10 && polled < 2; ++attempt)
+    {
+        polled += dealer.pollResponses(100);
+    }
+    assert((unmatched == std::vector<uint16_t>{0x0103}) && (unsolicited == std::vector<uint16_t>{0x0200}));
+
+    std::cout << "PASS\n";
+}
+
+void testRoutingTable()
+{
+    std::cout << "Test: Routing Table... ";
+
+    RoutingTable routes;
+    assert(routes.add(0x0030, PeerId(std::string("PLC"))) && routes.add(0x0010, PeerId(std::string("HMI"))));
+    assert(!routes.add(0x0030, PeerId(std::string("PLC"))) && routes.size() == 2);
+
+    // forEach() walks node ID order and sees updates made since the last walk
+    std::vector<uint16_t> order;
+    routes.forEach([&](const Route &route)
+                   { order.push_back(route.nodeID); });
+    assert((order == std::vector<uint16_t>{0x0010, 0x0030}));
+
+    const Route *plc = routes.lookup(0x0030);
+    assert(routes.add(0x0030, PeerId(std::string("PLC-2"))) && routes.remove(0x0010) && !routes.remove(0x0010));
+    assert(plc->identity == PeerId(std::string("PLC"))); // Retired, not freed
+    order.clear();
+    routes.forEach([&](const Route &route)
+                   { order.push_back(route.nodeID); });
+    assert((order == std::vector<uint16_t>{0x0030}) && routes.size() == 1);
+    assert(routes.lookup(0x0030)->identity == PeerId(std::string("PLC-2")));
+    assert(routes.reclaim() == 2);
+
+    routes.clear();
+    size_t visited = 0;
+    routes.forEach([&](const Route &)
+                   { ++visited; });
+    assert(visited == 0 && routes.size() == 0 && !routes.lookup(0x0030) && routes.reclaim() == 1);
+
+    std::cout << "PASS\n";
+}
+
+void testConcurrentSender()
+{
+    std::cout << "Test: Concurrent Sender... ";
+
+    // One frame per batch: instance 1 is refused once (EAGAIN), instance 2 hits a dead socket
+    ConcurrentSender::Options options;
+    options.batchSize = 1;
+    int refusals = 1;
+    std::vector<uint16_t> delivered;
+    ConcurrentSender sender([&](Span<const Frame> frames, size_t &sent)
+                            {
+                                sent = 0;
+                                if (frames[0].instanceID == 1 && refusals > 0)
+                                {
+                                    --refusals;
+                                    errno = EAGAIN;
+                                    return TransportError::SendFailed;
+                                }
+                                if (frames[0].instanceID == 2)
+                                {
+                                    errno = ENOTSOCK;
+                                    return TransportError::SendFailed;
+                                }
+                                delivered.push_back(frames[0].instanceID);
+                                sent = 1;
+                                return TransportError::None;
+                            },
+                            options);
+    std::vector<ErrorEvent> events;
+    sender.setErrorEventCallback([&](const ErrorEvent &event) { events.push_back(event); });
+
+    assert(sender.send(MessageBuilder::event(0x0001, 0x4000, 1, 1).build()) == TransportError::NotConnected);
+    assert(sender.start() == TransportError::None);
+    for (uint16_t id = 1; id <= 3; ++id)
+    {
+        assert(sender.send(MessageBuilder::event(0x0001, 0x4000, id, 1).build()) == TransportError::None);
+    }
+    assert(sender.flush(1000));
+    sender.stop();
+
+    const ConcurrentSender::Stats stats = sender.getStats();
+    assert(delivered.size() == 2 && delivered[0] == 1 && delivered[1] == 3);
+    assert(stats.sent == 2 && stats.retried == 1 && stats.dropped == 1);
+    assert(events.size() == 1 && events[0].error == TransportError::SendFailed);
+    assert(events[0].operation == TransportOperation::Send && events[0].errnum == ENOTSOCK);
+    assert(sender.send(MessageBuilder::event(0x0001, 0x4000, 4, 1).build()) == TransportError::NotConnected);
+
+    std::cout << "PASS\n";
+}
+
+void testZmqProxy()
+{
+    std::cout << "Test: ZMQ Proxy Start... ";
+
+    ZMQConfig config;
+    config.useSharedContext = true;
+    ZMQProxy proxy(ZMQProxy::ProxyType::XPUB_XSUB, config);
+    proxy.setErrorCallback([](const std::string &) {});
+    assert(proxy.setFrontend("inproc://limp-test-proxy-in") == TransportError::None);
+    assert(proxy.setBackend("inproc://limp-test-proxy-out") == TransportError::None);
+
+    // Running as soon as start() returns; a second start() is refused, not fatal
+    assert(proxy.start() == TransportError::None && proxy.isRunning());
+    assert(proxy.pause() == TransportError::None && proxy.isPaused());
+    ZMQProxy::Stats stats;
+    assert(proxy.stats(stats, 1000) == TransportError::None);
+    assert(proxy.resume() == TransportError::None);
+    assert(proxy.start() == TransportError::ConfigurationError);
+
+    // A busy endpoint fails start() itself and leaves the proxy ready for another start()
+    ZMQProxy busy(ZMQProxy::ProxyType::XPUB_XSUB, config);
+    std::vector<ErrorEvent> events;
+    busy.setErrorEventCallback([&](const ErrorEvent &event) { events.push_back(event); });
+    assert(busy.setFrontend("inproc://limp-test-proxy-in") == TransportError::None);
+    assert(busy.setBackend("inproc://limp-test-proxy-other") == TransportError::None);
+    assert(busy.start() == TransportError::BindFailed && !busy.isRunning());
+    assert(events.size() == 1 && events[0].operation == TransportOperation::Bind);
+    assert(busy.pause() == TransportError::NotConnected);
+
+    assert(busy.setFrontend("inproc://limp-test-proxy-free") == TransportError::None);
+    assert(busy.start() == TransportError::None && busy.isRunning());
+    busy.stop();
+    proxy.stop();
+    assert(!proxy.isRunning());
+
+    std::cout << "PASS\n";
+}
+
+void testSubscriberConflation()
+{
+    std::cout << "Test: ZMQ Subscriber Conflation... ";
+
+    ZMQConfig config;
+    config.useSharedContext = true;
+    ZMQPublisher publisher(config);
+    ZMQSubscriber subscriber(config);
+    assert(publisher.bind("inproc://limp-test-conflate") == TransportError::None);
+    assert(subscriber.connect("inproc://limp-test-conflate") == TransportError::None);
+    assert(subscriber.subscribe("") == TransportError::None);
+
+    // The subscription reaches the publisher asynchronously: publish until one arrives
+    Frame probe;
+    do
+    {
+        assert(publisher.publish(MessageBuilder::event(0x0010, 0x4000, 9, 9).build()) == TransportError::None);
+    } while (subscriber.receive(probe, 10) == TransportError::Timeout);
+    while (subscriber.receive(probe, 10) == TransportError::None)
+    {
+    }
+
+    // maxFrames 0 applies everything queued; each attribute keeps its newest value
+    for (uint32_t value = 1; value <= 5; ++value)
+    {
+        const uint16_t attr = static_cast<uint16_t>(value % 2 + 1);
+        assert(publisher.publish(MessageBuilder::event(0x0010, 0x4000, 1, attr).setPayload(value).build()) ==
+               TransportError::None);
+    }
+    LastValueCache cache;
+    size_t received = 0;
+    assert(subscriber.receiveInto(cache, 0, received, 1000) == TransportError::None && received == 5);
+    assert(cache.size() == 2);
+    MessageParser latest(*cache.get(0x4000, 1, 2));
+    assert(latest.getUInt32() == 5u);
+    assert(subscriber.receiveInto(cache, 0, received, 0) == TransportError::Timeout && received == 0);
+
+    // A limit still stops early
+    for (uint32_t value = 6; value <= 8; ++value)
+    {
+        assert(publisher.publish(MessageBuilder::event(0x0010, 0x4000, 1, 1).setPayload(value).build()) ==
+               TransportError::None);
+    }
+    assert(subscriber.receiveInto(cache, 2, received, 1000) == TransportError::None && received == 2);
+    assert(subscriber.receiveInto(cache, 0, received, 0) == TransportError::None && received == 1);
+
+    std::cout << "PASS\n";
+}
+
+void testZmqProxyCluster()
+{
+    std::cout << "Test: ZMQ Proxy Cluster... ";
+
+    ZMQConfig config;
+    config.useSharedContext = true;
+    ZMQProxyCluster cluster(config);
+    std::vector<ErrorEvent> events;
+    cluster.setErrorEventCallback([&](const ErrorEvent &event) { events.push_back(event); });
+
+    assert(cluster.start() == TransportError::ConfigurationError);
+    assert(cluster.addShard("", "inproc://limp-test-shard-out") == TransportError::InvalidEndpoint);
+    assert(events.size() == 2 && events[0].error == TransportError::ConfigurationError);
+    assert(events[1].error == TransportError::InvalidEndpoint && events[1].operation == TransportOperation::Setup);
+
+    assert(cluster.addShard("inproc://limp-test-shard-in0", "inproc://limp-test-shard-out0") == TransportError::None);
+    assert(cluster.addShard("inproc://limp-test-shard-in1", "inproc://limp-test-shard-out1") == TransportError::None);
+    assert(cluster.start() == TransportError::None && cluster.isRunning());
+    assert(cluster.shardFor("plc7/temp") < cluster.shardCount());
+    ZMQProxy::Stats stats;
+    assert(cluster.stats(stats, 1000) == TransportError::None);
+    assert(cluster.stats(2, stats) == TransportError::ConfigurationError);
+    assert(cluster.addShard("inproc://limp-test-shard-in2", "inproc://limp-test-shard-out2") ==
+           TransportError::ConfigurationError);
+    assert(events.size() == 3 && std::strcmp(events[2].context, "cluster add shard") == 0);
+    cluster.stop();
+    assert(!cluster.isRunning());
+
+    // A busy shard endpoint fails start() and stops the shards started before it
+    ZMQProxy blocker(ZMQProxy::ProxyType::XPUB_XSUB, config);
+    blocker.setErrorCallback([](const std::string &) {});
+    assert(blocker.setFrontend("inproc://limp-test-shard-busy-in") == TransportError::None);
+    assert(blocker.setBackend("inproc://limp-test-shard-busy-out") == TransportError::None);
+    assert(blocker.start() == TransportError::None);
+
+    ZMQProxyCluster partial(config);
+    events.clear();
+    partial.setErrorEventCallback([&](const ErrorEvent &event) { events.push_back(event); });
+    assert(partial.addShard("inproc://limp-test-shard-a-in", "inproc://limp-test-shard-a-out") == TransportError::None);
+    assert(partial.addShard("inproc://limp-test-shard-busy-in", "inproc://limp-test-shard-b-out") ==
+           TransportError::None);
+    assert(partial.start() == TransportError::BindFailed && !partial.isRunning());
+    assert(events.size() == 1 && events[0].error == TransportError::BindFailed);
+    assert(events[0].operation == TransportOperation::Bind && std::strcmp(events[0].context, "proxy frontend") == 0);
+    assert(partial.stats(0, stats, 100) == TransportError::NotConnected);
+    assert(partial.pause() == TransportError::NotConnected);
+    blocker.stop();
+
+    std::cout << "PASS\n";
+}
+#endif
+
+#ifdef LIMP_HAS_CAPTURE
+void testCaptureLog()
+{
+    std::cout << "Test: Capture Record/Replay/Seek... ";
+
+    const std::string path = "/tmp/limp_test_capture_" + std::to_string(::getpid());
+    const std::vector<uint8_t> payload(600, 0x5A);
+    constexpr uint16_t COUNT = 4000; // About 2.5 MB: spans several 1 MB segments
+
+    FrameRecorder::Options options;
+    options.segmentSize = FrameRecorder::MIN_SEGMENT_SIZE;
+    FrameRecorder recorder(options);
+    assert(recorder.open(path) == TransportError::None);
+    for (uint16_t i = 0; i < COUNT; ++i)
+    {
+        Frame frame = MessageBuilder::event(0x0010, 0x4000, i, 1).setPayload(payload).build();
+        assert(recorder.record(frame, 1000ull * (i + 1)) == TransportError::None);
+    }
+    assert(recorder.recordCount() == COUNT && recorder.segmentCount() > 1);
+
+    // A log still being written reads up to its last completed record
+    FrameReplayer replayer;
+    assert(replayer.open(path) == TransportError::None);
+    FrameView view;
+    uint64_t timestamp = 0;
+    uint16_t expected = 0;
+    while (replayer.next(view, timestamp))
+    {
+        assert(view.instanceID() == expected && timestamp == 1000ull * (expected + 1));
+        ++expected;
+    }
+    assert(expected == COUNT);
+    replayer.close();
+    recorder.close();
+
+    assert(replayer.open(path) == TransportError::None);
+    assert(replayer.segmentCount() == recorder.segmentCount() && replayer.firstTimestamp() == 1000);
+
+    // seek() lands on the first record at or after the time, also between records
+    assert(replayer.seek(1000ull * 2500) && replayer.next(view, timestamp) && view.instanceID() == 2499);
+    assert(replayer.seek(1000ull * 2500 - 1) && replayer.next(view, timestamp) && view.instanceID() == 2499);
+    assert(!replayer.seek(1000ull * (COUNT + 1)) && !replayer.next(view, timestamp));
+
+    // replay() hands every remaining record to the sink, unpaced at speed 0
+    FrameReplayer::Options unpaced;
+    unpaced.speed = 0;
+    FrameReplayer fast(unpaced);
+    assert(fast.open(path) == TransportError::None && fast.seek(1000ull * 3001));
+    size_t replayed = 0;
+    std::vector<uint16_t> instances;
+    auto sink = [&](const FrameView &frame, uint64_t)
+    {
+        instances.push_back(frame.instanceID());
+        return TransportError::None;
+    };
+    assert(fast.replay(sink, replayed) == TransportError::None);
+    assert(replayed == COUNT - 3000 && instances.front() == 3000 && instances.back() == COUNT - 1);
+
+    const size_t segments = fast.segmentCount();
+    fast.close();
+    replayer.close();
+    for (size_t sequence = 0; sequence < segments; ++sequence)
+    {
+        char suffix[32];
+        std::snprintf(suffix, sizeof(suffix), ".%06zu.limplog", sequence);
+        std::remove((path + suffix).c_str());
+    }
+
+    std::cout << "PASS\n";
+}
+#endif
+
+#ifdef LIMP_HAS_SHM
+void testShmTransport()
+{
+    std::cout << "Test: SHM Transport... ";
+
+    const std::string endpoint = "shm://limp-test-" + std::to_string(::getpid());
+    SHMConfig config;
+    config.ringSize = SharedMemoryRing::MIN_CAPACITY;
+    SHMTransport server(config);
+    SHMTransport client(config);
+    assert(server.bind(endpoint) == TransportError::None);
+    assert(client.connect(endpoint) == TransportError::None);
+
+    // Nothing queued: the receive waits for the timeout and returns empty-handed
+    FrameView view;
+    const auto waitStart = std::chrono::steady_clock::now();
+    assert(server.receiveView(view, 20) == TransportError::Timeout);
+    assert(std::chrono::steady_clock::now() - waitStart >= std::chrono::milliseconds(15));
+    assert(server.receiveView(view, 0) == TransportError::Timeout);
+
+    // About 60 KB per record does not divide the 256 KB ring, so the writer regularly
+    // pads out the end of the ring; the ring wraps about ten times
+    constexpr uint16_t COUNT = 40;
+    constexpr uint16_t IN_FLIGHT = 3;
+    std::vector<uint8_t> payload(60000);
+    auto fill = [&payload](uint16_t i)
+    {
+        for (size_t b = 0; b < payload.size(); ++b)
+        {
+            payload[b] = static_cast<uint8_t>(b * 31 + i);
+        }
+    };
+    uint16_t sent = 0;
+    uint16_t received = 0;
+    while (received < COUNT)
+    {
+        if (sent < COUNT && sent - received < IN_FLIGHT)
+        {
+            fill(sent);
+            assert(client.send(MessageBuilder::event(0x0010, 0x4000, sent, 1).setPayload(payload).build()) ==
+                   TransportError::None);
+            ++sent;
+            continue;
+        }
+        assert(server.receiveView(view, 1000) == TransportError::None);
+        fill(received);
+        assert(view.instanceID() == received && view.payloadLen() == payload.size());
+        assert(std::equal(payload.begin(), payload.end(), view.payload().begin()));
+        ++received;
+    }
+
+    // The way back is a separate ring
+    Frame reply;
+    assert(server.send(MessageBuilder::response(0x0020, 0x4000, 7, 1).setPayload(static_cast<uint32_t>(42)).build()) ==
+           TransportError::None);
+    assert(client.receive(reply, 1000) == TransportError::None && reply.instanceID == 7);
+    assert(client.receive(reply, 0) == TransportError::Timeout);
+    client.close();
+    server.close();
+
+    // A ring left behind by an exited process is replaced ...
+    const std::string ringName = "/limp.test-stale-" + std::to_string(::getpid());
+    pid_t child = ::fork();
+    assert(child >= 0);
+    if (child == 0)
+    {
+        SharedMemoryRing orphan;
+        ::_exit(orphan.create(ringName, SharedMemoryRing::MIN_CAPACITY, false) == TransportError::None ? 0 : 1);
+    }
+    int status = 0;
+    assert(::waitpid(child, &status, 0) == child && WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    SharedMemoryRing ring;
+    assert(ring.create(ringName, SharedMemoryRing::MIN_CAPACITY, false) == TransportError::None);
+
+    // ... one whose owner is alive is not
+    SharedMemoryRing rival;
+    errno = 0;
+    assert(rival.create(ringName, SharedMemoryRing::MIN_CAPACITY, false) == TransportError::BindFailed);
+    assert(errno == EEXIST && !rival.isOpen());
+    assert(ring.write(reinterpret_cast<const uint8_t *>("ok"), 2, 0, 0) == TransportError::None);
+    ring.close();
+
+    std::cout << "PASS\n";
+}
+#endif
+
+#ifdef LIMP_HAS_UDP
+void testUdpMulticast()
+{
+    std::cout << "Test: UDP Multicast Batches and Gaps... ";
+
+    // Loopback interface only, on a port derived from the pid to keep parallel runs apart
+    const std::string endpoint = "udp://239.192.0.77:" + std::to_string(20000 + ::getpid() % 20000);
+    UDPConfig config;
+    config.interfaceAddress = "127.0.0.1";
+    config.batchSize = 4;
+    config.receiveBufferSize = 1 << 20;
+    UDPMulticastTransport receiver(config);
+    UDPMulticastTransport publisher(config);
+    assert(receiver.join(endpoint) == TransportError::None);
+    assert(publisher.connect(endpoint) == TransportError::None);
+
+    std::vector<uint32_t> gaps;
+    receiver.setGapCallback([&gaps](uint16_t node, uint32_t lost)
+                            {
+                                assert(node == 0x0010);
+                                gaps.push_back(lost); });
+
+    // Ten frames in batches of four: three sendmmsg calls
+    std::vector<Frame> frames;
+    for (uint16_t i = 0; i < 10; ++i)
+    {
+        frames.push_back(
+            MessageBuilder::event(0x0010, 0x4000, i, 1).setPayload(static_cast<uint32_t>(i * 1000)).build());
+    }
+    size_t sent = 0;
+    assert(publisher.sendBatch(Span<const Frame>(frames.data(), frames.size()), sent) == TransportError::None);
+    assert(sent == frames.size());
+
+    // Loopback delivers during sendmmsg, so all ten are queued: 6 (two fills), then the last 4
+    std::vector<Frame> received;
+    std::vector<Frame> batch;
+    assert(receiver.receiveBatch(batch, 6, 1000) == TransportError::None && batch.size() == 6);
+    received = batch;
+    assert(receiver.receiveBatch(batch, 6, 1000) == TransportError::None && batch.size() == 4);
+    received.insert(received.end(), batch.begin(), batch.end());
+    for (size_t i = 0; i < frames.size(); ++i)
+    {
+        assert(received[i].instanceID == frames[i].instanceID && received[i].payload == frames[i].payload);
+        assert(received[i].flags & Flags::SEQUENCED);
+    }
+    assert(receiver.receiveBatch(batch, 6, 20) == TransportError::Timeout && batch.empty());
+
+    // A datagram numbered 13 from the same socket skips sequences 10-12
+    std::vector<uint8_t> skipped;
+    Frame ahead = MessageBuilder::event(0x0010, 0x4000, 99, 1).build();
+    ahead.flags |= Flags::SEQUENCED;
+    assert(serializeFrame(ahead, skipped));
+    skipped.insert(skipped.end(), {0, 0, 0, 13});
+    assert(publisher.sendRaw(skipped.data(), skipped.size()) == TransportError::None);
+    Frame frame;
+    assert(receiver.receive(frame, 1000) == TransportError::None && frame.instanceID == 99);
+    assert((gaps == std::vector<uint32_t>{3}));
+
+    // The publisher's own counter is behind now: its next frame arrives as a late datagram
+    assert(publisher.send(frames[0]) == TransportError::None);
+    assert(receiver.receive(frame, 1000) == TransportError::None && frame.instanceID == 0);
+
+    const UDPMulticastTransport::Stats stats = receiver.stats();
+    assert(stats.framesReceived == 12 && stats.invalidDatagrams == 0);
+    assert(stats.gaps == 1 && stats.lostFrames == 3 && stats.reordered == 1);
+    assert(publisher.stats().framesSent == 11);
+
+    std::cout << "PASS\n";
+}
+#endif
+
+void testSequencedFlag()
+{
+    std::cout << "Test: Sequenced Flag... ";
+
+    auto frame = MessageBuilder::event(0x0010, 0x3000, 1, 0x0001)
+                     .setPayload(static_cast<uint32_t>(7))
+                     .enableCRC()
+                     .build();
+    frame.flags |= Flags::SEQUENCED;
+    assert(frame.validate());
+
+    // The bit is carried in the header and covered by the CRC
+    std::vector<uint8_t> buffer;
+    assert(serializeFrame(frame, buffer));
+    uint8_t header[HEADER_SIZE];
+    serializeFrameHeader(frame, header);
+    assert(std::memcmp(header, buffer.data(), HEADER_SIZE) == 0);
+
+    FrameView view;
+    assert(deserializeFrameView(buffer.data(), buffer.size(), view));
+    assert(view.isSequenced() && view.hasCRC());
+    assert(FrameDecoder::isPlausibleHeader(buffer.data(), true));
+
+    // Remaining bits stay reserved
+    frame.flags |= 0x80;
+    assert(!frame.validate());
+
+    std::cout << "PASS\n";
+}
+
+void testQueues()
+{
+    std::cout << "Test: Lock-Free Queues... ";
+
+    // SPSC: capacity rounds up, batches are bounded by free space
+    SPSCQueue<int> spsc(5);
+    assert(spsc.capacity() == 8 && spsc.empty());
+    int items[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    assert(spsc.pushBatch(items, 10) == 8);
+    int value = 99;
+    assert(!spsc.tryPush(std::move(value)));
+    int out[10];
+    assert(spsc.popBatch(out, 3) == 3 && out[0] == 0 && out[2] == 2);
+    assert(spsc.size() == 5);
+    while (spsc.tryPop(value))
+    {
+    }
+    assert(value == 7 && spsc.empty());
+
+    // SPSC across threads keeps order
+    constexpr int COUNT = 100000;
+    SPSCQueue<int> stream(256);
+    std::thread producer([&stream]()
+                         {
+        int next = 0;
+        int batch[16];
+        while (next < COUNT) {
+            int n = 0;
+            while (n < 16 && next + n < COUNT) { batch[n] = next + n; ++n; }
+            next += static_cast<int>(stream.pushBatch(batch, static_cast<size_t>(n)));
+        } });
+    int expected = 0;
+    while (expected < COUNT)
+    {
+        size_t n = stream.popBatch(out, 10);
+        for (size_t i = 0; i < n; ++i)
+        {
+            assert(out[i] == expected++);
+        }
+    }
+    producer.join();
+
+    // MPSC: every producer's items arrive in its own order
+    constexpr int PRODUCERS = 4;
+    constexpr int PER_PRODUCER = 20000;
+    MPSCQueue<int> mpsc(128);
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p)
+    {
+        producers.emplace_back([&mpsc, p]()
+                               {
+            for (int i = 0; i < PER_PRODUCER;) {
+                if (i % 2 == 0 && i + 4 <= PER_PRODUCER) {
+                    int batch[4];
+                    for (int k = 0; k < 4; ++k) { batch[k] = p * PER_PRODUCER + i + k; }
+                    i += static_cast<int>(mpsc.pushBatch(batch, 4));
+                } else {
+                    int single = p * PER_PRODUCER + i;
+                    if (mpsc.tryPush(std::move(single))) { ++i; }
+                }
+            } });
+    }
+    int nextPerProducer[PRODUCERS] = {};
+    for (int received = 0; received < PRODUCERS * PER_PRODUCER;)
+    {
+        size_t n = mpsc.popBatch(out, 10);
+        for (size_t i = 0; i < n; ++i)
+        {
+            int p = out[i] / PER_PRODUCER;
+            assert(out[i] % PER_PRODUCER == nextPerProducer[p]++);
+        }
+        received += static_cast<int>(n);
+    }
+    for (auto &thread : producers)
+    {
+        thread.join();
+    }
+    assert(mpsc.empty());
+
+    // Pooled frame handles move through without copying the frame
+    MPSCQueue<PooledFrame> frames(4);
+    PooledFrame frame = FramePool::acquire();
+    frame->srcNodeID = 0x0042;
+    Frame *raw = frame.get();
+    assert(frames.tryPush(std::move(frame)) && !frame);
+    PooledFrame received;
+    assert(frames.tryPop(received) && received.get() == raw && received->srcNodeID == 0x0042);
+
+    std::cout << "PASS\n";
+}
+
+void testMetrics()
+{
+    std::cout << "Test: Transport Metrics... ";
+
+    // Buckets are exact below 16 and log-linear above, with contiguous bounds
+    assert(LatencyHistogram::bucketIndex(0) == 0);
+    assert(LatencyHistogram::bucketIndex(15) == 15);
+    assert(LatencyHistogram::bucketIndex(16) == 16);
+    assert(LatencyHistogram::bucketIndex(32) == LatencyHistogram::bucketIndex(33));
+    assert(LatencyHistogram::bucketIndex(UINT64_MAX) == LatencyHistogram::BUCKET_COUNT - 1);
+    for (size_t i = 1; i < LatencyHistogram::BUCKET_COUNT; ++i)
+    {
+        const uint64_t lower = LatencyHistogram::bucketLowerBound(i);
+        assert(LatencyHistogram::bucketIndex(lower) == i);
+        assert(LatencyHistogram::bucketIndex(lower - 1) == i - 1);
+    }
+
+    if (!metricsEnabled())
+    {
+        std::cout << "PASS (metrics disabled)" << std::endl;
+        return;
+    }
+
+    // Percentiles land within one sub-bucket of the true value
+    LatencyHistogram histogram;
+    for (uint64_t v = 1; v <= 1000; ++v)
+    {
+        histogram.record(v * 1000);
+    }
+    auto snapshot = histogram.snapshot();
+    assert(snapshot.count == 1000 && snapshot.max == 1000000);
+    assert(snapshot.mean() == 500500.0);
+    const uint64_t p50 = snapshot.percentile(0.50);
+    const uint64_t p99 = snapshot.percentile(0.99);
+    assert(p50 >= 500000 && p50 <= 500000 + 500000 / 16 + 1);
+    assert(p99 >= 990000 && p99 <= 1000000);
+    assert(snapshot.percentile(1.0) == 1000000);
+    histogram.reset();
+    assert(histogram.snapshot().count == 0 && histogram.snapshot().percentile(0.5) == 0);
+
+    // Counters, per-code errors and snapshot copies
+    TransportMetrics metrics;
+    metrics.recordSend(3, 48);
+    metrics.recordReceive(1, 16);
+    metrics.recordError(TransportError::Timeout);
+    metrics.recordError(TransportError::Timeout);
+    metrics.recordError(TransportError::SendFailed);
+    metrics.recordError(TransportError::None);
+    metrics.sendLatency().record(250);
+    TransportStats stats = metrics.snapshot();
+    assert(stats.framesSent == 3 && stats.bytesSent == 48);
+    assert(stats.framesReceived == 1 && stats.bytesReceived == 16);
+    assert(stats.timeouts == 2 && stats.errorCount(TransportError::Timeout) == 2);
+    assert(stats.errorCount(TransportError::SendFailed) == 1);
+    assert(stats.errorCount(TransportError::None) == 0 && stats.totalErrors() == 3);
+    assert(stats.sendLatency.count == 1 && stats.roundTrip.count == 0);
+
+    TransportMetrics copy(metrics);
+    metrics.reset();
+    assert(metrics.snapshot().framesSent == 0 && metrics.snapshot().totalErrors() == 0);
+    assert(copy.snapshot().framesSent == 3 && copy.snapshot().sendLatency.count == 1);
+
+    // Successful transactions feed the tracker's round-trip histogram
+    TransactionTracker tracker;
+    assert(tracker.registerTransaction(7, "", ""));
+    assert(tracker.registerTransaction(8, "", ""));
+    tracker.completeTransaction(7, true);
+    tracker.completeTransaction(8, false);
+    assert(tracker.getRoundTripLatency().count == 1);
+
+    std::cout << "PASS" << std::endl;
+}
+
+void testTracing()
+{
+    std::cout << "Test: Tracing Hooks... ";
+
+    struct RecordingTracer : Tracer
+    {
+        std::vector<TraceRecord> records;
+        void onEvent(const TraceRecord &record) noexcept override { records.push_back(record); }
+    };
+
+    Frame frame = MessageBuilder::request(0x0010, 0x3000, 7, 0x0042).setPayload(1.5f).build();
+    std::vector<uint8_t> wire;
+    assert(serializeFrame(frame, wire));
+
+    // No tracer: hooks are no-ops
+    assert(getTracer() == nullptr && !isTracing());
+    traceFrame(TraceEvent::FrameReceived, wire.data(), wire.size(), TransportError::None, "test");
+
+    RecordingTracer tracer;
+    setTracer(&tracer);
+    assert(getTracer() == &tracer && isTracing());
+    traceFrame(TraceEvent::SendEnqueued, wire.data(), wire.size(), TransportError::None, "test send");
+    traceFrame(TraceEvent::SendComplete, wire.data(), wire.size(), TransportError::SendFailed, "test send");
+    traceFrame(TraceEvent::FrameReceived, wire.data(), 3, TransportError::None, "test receive");
+    setTracer(nullptr);
+    traceFrame(TraceEvent::FrameReceived, wire.data(), wire.size(), TransportError::None, "test");
+
+    assert(tracer.records.size() == 3);
+    const TraceRecord &sent = tracer.records[0];
+    assert(sent.event == TraceEvent::SendEnqueued && sent.hasHeader && sent.size == wire.size());
+    assert(sent.msgType == MsgType::REQUEST && sent.srcNodeID == 0x0010 && sent.classID == 0x3000);
+    assert(sent.instanceID == 7 && sent.attrID == 0x0042 && sent.flags == frame.flags);
+    assert(std::strcmp(sent.operation, "test send") == 0);
+    assert(tracer.records[1].error == TransportError::SendFailed);
+    assert(tracer.records[1].timestamp >= sent.timestamp);
+    assert(!tracer.records[2].hasHeader && tracer.records[2].size == 3);
+    assert(std::strcmp(toString(TraceEvent::DeserializeComplete), "DeserializeComplete") == 0);
+
+    std::cout << "PASS" << std::endl;
+}
+
+void testErrorReporter()
+{
+    std::cout << "Test: Error Reporter... ";
+
+    char text[128];
+    ErrorEvent event{TransportError::SendFailed, TransportOperation::Send, 113, "router send", "Host unreachable"};
+    size_t length = formatErrorEvent(event, "ZMQ", text, sizeof(text));
+    assert(std::string(text, length) == "ZMQ error during router send: Host unreachable (code: 113)");
+    event.errnum = 0;
+    event.reason = nullptr;
+    formatErrorEvent(event, "ZMQ", text, sizeof(text));
+    assert(std::string(text) == std::string("ZMQ error during router send: ") + toString(TransportError::SendFailed));
+    assert(formatErrorEvent(event, "ZMQ", text, 8) == 7 && std::strlen(text) == 7);
+
+    // Structured callback sees every event; text is rate-limited
+    ErrorReporter reporter("ZMQ");
+    size_t events = 0;
+    std::vector<std::string> messages;
+    reporter.setEventCallback([&events](const ErrorEvent &e)
+                              { events += (e.operation == TransportOperation::Send) ? 1 : 0; });
+    reporter.setMessageCallback([&messages](const std::string &m) { messages.push_back(m); });
+    reporter.setRateLimit(3, std::chrono::milliseconds(60000));
+    for (int i = 0; i < 10; ++i)
+    {
+        reporter.report(event);
+    }
+    assert(events == 10 && messages.size() == 3 && reporter.suppressedCount() == 7);
+
+    // A new window reports how many were dropped
+    reporter.setRateLimit(3, std::chrono::milliseconds(0));
+    reporter.report(event);
+    assert(messages.size() == 4 && messages.back().find("(7 more suppressed)") != std::string::npos);
+    assert(std::strcmp(toString(TransportOperation::Receive), "Receive") == 0);
+
+    std::cout << "PASS" << std::endl;
+}
+
+void testCompression()
+{
+    std::cout << "Test: Payload Compression... ";
+
+    // Bit 2 is no longer reserved, but only variable-length payloads may carry it
+    Frame scalar = MessageBuilder::event(0x0010, 0x3000, 1, 0x0001).setPayload(1.0f).build();
+    scalar.flags |= Flags::COMPRESSED;
+    assert(!scalar.validate());
+
+    std::string log;
+    for (int i = 0; i < 200; ++i)
+    {
+        log += "2025-01-01 12:00:00 INFO line " + std::to_string(i % 10) + " recipe step complete\n";
+    }
+    Frame frame = MessageBuilder::event(0x0010, 0x3000, 1, 0x0002).setPayload(log).enableCRC(true).build();
+    assert(frame.payload.size() == log.size());
+
+    if (!isCompressionAvailable())
+    {
+        // Without zstd, frames go out uncompressed and compressed frames are rejected
+        CompressionOptions options;
+        options.threshold = 0;
+        assert(!compressFrame(frame, options) && !frame.isCompressed());
+        std::cout << "PASS (zstd not built)" << std::endl;
+        return;
+    }
+
+    // In-place compress/decompress
+    Frame packed = frame;
+    CompressionOptions options;
+    assert(compressFrame(packed, options) && packed.isCompressed() && packed.validate());
+    assert(packed.payload.size() < frame.payload.size() / 4);
+    assert(decompressFrame(packed) && !packed.isCompressed() && packed.payload == frame.payload);
+
+    // Small and fixed-size payloads are left alone
+    Frame small = MessageBuilder::event(0x0010, 0x3000, 1, 0x0003).setPayload(std::string("short")).build();
+    assert(!compressFrame(small, options) && !small.isCompressed());
+
+    // Transparent in serializeFrame/deserializeFrame, CRC over the compressed bytes
+    options.enabled = true;
+    setFrameCompression(options);
+    std::vector<uint8_t> wire;
+    assert(serializeFrame(frame, wire) && wire.size() < frame.totalSize());
+    FrameView view;
+    assert(deserializeFrameView(wire.data(), wire.size(), view) && view.isCompressed());
+    Frame decoded;
+    assert(deserializeFrame(wire, decoded));
+    assert(!decoded.isCompressed() && decoded.payload == frame.payload && decoded.payloadLen == frame.payloadLen);
+    wire[HEADER_SIZE + 3] ^= 0xFF;
+    assert(!deserializeFrame(wire, decoded));
+
+#ifdef LIMP_HAS_TCP
+    // Transports send the compressed form as well, one frame or a batch at a time
+    {
+        int fds[2];
+        assert(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+        TCPTransport sender(fds[0], TCPConfig());
+        TCPTransport receiver(fds[1], TCPConfig());
+        const Frame batch[2] = {frame, small};
+        size_t sent = 0;
+        assert(sender.send(frame) == TransportError::None);
+        assert(sender.sendBatch(Span<const Frame>(batch, 2), sent) == TransportError::None && sent == 2);
+
+        assert(receiver.receiveView(view, 1000) == TransportError::None);
+        assert(view.isCompressed() && view.size() < frame.totalSize());
+        assert(view.toFrame(decoded) && decoded.payload == frame.payload && !decoded.isCompressed());
+        assert(receiver.receive(decoded, 1000) == TransportError::None && decoded.payload == frame.payload);
+        assert(receiver.receiveView(view, 1000) == TransportError::None && !view.isCompressed());
+        assert(view.toFrame(decoded) && decoded.payload == small.payload);
+    }
+#endif
+
+    // A trained dictionary pays off for small repetitive payloads and must match
+    std::vector<std::vector<uint8_t>> samples;
+    for (int i = 0; i < 500; ++i)
+    {
+        std::string s = "{\"recipe\":\"R" + std::to_string(i) + "\",\"temperature\":" + std::to_string(180 + i % 40) +
+                        ",\"pressure\":" + std::to_string(i % 7) + ",\"mode\":\"automatic\",\"operator\":\"shift-" +
+                        std::to_string(i % 3) + "\"}";
+        samples.emplace_back(s.begin(), s.end());
+    }
+    auto dictionary = CompressionDictionary::train(samples, 4096);
+    assert(dictionary && dictionary->isValid() && dictionary->id() != 0);
+    std::string recipe = "{\"recipe\":\"R9001\",\"temperature\":201,\"pressure\":3,\"mode\":\"automatic\",\"operator\":\"shift-1\"}";
+    Frame tiny = MessageBuilder::event(0x0010, 0x3000, 1, 0x0004).setPayload(recipe).build();
+    CompressionOptions withDictionary;
+    withDictionary.enabled = true;
+    withDictionary.threshold = 32;
+    withDictionary.dictionary = dictionary;
+    packed = tiny;
+    assert(compressFrame(packed, withDictionary) && packed.payload.size() < recipe.size() / 2);
+    Frame wrong = packed;
+    assert(!decompressFrame(wrong));
+    assert(decompressFrame(packed, dictionary.get()) && packed.payload == tiny.payload);
+
+    setFrameCompression(withDictionary);
+    assert(serializeFrame(tiny, wire) && deserializeFrame(wire, decoded) && decoded.payload == tiny.payload);
+
+    // Replaced settings, dictionary included, are freed once no thread holds them
+    std::weak_ptr<const CompressionDictionary> retired = dictionary;
+    dictionary.reset();
+    withDictionary.dictionary.reset();
+    assert(!retired.expired());
+    setFrameCompression(CompressionOptions());
+    assert(serializeFrame(frame, wire) && wire.size() == frame.totalSize());
+    assert(retired.expired());
+
+    std::cout << "PASS" << std::endl;
+}
+
+void testDeadband()
+{
+    std::cout << "Test: Deadband Filter... ";
+
+    using Clock = DeadbandFilter::Clock;
+    const Clock::time_point t0 = Clock::now();
+    auto reading = [](uint16_t instance, float value)
+    { return MessageBuilder::event(0x0010, 0x3000, instance, 0x0001).setPayload(value).build(); };
+
+    // Absolute deadband: first value passes, noise is suppressed, a real change passes
+    DeadbandFilter::Options options;
+    options.absolute = 0.5;
+    options.refreshInterval = std::chrono::milliseconds(1000);
+    options.initialCapacity = 4;
+    DeadbandFilter filter(options);
+    assert(filter.check(reading(1, 20.0f), t0));
+    assert(!filter.check(reading(1, 20.4f), t0));
+    assert(!filter.check(reading(1, 19.6f), t0));
+    assert(filter.check(reading(1, 21.0f), t0));
+    assert(!filter.check(reading(1, 20.6f), t0)); // Compared with the last value sent (21.0)
+
+    // Integrity refresh resends an unchanged value
+    assert(!filter.check(reading(1, 21.0f), t0 + std::chrono::milliseconds(999)));
+    assert(filter.check(reading(1, 21.0f), t0 + std::chrono::milliseconds(1000)));
+    assert(!filter.check(reading(1, 21.0f), t0 + std::chrono::milliseconds(1500)));
+
+    // Per-attribute percent deadband
+    filter.setDeadband(0x3000, 2, 0x0001, 0.0, 10.0);
+    assert(filter.check(reading(2, 100.0f), t0));
+    assert(!filter.check(reading(2, 109.0f), t0));
+    assert(filter.check(reading(2, 111.0f), t0));
+
+    // Non-numeric payloads are compared by content
+    Frame text = MessageBuilder::event(0x0010, 0x3000, 3, 0x0002).setPayload("RUNNING").build();
+    assert(filter.check(text, t0));
+    assert(!filter.check(text, t0));
+    Frame other = MessageBuilder::event(0x0010, 0x3000, 3, 0x0002).setPayload("STOPPED").build();
+    assert(filter.check(other, t0));
+
+    // Only EVENT frames are filtered
+    Frame request = MessageBuilder::request(0x0010, 0x3000, 4, 0x0001).build();
+    assert(filter.check(request, t0) && filter.check(request, t0));
+
+    // A failed send is forgotten so the next value goes out
+    assert(!filter.check(reading(1, 21.0f), t0 + std::chrono::milliseconds(1500)));
+    filter.invalidate(reading(1, 21.0f));
+    assert(filter.check(reading(1, 21.0f), t0 + std::chrono::milliseconds(1500)));
+
+    // The table grows past its initial capacity and keeps every attribute
+    for (uint16_t i = 100; i < 200; ++i)
+    {
+        assert(filter.check(reading(i, 1.0f), t0));
+    }
+    assert(filter.size() == 103);
+    for (uint16_t i = 100; i < 200; ++i)
+    {
+        assert(!filter.check(reading(i, 1.2f), t0));
+    }
+
+    const DeadbandFilter::Stats &stats = filter.getStats();
+    assert(stats.refreshed == 1);
+    assert(stats.passed == 107);
+    assert(stats.suppressed == 108);
+
+    filter.clear();
+    assert(filter.size() == 0 && filter.getStats().passed == 0);
+    assert(filter.check(reading(1, 21.0f), t0));
+
+    std::cout << "PASS\n";
+}
+
+void testCreditFrames()
+{
+    std::cout << "Test: Credit Frames... ";
+
+    uint32_t credits = 0;
+    Frame grant = makeCreditFrame(0x0001, 64);
+    assert(grant.msgType == MsgType::ACK && grant.classID == CREDIT_CLASS_ID && grant.validate());
+    assert(parseCreditFrame(grant, credits) && credits == 64);
+
+    Frame request = makeCreditFrame(0x0002, 0);
+    assert(parseCreditFrame(request, credits) && credits == 0);
+
+    // Also recognized on the zero-copy path
+    std::vector<uint8_t> wire;
+    assert(serializeFrame(grant, wire));
+    FrameView view;
+    credits = 0;
+    assert(deserializeFrameView(wire.data(), wire.size(), view) && parseCreditFrame(view, credits) && credits == 64);
+
+    // Ordinary ACKs and other classes are not flow control
+    Frame ack = MessageBuilder::ack(0x0001, 0x3000, 1, 2).build();
+    assert(!parseCreditFrame(ack, credits));
+    Frame event = MessageBuilder::event(0x0001, CREDIT_CLASS_ID, 0, 0).setPayload(uint32_t(5)).build();
+    assert(!parseCreditFrame(event, credits));
+    Frame wrongType = MessageBuilder::ack(0x0001, CREDIT_CLASS_ID, 0, 0).setPayload(uint16_t(5)).build();
+    assert(!parseCreditFrame(wrongType, credits));
+
+    std::cout << "PASS" << std::endl;
+}
+
+void testBulkDeserialize()
+{
+    std::cout << "Test: Bulk Deserialize... ";
+
+    // Encodings of every kind, then damaged copies of them
+    std::vector<std::vector<uint8_t>> wires;
+    const uint32_t samples[] = {1, 2, 3};
+    const Frame sources[] = {
+        MessageBuilder::event(0x0001, 0x4000, 1, 1).setPayload(uint32_t(42)).build(),
+        MessageBuilder::event(0x0001, 0x4000, 1, 2).setPayload(3.5).enableCRC().build(),
+        MessageBuilder::response(0x0002, 0x3000, 2, 1).setPayload("hello").enableCRC().build(),
+        MessageBuilder::event(0x0003, 0x4000, 3, 1).setPayload(Span<const uint32_t>(samples)).build(),
+        MessageBuilder::request(0x0004, 0x3000, 1, 1).build(),
+    };
+    for (const Frame &source : sources)
+    {
+        std::vector<uint8_t> wire;
+        assert(serializeFrame(source, wire));
+        wires.push_back(wire);
+    }
+    std::vector<uint8_t> badCRC = wires[1];
+    badCRC[HEADER_SIZE] ^= 0x01;
+    std::vector<uint8_t> badVersion = wires[0];
+    badVersion[0] = 0x7F;
+    std::vector<uint8_t> reserved = wires[0];
+    reserved[13] |= 0x80;
+    std::vector<uint8_t> compressedScalar = wires[0];
+    compressedScalar[13] |= Flags::COMPRESSED;
+    std::vector<uint8_t> wrongLength = wires[3];
+    wrongLength[12] = 10; // Not a whole number of elements
+    std::vector<uint8_t> truncated(wires[2].begin(), wires[2].end() - 1);
+    std::vector<uint8_t> shortInput(wires[0].begin(), wires[0].begin() + 5);
+    for (const auto *damaged : {&badCRC, &badVersion, &reserved, &compressedScalar, &wrongLength, &truncated, &shortInput})
+    {
+        wires.push_back(*damaged);
+    }
+
+    std::vector<ByteSpan> inputs;
+    for (const auto &wire : wires)
+    {
+        inputs.emplace_back(wire.data(), wire.size());
+    }
+    inputs.emplace_back();
+
+    // Same verdict as the one-at-a-time path, header checks and all
+    std::vector<Frame> frames(inputs.size());
+    std::unique_ptr<bool[]> valid(new bool[inputs.size()]);
+    const Span<bool> validSpan(valid.get(), inputs.size());
+    assert(deserializeFrames(inputs, frames, validSpan) == 5);
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        Frame expected;
+        assert(valid[i] == deserializeFrame(inputs[i].data(), inputs[i].size(), expected));
+        if (valid[i])
+        {
+            assert(frames[i].classID == expected.classID && frames[i].flags == expected.flags &&
+                   frames[i].payload == expected.payload);
+        }
+    }
+
+    // A large batch split across a pool matches the serial result
+    ThreadPool pool(3);
+    BulkDecodeOptions options;
+    options.pool = &pool;
+    options.framesPerTask = 64;
+    std::vector<ByteSpan> batch;
+    for (size_t i = 0; i < 5000; ++i)
+    {
+        batch.push_back(inputs[i % inputs.size()]);
+    }
+    std::unique_ptr<bool[]> batchValid(new bool[batch.size()]);
+    std::vector<FrameView> views(batch.size());
+    const size_t passed = validateFrames(batch, views, Span<bool>(batchValid.get(), batch.size()), options);
+    std::vector<Frame> decoded(batch.size());
+    assert(deserializeFrames(batch, decoded, Span<bool>(batchValid.get(), batch.size()), options) == passed);
+    for (size_t i = 0; i < batch.size(); ++i)
+    {
+        assert(batchValid[i] == valid[i % inputs.size()]);
+        assert(!batchValid[i] || (views[i].data() == batch[i].data() && decoded[i].payload == frames[i % inputs.size()].payload));
+    }
+
+    assert(checkFrameHeaders(inputs, validSpan) == 6); // The bad CRC is only caught later
+    assert(valid[5] && !valid[6]);
+
+    std::cout << "PASS" << std::endl;
+}
+
+/** @brief Transport that keeps what it is sent, noting whether the frame was moved in */
+class RecordingTransport : public Transport
+{
+public:
+    TransportError send(const Frame &frame) override
+    {
+        frames.push_back(frame);
+        moved.push_back(false);
+        return TransportError::None;
+    }
+
+    TransportError send(Frame &&frame)
+    {
+        frames.push_back(std::move(frame));
+        moved.push_back(true);
+        return TransportError::None;
+    }
+
+    TransportError send(const std::string &identity, const Frame &frame)
+    {
+        identities.push_back(identity);
+        return send(frame);
+    }
+
+    TransportError receive(Frame &, int) override { return TransportError::Timeout; }
+    bool isConnected() const override { return true; }
+    void close() override {}
+
+    std::vector<Frame> frames;
+    std::vector<bool> moved;
+    std::vector<std::string> identities;
+};
+
+void testBuilderSendVia()
+{
+    std::cout << "Test: Builder Send Via Transport... ";
+
+    RecordingTransport transport;
+    auto builder = MessageBuilder::event(0x0001, 0x4000, 1, 1).setPayload(uint32_t(7));
+    assert(builder.sendVia(transport) == TransportError::None);
+    assert(!transport.moved[0] && transport.frames[0].payload == builder.build().payload);
+
+    // A moved builder hands its frame over, payload allocation included
+    std::vector<uint8_t> image(8192, 0x5A);
+    const uint8_t *imageData = image.data();
+    auto imageBuilder = MessageBuilder::event(0x0001, 0x4000, 1, 2);
+    imageBuilder.setPayload(std::move(image));
+    assert(std::move(imageBuilder).sendVia(transport) == TransportError::None);
+    assert(transport.moved[1] && transport.frames[1].payload.data() == imageData);
+
+    // Leading arguments are passed through
+    assert(builder.sendVia(transport, std::string("peer")) == TransportError::None);
+    assert(transport.identities.size() == 1 && transport.identities[0] == "peer" && transport.frames.size() == 3);
+
+    std::cout << "PASS" << std::endl;
+}
+
+void testTransactionTracker()
+{
+    std::cout << "Test: Transaction Tracker... ";
+
+    TransactionTracker tracker(std::chrono::milliseconds(1));
+
+    uint16_t id = tracker.registerTransaction("src", "dst");
+    assert(id != 0 && tracker.isPending(id));
+    assert(!tracker.registerTransaction(id, "", ""));
+    auto info = tracker.getTransaction(id);
+    assert(info && info->destinationIdentity == "dst");
+    assert(tracker.completeTransaction(id) && !tracker.isPending(id));
+    assert(!tracker.completeTransaction(id));
+
+    // Requests register their AttrID, replies complete it
+    auto request = MessageBuilder::request(0x0010, 0x3000, 1, 0x0042).build();
+    auto reply = MessageBuilder::response(0x0020, 0x3000, 1, 0x0042).build();
+    assert(tracker.track(request) && tracker.isPending(0x0042));
+    assert(tracker.track(reply) && !tracker.isPending(0x0042));
+
+    // Completion handlers receive the matching reply exactly once
+    int calls = 0;
+    TransportError result = TransportError::InternalError;
+    assert(tracker.registerTransaction(0x0042, "", "plc", [&](TransportError error, const Frame *frame)
+                                       {
+                                           ++calls;
+                                           result = error;
+                                           assert(frame && frame->msgType == MsgType::RESPONSE); }));
+    assert(tracker.track(reply) && !tracker.track(reply));
+    assert(calls == 1 && result == TransportError::None);
+
+    // Concurrent register/complete across shards
+    std::vector<std::thread> threads;
+    for (uint16_t t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&tracker, t]()
+                             {
+                                 for (uint16_t i = 1; i <= 500; ++i)
+                                 {
+                                     uint16_t txn = static_cast<uint16_t>(t * 1000 + i);
+                                     assert(tracker.registerTransaction(txn, "", ""));
+                                     if (i % 2 == 0)
+                                     {
+                                         assert(tracker.completeTransaction(txn));
+                                     }
+                                 } });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+    assert(tracker.getPendingCount() == 1000);
+
+    // Timer wheel expiry
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    uint16_t fresh = tracker.registerTransaction();
+    bool completed = false;
+    assert(tracker.registerTransaction(0x9000, "", "", [&](TransportError error, const Frame *frame)
+                                       { completed = (error == TransportError::None) && !frame; }));
+    assert(tracker.completeTransaction(0x9000) && completed);
+    assert(tracker.getTimedOutTransactions(std::chrono::milliseconds(25)).size() == 1000);
+    assert(tracker.cleanupTimedOutTransactions(std::chrono::milliseconds(25)) == 1000);
+    assert(tracker.getPendingCount() == 1 && tracker.isPending(fresh));
+    assert(tracker.getStats().timedOut == 1000);
+
+    tracker.clear();
+    assert(tracker.getPendingCount() == 0);
+
+    // One shard and one wheel slot: removals out of order keep the slot consistent
+    TransactionTracker coarse(std::chrono::hours(1));
+    for (uint16_t i = 1; i <= 8; ++i)
+    {
+        assert(coarse.registerTransaction(static_cast<uint16_t>(i * TransactionTracker::SHARD_COUNT), "", ""));
+    }
+    for (uint16_t i : {4, 1, 8, 5})
+    {
+        assert(coarse.completeTransaction(static_cast<uint16_t>(i * TransactionTracker::SHARD_COUNT)));
+    }
+    std::vector<uint16_t> expired = coarse.getTimedOutTransactions(std::chrono::milliseconds(0));
+    std::sort(expired.begin(), expired.end());
+    assert((expired == std::vector<uint16_t>{32, 48, 96, 112}));
+    assert(coarse.completeTransaction(48));
+    assert(coarse.cleanupTimedOutTransactions(std::chrono::milliseconds(0)) == 3);
+    assert(coarse.getPendingCount() == 0 && coarse.getTimedOutTransactions(std::chrono::milliseconds(0)).empty());
+
+    std::cout << "PASS\n";
+}
+
 void testErrorMessages()
 {
     std::cout << "Test: Error Messages... ";
@@ -191,6 +2258,51 @@ int main()
         testBasicFrame();
         testPayloadTypes();
         testCRC();
+        testCRCEngines();
+        testFrameView();
+        testSerializeInto();
+        testPayloadBuffer();
+        testPools();
+        testWireBuffer();
+        testTopics();
+        testLastValueCache();
+        testBatch();
+        testArrayPayloads();
+        testMessageView();
+        testTypedAttributes();
+        testFrameDecoder();
+#ifdef LIMP_HAS_TCP
+        testTcpPartialWrite();
+#endif
+#ifdef LIMP_HAS_ZMQ
+        testZmqReactor();
+        testRoutingTable();
+        testTransactionalDealer();
+        testConcurrentSender();
+        testZmqProxy();
+        testZmqProxyCluster();
+        testSubscriberConflation();
+#endif
+#ifdef LIMP_HAS_CAPTURE
+        testCaptureLog();
+#endif
+#ifdef LIMP_HAS_SHM
+        testShmTransport();
+#endif
+#ifdef LIMP_HAS_UDP
+        testUdpMulticast();
+#endif
+        testSequencedFlag();
+        testQueues();
+        testMetrics();
+        testTracing();
+        testErrorReporter();
+        testCompression();
+        testDeadband();
+        testCreditFrames();
+        testBulkDeserialize();
+        testBuilderSendVia();
+        testTransactionTracker();
         testErrorMessages();
         testEndianness();
         testMessageTypes();